@@ -48,6 +48,8 @@
 
 namespace opentxs
 {
+struct PaymentWorkflowQuery;
+
 namespace api
 {
 namespace client
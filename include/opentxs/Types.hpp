@@ -408,6 +408,13 @@ enum class ThreadStatus : std::uint8_t {
     SHUTDOWN = 4,
 };
 
+enum class ThreadDelta : std::uint8_t {
+    RELOAD = 0,
+    ITEMADDED = 1,
+    ITEMREMOVED = 2,
+    READSTATE = 3,
+};
+
 enum class Messagability : std::int8_t {
     MISSING_CONTACT = -5,
     CONTACT_LACKS_NYM = -4,
@@ -210,6 +210,26 @@ public:
      */
     EXPORT virtual std::size_t UnreadCount(const Identifier& nym) const = 0;
 
+    /**   Obtain the endpoint on which changes to a nym's threads are published
+     *
+     *    Each message contains the following body frames:
+     *      0. thread id
+     *      1. sequence number, incremented by one for each message on the
+     *         endpoint. Subscribers which observe a gap should reload.
+     *      2. ThreadDelta
+     *      3. item id
+     *      4. StorageBox of the item
+     *      5. account id of the item
+     *      6. time of the item
+     *      7. index of the item
+     *      8. "1" if the item is unread, otherwise "0"
+     *
+     *    Frames 3 through 8 are empty for ThreadDelta::RELOAD. Only frames 3
+     *    and 8 are meaningful for ThreadDelta::READSTATE. Numeric frames are
+     *    decimal strings.
+     *
+     *    \param[in] nym the identifier of the nym
+     */
     EXPORT virtual std::string ThreadPublisher(const Identifier& nym) const = 0;
 
     virtual ~Activity() = default;
@@ -145,6 +145,11 @@ public:
     EXPORT virtual std::vector<OTIdentifier> WorkflowsByAccount(
         const Identifier& nymID,
         const Identifier& accountID) const = 0;
+    /** Get workflow IDs matching every criterion in the query, most recently
+     *  active first */
+    EXPORT virtual std::vector<OTIdentifier> WorkflowsByQuery(
+        const Identifier& nymID,
+        const PaymentWorkflowQuery& query) const = 0;
     /** Create a new outgoing cheque workflow */
     EXPORT virtual OTIdentifier WriteCheque(
         const opentxs::Cheque& cheque) const = 0;
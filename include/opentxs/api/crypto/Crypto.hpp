@@ -45,9 +45,13 @@
 #include "opentxs/Proto.hpp"
 
 #include <chrono>
+#include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <tuple>
+#include <vector>
 
 namespace opentxs
 {
@@ -57,6 +61,16 @@ namespace api
 class Crypto
 {
 public:
+    /** A contract signature to be checked by VerifyBatch() */
+    using SignatureCheck = std::tuple<
+        const OTAsymmetricKey*,  // public key
+        const String*,           // signed contents
+        const OTSignature*,      // signature
+        proto::HashType>;        // hash algorithm
+    /** Verification cache hits, misses, and number of cached results */
+    using VerificationStats =
+        std::tuple<std::uint64_t, std::uint64_t, std::size_t>;
+
     EXPORT virtual const OTCachedKey& DefaultKey() const = 0;
     EXPORT virtual Editor<OTCachedKey> mutable_DefaultKey() const = 0;
     EXPORT virtual const OTCachedKey& CachedKey(const Identifier& id) const = 0;
@@ -102,6 +116,28 @@ public:
     EXPORT virtual std::unique_ptr<SymmetricKey> GetStorageKey(
         std::string& seed) const = 0;
 
+    /** Checks many signatures at once. None of the bundled libraries expose
+     *  batch verification, so the checks are spread across a pool of
+     *  threads. Results are in the same order as the input. */
+    EXPORT virtual std::vector<bool> VerifyBatch(
+        const std::vector<SignatureCheck>& checks) const = 0;
+    /** Runs arbitrary verification functions on the same pool, such as a
+     *  contract's virtual VerifySignature(). Results are in the same order
+     *  as the input. */
+    EXPORT virtual std::vector<bool> VerifyBatch(
+        const std::vector<std::function<bool()>>& checks) const = 0;
+    /** Verifies a signature with the key's engine. Successful results are
+     *  remembered in a bounded cache keyed by the public key, a digest of
+     *  the contents, and the signature, so verifying the same object again
+     *  only costs the digest. */
+    EXPORT virtual bool Verify(
+        const Data& plaintext,
+        const OTAsymmetricKey& key,
+        const Data& signature,
+        const proto::HashType hashType,
+        const OTPasswordData* pPWData = nullptr) const = 0;
+    EXPORT virtual VerificationStats VerificationCacheStats() const = 0;
+
     EXPORT virtual ~Crypto() = default;
 
 protected:
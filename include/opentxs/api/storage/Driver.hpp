@@ -95,6 +95,12 @@ public:
         const std::string& hash,
         std::shared_ptr<T>& serialized,
         const bool checking = false) const;
+    /** Avoids copying an object which the driver has cached */
+    template <class T>
+    bool LoadProto(
+        const std::string& hash,
+        std::shared_ptr<const T>& serialized,
+        const bool checking = false) const;
 
     template <class T>
     bool StoreProto(const T& data, std::string& key, std::string& plaintext)
@@ -109,6 +115,22 @@ public:
 protected:
     Driver() = default;
 
+    // Objects are addressed by the hash of their contents and never change,
+    // so a driver may keep parsed objects for reuse. The key identifies both
+    // the hash and the object type. The default implementation caches
+    // nothing.
+    virtual bool cached_object(
+        const std::string& key,
+        std::shared_ptr<const void>& object) const
+    {
+        return false;
+    }
+    virtual void cache_object(
+        const std::string& key,
+        const std::shared_ptr<const void>& object) const
+    {
+    }
+
 private:
     Driver(const Driver&) = delete;
     Driver(Driver&&) = delete;
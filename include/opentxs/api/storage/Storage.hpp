@@ -45,12 +45,16 @@
 #include "opentxs/Types.hpp"
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <ctime>
 #include <functional>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <tuple>
+#include <vector>
 
 namespace opentxs
 {
@@ -58,6 +62,27 @@ typedef std::function<void(const proto::CredentialIndex&)> NymLambda;
 typedef std::function<void(const proto::ServerContract&)> ServerLambda;
 typedef std::function<void(const proto::UnitDefinition&)> UnitLambda;
 
+/** Compound filter over the payment workflow indices
+ *
+ *  Every criterion which is set must match. Empty strings, ERROR enum values,
+ *  and zero times and limits are not filtered on. Results are ordered by the
+ *  time of the most recent event, newest first.
+ */
+struct PaymentWorkflowQuery {
+    std::string account_{};
+    std::string unit_{};
+    proto::PaymentWorkflowType type_{proto::PAYMENTWORKFLOWTYPE_ERROR};
+    proto::PaymentWorkflowState state_{proto::PAYMENTWORKFLOWSTATE_ERROR};
+    /** Earliest last event time to include */
+    std::int64_t from_{0};
+    /** Latest last event time to include */
+    std::int64_t to_{0};
+    /** Number of matching workflows to skip */
+    std::size_t offset_{0};
+    /** Maximum number of workflows to return */
+    std::size_t limit_{0};
+};
+
 namespace api
 {
 namespace storage
@@ -65,6 +90,9 @@ namespace storage
 class Storage
 {
 public:
+    /** Hits, misses, and number of objects currently cached */
+    using CacheStats = std::tuple<std::uint64_t, std::uint64_t, std::size_t>;
+
     virtual ObjectList AccountList() const = 0;
     virtual OTIdentifier AccountContract(const Identifier& accountID) const = 0;
     virtual OTIdentifier AccountIssuer(const Identifier& accountID) const = 0;
@@ -218,11 +246,13 @@ public:
         const std::string& nymId,
         const std::string& fromThreadID,
         const std::string& toThreadID,
-        const std::string& itemID) const = 0;
+        const std::string& itemID,
+        proto::StorageThreadItem* moved = nullptr) const = 0;
     virtual ObjectList NymBoxList(
         const std::string& nymID,
         const StorageBox box) const = 0;
     virtual ObjectList NymList() const = 0;
+    virtual CacheStats ObjectCacheStats() const = 0;
     virtual ObjectList PaymentWorkflowList(const std::string& nymID) const = 0;
     virtual std::string PaymentWorkflowLookup(
         const std::string& nymID,
@@ -230,6 +260,11 @@ public:
     virtual std::set<std::string> PaymentWorkflowsByAccount(
         const std::string& nymID,
         const std::string& accountID) const = 0;
+    /** Workflow IDs matching every criterion in the query, most recently
+     *  active first */
+    virtual std::vector<std::string> PaymentWorkflowsByQuery(
+        const std::string& nymID,
+        const PaymentWorkflowQuery& query) const = 0;
     virtual std::set<std::string> PaymentWorkflowsByState(
         const std::string& nymID,
         const proto::PaymentWorkflowType type,
@@ -247,7 +282,9 @@ public:
     virtual bool RemoveNymBoxItem(
         const std::string& nymID,
         const StorageBox box,
-        const std::string& itemID) const = 0;
+        const std::string& itemID,
+        std::map<std::string, proto::StorageThreadItem>* removed =
+            nullptr) const = 0;
     virtual bool RemoveServer(const std::string& id) const = 0;
     virtual bool RemoveUnitDefinition(const std::string& id) const = 0;
     virtual bool RenameThread(
@@ -317,7 +354,8 @@ public:
         const std::string& alias,
         const std::string& data,
         const StorageBox box,
-        const std::string& account = std::string("")) const = 0;
+        const std::string& account = std::string(""),
+        proto::StorageThreadItem* stored = nullptr) const = 0;
     virtual bool Store(
         const proto::PeerReply& data,
         const std::string& nymid,
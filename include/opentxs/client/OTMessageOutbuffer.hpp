@@ -44,10 +44,18 @@
 #include "opentxs/core/Lockable.hpp"
 #include "opentxs/core/String.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <tuple>
+#include <utility>
 
 namespace opentxs
 {
+class Journal;
 
 // OUTOING MESSAGES (from me--client--sent to server.)
 //
@@ -61,6 +69,11 @@ namespace opentxs
 // once they are dealt with. This way the developer can automatically assume
 // that any reply is old if it carries a request number that cannot be found in
 // this queue.
+//
+// Sent messages are indexed in memory. Additions and removals are appended to
+// a single Journal so that the buffer survives a restart without each message
+// being written to its own file. Messages read back from the journal are only
+// parsed when they are requested.
 class OTMessageOutbuffer : Lockable
 {
 public:
@@ -96,10 +109,42 @@ public:
     EXPORT ~OTMessageOutbuffer();
 
 private:
-    typedef std::multimap<std::int64_t, Message*> mapOfMessages;
+    // notary ID, nym ID, request number
+    using Key = std::tuple<std::string, std::string, std::int64_t>;
+    // notary ID, nym ID
+    using NymKey = std::pair<std::string, std::string>;
+
+    struct Entry {
+        std::unique_ptr<Message> message_{nullptr};
+        // Serialized form of a message loaded from the journal and not yet
+        // parsed
+        std::string serialized_{};
+    };
 
-    mapOfMessages messagesMap_{};
+    std::map<Key, Entry> messages_{};
+    std::set<NymKey> imported_{};
     String dataFolder_{};
+    std::unique_ptr<Journal> journal_{nullptr};
+    bool loaded_{false};
+
+    static std::string make_record(
+        const std::string& notaryID,
+        const std::string& nymID,
+        const std::int64_t number,
+        const std::string& serialized);
+    static std::string serialize(const Message& message);
+
+    bool append(const Lock& lock, const std::string& record);
+    bool compact(const Lock& lock);
+    Message* get(const Lock& lock, Entry& entry);
+    void import_legacy(
+        const Lock& lock,
+        const std::string& notaryID,
+        const std::string& nymID);
+    void load(const Lock& lock);
+    std::map<Key, Entry>::iterator remove(
+        const Lock& lock,
+        std::map<Key, Entry>::iterator it);
 
     OTMessageOutbuffer(const OTMessageOutbuffer&);
     OTMessageOutbuffer& operator=(const OTMessageOutbuffer&);
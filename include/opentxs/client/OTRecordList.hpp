@@ -45,6 +45,7 @@
 #include "opentxs/core/util/Common.hpp"
 
 #include <cstdint>
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
@@ -157,6 +158,7 @@ typedef std::weak_ptr<OTRecord> weak_ptr_OTRecord;
 typedef std::shared_ptr<OTRecord> shared_ptr_OTRecord;
 
 typedef std::vector<shared_ptr_OTRecord> vec_OTRecordList;
+typedef std::function<void(const shared_ptr_OTRecord&)> OTRecordCallback;
 typedef std::list<std::string> list_of_strings;
 typedef std::map<std::string, std::string> map_of_strings;
 
@@ -186,6 +188,49 @@ private:
     static const std::string s_blank;
     static const std::string s_message_type;
 
+    /** The records produced from one Nym's boxes, or from one account's
+     * boxes, along with the hashes of the boxes they came from. */
+    struct BoxCache {
+        std::string hash_{};
+        vec_OTRecordList records_{};
+    };
+
+    struct AccountBoxes {
+        std::string account_id_{};
+        std::string nym_id_{};
+        std::string notary_id_{};
+        std::string hash_{};
+        std::unique_ptr<Ledger> inbox_{nullptr};
+        std::unique_ptr<Ledger> outbox_{nullptr};
+        std::unique_ptr<Ledger> recordbox_{nullptr};
+    };
+
+    std::map<std::string, BoxCache> box_cache_{};
+
+    static std::string box_hash(
+        const char* folder,
+        const std::string& notaryID,
+        const std::string& boxID);
+    static std::string digest(const std::string& input);
+    static void emit(
+        const vec_OTRecordList& records,
+        const OTRecordCallback& callback);
+
+    std::string flags() const;
+    void hash_account(AccountBoxes& boxes) const;
+    std::string hash_nym(const std::string& nymID) const;
+    void load_account(AccountBoxes& boxes) const;
+    void populate(const OTRecordCallback& callback);
+    void populate_account(
+        const std::string& str_account_id,
+        const std::int32_t nAccountIndex,
+        AccountBoxes& boxes,
+        vec_OTRecordList& output);
+    void populate_nym(
+        const std::string& str_nym_id,
+        const std::int32_t nNymIndex,
+        vec_OTRecordList& output);
+
 public:  // ADDRESS BOOK CALLBACK
     static bool setAddrBookCaller(OTLookupCaller& theCaller);
     static OTLookupCaller* getAddrBookCaller();
@@ -326,8 +371,21 @@ public:
         const std::string p_txn_contents,
         TransactionNumber lTransactionNum,
         TransactionNumber lTransNumForDisplay) const;
-    /** Populates m_contents from OT API. Calls ClearContents(). */
+    /** Populates m_contents from OT API. Calls ClearContents(). Every box is
+     * read again, so call this after the address book changes. */
     EXPORT bool Populate();
+    /** Like Populate(), but only re-reads the boxes whose contents changed
+     * since the last Populate() or Refresh(). The records from unchanged
+     * boxes are reused. */
+    EXPORT bool Refresh();
+    /** Incremental like Refresh(), but passes each record to callback as
+     * its box is read instead of collecting them. m_contents is not touched
+     * and the records are not sorted. */
+    EXPORT bool Refresh(const OTRecordCallback& callback);
+    /** Forgets the cached records of a Nym or account, so that the next
+     * Refresh() reads its boxes again. Call this after removing records from
+     * a record box without going through OTRecord::DeleteRecord(). */
+    EXPORT void Invalidate(const std::string& id);
     /** Clears m_contents (NOT nyms, accounts, servers, or instrument
      * definitions.) */
     EXPORT void ClearContents();
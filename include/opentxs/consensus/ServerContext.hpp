@@ -143,6 +143,8 @@ public:
     void SetAdminPassword(const std::string& password);
     void SetAdminSuccess();
     bool SetHighest(const TransactionNumber& highest);
+    /** Records that the notary reads version 2.0 transaction statements */
+    void SetRangeStatements();
     void SetRevision(const std::uint64_t revision);
     TransactionNumber UpdateHighest(
         const std::set<TransactionNumber>& numbers,
@@ -165,6 +167,8 @@ private:
     std::string admin_password_{""};
     OTFlag admin_attempted_;
     OTFlag admin_success_;
+    // Not serialized: learned again from the first reply after a restart
+    OTFlag range_statements_;
     std::atomic<std::uint64_t> revision_{0};
     std::atomic<TransactionNumber> highest_transaction_number_{0};
     std::set<TransactionNumber> tentative_transaction_numbers_{};
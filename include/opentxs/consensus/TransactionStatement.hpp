@@ -41,6 +41,7 @@
 
 #include "opentxs/Forward.hpp"
 
+#include "opentxs/core/util/IntervalSet.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/Types.hpp"
 
@@ -56,8 +57,8 @@ private:
     std::string version_;
     std::string nym_id_;
     std::string notary_;
-    std::set<TransactionNumber> available_;
-    std::set<TransactionNumber> issued_;
+    IntervalSet<TransactionNumber> available_;
+    IntervalSet<TransactionNumber> issued_;
 
     TransactionStatement() = delete;
     TransactionStatement(const TransactionStatement& rhs) = delete;
@@ -68,13 +69,14 @@ public:
     TransactionStatement(
         const std::string& notary,
         const std::set<TransactionNumber>& issued,
-        const std::set<TransactionNumber>& available);
+        const std::set<TransactionNumber>& available,
+        const bool ranges = false);
     TransactionStatement(const String& serialized);
     TransactionStatement(TransactionStatement&& rhs) = default;
 
     explicit operator String() const;
 
-    const std::set<TransactionNumber>& Issued() const;
+    const IntervalSet<TransactionNumber>& Issued() const;
     const std::string& Notary() const;
 
     void Remove(const TransactionNumber& number);
@@ -114,6 +114,12 @@ public:
     EXPORT bool Credit(const Amount amount);
     EXPORT bool GetInboxHash(Identifier& output);
     EXPORT bool GetOutboxHash(Identifier& output);
+    /** Returns the inbox hash recorded in the account file. Unlike
+     *  GetInboxHash, never loads the inbox if no hash was recorded. */
+    EXPORT bool GetRecordedInboxHash(Identifier& output) const;
+    /** Returns the outbox hash recorded in the account file. Unlike
+     *  GetOutboxHash, never loads the outbox if no hash was recorded. */
+    EXPORT bool GetRecordedOutboxHash(Identifier& output) const;
     // If you pass the identifier in, the inbox hash is recorded there
     EXPORT bool SaveInbox(Ledger& box, Identifier* hash = nullptr);
     // If you pass the identifier in, the outbox hash is recorded there
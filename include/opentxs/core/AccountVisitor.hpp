@@ -43,6 +43,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 namespace opentxs
 {
@@ -54,6 +55,10 @@ public:
     OTIdentifier GetNotaryID() const { return notaryID_; }
 
     virtual bool Trigger(const Account& account) = 0;
+    /** Visits a batch of accounts. The default implementation calls Trigger
+     *  for each account in order. Subclasses may override this to do
+     *  per-batch work once. Returns false if any account failed. */
+    virtual bool TriggerBatch(const std::vector<const Account*>& accounts);
 
     virtual ~AccountVisitor() = default;
 
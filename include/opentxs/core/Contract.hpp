@@ -53,6 +53,7 @@
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace irr
 {
@@ -377,6 +378,14 @@ public:
     EXPORT virtual void CalculateContractID(Identifier& newID) const;
     EXPORT virtual void CalculateAndSetContractID(Identifier& newID);
 
+    /** Same result as calling VerifySignature(theNym) on each contract,
+     *  except that the contracts are verified concurrently on the crypto
+     *  api's thread pool. Null entries fail. */
+    EXPORT static std::vector<bool> VerifySignatures(
+        const api::Crypto& crypto,
+        const std::vector<const Contract*>& contracts,
+        const Nym& theNym);
+
     /** So far not overridden anywhere (used to be OTTrade.) */
     EXPORT virtual bool VerifySignature(
         const Nym& theNym,
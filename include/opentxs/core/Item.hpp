@@ -48,6 +48,7 @@
 #include "opentxs/core/String.hpp"
 #include "opentxs/Types.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <list>
 
@@ -420,6 +421,11 @@ public:
         const Identifier* pDestinationAcctID = nullptr);
 
     virtual ~Item();
+
+    // Items of receipts loaded by a ledger in arena mode come from that
+    // ledger's arena. See Ledger::SetArenaAllocation.
+    EXPORT static void* operator new(std::size_t size);
+    EXPORT static void operator delete(void* pointer);
     //    OTItem& operator=(const OTItem& rhs);
     void InitItem();
 
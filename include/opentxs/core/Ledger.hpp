@@ -45,17 +45,23 @@
 #include "opentxs/core/OTTransaction.hpp"
 #include "opentxs/core/OTTransactionType.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <string>
 
 namespace opentxs
 {
 
 class Account;
+class Arena;
 class Cheque;
 class Identifier;
 class Item;
+class MerkleTree;
 class Nym;
 class ServerContext;
 class String;
@@ -206,6 +212,20 @@ public:
     // the hash is
     // recorded there
 
+    // Boxes saved in the Merkle format (version 3.0) are hashed as a Merkle
+    // root over their receipts instead of as a single digest of the ledger,
+    // so that adding or removing one receipt does not rehash the others.
+    EXPORT bool IsMerkleBox() const;
+    // Causes the nymboxes, inboxes and outboxes of the notary to be upgraded
+    // to the Merkle format the next time they are signed. Off by default.
+    EXPORT static void SetMerkleBoxes(
+        const Identifier& notaryID,
+        const bool enabled);
+    // Allocates the receipts, items and their strings from one arena per
+    // ledger when loading, instead of from the heap one at a time. Each arena
+    // block is freed once every receipt allocated from it has been released.
+    // Off by default.
+    EXPORT static void SetArenaAllocation(const bool enabled);
     EXPORT bool CalculateHash(Identifier& theOutput);
     EXPORT bool CalculateInboxHash(Identifier& theOutput);
     EXPORT bool CalculateOutboxHash(Identifier& theOutput);
@@ -299,8 +319,21 @@ private:  // Private prevents erroneous use by other classes.
     friend OTTransactionType* OTTransactionType::TransactionFactory(
         String strInput);
 
+    static std::mutex merkle_lock_;
+    static std::set<std::string> merkle_notaries_;
+    static std::atomic<bool> arena_allocation_;
+
     mapOfTransactions m_mapTransactions;  // a ledger contains a map of
                                           // transactions.
+    std::unique_ptr<MerkleTree> merkle_tree_;
+    // Receipt hash each leaf of merkle_tree_ was built from
+    std::map<std::int64_t, std::string> merkle_leaves_;
+    // Backs the transactions loaded into m_mapTransactions in arena mode
+    std::unique_ptr<Arena> arena_;
+
+    // Returns nullptr unless arena allocation is enabled
+    Arena* arena();
+    bool calculate_merkle_hash(Identifier& theOutput);
 
     bool generate_ledger(
         const Identifier& theNymID,
@@ -109,10 +109,17 @@ private:
     static const ReverseTypeMap message_types_;
     static const std::map<MessageType, MessageType> reply_message_;
 
+    // Only set when the message was instantiated via LoadBinary()
+    std::string binary_message_{};
+    std::string binary_signature_{};
+    proto::HashType binary_hash_type_{proto::HASHTYPE_ERROR};
+
     static ReverseTypeMap make_reverse_map();
     static MessageType reply_command(const MessageType& type);
 
+    void update_xml();
     bool updateContentsByType(Tag& parent);
+    bool verify_binary(const Nym& theNym, const OTPasswordData* pPWData) const;
 
     std::int32_t processXmlNodeAckReplies(
         Message& m,
@@ -128,6 +135,9 @@ public:
     EXPORT static std::string Command(const MessageType type);
     EXPORT static MessageType Type(const std::string& type);
     EXPORT static std::string ReplyCommand(const MessageType type);
+    /** Commands which may be sent using the binary wire format. The replies
+     *  to all other commands may embed the signed XML form of the request. */
+    EXPORT static bool BinaryFormatAllowed(const MessageType type);
 
     EXPORT Message();
     EXPORT virtual ~Message();
@@ -141,6 +151,19 @@ public:
         const Nym& theNym,
         const OTPasswordData* pPWData = nullptr) const override;
 
+    /** True if the message was instantiated by LoadBinary() */
+    bool Binary() const { return false == binary_message_.empty(); }
+    /** Instantiates a message from the binary wire format produced by
+     *  SaveBinary(). The XML form of the message is regenerated so that
+     *  String(message) keeps working, but it does not carry a signature. */
+    EXPORT bool LoadBinary(const std::string& serialized);
+    /** Serializes the message into the binary wire format, signed over the
+     *  serialized bytes by theNym's authentication key. */
+    EXPORT bool SaveBinary(
+        const Nym& theNym,
+        std::string& serialized,
+        const OTPasswordData* pPWData = nullptr) const;
+
     EXPORT bool HarvestTransactionNumbers(
         ServerContext& context,
         bool bHarvestingForRetry,            // false until positively asserted.
@@ -155,6 +178,11 @@ public:
     EXPORT void SetAcknowledgments(const Context& context);
     EXPORT void SetAcknowledgments(const std::set<RequestNumber>& numbers);
 
+    /** True if the sender reads version 2.0 transaction statements */
+    EXPORT bool RangeStatements() const;
+    /** Advertises that the sender reads version 2.0 transaction statements */
+    EXPORT void SetRangeStatements();
+
     EXPORT static void registerStrategy(
         std::string name,
         OTMessageStrategy* strategy);
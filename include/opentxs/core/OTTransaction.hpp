@@ -45,6 +45,8 @@
 #include "opentxs/core/Item.hpp"
 #include "opentxs/Types.hpp"
 
+#include <cstddef>
+
 namespace opentxs
 {
 
@@ -474,6 +476,11 @@ public:
 
     EXPORT virtual ~OTTransaction();
 
+    // Receipts loaded by a ledger in arena mode come from that ledger's
+    // arena. See Ledger::SetArenaAllocation.
+    EXPORT static void* operator new(std::size_t size);
+    EXPORT static void operator delete(void* pointer);
+
     void Release() override;
     EXPORT std::int64_t GetNumberOfOrigin() override;
     EXPORT void CalculateNumberOfOrigin() override;
@@ -495,6 +502,10 @@ public:
 
     bool IsAbbreviated() const { return m_bIsAbbreviated; }
 
+    // The hash recorded in an abbreviated box record, or for a full receipt,
+    // the hash which such a record would contain.
+    EXPORT void GetReceiptHash(Identifier& theOutput) const;
+
     std::int64_t GetAbbrevAdjustment() const { return m_lAbbrevAmount; }
 
     void SetAbbrevAdjustment(std::int64_t lAmount)
@@ -611,7 +622,7 @@ public:
     // they are first loaded up. NotaryID and AccountID have been verified.
     // Now we check ownership, and signatures, and transaction #s, etc.
     // (We go deeper.)
-    EXPORT bool VerifyItems(const Nym& theNym);
+    EXPORT bool VerifyItems(const api::Crypto& crypto, const Nym& theNym);
 
     inline std::int32_t GetItemCount() const
     {
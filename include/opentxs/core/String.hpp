@@ -89,6 +89,7 @@ public:
 
     EXPORT String();
     EXPORT String(const String& value);
+    EXPORT String(String&& value);
     EXPORT explicit String(const OTASCIIArmor& value);
     EXPORT explicit String(const OTSignature& value);
     EXPORT explicit String(const Contract& value);
@@ -128,6 +129,11 @@ public:
 public:
     static size_t safe_strlen(const char* s, size_t max);
 
+    /** Number of heap buffers allocated by String instances on the calling
+     *  thread so far. Short values and copies of long values do not
+     *  allocate. */
+    EXPORT static std::uint64_t Allocations();
+
     EXPORT static std::string LongToString(const std::int64_t& lNumber);
     EXPORT static std::string UlongToString(const std::uint64_t& uNumber);
 
@@ -196,10 +202,33 @@ private:
      * function ASSUMES the new_string pointer is good. */
     void LowLevelSet(const char* data, std::uint32_t enforcedMaxLength);
 
+    void append(const char* data, const std::uint32_t size);
+    void append_format(
+        const char* fmt,
+        std::va_list* pvl,
+        const bool replace);
+    /** Gives this object its own copy of a buffer shared with other copies */
+    void detach() const;
+    bool is_inline() const { return data_ == small_; }
+    void release_buffer();
+    /** Ensures data_ is unshared with room for size characters, keeping the
+     *  current contents. Heap buffers grow geometrically. */
+    void reserve(const std::uint32_t size);
+    /** Moves the contents of rhs into this object, which must be empty */
+    void take(String& rhs);
+
 protected:
     std::uint32_t length_;
     std::uint32_t position_;
-    char* data_;
+    /** Points to small_, to a heap buffer which may be shared by copies of
+     *  this object, or is nullptr. Mutable because zeroMemory() and
+     *  ConvertToUpperCase() must unshare the buffer before writing to it. */
+    mutable char* data_;
+
+private:
+    /** Holds values short enough to need no separate allocation (numbers,
+     *  amounts, type names), plus the terminator */
+    mutable char small_[2 * sizeof(char*)];
 };
 }  // namespace opentxs
 #endif  // OPENTXS_CORE_OTSTRING_HPP
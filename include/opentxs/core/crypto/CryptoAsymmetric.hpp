@@ -55,6 +55,7 @@ class Data;
 class OTPassword;
 class OTPasswordData;
 class OTSignature;
+class VerificationCache;
 
 typedef std::multimap<std::string, OTAsymmetricKey*> mapOfAsymmetricKeys;
 
@@ -91,8 +92,20 @@ public:
         const Data& signature,
         const proto::HashType hashType,
         const OTPasswordData* pPWData = nullptr) const = 0;
+    /** Same as Verify(), except that signatures which this engine has
+     *  already verified successfully are not checked again */
+    bool VerifyWithCache(
+        const Data& plaintext,
+        const OTAsymmetricKey& theKey,
+        const Data& signature,
+        const proto::HashType hashType,
+        const OTPasswordData* pPWData = nullptr) const;
 
     virtual ~CryptoAsymmetric() = default;
+
+protected:
+    /** Set by the crypto api which owns the engine */
+    const VerificationCache* verification_cache_{nullptr};
 };
 
 }  // namespace opentxs
@@ -0,0 +1,421 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_CORE_UTIL_INTERVALSET_HPP
+#define OPENTXS_CORE_UTIL_INTERVALSET_HPP
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <set>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace opentxs
+{
+/** \brief Set of integers stored as sorted, non-adjacent inclusive runs
+ *
+ *  Transaction numbers are issued in long contiguous blocks, so a context
+ *  holding thousands of numbers typically needs only a handful of runs. The
+ *  runs are kept in one contiguous vector: lookups are a binary search and
+ *  union, difference and comparison are single linear merges over runs
+ *  instead of over individual numbers.
+ *
+ *  The text encoding is a comma-separated list of runs, where a run of more
+ *  than one number is written as "first-last", for example "1-500,503".
+ */
+template <typename T>
+class IntervalSet
+{
+public:
+    using Range = std::pair<T, T>;
+    using Ranges = std::vector<Range>;
+
+    /** Parses the text encoding. Returns false if the input is malformed or
+     *  contains a run whose last number precedes its first. */
+    static bool Decode(const std::string& input, IntervalSet& output)
+    {
+        output.ranges_.clear();
+        Ranges runs{};
+        std::istringstream stream(input);
+        std::string run{};
+
+        while (std::getline(stream, run, ',')) {
+            run.erase(
+                std::remove_if(
+                    run.begin(),
+                    run.end(),
+                    [](const char c) { return std::isspace(c); }),
+                run.end());
+
+            if (run.empty()) { continue; }
+
+            const auto dash = run.find('-', 1);
+            T first{0};
+            T last{0};
+
+            if (std::string::npos == dash) {
+                if (false == parse(run, first)) { return false; }
+
+                last = first;
+            } else {
+                if (false == parse(run.substr(0, dash), first)) {
+                    return false;
+                }
+
+                if (false == parse(run.substr(dash + 1), last)) {
+                    return false;
+                }
+            }
+
+            if (last < first) { return false; }
+
+            runs.emplace_back(first, last);
+        }
+
+        // Sorting first lets every run be coalesced in a single pass
+        std::sort(runs.begin(), runs.end());
+
+        for (const auto& range : runs) { append(output.ranges_, range); }
+
+        return true;
+    }
+
+    /** Returns false if the value was already present */
+    bool Add(const T value) { return Add(value, value); }
+
+    /** Adds every number in [first, last]. Returns false if any of them was
+     *  already present. */
+    bool Add(const T first, const T last)
+    {
+        if (last < first) { return false; }
+
+        const bool present = overlaps(first, last);
+        ranges_ = merge(ranges_, Ranges{{first, last}});
+
+        return (false == present);
+    }
+
+    /** Adds every number in rhs with a single merge. Returns false if any of
+     *  them was already present. */
+    bool Add(const IntervalSet& rhs)
+    {
+        const bool present = Intersects(rhs);
+        ranges_ = merge(ranges_, rhs.ranges_);
+
+        return (false == present);
+    }
+
+    void Clear() { ranges_.clear(); }
+
+    bool Contains(const T value) const
+    {
+        auto it = std::upper_bound(
+            ranges_.begin(),
+            ranges_.end(),
+            value,
+            [](const T& lhs, const Range& rhs) { return lhs < rhs.first; });
+
+        if (ranges_.begin() == it) { return false; }
+
+        return value <= (--it)->second;
+    }
+
+    /** True if every number in rhs is also in this set */
+    bool Contains(const IntervalSet& rhs) const
+    {
+        return rhs.Difference(*this).Empty();
+    }
+
+    /** Number of values in the set, not the number of runs. Saturates at
+     *  the maximum value of std::size_t. */
+    std::size_t Count() const
+    {
+        std::size_t output{0};
+
+        for (const auto& range : ranges_) {
+            const auto count = width(range);
+
+            if ((std::numeric_limits<std::size_t>::max() - output) < count) {
+                return std::numeric_limits<std::size_t>::max();
+            }
+
+            output += count;
+        }
+
+        return output;
+    }
+
+    /** Values in this set which are not in rhs */
+    IntervalSet Difference(const IntervalSet& rhs) const
+    {
+        IntervalSet output{};
+        auto other = rhs.ranges_.begin();
+
+        for (auto [first, last] : ranges_) {
+            while ((rhs.ranges_.end() != other) && (other->second < first)) {
+                ++other;
+            }
+
+            auto next = other;
+            bool remaining{true};
+
+            while ((rhs.ranges_.end() != next) && (next->first <= last)) {
+                if (first < next->first) {
+                    output.ranges_.emplace_back(first, next->first - 1);
+                }
+
+                if (next->second >= last) {
+                    remaining = false;
+
+                    break;
+                }
+
+                first = next->second + 1;
+                ++next;
+            }
+
+            if (remaining) { output.ranges_.emplace_back(first, last); }
+        }
+
+        return output;
+    }
+
+    bool Empty() const { return ranges_.empty(); }
+
+    /** True if at least one number is in both sets */
+    bool Intersects(const IntervalSet& rhs) const
+    {
+        auto left = ranges_.begin();
+        auto right = rhs.ranges_.begin();
+
+        while ((ranges_.end() != left) && (rhs.ranges_.end() != right)) {
+            if (left->second < right->first) {
+                ++left;
+            } else if (right->second < left->first) {
+                ++right;
+            } else {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    std::string Encode() const
+    {
+        std::ostringstream output{};
+        bool first{true};
+
+        for (const auto& range : ranges_) {
+            if (false == first) { output << ','; }
+
+            first = false;
+            output << range.first;
+
+            if (range.first != range.second) { output << '-' << range.second; }
+        }
+
+        return output.str();
+    }
+
+    /** Returns false if the value was not present */
+    bool Remove(const T value)
+    {
+        if (false == Contains(value)) { return false; }
+
+        IntervalSet removed{};
+        removed.ranges_.emplace_back(value, value);
+        *this = Difference(removed);
+
+        return true;
+    }
+
+    /** Removes every number in rhs. Returns false, and leaves the set
+     *  unchanged, if any of them was not present. */
+    bool Remove(const IntervalSet& rhs)
+    {
+        if (false == Contains(rhs)) { return false; }
+
+        *this = Difference(rhs);
+
+        return true;
+    }
+
+    const Ranges& Runs() const { return ranges_; }
+
+    /** Expands the runs into individual values */
+    std::set<T> Set() const
+    {
+        std::set<T> output{};
+
+        for (const auto& [first, last] : ranges_) {
+            for (auto i = first;; ++i) {
+                output.emplace_hint(output.end(), i);
+
+                if (i == last) { break; }
+            }
+        }
+
+        return output;
+    }
+
+    IntervalSet Union(const IntervalSet& rhs) const
+    {
+        IntervalSet output{};
+        output.ranges_ = merge(ranges_, rhs.ranges_);
+
+        return output;
+    }
+
+    bool operator==(const IntervalSet& rhs) const
+    {
+        return ranges_ == rhs.ranges_;
+    }
+    bool operator!=(const IntervalSet& rhs) const { return !(*this == rhs); }
+
+    /** Builds the runs in one pass since a std::set is already sorted */
+    explicit IntervalSet(const std::set<T>& values)
+        : ranges_()
+    {
+        for (const auto& value : values) { append(ranges_, {value, value}); }
+    }
+    IntervalSet() = default;
+    IntervalSet(const IntervalSet&) = default;
+    IntervalSet(IntervalSet&&) = default;
+    IntervalSet& operator=(const IntervalSet&) = default;
+    IntervalSet& operator=(IntervalSet&&) = default;
+
+    ~IntervalSet() = default;
+
+private:
+    Ranges ranges_{};
+
+    static bool adjacent(const T last, const T first)
+    {
+        return (std::numeric_limits<T>::max() != last) && (last + 1 == first);
+    }
+
+    /** Appends a run which does not start before the last run in output,
+     *  coalescing it with that run if they overlap or touch */
+    static void append(Ranges& output, const Range& range)
+    {
+        if (output.empty()) {
+            output.emplace_back(range);
+
+            return;
+        }
+
+        auto& back = output.back();
+
+        const bool touching =
+            (range.first <= back.second) || adjacent(back.second, range.first);
+
+        if (touching) {
+            back.second = std::max(back.second, range.second);
+        } else {
+            output.emplace_back(range);
+        }
+    }
+
+    static Ranges merge(const Ranges& lhs, const Ranges& rhs)
+    {
+        Ranges output{};
+        output.reserve(lhs.size() + rhs.size());
+        auto left = lhs.begin();
+        auto right = rhs.begin();
+
+        while ((lhs.end() != left) || (rhs.end() != right)) {
+            const bool takeLeft =
+                (rhs.end() == right) ||
+                ((lhs.end() != left) && (left->first < right->first));
+
+            if (takeLeft) {
+                append(output, *left++);
+            } else {
+                append(output, *right++);
+            }
+        }
+
+        return output;
+    }
+
+    static bool parse(const std::string& input, T& output)
+    {
+        if (input.empty()) { return false; }
+
+        std::istringstream stream(input);
+        stream >> output;
+
+        return (false == stream.fail()) && stream.eof();
+    }
+
+    /** Number of values in the run, computed without signed overflow.
+     *  Saturates at the maximum value of std::size_t. */
+    static std::size_t width(const Range& range)
+    {
+        using Unsigned = std::make_unsigned_t<T>;
+        const auto distance = static_cast<Unsigned>(
+            static_cast<Unsigned>(range.second) -
+            static_cast<Unsigned>(range.first));
+
+        if (std::numeric_limits<std::size_t>::max() <= distance) {
+            return std::numeric_limits<std::size_t>::max();
+        }
+
+        return static_cast<std::size_t>(distance) + 1;
+    }
+
+    bool overlaps(const T first, const T last) const
+    {
+        auto it = std::lower_bound(
+            ranges_.begin(),
+            ranges_.end(),
+            first,
+            [](const Range& lhs, const T& rhs) { return lhs.second < rhs; });
+
+        return (ranges_.end() != it) && (it->first <= last);
+    }
+};
+}  // namespace opentxs
+#endif  // OPENTXS_CORE_UTIL_INTERVALSET_HPP
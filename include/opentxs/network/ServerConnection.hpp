@@ -53,6 +53,11 @@ namespace network
 class ServerConnection
 {
 public:
+    /** Optional second body frame which names the encoding of the first
+     *  frame. Sending it advertises support for the binary message format. */
+    EXPORT static const std::string ArmoredFormat;
+    EXPORT static const std::string BinaryFormat;
+
     EXPORT static OTServerConnection Factory(
         const api::network::ZMQ& zmq,
         const std::string& serverID);
@@ -62,7 +67,11 @@ public:
     EXPORT virtual bool EnableProxy() = 0;
     EXPORT virtual NetworkReplyRaw Send(const std::string& message) = 0;
     EXPORT virtual NetworkReplyString Send(const String& message) = 0;
-    EXPORT virtual NetworkReplyMessage Send(const Message& message) = 0;
+    /** signer must be the sender of the message. It signs the binary form
+     *  of the message when the server supports it. */
+    EXPORT virtual NetworkReplyMessage Send(
+        const Message& message,
+        const Nym& signer) = 0;
     EXPORT virtual bool Status() const = 0;
 
     virtual ~ServerConnection() = default;
@@ -69,6 +69,12 @@ public:
 
     EXPORT virtual operator void*() const = 0;
 
+    /** Per-socket traffic counters and callback latency histograms
+     *
+     *  Returns one line per open socket plus one line per socket type
+     *  totalling the sockets which have already been closed.
+     */
+    EXPORT virtual std::string DumpMetrics() const = 0;
     EXPORT virtual Pimpl<network::zeromq::SubscribeSocket> PairEventListener(
         const PairEventCallback& callback) const = 0;
     EXPORT virtual Pimpl<network::zeromq::PairSocket> PairSocket(
@@ -82,6 +88,9 @@ public:
     EXPORT virtual Pimpl<network::zeromq::Proxy> Proxy(
         Socket& frontend,
         Socket& backend) const = 0;
+    /** Publish the output of DumpMetrics() as a single frame on
+     *  Socket::MetricsEndpoint */
+    EXPORT virtual bool PublishMetrics() const = 0;
     EXPORT virtual Pimpl<network::zeromq::PublishSocket> PublishSocket()
         const = 0;
     EXPORT virtual Pimpl<network::zeromq::PullSocket> PullSocket(
@@ -84,9 +84,12 @@ public:
 
     EXPORT static const std::string AccountUpdateEndpoint;
     EXPORT static const std::string ContactUpdateEndpoint;
+    EXPORT static const std::string MetricsEndpoint;
     EXPORT static const std::string NymDownloadEndpoint;
     EXPORT static const std::string PairEndpointPrefix;
     EXPORT static const std::string PairEventEndpoint;
+    EXPORT static const std::string PeerReplyUpdateEndpoint;
+    EXPORT static const std::string PeerRequestUpdateEndpoint;
     EXPORT static const std::string PendingBailmentEndpoint;
     EXPORT static const std::string ThreadUpdateEndpoint;
     EXPORT static const std::string WidgetUpdateEndpoint;
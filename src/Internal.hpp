@@ -87,7 +87,9 @@ namespace zeromq
 namespace implementation
 {
 class Context;
+class Metrics;
 class Proxy;
+class SocketMetrics;
 }  // namespace implementation
 }  // namespace zeromq
 }  // namespace network
@@ -230,6 +232,7 @@ using ProfileSubsectionOuter =
 }  // namespace ui
 
 class DhtConfig;
+class Journal;
 #if OT_CRYPTO_USING_LIBSECP256K1
 class Libsecp256k1;
 #endif
@@ -239,9 +242,11 @@ class OpenSSL;
 #endif
 class StorageConfig;
 class StorageMultiplex;
+class ThreadPool;
 #if OT_CRYPTO_USING_TREZOR
 class TrezorCrypto;
 #endif
+class VerificationCache;
 }  // namespace opentxs
 
 extern template class std::
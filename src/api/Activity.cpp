@@ -53,12 +53,20 @@
 #include "opentxs/core/Message.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/PublishSocket.hpp"
 #include "opentxs/Types.hpp"
 
-#include <thread>
+#include <algorithm>
+#include <cstdint>
+#include <future>
+#include <map>
+#include <utility>
+#include <vector>
 
 #define OT_METHOD "opentxs::api::implementation::Activity::"
+// Decrypted mail is kept in memory up to this many bytes of plaintext
+#define OT_ACTIVITY_MAIL_CACHE_BYTES 16777216
 
 namespace opentxs::api::implementation
 {
@@ -66,15 +74,24 @@ Activity::Activity(
     const ContactManager& contact,
     const storage::Storage& storage,
     const client::Wallet& wallet,
-    const opentxs::network::zeromq::Context& zmq)
+    const opentxs::network::zeromq::Context& zmq,
+    const ThreadPool& pool)
     : contact_(contact)
     , storage_(storage)
     , wallet_(wallet)
     , zmq_(zmq)
-    , mail_cache_lock_()
-    , mail_cache_()
+    , mail_cache_(OT_ACTIVITY_MAIL_CACHE_BYTES)
+    , mail_job_lock_()
+    , mail_jobs_()
     , publisher_lock_()
     , thread_publishers_()
+    , sequence_lock_()
+    , thread_sequence_()
+    , running_(true)
+    , pool_(pool)
+    , task_lock_()
+    , task_finished_()
+    , tasks_(0)
 {
 }
 
@@ -87,7 +104,7 @@ void Activity::activity_preload_thread(
 
     for (const auto& it : threads) {
         const auto& threadID = it.first;
-        thread_preload_thread(nymID, threadID, 0, count);
+        thread_preload_thread(nymID, threadID, 0, count, false);
     }
 }
 
@@ -116,10 +133,19 @@ bool Activity::AddBlockchainTransaction(
         storage_.CreateThread(sNymID, sthreadID, {sthreadID});
     }
 
+    proto::StorageThreadItem item{};
     const bool saved = storage_.Store(
-        sNymID, sthreadID, transaction.txid(), transaction.time(), {}, {}, box);
+        sNymID,
+        sthreadID,
+        transaction.txid(),
+        transaction.time(),
+        {},
+        {},
+        box,
+        {},
+        &item);
 
-    if (saved) { publish(nymID, sthreadID); }
+    if (saved) { publish(nymID, sthreadID, ThreadDelta::ITEMADDED, item); }
 
     return saved;
 }
@@ -151,6 +177,7 @@ bool Activity::AddPaymentEvent(
         storage_.CreateThread(sNymID, sthreadID, {sthreadID});
     }
 
+    proto::StorageThreadItem item{};
     const bool saved = storage_.Store(
         sNymID,
         sthreadID,
@@ -159,9 +186,10 @@ bool Activity::AddPaymentEvent(
         {},
         {},
         type,
-        workflowID.str());
+        workflowID.str(),
+        &item);
 
-    if (saved) { publish(nymID, sthreadID); }
+    if (saved) { publish(nymID, sthreadID, ThreadDelta::ITEMADDED, item); }
 
     return saved;
 }
@@ -219,6 +247,90 @@ Activity::ChequeData Activity::Cheque(
     return output;
 }
 
+std::shared_future<Activity::MailPointer> Activity::decrypt(
+    const Identifier& nym,
+    const Identifier& id,
+    const StorageBox box,
+    const bool visible) const
+{
+    const std::string key = id.str();
+    const auto nymID = Identifier::Factory(nym);
+    const auto mailID = Identifier::Factory(id);
+    auto task = [this, nymID, mailID, box]() -> void {
+        run_decrypt(nymID, mailID, box);
+    };
+    Lock lock(mail_job_lock_);
+    auto it = mail_jobs_.find(key);
+
+    if (mail_jobs_.end() != it) {
+        auto& job = it->second;
+
+        // Promote a queued background preload which has become visible
+        if (visible && (false == job.started_)) {
+            run(task, true);
+        }
+
+        return job.future_;
+    }
+
+    auto& job = mail_jobs_[key];
+    job.future_ = job.promise_.get_future().share();
+
+    if (visible) {
+        run(task, true);
+    } else {
+        run(task, false);
+    }
+
+    return job.future_;
+}
+
+Activity::MailPointer Activity::decrypt_mail(
+    const Identifier& nymID,
+    const Identifier& id,
+    const StorageBox box) const
+{
+    const auto message = Mail(nymID, id, box);
+
+    if (!message) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load message "
+              << String(id) << std::endl;
+
+        return {};
+    }
+
+    auto nym = wallet_.Nym(nymID);
+
+    if (false == bool(nym)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load recipent nym."
+              << std::endl;
+
+        return {};
+    }
+
+    otErr << OT_METHOD << __FUNCTION__ << ": Decrypting message " << id.str()
+          << std::endl;
+    auto peerObject = PeerObject::Factory(nym, message->m_ascPayload);
+    otErr << OT_METHOD << __FUNCTION__ << ": Message " << id.str()
+          << " decrypted." << std::endl;
+
+    if (!peerObject) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Unable to instantiate peer object." << std::endl;
+
+        return {};
+    }
+
+    if (!peerObject->Message()) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Peer object does not contain a message." << std::endl;
+
+        return {};
+    }
+
+    return std::make_shared<const std::string>(*peerObject->Message());
+}
+
 const opentxs::network::zeromq::PublishSocket& Activity::get_publisher(
     const Identifier& nymID) const
 {
@@ -257,8 +369,21 @@ bool Activity::MoveIncomingBlockchainTransaction(
     const Identifier& toThreadID,
     const std::string& txid) const
 {
-    return storage_.MoveThreadItem(
-        nymID.str(), fromThreadID.str(), toThreadID.str(), txid);
+    const auto from = fromThreadID.str();
+    const auto to = toThreadID.str();
+    proto::StorageThreadItem moved{};
+    const bool output =
+        storage_.MoveThreadItem(nymID.str(), from, to, txid, &moved);
+
+    if (output) {
+        publish(nymID, from, ThreadDelta::ITEMREMOVED, moved);
+        publish(nymID, to, ThreadDelta::ITEMADDED, moved);
+    } else {
+        // The item may have left the source thread before the move failed
+        publish(nymID, from, ThreadDelta::RELOAD, {});
+    }
+
+    return output;
 }
 
 std::unique_ptr<Message> Activity::Mail(
@@ -344,6 +469,7 @@ std::string Activity::Mail(
         storage_.CreateThread(nymID, threadID, {contactID});
     }
 
+    proto::StorageThreadItem item{};
     const bool saved = storage_.Store(
         localName.Get(),
         threadID,
@@ -351,12 +477,13 @@ std::string Activity::Mail(
         mail.m_lTime,
         alias,
         data.Get(),
-        box);
+        box,
+        {},
+        &item);
 
     if (saved) {
-        std::thread preload(&Activity::preload, this, nym, id, box);
-        preload.detach();
-        publish(nym, threadID);
+        decrypt(nym, id, box, false);
+        publish(nym, threadID, ThreadDelta::ITEMADDED, item);
 
         return output;
     }
@@ -376,8 +503,14 @@ bool Activity::MailRemove(
 {
     const std::string nymid = nym.str();
     const std::string mail = id.str();
+    std::map<std::string, proto::StorageThreadItem> removed{};
+    const bool output = storage_.RemoveNymBoxItem(nymid, box, mail, &removed);
+
+    for (const auto& [thread, item] : removed) {
+        publish(nym, thread, ThreadDelta::ITEMREMOVED, item);
+    }
 
-    return storage_.RemoveNymBoxItem(nymid, box, mail);
+    return output;
 }
 
 std::shared_ptr<const std::string> Activity::MailText(
@@ -385,20 +518,11 @@ std::shared_ptr<const std::string> Activity::MailText(
     const Identifier& id,
     const StorageBox& box) const
 {
-    Lock lock(mail_cache_lock_);
-    auto it = mail_cache_.find(id);
-    lock.unlock();
-
-    if (mail_cache_.end() != it) { return it->second; }
-
-    preload(nymID, id, box);
-    lock.lock();
-    it = mail_cache_.find(id);
-    lock.unlock();
+    MailPointer output{};
 
-    if (mail_cache_.end() == it) { return {}; }
+    if (mail_cache_.Get(id.str(), output)) { return output; }
 
-    return it->second;
+    return decrypt(nymID, id, box, true).get();
 }
 
 bool Activity::MarkRead(
@@ -409,8 +533,16 @@ bool Activity::MarkRead(
     const std::string nym = nymId.str();
     const std::string thread = threadId.str();
     const std::string item = itemId.str();
+    const bool output = storage_.SetReadState(nym, thread, item, false);
 
-    return storage_.SetReadState(nym, thread, item, false);
+    if (output) {
+        proto::StorageThreadItem changed{};
+        changed.set_id(item);
+        changed.set_unread(false);
+        publish(nymId, thread, ThreadDelta::READSTATE, changed);
+    }
+
+    return output;
 }
 
 bool Activity::MarkUnread(
@@ -421,8 +553,16 @@ bool Activity::MarkUnread(
     const std::string nym = nymId.str();
     const std::string thread = threadId.str();
     const std::string item = itemId.str();
+    const bool output = storage_.SetReadState(nym, thread, item, true);
 
-    return storage_.SetReadState(nym, thread, item, true);
+    if (output) {
+        proto::StorageThreadItem changed{};
+        changed.set_id(item);
+        changed.set_unread(true);
+        publish(nymId, thread, ThreadDelta::READSTATE, changed);
+    }
+
+    return output;
 }
 
 void Activity::MigrateLegacyThreads() const
@@ -567,60 +707,14 @@ std::shared_ptr<const std::string> Activity::PaymentText(
     return output;
 }
 
-void Activity::preload(
-    const Identifier nymID,
-    const Identifier id,
-    const StorageBox box) const
-{
-    const auto message = Mail(nymID, id, box);
-
-    if (!message) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load message "
-              << String(id) << std::endl;
-
-        return;
-    }
-
-    auto nym = wallet_.Nym(nymID);
-
-    if (false == bool(nym)) {
-        otErr << OT_METHOD << __FUNCTION__ << ": Unable to load recipent nym."
-              << std::endl;
-
-        return;
-    }
-
-    otErr << OT_METHOD << __FUNCTION__ << ": Decrypting message " << id.str()
-          << std::endl;
-    auto peerObject = PeerObject::Factory(nym, message->m_ascPayload);
-    otErr << OT_METHOD << __FUNCTION__ << ": Message " << id.str()
-          << " decrypted." << std::endl;
-
-    if (!peerObject) {
-        otErr << OT_METHOD << __FUNCTION__
-              << ": Unable to instantiate peer object." << std::endl;
-
-        return;
-    }
-
-    if (!peerObject->Message()) {
-        otErr << OT_METHOD << __FUNCTION__
-              << ": Peer object does not contain a message." << std::endl;
-
-        return;
-    }
-
-    Lock lock(mail_cache_lock_);
-    auto& output = mail_cache_[id];
-    lock.unlock();
-    output.reset(new std::string(*peerObject->Message()));
-}
-
 void Activity::PreloadActivity(const Identifier& nymID, const std::size_t count)
     const
 {
-    std::thread preload(&Activity::activity_preload_thread, this, nymID, count);
-    preload.detach();
+    const auto nym = Identifier::Factory(nymID);
+    auto task = [this, nym, count]() -> void {
+        activity_preload_thread(nym, count);
+    };
+    run(task, false);
 }
 
 void Activity::PreloadThread(
@@ -631,16 +725,93 @@ void Activity::PreloadThread(
 {
     const std::string nym = nymID.str();
     const std::string thread = threadID.str();
-    std::thread preload(
-        &Activity::thread_preload_thread, this, nym, thread, start, count);
-    preload.detach();
+    auto task = [this, nym, thread, start, count]() -> void {
+        thread_preload_thread(nym, thread, start, count, true);
+    };
+    run(task, true);
 }
 
-void Activity::publish(const Identifier& nymID, const std::string& threadID)
-    const
+void Activity::publish(
+    const Identifier& nymID,
+    const std::string& threadID,
+    const ThreadDelta type,
+    const proto::StorageThreadItem& item) const
 {
+    const bool full =
+        (ThreadDelta::ITEMADDED == type) || (ThreadDelta::ITEMREMOVED == type);
+    auto message = network::zeromq::Message::Factory(threadID);
+    // Hold the lock while publishing so that sequence numbers are sent in
+    // order
+    Lock lock(sequence_lock_);
+    const auto sequence = ++thread_sequence_[nymID];
+    message->AddFrame(std::to_string(sequence));
+    message->AddFrame(std::to_string(static_cast<std::uint8_t>(type)));
+    message->AddFrame(item.id());
+    message->AddFrame(full ? std::to_string(item.box()) : "");
+    message->AddFrame(full ? item.account() : "");
+    message->AddFrame(full ? std::to_string(item.time()) : "");
+    message->AddFrame(full ? std::to_string(item.index()) : "");
+    message->AddFrame(
+        (ThreadDelta::RELOAD == type) ? "" : (item.unread() ? "1" : "0"));
     auto& publisher = get_publisher(nymID);
-    publisher.Publish(threadID);
+    publisher.Publish(message);
+}
+
+void Activity::run(ThreadPool::Task task, const bool next) const
+{
+    Lock lock(task_lock_);
+    ++tasks_;
+    lock.unlock();
+    auto job = [this, task]() -> void {
+        // Nothing reads the future, so an exception would be lost anyway
+        try {
+            task();
+        } catch (...) {
+        }
+
+        Lock lock(task_lock_);
+        --tasks_;
+        // Notify while locked so that the destructor can not return and
+        // destroy the condition variable before this call completes
+        task_finished_.notify_all();
+    };
+
+    if (next) {
+        pool_.RunNext(job);
+    } else {
+        pool_.Run(job);
+    }
+}
+
+void Activity::run_decrypt(
+    const Identifier nym,
+    const Identifier id,
+    const StorageBox box) const
+{
+    const std::string key = id.str();
+    Lock lock(mail_job_lock_);
+    auto it = mail_jobs_.find(key);
+
+    // A job submitted twice for priority runs only once
+    if ((mail_jobs_.end() == it) || it->second.started_) { return; }
+
+    it->second.started_ = true;
+    lock.unlock();
+    MailPointer output{};
+
+    if (running_) { output = decrypt_mail(nym, id, box); }
+
+    if (output) { mail_cache_.Put(key, output, output->size()); }
+
+    lock.lock();
+    it = mail_jobs_.find(key);
+
+    OT_ASSERT(mail_jobs_.end() != it);
+
+    auto promise = std::move(it->second.promise_);
+    mail_jobs_.erase(it);
+    lock.unlock();
+    promise.set_value(output);
 }
 
 std::shared_ptr<proto::StorageThread> Activity::Thread(
@@ -658,7 +829,8 @@ void Activity::thread_preload_thread(
     const std::string nymID,
     const std::string threadID,
     const std::size_t start,
-    const std::size_t count) const
+    const std::size_t count,
+    const bool visible) const
 {
     std::shared_ptr<proto::StorageThread> thread{};
     const bool loaded = storage_.Load(nymID, threadID, thread);
@@ -671,7 +843,6 @@ void Activity::thread_preload_thread(
     }
 
     const std::size_t size = thread->item_size();
-    std::size_t cached{0};
 
     if (start > size) {
         otErr << OT_METHOD << __FUNCTION__ << ": Error: start larger than size "
@@ -681,8 +852,11 @@ void Activity::thread_preload_thread(
         return;
     }
 
+    const auto nym = Identifier::Factory(nymID);
+    std::vector<std::pair<std::string, StorageBox>> items{};
+
     for (auto i = (size - start); i > 0; --i) {
-        if (cached >= count) { break; }
+        if (items.size() >= count) { break; }
 
         const auto& item = thread->item(i - 1);
         const auto& box = static_cast<StorageBox>(item.box());
@@ -690,19 +864,29 @@ void Activity::thread_preload_thread(
         switch (box) {
             case StorageBox::MAILINBOX:
             case StorageBox::MAILOUTBOX: {
-                otErr << OT_METHOD << __FUNCTION__ << ": Preloading item "
-                      << item.id() << " in thread " << threadID << std::endl;
-                MailText(
-                    Identifier::Factory(nymID),
-                    Identifier::Factory(item.id()),
-                    box);
-                ++cached;
+                items.emplace_back(item.id(), box);
             } break;
             default: {
                 continue;
             }
         }
     }
+
+    // Visible items are queued ahead of everything else, so queue the oldest
+    // first in order for the newest to be decrypted first.
+    if (visible) { std::reverse(items.begin(), items.end()); }
+
+    for (const auto& [id, box] : items) {
+        if (false == running_) { return; }
+
+        MailPointer cached{};
+
+        if (mail_cache_.Get(id, cached)) { continue; }
+
+        otInfo << OT_METHOD << __FUNCTION__ << ": Preloading item " << id
+               << " in thread " << threadID << std::endl;
+        decrypt(nym, Identifier::Factory(id), box, visible);
+    }
 }
 
 std::string Activity::ThreadPublisher(const Identifier& nym) const
@@ -753,4 +937,11 @@ std::size_t Activity::UnreadCount(const Identifier& nymId) const
 
     return output;
 }
+
+Activity::~Activity()
+{
+    running_.store(false);
+    Lock lock(task_lock_);
+    task_finished_.wait(lock, [this]() -> bool { return 0 == tasks_; });
+}
 }  // namespace opentxs::api::implementation
@@ -44,6 +44,13 @@
 #include "opentxs/api/Activity.hpp"
 #include "opentxs/core/Lockable.hpp"
 
+#include "util/LRU.hpp"
+#include "util/ThreadPool.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <future>
 #include <map>
 #include <mutex>
 
@@ -214,21 +221,39 @@ public:
 
     std::string ThreadPublisher(const Identifier& nym) const override;
 
-    ~Activity() = default;
+    ~Activity();
 
 private:
     friend class implementation::Native;
 
-    typedef std::map<Identifier, std::shared_ptr<const std::string>> MailCache;
+    using MailPointer = std::shared_ptr<const std::string>;
+    using MailCache = LRU<std::string, MailPointer>;
+
+    /** A decryption which has been queued or is in progress. Every caller
+     *  which asks for the same message while it is in flight shares the
+     *  same future. */
+    struct MailJob {
+        std::promise<MailPointer> promise_{};
+        std::shared_future<MailPointer> future_{};
+        bool started_{false};
+    };
 
     const ContactManager& contact_;
     const storage::Storage& storage_;
     const client::Wallet& wallet_;
     const opentxs::network::zeromq::Context& zmq_;
-    mutable std::mutex mail_cache_lock_;
     mutable MailCache mail_cache_;
+    mutable std::mutex mail_job_lock_;
+    mutable std::map<std::string, MailJob> mail_jobs_;
     mutable std::mutex publisher_lock_;
     mutable std::map<Identifier, OTZMQPublishSocket> thread_publishers_;
+    mutable std::mutex sequence_lock_;
+    mutable std::map<Identifier, std::uint64_t> thread_sequence_;
+    std::atomic<bool> running_;
+    const ThreadPool& pool_;
+    mutable std::mutex task_lock_;
+    mutable std::condition_variable task_finished_;
+    mutable std::size_t tasks_;
 
     /**   Migrate nym-based thread IDs to contact-based thread IDs
      *
@@ -238,15 +263,30 @@ private:
     void activity_preload_thread(
         const Identifier nymID,
         const std::size_t count) const;
-    void preload(
+    /** Queues a message for decryption unless it is already in flight.
+     *  Visible messages are decrypted ahead of background preloads. */
+    std::shared_future<MailPointer> decrypt(
+        const Identifier& nym,
+        const Identifier& id,
+        const StorageBox box,
+        const bool visible) const;
+    MailPointer decrypt_mail(
+        const Identifier& nym,
+        const Identifier& id,
+        const StorageBox box) const;
+    void run_decrypt(
         const Identifier nym,
         const Identifier id,
         const StorageBox box) const;
+    /** Queues a task on the shared pool and counts it as outstanding until
+     *  it finishes, so that the destructor can wait for it */
+    void run(ThreadPool::Task task, const bool next) const;
     void thread_preload_thread(
         const std::string nymID,
         const std::string threadID,
         const std::size_t start,
-        const std::size_t count) const;
+        const std::size_t count,
+        const bool visible) const;
 
     std::shared_ptr<const Contact> nym_to_contact(
         const std::string& nymID) const;
@@ -255,13 +295,18 @@ private:
     const opentxs::network::zeromq::PublishSocket& get_publisher(
         const Identifier& nymID,
         std::string& endpoint) const;
-    void publish(const Identifier& nymID, const std::string& threadID) const;
+    void publish(
+        const Identifier& nymID,
+        const std::string& threadID,
+        const ThreadDelta type,
+        const proto::StorageThreadItem& item) const;
 
     Activity(
         const ContactManager& contact,
         const storage::Storage& storage,
         const client::Wallet& wallet,
-        const opentxs::network::zeromq::Context& zmq);
+        const opentxs::network::zeromq::Context& zmq,
+        const ThreadPool& pool);
     Activity() = delete;
     Activity(const Activity&) = delete;
     Activity(Activity&&) = delete;
@@ -65,7 +65,8 @@ ContactManager::ContactManager(
     , wallet_(wallet)
     , lock_()
     , contact_map_()
-    , contact_name_map_(build_name_map(storage))
+    , contact_name_map_()
+    , indexed_(false)
     , publisher_(context.PublishSocket())
 {
     publisher_->Start(opentxs::network::zeromq::Socket::ContactUpdateEndpoint);
@@ -107,6 +108,7 @@ OTIdentifier ContactManager::BlockchainAddressToContact(
     const proto::ContactItemType currency) const
 {
     rLock lock(lock_);
+    check_indices(lock);
 
     return address_to_contact(lock, address, currency);
 }
@@ -123,6 +125,32 @@ ContactManager::ContactNameMap ContactManager::build_name_map(
     return output;
 }
 
+// Loading the name map and upgrading the indices requires reading every
+// contact, so it is postponed until the first time a caller needs them
+void ContactManager::check_indices(const rLock& lock) const
+{
+    if (false == verify_write_lock(lock)) {
+        throw std::runtime_error("lock error");
+    }
+
+    if (indexed_) { return; }
+
+    indexed_ = true;
+    contact_name_map_ = build_name_map(storage_);
+    const auto level = storage_.ContactUpgradeLevel();
+
+    switch (level) {
+        case 0:
+        case 1: {
+            init_nym_map(lock);
+            import_contacts(lock);
+        }
+        case 2:
+        default: {
+        }
+    }
+}
+
 void ContactManager::check_identifiers(
     const Identifier& inputNymID,
     const PaymentCode& paymentCode,
@@ -195,23 +223,31 @@ std::shared_ptr<const class Contact> ContactManager::Contact(
     const Identifier& id) const
 {
     rLock lock(lock_);
+    check_indices(lock);
 
     return contact(lock, id);
 }
 
 OTIdentifier ContactManager::ContactID(const Identifier& nymID) const
 {
+    rLock lock(lock_);
+    check_indices(lock);
+
     return Identifier::Factory(storage_.ContactOwnerNym(nymID.str()));
 }
 
 ObjectList ContactManager::ContactList() const
 {
+    rLock lock(lock_);
+    check_indices(lock);
+
     return storage_.ContactList();
 }
 
 std::string ContactManager::ContactName(const Identifier& contactID) const
 {
     rLock lock(lock_);
+    check_indices(lock);
     auto it = contact_name_map_.find(contactID);
 
     if (contact_name_map_.end() == it) { return {}; }
@@ -219,7 +255,7 @@ std::string ContactManager::ContactName(const Identifier& contactID) const
     return it->second;
 }
 
-void ContactManager::import_contacts(const rLock& lock)
+void ContactManager::import_contacts(const rLock& lock) const
 {
     auto nyms = wallet_.NymList();
 
@@ -251,7 +287,7 @@ void ContactManager::import_contacts(const rLock& lock)
     }
 }
 
-void ContactManager::init_nym_map(const rLock& lock)
+void ContactManager::init_nym_map(const rLock& lock) const
 {
     otErr << OT_METHOD << __FUNCTION__ << ": Upgrading indices" << std::endl;
 
@@ -327,6 +363,7 @@ std::shared_ptr<const class Contact> ContactManager::Merge(
     const Identifier& child) const
 {
     rLock lock(lock_);
+    check_indices(lock);
     auto childContact = contact(lock, child);
 
     if (false == bool(childContact)) {
@@ -417,6 +454,7 @@ std::unique_ptr<Editor<class Contact>> ContactManager::mutable_Contact(
     const Identifier& id) const
 {
     rLock lock(lock_);
+    check_indices(lock);
     auto output = mutable_contact(lock, id);
     lock.unlock();
 
@@ -483,6 +521,7 @@ std::shared_ptr<const class Contact> ContactManager::NewContact(
     const std::string& label) const
 {
     rLock lock(lock_);
+    check_indices(lock);
 
     return contact(lock, label);
 }
@@ -493,6 +532,7 @@ std::shared_ptr<const class Contact> ContactManager::NewContact(
     const PaymentCode& paymentCode) const
 {
     rLock lock(lock_);
+    check_indices(lock);
 
     return new_contact(lock, label, nymID, paymentCode);
 }
@@ -503,6 +543,7 @@ std::shared_ptr<const class Contact> ContactManager::NewContactFromAddress(
     const proto::ContactItemType currency) const
 {
     rLock lock(lock_);
+    check_indices(lock);
 
     const auto existingID = address_to_contact(lock, address, currency);
 
@@ -591,23 +632,6 @@ void ContactManager::save(class Contact* contact) const
     refresh_indices(lock, *contact);
 }
 
-void ContactManager::start()
-{
-    const auto level = storage_.ContactUpgradeLevel();
-
-    switch (level) {
-        case 0:
-        case 1: {
-            rLock lock(lock_);
-            init_nym_map(lock);
-            import_contacts(lock);
-        }
-        case 2:
-        default: {
-        }
-    }
-}
-
 std::shared_ptr<const class Contact> ContactManager::Update(
     const proto::CredentialIndex& serialized) const
 {
@@ -635,6 +659,7 @@ std::shared_ptr<const class Contact> ContactManager::Update(
 
     const auto& nymID = nym->ID();
     rLock lock(lock_);
+    check_indices(lock);
     const auto contactIdentifier = storage_.ContactOwnerNym(nymID.str());
     const auto contactID = Identifier::Factory(contactIdentifier);
 
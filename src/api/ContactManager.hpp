@@ -95,10 +95,12 @@ private:
     mutable std::recursive_mutex lock_{};
     mutable ContactMap contact_map_{};
     mutable ContactNameMap contact_name_map_;
+    mutable bool indexed_{false};
     OTZMQPublishSocket publisher_;
 
     static ContactNameMap build_name_map(const api::storage::Storage& storage);
 
+    void check_indices(const rLock& lock) const;
     void check_identifiers(
         const Identifier& inputNymID,
         const PaymentCode& paymentCode,
@@ -120,8 +122,8 @@ private:
     std::shared_ptr<const class Contact> contact(
         const rLock& lock,
         const Identifier& id) const;
-    void import_contacts(const rLock& lock);
-    void init_nym_map(const rLock& lock);
+    void import_contacts(const rLock& lock) const;
+    void init_nym_map(const rLock& lock) const;
     ContactMap::iterator load_contact(const rLock& lock, const Identifier& id)
         const;
     std::unique_ptr<Editor<class Contact>> mutable_contact(
@@ -136,7 +138,6 @@ private:
         const PaymentCode& paymentCode) const;
     void refresh_indices(const rLock& lock, class Contact& contact) const;
     void save(class Contact* contact) const;
-    void start();
     std::shared_ptr<const class Contact> update_existing_contact(
         const rLock& lock,
         const std::string& label,
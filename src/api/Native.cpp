@@ -78,11 +78,16 @@
 #include "api/Activity.hpp"
 #include "api/ContactManager.hpp"
 #include "api/Server.hpp"
+#include "core/contract/AccountRegistry.hpp"
 #include "network/DhtConfig.hpp"
 #include "network/OpenDHT.hpp"
 #include "storage/StorageConfig.hpp"
+#include "util/TaskGraph.hpp"
+#include "util/ThreadPool.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <ctime>
 #include <memory>
 #include <mutex>
@@ -117,6 +122,7 @@ Native::Native(
     , task_list_lock_()
     , signal_handler_lock_()
     , periodic_task_list()
+    , pool_(new ThreadPool)
     , activity_(nullptr)
     , api_(nullptr)
     , blockchain_(nullptr)
@@ -290,27 +296,54 @@ const api::Identity& Native::Identity() const
 
 void Native::Init()
 {
-    Init_Config();
-    Init_Log();  // requires Init_Config()
-    Init_Crypto();
-    Init_Storage();     // requires Init_Config(), Init_Crypto()
-    Init_ZMQ();         // requires Init_Config()
-    Init_Contracts();   // requires Init_ZMQ()
-    Init_Dht();         // requires Init_Config()
-    Init_Identity();    // requires Init_Contracts()
-    Init_Contacts();    // requires Init_Contracts(), Init_Storage(), Init_ZMQ()
-    Init_Activity();    // requires Init_Storage(), Init_Contacts(),
-                        // Init_Contracts()
-    Init_Blockchain();  // requires Init_Storage(), Init_Crypto(),
-                        // Init_Contracts(), Init_Activity()
-    Init_Api();  // requires Init_Config(), Init_Crypto(), Init_Contracts(),
-                 // Init_Identity(), Init_Storage(), Init_ZMQ(), Init_Contacts()
-                 // Init_Activity()
+    // Each stage is started as soon as the stages it requires have finished
+    TaskGraph startup{};
+    startup.Add("config", {}, [this]() -> void { Init_Config(); });
+    startup.Add("log", {"config"}, [this]() -> void { Init_Log(); });
+    startup.Add("crypto", {"log"}, [this]() -> void { Init_Crypto(); });
+    startup.Add("zmq", {"log"}, [this]() -> void { Init_ZMQ(); });
+    startup.Add(
+        "storage", {"log", "crypto"}, [this]() -> void { Init_Storage(); });
+    startup.Add("contracts", {"zmq"}, [this]() -> void { Init_Contracts(); });
+    // Init_Storage() reads dht_, so it must not run concurrently with
+    // Init_Dht()
+    startup.Add(
+        "dht", {"contracts", "storage"}, [this]() -> void { Init_Dht(); });
+    startup.Add(
+        "identity", {"contracts"}, [this]() -> void { Init_Identity(); });
+    startup.Add(
+        "contacts",
+        {"contracts", "storage", "zmq"},
+        [this]() -> void { Init_Contacts(); });
+    startup.Add(
+        "activity",
+        {"storage", "contacts", "contracts"},
+        [this]() -> void { Init_Activity(); });
+    startup.Add(
+        "blockchain",
+        {"storage", "crypto", "contracts", "activity"},
+        [this]() -> void { Init_Blockchain(); });
+    startup.Add(
+        "api",
+        {"config",
+         "crypto",
+         "contracts",
+         "identity",
+         "storage",
+         "zmq",
+         "contacts",
+         "activity"},
+        [this]() -> void { Init_Api(); });
+
     if (!server_mode_) {
-        Init_UI();  // requires Init_Activity(), Init_Contacts(), Init_Api(),
-                    // Init_Storage()
+        startup.Add(
+            "ui",
+            {"activity", "contacts", "api", "storage"},
+            [this]() -> void { Init_UI(); });
     }
 
+    startup.Run(*pool_);
+
     if (recover_) { recover(); }
 
     Init_Server();  // requires Init_Config(), Init_Storage(), Init_Crypto(),
@@ -326,12 +359,14 @@ void Native::Init_Activity()
     OT_ASSERT(storage_);
 
     activity_.reset(new api::implementation::Activity(
-        *contacts_, *storage_, *wallet_, zmq_context_));
+        *contacts_, *storage_, *wallet_, zmq_context_, *pool_));
 }
 
 void Native::Init_Api()
 {
+    std::unique_lock<std::mutex> lock(config_lock_);
     auto& config = config_[""];
+    lock.unlock();
 
     OT_ASSERT(activity_);
     OT_ASSERT(config);
@@ -388,6 +423,7 @@ void Native::Init_Config()
 
     String strConfigFilePath;
     OTDataFolder::GetConfigFilePath(strConfigFilePath);
+    std::unique_lock<std::mutex> lock(config_lock_);
     config_[""].reset(new api::Settings(strConfigFilePath));
 }
 
@@ -407,7 +443,10 @@ void Native::Init_Contracts()
     wallet_.reset(Factory::Wallet(*this, zeromq_->Context()));
 }
 
-void Native::Init_Crypto() { crypto_.reset(new class Crypto(*this)); }
+void Native::Init_Crypto()
+{
+    crypto_.reset(new class Crypto(*this, *pool_));
+}
 
 void Native::Init_Dht()
 {
@@ -589,6 +628,7 @@ void Native::Init_Server()
         Config(),
         *storage_,
         *wallet_,
+        *pool_,
         running_,
         zmq_context_));
 
@@ -690,6 +730,15 @@ void Native::Init_Storage()
         String(config.path_),
         config.path_,
         notUsed);
+    std::int64_t objectCacheSize{0};
+    Config().CheckSet_long(
+        STORAGE_CONFIG_KEY,
+        STORAGE_CONFIG_OBJECT_CACHE_SIZE_KEY,
+        static_cast<std::int64_t>(config.object_cache_size_),
+        objectCacheSize,
+        notUsed);
+    config.object_cache_size_ =
+        static_cast<std::size_t>(std::max<std::int64_t>(objectCacheSize, 0));
 #if OT_STORAGE_FS
     Config().CheckSet_str(
         STORAGE_CONFIG_KEY,
@@ -823,7 +872,9 @@ void Native::Init_UI()
 
 void Native::Init_ZMQ()
 {
+    std::unique_lock<std::mutex> lock(config_lock_);
     auto& config = config_[""];
+    lock.unlock();
 
     OT_ASSERT(config);
 
@@ -958,6 +1009,8 @@ void Native::shutdown()
     zeromq_.reset();
     storage_.reset();
     crypto_.reset();
+    pool_.reset();
+    AccountRegistry::Cleanup();
     Log::Cleanup();
 
     for (auto& config : config_) { config.second.reset(); }
@@ -994,7 +1047,6 @@ void Native::start()
     OT_ASSERT(storage_);
 
     storage_->UpgradeNyms();
-    dynamic_cast<ContactManager&>(*contacts_).start();
     activity.MigrateLegacyThreads();
     Init_Periodic();
 
@@ -117,6 +117,8 @@ private:
     mutable std::mutex task_list_lock_;
     mutable std::mutex signal_handler_lock_;
     mutable TaskList periodic_task_list;
+    /** Shared by every subsystem which fans work out across threads */
+    std::unique_ptr<ThreadPool> pool_;
     std::unique_ptr<api::Activity> activity_;
     std::unique_ptr<api::Api> api_;
     std::unique_ptr<api::Blockchain> blockchain_;
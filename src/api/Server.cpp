@@ -78,6 +78,7 @@ Server::Server(
     const opentxs::api::Settings& config,
     const opentxs::api::storage::Storage& storage,
     const opentxs::api::client::Wallet& wallet,
+    const ThreadPool& pool,
     const Flag& running,
     const opentxs::network::zeromq::Context& context)
     : args_(args)
@@ -87,7 +88,13 @@ Server::Server(
     , wallet_(wallet)
     , running_(running)
     , zmq_context_(context)
-    , server_p_(new server::Server(crypto_, config_, *this, storage_, wallet_))
+    , server_p_(new server::Server(
+          crypto_,
+          config_,
+          *this,
+          storage_,
+          wallet_,
+          pool))
     , server_(*server_p_)
     , message_processor_p_(
           new server::MessageProcessor(server_, context, running_))
@@ -150,6 +150,7 @@ private:
         const api::Settings& config,
         const api::storage::Storage& storage,
         const api::client::Wallet& wallet,
+        const ThreadPool& pool,
         const Flag& running,
         const opentxs::network::zeromq::Context& context);
     Server() = delete;
@@ -0,0 +1,197 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "stdafx.hpp"
+
+#include "opentxs/core/util/Assert.hpp"
+#include "opentxs/core/util/OTFolders.hpp"
+#include "opentxs/core/util/OTPaths.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/OTStorage.hpp"
+#include "opentxs/core/String.hpp"
+
+#include "util/Journal.hpp"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ContextJournal.hpp"
+
+#define OT_CONTEXT_JOURNAL "contexts.journal"
+#define OT_CONTEXT_JOURNAL_MIN_COMPACT 256
+
+#define OT_METHOD "opentxs::api::client::implementation::ContextJournal::"
+
+namespace opentxs::api::client::implementation
+{
+ContextJournal::ContextJournal()
+    : lock_()
+    , journal_(nullptr)
+    , loaded_(false)
+    , pending_()
+{
+}
+
+void ContextJournal::Add(const ContextID& id, const proto::Context& serialized)
+{
+    Lock lock(lock_);
+    load(lock);
+    auto& entry = pending_[id];
+    entry = proto::ProtoAsString(serialized);
+    append(lock, "+\t" + id.first + "\t" + id.second + "\t" + entry);
+}
+
+void ContextJournal::append(const Lock& lock, const std::string& record)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    if (false == bool(journal_)) { return; }
+
+    // A failed append or compaction leaves every earlier record intact, and
+    // the in-memory state is still signed and stored by the wallet.
+    if (false == journal_->Append(record)) { return; }
+
+    if (journal_->ShouldCompact(pending_.size())) {
+        std::vector<std::string> records{};
+
+        for (const auto& [id, serialized] : pending_) {
+            records.emplace_back(
+                "+\t" + id.first + "\t" + id.second + "\t" + serialized);
+        }
+
+        journal_->Rewrite(records);
+    }
+}
+
+void ContextJournal::load(const Lock& lock)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    if (loaded_) { return; }
+
+    loaded_ = true;
+    std::string path{};
+    const auto found =
+        OTDB::FormPathString(path, OTFolders::Nym().Get(), OT_CONTEXT_JOURNAL);
+
+    if (0 > found) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Unable to construct path for context journal."
+              << std::endl;
+
+        return;
+    }
+
+    bool created{false};
+    OTPaths::BuildFilePath(String(path), created);
+    journal_.reset(new Journal(path, OT_CONTEXT_JOURNAL_MIN_COMPACT));
+
+    OT_ASSERT(journal_);
+
+    std::vector<std::string> records{};
+
+    if (false == journal_->Load(records)) { return; }
+
+    std::vector<std::string> fields{};
+
+    for (const auto& record : records) {
+        const bool add = (0 == record.compare(0, 2, "+\t"));
+        const bool remove = (0 == record.compare(0, 2, "-\t"));
+        const bool valid =
+            (add || remove) && Journal::Split(record, add ? 4 : 3, fields) &&
+            (false == fields.at(1).empty()) &&
+            (false == fields.at(2).empty()) &&
+            (remove || (false == fields.at(3).empty()));
+
+        if (false == valid) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Ignoring invalid record in " << path << std::endl;
+
+            continue;
+        }
+
+        const ContextID id{fields.at(1), fields.at(2)};
+
+        if (add) {
+            pending_[id] = fields.at(3);
+        } else {
+            pending_.erase(id);
+        }
+    }
+}
+
+bool ContextJournal::Pending(const ContextID& id, proto::Context& output)
+{
+    Lock lock(lock_);
+    load(lock);
+    const auto it = pending_.find(id);
+
+    if (pending_.end() == it) { return false; }
+
+    output.Clear();
+    const bool parsed = output.ParseFromString(it->second) &&
+                        (id.first == output.localnym()) &&
+                        (id.second == output.remotenym());
+
+    if (false == parsed) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Discarding unreadable journaled context." << std::endl;
+        pending_.erase(it);
+        append(lock, "-\t" + id.first + "\t" + id.second);
+
+        return false;
+    }
+
+    return true;
+}
+
+void ContextJournal::Remove(const ContextID& id)
+{
+    Lock lock(lock_);
+    load(lock);
+
+    if (0 == pending_.erase(id)) { return; }
+
+    append(lock, "-\t" + id.first + "\t" + id.second);
+}
+
+ContextJournal::~ContextJournal() {}
+}  // namespace opentxs::api::client::implementation
@@ -0,0 +1,94 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_API_CLIENT_IMPLEMENTATION_CONTEXTJOURNAL_HPP
+#define OPENTXS_API_CLIENT_IMPLEMENTATION_CONTEXTJOURNAL_HPP
+
+#include "Internal.hpp"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace opentxs::api::client::implementation
+{
+/** \brief Append-only record of contexts which have been modified in memory
+ *  but not yet signed and stored
+ *
+ *  The wallet signs contexts periodically instead of every time an editor is
+ *  released. Each release writes the unsigned state of the context here
+ *  first, so that no change is lost if the process stops before the next
+ *  signature. Records are kept in a Journal, so a record torn by a crash is
+ *  discarded rather than recovered.
+ */
+class ContextJournal
+{
+public:
+    using ContextID = std::pair<std::string, std::string>;
+
+    /** Records the latest unsigned state of a context */
+    void Add(const ContextID& id, const proto::Context& serialized);
+    /** Retrieves the unsigned state of a context whose last changes were
+     *  never stored. Records which can not be parsed are discarded. */
+    bool Pending(const ContextID& id, proto::Context& output);
+    /** Records that a context has been signed and stored */
+    void Remove(const ContextID& id);
+
+    ContextJournal();
+    ~ContextJournal();
+
+private:
+    std::mutex lock_;
+    std::unique_ptr<Journal> journal_;
+    bool loaded_{false};
+    // Serialized contexts
+    std::map<ContextID, std::string> pending_;
+
+    void append(const Lock& lock, const std::string& record);
+    void load(const Lock& lock);
+
+    ContextJournal(const ContextJournal&) = delete;
+    ContextJournal(ContextJournal&&) = delete;
+    ContextJournal& operator=(const ContextJournal&) = delete;
+    ContextJournal& operator=(ContextJournal&&) = delete;
+};
+}  // namespace opentxs::api::client::implementation
+#endif  // OPENTXS_API_CLIENT_IMPLEMENTATION_CONTEXTJOURNAL_HPP
@@ -58,13 +58,19 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/Message.hpp"
 #include "opentxs/core/Nym.hpp"
-#include "opentxs/core/UniqueQueue.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/Frame.hpp"
+#include "opentxs/network/zeromq/FrameIterator.hpp"
+#include "opentxs/network/zeromq/FrameSection.hpp"
+#include "opentxs/network/zeromq/ListenCallback.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/PublishSocket.hpp"
+#include "opentxs/network/zeromq/SubscribeSocket.hpp"
 
-#include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <set>
 #include <thread>
 #include <tuple>
@@ -76,8 +82,6 @@
 #define SHUTDOWN()                                                             \
     {                                                                          \
         if (!running_) { return; }                                             \
-                                                                               \
-        Log::Sleep(std::chrono::milliseconds(50));                             \
     }
 
 #define OT_METHOD "opentxs::api::client::implementation::Pair::"
@@ -100,14 +104,6 @@ api::client::Pair* Factory::Pair(
 
 namespace opentxs::api::client::implementation
 {
-Pair::Cleanup::Cleanup(Flag& run)
-    : run_(run)
-{
-    run_.On();
-}
-
-Pair::Cleanup::~Cleanup() { run_.Off(); }
-
 Pair::Pair(
     const Flag& running,
     const api::client::Sync& sync,
@@ -124,19 +120,35 @@ Pair::Pair(
     , exec_(exec)
     , zmq_(context)
     , status_lock_()
-    , pairing_(Flag::Factory(false))
-    , last_refresh_(0)
+    , update_lock_()
+    , update_signal_()
+    , shutdown_(false)
+    , pairing_pending_(false)
+    , peer_pending_(false)
+    , peer_pending_nyms_()
+    , processed_replies_()
+    , processed_requests_()
     , pairing_thread_(nullptr)
     , refresh_thread_(nullptr)
     , pair_status_()
-    , update_()
     , pair_event_(context.PublishSocket())
     , pending_bailment_(context.PublishSocket())
+    , peer_callback_(opentxs::network::zeromq::ListenCallback::Factory(
+          [this](const opentxs::network::zeromq::Message& message) -> void {
+              this->process_peer_update(message);
+          }))
+    , peer_reply_subscriber_(context.SubscribeSocket(peer_callback_.get()))
+    , peer_request_subscriber_(context.SubscribeSocket(peer_callback_.get()))
 {
-    refresh_thread_.reset(new std::thread(&Pair::check_refresh, this));
     pair_event_->Start(opentxs::network::zeromq::Socket::PairEventEndpoint);
     pending_bailment_->Start(
         opentxs::network::zeromq::Socket::PendingBailmentEndpoint);
+    peer_reply_subscriber_->Start(
+        opentxs::network::zeromq::Socket::PeerReplyUpdateEndpoint);
+    peer_request_subscriber_->Start(
+        opentxs::network::zeromq::Socket::PeerRequestUpdateEndpoint);
+    pairing_thread_.reset(new std::thread(&Pair::check_pairing, this));
+    refresh_thread_.reset(new std::thread(&Pair::check_refresh, this));
 }
 
 bool Pair::AddIssuer(
@@ -179,35 +191,51 @@ bool Pair::AddIssuer(
     return true;
 }
 
+// Runs the state machine for every issuer each time pairing is requested via
+// Update(), AddIssuer(), or a processed peer object. Sleeps otherwise.
 void Pair::check_pairing() const
 {
-    Cleanup cleanup(pairing_);
+    while (running_) {
+        Lock lock(update_lock_);
+        update_signal_.wait(
+            lock, [this]() -> bool { return shutdown_ || pairing_pending_; });
 
-    for (const auto& [nymID, issuerSet] : create_issuer_map()) {
-        SHUTDOWN()
+        if (shutdown_) { return; }
+
+        pairing_pending_ = false;
+        lock.unlock();
 
-        for (const auto& issuerID : issuerSet) {
+        for (const auto& [nymID, issuerSet] : create_issuer_map()) {
             SHUTDOWN()
 
-            state_machine(nymID, issuerID);
+            for (const auto& issuerID : issuerSet) {
+                SHUTDOWN()
+
+                state_machine(nymID, issuerID);
+            }
         }
     }
 }
 
+// Processes peer objects for the nyms named by wallet notifications, or for
+// every local nym after Update(). Sleeps otherwise.
 void Pair::check_refresh() const
 {
-    auto taskID = Identifier::Factory();
-    bool update{false};
-
     while (running_) {
-        const auto current = sync_.RefreshCount();
-        const auto previous = last_refresh_.exchange(current);
-
-        if (previous != current) { refresh(); }
-
-        if (update_.Pop(taskID, update)) { refresh(); }
-
-        Log::Sleep(std::chrono::milliseconds(100));
+        Lock lock(update_lock_);
+        update_signal_.wait(lock, [this]() -> bool {
+            return shutdown_ || peer_pending_ ||
+                   (false == peer_pending_nyms_.empty());
+        });
+
+        if (shutdown_) { return; }
+
+        const bool all = peer_pending_;
+        std::set<OTIdentifier> nyms{};
+        nyms.swap(peer_pending_nyms_);
+        peer_pending_ = false;
+        lock.unlock();
+        update_peer(all, nyms);
     }
 }
 
@@ -326,7 +354,7 @@ bool Pair::need_registration(
     return true;
 }
 
-void Pair::process_connection_info(
+bool Pair::process_connection_info(
     const Lock& lock,
     const Identifier& nymID,
     const proto::PeerReply& reply) const
@@ -345,11 +373,13 @@ void Pair::process_connection_info(
 
     if (added) {
         wallet_.PeerRequestComplete(nymID, replyID);
-        update_.Push(Identifier::Random(), true);
+        update_pairing();
     } else {
         otErr << OT_METHOD << __FUNCTION__ << ": Failed to add reply."
               << std::endl;
     }
+
+    return added;
 }
 
 void Pair::process_peer_replies(const Lock& lock, const Identifier& nymID) const
@@ -357,8 +387,16 @@ void Pair::process_peer_replies(const Lock& lock, const Identifier& nymID) const
     OT_ASSERT(verify_lock(lock, peer_lock_));
 
     auto replies = wallet_.PeerReplyIncoming(nymID);
+    auto& processed = processed_replies_[nymID.str()];
+    std::set<std::string> incoming{};
 
     for (const auto& it : replies) {
+        incoming.emplace(it.first);
+
+        // Peer objects are immutable, so each one only needs to be handled
+        // successfully once
+        if (0 < processed.count(it.first)) { continue; }
+
         const auto replyID = Identifier::Factory(it.first);
         const auto reply =
             wallet_.PeerReply(nymID, replyID, StorageBox::INCOMINGPEERREPLY);
@@ -371,36 +409,48 @@ void Pair::process_peer_replies(const Lock& lock, const Identifier& nymID) const
         }
 
         const auto& type = reply->type();
+        // Replies which fail to process are retried on the next refresh
+        bool done{true};
 
         switch (type) {
             case proto::PEERREQUEST_BAILMENT: {
                 otErr << OT_METHOD << __FUNCTION__
                       << ": Received bailment reply." << std::endl;
-                process_request_bailment(lock, nymID, *reply);
+                done = process_request_bailment(lock, nymID, *reply);
             } break;
             case proto::PEERREQUEST_OUTBAILMENT: {
                 otErr << OT_METHOD << __FUNCTION__
                       << ": Received outbailment reply." << std::endl;
-                process_request_outbailment(lock, nymID, *reply);
+                done = process_request_outbailment(lock, nymID, *reply);
             } break;
             case proto::PEERREQUEST_CONNECTIONINFO: {
                 otErr << OT_METHOD << __FUNCTION__
                       << ": Received connection info reply." << std::endl;
-                process_connection_info(lock, nymID, *reply);
+                done = process_connection_info(lock, nymID, *reply);
             } break;
             case proto::PEERREQUEST_STORESECRET: {
                 otErr << OT_METHOD << __FUNCTION__
                       << ": Received store secret reply." << std::endl;
-                process_store_secret(lock, nymID, *reply);
+                done = process_store_secret(lock, nymID, *reply);
             } break;
             case proto::PEERREQUEST_ERROR:
             case proto::PEERREQUEST_PENDINGBAILMENT:
             case proto::PEERREQUEST_VERIFICATIONOFFER:
             case proto::PEERREQUEST_FAUCET:
             default: {
-                continue;
             }
         }
+
+        if (done) { processed.emplace(it.first); }
+    }
+
+    // Forget replies which have left the incoming box
+    for (auto it = processed.begin(); it != processed.end();) {
+        if (0 == incoming.count(*it)) {
+            it = processed.erase(it);
+        } else {
+            ++it;
+        }
     }
 }
 
@@ -410,8 +460,14 @@ void Pair::process_peer_requests(const Lock& lock, const Identifier& nymID)
     OT_ASSERT(verify_lock(lock, peer_lock_));
 
     const auto requests = wallet_.PeerRequestIncoming(nymID);
+    auto& processed = processed_requests_[nymID.str()];
+    std::set<std::string> incoming{};
 
     for (const auto& it : requests) {
+        incoming.emplace(it.first);
+
+        if (0 < processed.count(it.first)) { continue; }
+
         const auto requestID = Identifier::Factory(it.first);
         std::time_t time{};
         const auto request = wallet_.PeerRequest(
@@ -425,13 +481,15 @@ void Pair::process_peer_requests(const Lock& lock, const Identifier& nymID)
         }
 
         const auto& type = request->type();
+        // Requests which fail to process are retried on the next refresh
+        bool done{true};
 
         switch (type) {
             case proto::PEERREQUEST_PENDINGBAILMENT: {
                 otErr << OT_METHOD << __FUNCTION__
                       << ": Received pending bailment notification."
                       << std::endl;
-                process_pending_bailment(lock, nymID, *request);
+                done = process_pending_bailment(lock, nymID, *request);
             } break;
             case proto::PEERREQUEST_ERROR:
             case proto::PEERREQUEST_BAILMENT:
@@ -441,14 +499,43 @@ void Pair::process_peer_requests(const Lock& lock, const Identifier& nymID)
             case proto::PEERREQUEST_VERIFICATIONOFFER:
             case proto::PEERREQUEST_FAUCET:
             default: {
-
-                continue;
             }
         }
+
+        if (done) { processed.emplace(it.first); }
+    }
+
+    // Forget requests which have left the incoming box
+    for (auto it = processed.begin(); it != processed.end();) {
+        if (0 == incoming.count(*it)) {
+            it = processed.erase(it);
+        } else {
+            ++it;
+        }
     }
 }
 
-void Pair::process_pending_bailment(
+void Pair::process_peer_update(
+    const opentxs::network::zeromq::Message& message) const
+{
+    if (1 != message.Body().size()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Invalid message" << std::endl;
+
+        return;
+    }
+
+    const std::string id(*message.Body().begin());
+    const auto nymID = Identifier::Factory(id);
+
+    if (nymID->empty()) { return; }
+
+    Lock lock(update_lock_);
+    peer_pending_nyms_.emplace(nymID);
+    lock.unlock();
+    update_signal_.notify_all();
+}
+
+bool Pair::process_pending_bailment(
     const Lock& lock,
     const Identifier& nymID,
     const proto::PeerRequest& request) const
@@ -464,6 +551,29 @@ void Pair::process_pending_bailment(
     auto& issuer = editor.It();
     const auto added =
         issuer.AddRequest(proto::PEERREQUEST_PENDINGBAILMENT, requestID);
+    // A previous attempt may have recorded the notice but failed to
+    // acknowledge it
+    bool unacknowledged{added};
+
+    if (false == added) {
+        const auto pending = issuer.GetRequests(
+            proto::PEERREQUEST_PENDINGBAILMENT,
+            api::client::Issuer::RequestStatus::Requested);
+
+        for (const auto& [id, reply, used] : pending) {
+            const auto& notUsed[[maybe_unused]] = reply;
+            const auto& isUsed[[maybe_unused]] = used;
+
+            if (id == requestID) { unacknowledged = true; }
+        }
+    }
+
+    if (false == unacknowledged) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to add request."
+              << std::endl;
+
+        return false;
+    }
 
     if (added) {
         pending_bailment_->Publish(proto::ProtoAsString(request));
@@ -475,26 +585,24 @@ void Pair::process_pending_bailment(
             otErr << OT_METHOD << __FUNCTION__
                   << ": Failed to set request as used on issuer." << std::endl;
         }
+    }
 
-        auto action = action_.AcknowledgeNotice(
-            nymID, serverID, issuerNymID, requestID, true);
-        action->Run();
+    auto action = action_.AcknowledgeNotice(
+        nymID, serverID, issuerNymID, requestID, true);
+    action->Run();
 
-        if (SendResult::VALID_REPLY == action->LastSendResult()) {
-            OT_ASSERT(action->SentPeerReply())
+    if (SendResult::VALID_REPLY != action->LastSendResult()) { return false; }
 
-            const auto replyID(action->SentPeerReply()->ID());
-            issuer.AddReply(
-                proto::PEERREQUEST_PENDINGBAILMENT, requestID, replyID);
-            update_.Push(Identifier::Random(), true);
-        }
-    } else {
-        otErr << OT_METHOD << __FUNCTION__ << ": Failed to add request."
-              << std::endl;
-    }
+    OT_ASSERT(action->SentPeerReply())
+
+    const auto replyID(action->SentPeerReply()->ID());
+    issuer.AddReply(proto::PEERREQUEST_PENDINGBAILMENT, requestID, replyID);
+    update_pairing();
+
+    return true;
 }
 
-void Pair::process_request_bailment(
+bool Pair::process_request_bailment(
     const Lock& lock,
     const Identifier& nymID,
     const proto::PeerReply& reply) const
@@ -513,14 +621,16 @@ void Pair::process_request_bailment(
 
     if (added) {
         wallet_.PeerRequestComplete(nymID, replyID);
-        update_.Push(Identifier::Random(), true);
+        update_pairing();
     } else {
         otErr << OT_METHOD << __FUNCTION__ << ": Failed to add reply."
               << std::endl;
     }
+
+    return added;
 }
 
-void Pair::process_request_outbailment(
+bool Pair::process_request_outbailment(
     const Lock& lock,
     const Identifier& nymID,
     const proto::PeerReply& reply) const
@@ -539,14 +649,16 @@ void Pair::process_request_outbailment(
 
     if (added) {
         wallet_.PeerRequestComplete(nymID, replyID);
-        update_.Push(Identifier::Random(), true);
+        update_pairing();
     } else {
         otErr << OT_METHOD << __FUNCTION__ << ": Failed to add reply."
               << std::endl;
     }
+
+    return added;
 }
 
-void Pair::process_store_secret(
+bool Pair::process_store_secret(
     const Lock& lock,
     const Identifier& nymID,
     const proto::PeerReply& reply) const
@@ -565,7 +677,7 @@ void Pair::process_store_secret(
 
     if (added) {
         wallet_.PeerRequestComplete(nymID, replyID);
-        update_.Push(Identifier::Random(), true);
+        update_pairing();
         proto::PairEvent event;
         event.set_version(1);
         event.set_type(proto::PAIREVENT_STORESECRET);
@@ -585,6 +697,8 @@ void Pair::process_store_secret(
         otErr << OT_METHOD << __FUNCTION__ << ": Failed to add reply."
               << std::endl;
     }
+
+    return added;
 }
 
 void Pair::queue_nym_download(
@@ -619,12 +733,6 @@ void Pair::queue_unit_definition(
     sync_.ScheduleDownloadContract(nymID, serverID, unitID);
 }
 
-void Pair::refresh() const
-{
-    update_pairing();
-    update_peer();
-}
-
 std::pair<bool, OTIdentifier> Pair::register_account(
     const Identifier& nymID,
     const Identifier& serverID,
@@ -920,28 +1028,33 @@ std::pair<bool, Identifier> Pair::store_secret(
     return output;
 }
 
-void Pair::Update() const { update_.Push(Identifier::Random(), true); }
+void Pair::Update() const
+{
+    Lock lock(update_lock_);
+    pairing_pending_ = true;
+    peer_pending_ = true;
+    lock.unlock();
+    update_signal_.notify_all();
+}
 
 void Pair::update_pairing() const
 {
-    const auto pairing = pairing_->Set(true);
-
-    if (false == pairing) {
-        if (pairing_thread_) {
-            pairing_thread_->join();
-            pairing_thread_.reset();
-        }
-
-        pairing_thread_.reset(new std::thread(&Pair::check_pairing, this));
-    }
+    Lock lock(update_lock_);
+    pairing_pending_ = true;
+    lock.unlock();
+    update_signal_.notify_all();
 }
 
-void Pair::update_peer() const
+void Pair::update_peer(const bool all, const std::set<OTIdentifier>& nyms)
+    const
 {
     Lock lock(peer_lock_);
 
-    for (const auto& [nymID, issuerSet] : create_issuer_map()) {
-        const auto& notUsed[[maybe_unused]] = issuerSet;
+    for (const auto& nymID : (all ? ot_api_.LocalNymList() : nyms)) {
+        SHUTDOWN()
+
+        if (false == wallet_.IsLocalNym(nymID->str())) { continue; }
+
         process_peer_replies(lock, nymID);
         process_peer_requests(lock, nymID);
     }
@@ -949,7 +1062,10 @@ void Pair::update_peer() const
 
 Pair::~Pair()
 {
-    if (pairing_.get()) { Log::Sleep(std::chrono::milliseconds(250)); }
+    Lock lock(update_lock_);
+    shutdown_ = true;
+    lock.unlock();
+    update_signal_.notify_all();
 
     if (refresh_thread_) {
         refresh_thread_->join();
@@ -63,17 +63,6 @@ public:
     friend class opentxs::api::client::Pair;
 
 private:
-    class Cleanup
-    {
-    private:
-        Flag& run_;
-        Cleanup() = delete;
-
-    public:
-        Cleanup(Flag& run);
-        ~Cleanup();
-    };
-
     enum class Status : std::uint8_t {
         Error = 0,
         Started = 1,
@@ -93,14 +82,23 @@ private:
     const opentxs::network::zeromq::Context& zmq_;
     mutable std::mutex peer_lock_{};
     mutable std::mutex status_lock_{};
-    mutable OTFlag pairing_;
-    mutable std::atomic<std::uint64_t> last_refresh_{0};
-    mutable std::unique_ptr<std::thread> pairing_thread_{nullptr};
-    mutable std::unique_ptr<std::thread> refresh_thread_{nullptr};
+    mutable std::mutex update_lock_{};
+    mutable std::condition_variable update_signal_{};
+    mutable bool shutdown_{false};
+    mutable bool pairing_pending_{false};
+    mutable bool peer_pending_{false};
+    mutable std::set<OTIdentifier> peer_pending_nyms_{};
+    /// local nym id, ids of the peer replies or requests already processed
+    mutable std::map<std::string, std::set<std::string>> processed_replies_{};
+    mutable std::map<std::string, std::set<std::string>> processed_requests_{};
+    std::unique_ptr<std::thread> pairing_thread_{nullptr};
+    std::unique_ptr<std::thread> refresh_thread_{nullptr};
     mutable std::map<IssuerID, std::pair<Status, bool>> pair_status_{};
-    mutable UniqueQueue<bool> update_;
     OTZMQPublishSocket pair_event_;
     OTZMQPublishSocket pending_bailment_;
+    OTZMQListenCallback peer_callback_;
+    OTZMQSubscribeSocket peer_reply_subscriber_;
+    OTZMQSubscribeSocket peer_request_subscriber_;
 
     void check_pairing() const;
     void check_refresh() const;
@@ -115,25 +113,27 @@ private:
         const Identifier& serverID,
         const Identifier& issuerID,
         const Identifier& unitID) const;
-    void process_connection_info(
+    bool process_connection_info(
         const Lock& lock,
         const Identifier& nymID,
         const proto::PeerReply& reply) const;
     void process_peer_replies(const Lock& lock, const Identifier& nymID) const;
     void process_peer_requests(const Lock& lock, const Identifier& nymID) const;
-    void process_pending_bailment(
+    void process_peer_update(
+        const opentxs::network::zeromq::Message& message) const;
+    bool process_pending_bailment(
         const Lock& lock,
         const Identifier& nymID,
         const proto::PeerRequest& request) const;
-    void process_request_bailment(
+    bool process_request_bailment(
         const Lock& lock,
         const Identifier& nymID,
         const proto::PeerReply& reply) const;
-    void process_request_outbailment(
+    bool process_request_outbailment(
         const Lock& lock,
         const Identifier& nymID,
         const proto::PeerReply& reply) const;
-    void process_store_secret(
+    bool process_store_secret(
         const Lock& lock,
         const Identifier& nymID,
         const proto::PeerReply& reply) const;
@@ -151,7 +151,6 @@ private:
         const Identifier& nymID,
         const Identifier& serverID,
         const Identifier& unitID) const;
-    void refresh() const;
     std::pair<bool, OTIdentifier> register_account(
         const Identifier& nymID,
         const Identifier& serverID,
@@ -167,7 +166,8 @@ private:
         const Identifier& issuerNymID,
         const Identifier& serverID) const;
     void update_pairing() const;
-    void update_peer() const;
+    void update_peer(const bool all, const std::set<OTIdentifier>& nyms)
+        const;
 
     Pair(
         const Flag& running,
@@ -75,12 +75,16 @@
 #include "Exclusive.tpp"
 #include "Shared.tpp"
 
+#include <chrono>
 #include <functional>
 #include <map>
 #include <mutex>
+#include <set>
 #include <shared_mutex>
 #include <stdexcept>
+#include <thread>
 #include <tuple>
+#include <vector>
 
 #include "Wallet.hpp"
 
@@ -88,6 +92,9 @@ template class opentxs::Exclusive<opentxs::Account>;
 template class opentxs::Shared<opentxs::Account>;
 
 #define OT_METHOD "opentxs::api::client::implementation::Wallet::"
+#define OT_WALLET_CACHE_SHARDS 32
+// Modified contexts are signed and stored at most this often, in milliseconds
+#define OT_CONTEXT_FLUSH_INTERVAL 1000
 
 namespace opentxs
 {
@@ -127,16 +134,12 @@ const std::map<std::string, proto::ContactItemType> Wallet::unit_of_account_{
 Wallet::Wallet(const Native& ot, const opentxs::network::zeromq::Context& zmq)
     : ot_(ot)
     , account_map_()
-    , nym_map_()
-    , server_map_()
-    , unit_map_()
-    , context_map_()
+    , nym_map_(OT_WALLET_CACHE_SHARDS)
+    , server_map_(OT_WALLET_CACHE_SHARDS)
+    , unit_map_(OT_WALLET_CACHE_SHARDS)
+    , context_map_(OT_WALLET_CACHE_SHARDS)
     , issuer_map_()
     , account_map_lock_()
-    , nym_map_lock_()
-    , server_map_lock_()
-    , unit_map_lock_()
-    , context_map_lock_()
     , issuer_map_lock_()
     , peer_map_lock_()
     , peer_lock_()
@@ -144,11 +147,24 @@ Wallet::Wallet(const Native& ot, const opentxs::network::zeromq::Context& zmq)
     , nymfile_lock_()
     , nym_publisher_(zmq.PublishSocket())
     , account_publisher_(zmq.PublishSocket())
+    , peer_reply_publisher_(zmq.PublishSocket())
+    , peer_request_publisher_(zmq.PublishSocket())
+    , context_journal_()
+    , dirty_context_lock_()
+    , dirty_context_signal_()
+    , dirty_contexts_()
+    , shutdown_(false)
+    , context_flusher_()
 {
     nym_publisher_->Start(
         opentxs::network::zeromq::Socket::NymDownloadEndpoint);
     account_publisher_->Start(
         opentxs::network::zeromq::Socket::AccountUpdateEndpoint);
+    peer_reply_publisher_->Start(
+        opentxs::network::zeromq::Socket::PeerReplyUpdateEndpoint);
+    peer_request_publisher_->Start(
+        opentxs::network::zeromq::Socket::PeerRequestUpdateEndpoint);
+    context_flusher_ = std::thread(&Wallet::flush_contexts_thread, this);
 }
 
 Wallet::AccountLock& Wallet::account(
@@ -622,17 +638,26 @@ std::shared_ptr<class Context> Wallet::context(
     const std::string local = localNymID.str();
     const std::string remote = remoteNymID.str();
     const ContextID context = {local, remote};
-    auto it = context_map_.find(context);
-    const bool inMap = (it != context_map_.end());
+    std::shared_ptr<class Context> entry{nullptr};
 
-    if (inMap) { return it->second; }
+    if (context_map_.Get(context, entry)) { return entry; }
 
-    // Load from storage, if it exists.
+    // Changes which were journaled but never signed take precedence over the
+    // last stored version. The journal only returns records which passed
+    // their checksum and parsed as a context for this pair of nyms.
     std::shared_ptr<proto::Context> serialized;
-    const bool loaded =
-        ot_.DB().Load(localNymID.str(), remoteNymID.str(), serialized, true);
+    proto::Context journaled{};
+    const bool recovered = context_journal_.Pending(context, journaled);
+
+    if (recovered) {
+        serialized = std::make_shared<proto::Context>(journaled);
+    } else {
+        // Load from storage, if it exists.
+        const bool loaded = ot_.DB().Load(
+            localNymID.str(), remoteNymID.str(), serialized, true);
 
-    if (!loaded) { return nullptr; }
+        if (!loaded) { return nullptr; }
+    }
 
     if (local != serialized->localnym()) {
         otErr << OT_METHOD << __FUNCTION__ << ": Incorrect localnym in protobuf"
@@ -648,8 +673,6 @@ std::shared_ptr<class Context> Wallet::context(
         return nullptr;
     }
 
-    auto& entry = context_map_[context];
-
     // Obtain nyms.
     const auto localNym = Nym(localNymID);
     const auto remoteNym = Nym(remoteNymID);
@@ -698,11 +721,11 @@ std::shared_ptr<class Context> Wallet::context(
 
     OT_ASSERT(entry);
 
+    if (recovered) { store_context(context, *entry); }
+
     const bool valid = entry->Validate();
 
     if (!valid) {
-        context_map_.erase(context);
-
         otErr << OT_METHOD << __FUNCTION__ << ": invalid signature on context."
               << std::endl;
 
@@ -711,7 +734,8 @@ std::shared_ptr<class Context> Wallet::context(
         return nullptr;
     }
 
-    return entry;
+    // If another thread loaded the same context first, use its instance
+    return context_map_.Add(context, entry);
 }
 
 std::shared_ptr<const class Context> Wallet::Context(
@@ -791,7 +815,6 @@ Editor<class ClientContext> Wallet::mutable_ClientContext(
 
     const auto& serverID = ot_.Server().ID();
     const auto& serverNymID = ot_.Server().NymID();
-    Lock lock(context_map_lock_);
     auto base = context(serverNymID, remoteNymID);
     std::function<void(class Context*)> callback =
         [&](class Context* in) -> void { this->save(in); };
@@ -810,10 +833,9 @@ Editor<class ClientContext> Wallet::mutable_ClientContext(
 
         // Create a new Context
         const ContextID contextID = {serverNymID.str(), remoteNymID.str()};
-        auto& entry = context_map_[contextID];
-        entry.reset(new class ClientContext(
+        std::shared_ptr<class Context> entry(new class ClientContext(
             local, remote, serverID, nymfile_lock(remoteNymID)));
-        base = entry;
+        base = context_map_.Add(contextID, entry);
     }
 
     OT_ASSERT(base);
@@ -829,8 +851,6 @@ Editor<class ServerContext> Wallet::mutable_ServerContext(
     const Identifier& localNymID,
     const Identifier& remoteID) const
 {
-    Lock lock(context_map_lock_);
-
     auto serverID = Identifier::Factory(remoteID);
     auto remoteNymID = Identifier::Factory(ServerToNym(serverID));
 
@@ -853,16 +873,15 @@ Editor<class ServerContext> Wallet::mutable_ServerContext(
 
         // Create a new Context
         const ContextID contextID = {localNymID.str(), remoteNymID->str()};
-        auto& entry = context_map_[contextID];
         auto& zmq = ot_.ZMQ();
         auto& connection = zmq.Server(serverID->str());
-        entry.reset(new class ServerContext(
+        std::shared_ptr<class Context> entry(new class ServerContext(
             localNym,
             remoteNym,
             serverID,
             connection,
             nymfile_lock(localNymID)));
-        base = entry;
+        base = context_map_.Add(contextID, entry);
     }
 
     OT_ASSERT(base);
@@ -874,6 +893,37 @@ Editor<class ServerContext> Wallet::mutable_ServerContext(
     return Editor<class ServerContext>(child, callback);
 }
 
+void Wallet::flush_contexts() const
+{
+    std::set<ContextID> dirty{};
+    Lock lock(dirty_context_lock_);
+    dirty.swap(dirty_contexts_);
+    lock.unlock();
+
+    for (const auto& id : dirty) {
+        std::shared_ptr<class Context> context{nullptr};
+
+        if (false == context_map_.Get(id, context)) { continue; }
+
+        OT_ASSERT(context);
+
+        store_context(id, *context);
+    }
+}
+
+void Wallet::flush_contexts_thread()
+{
+    while (false == shutdown_.load()) {
+        Lock lock(dirty_context_lock_);
+        dirty_context_signal_.wait_for(
+            lock, std::chrono::milliseconds(OT_CONTEXT_FLUSH_INTERVAL), [&] {
+                return shutdown_.load();
+            });
+        lock.unlock();
+        flush_contexts();
+    }
+}
+
 bool Wallet::ImportAccount(std::unique_ptr<opentxs::Account>& imported) const
 {
     if (false == bool(imported)) {
@@ -1128,53 +1178,61 @@ ConstNym Wallet::Nym(
     const std::chrono::milliseconds& timeout) const
 {
     const std::string nym = id.str();
-    Lock mapLock(nym_map_lock_);
-    bool inMap = (nym_map_.find(nym) != nym_map_.end());
-    bool valid = false;
+    std::shared_ptr<class Nym> pNym{nullptr};
+    nym_map_.Read(
+        nym, [&](const NymLock& entry) -> void { pNym = entry.second; });
 
-    if (!inMap) {
-        std::shared_ptr<proto::CredentialIndex> serialized;
+    if (pNym) {
+        if (pNym->VerifyPseudonym()) { return pNym; }
 
-        std::string alias;
-        bool loaded = ot_.DB().Load(nym, serialized, alias, true);
+        return nullptr;
+    }
 
-        if (loaded) {
-            auto& pNym = nym_map_[nym].second;
-            pNym.reset(new class Nym(*this, id));
+    std::shared_ptr<proto::CredentialIndex> serialized;
+    std::string alias;
+    const bool loaded = ot_.DB().Load(nym, serialized, alias, true);
 
-            if (pNym) {
-                if (pNym->LoadCredentialIndex(*serialized)) {
-                    valid = pNym->VerifyPseudonym();
-                    pNym->alias_ = alias;
-                }
-            }
-        } else {
-            ot_.DHT().GetPublicNym(nym);
+    if (loaded) {
+        pNym.reset(new class Nym(*this, id));
 
-            if (timeout > std::chrono::milliseconds(0)) {
-                mapLock.unlock();
-                auto start = std::chrono::high_resolution_clock::now();
-                auto end = start + timeout;
-                const auto interval = std::chrono::milliseconds(100);
+        OT_ASSERT(pNym);
 
-                while (std::chrono::high_resolution_clock::now() < end) {
-                    std::this_thread::sleep_for(interval);
-                    mapLock.lock();
-                    bool found = (nym_map_.find(nym) != nym_map_.end());
-                    mapLock.unlock();
+        bool valid = false;
 
-                    if (found) { break; }
-                }
+        if (pNym->LoadCredentialIndex(*serialized)) {
+            valid = pNym->VerifyPseudonym();
+            pNym->alias_ = alias;
+        }
+
+        if (false == valid) { return nullptr; }
 
-                return Nym(id);  // timeout of zero prevents infinite recursion
+        // If another thread loaded the same nym first, use its instance
+        nym_map_.Modify(nym, [&](NymLock& entry) -> void {
+            if (entry.second) {
+                pNym = entry.second;
+            } else {
+                entry.second = pNym;
             }
-        }
-    } else {
-        auto& pNym = nym_map_[nym].second;
-        if (pNym) { valid = pNym->VerifyPseudonym(); }
+        });
+
+        return pNym;
     }
 
-    if (valid) { return nym_map_[nym].second; }
+    ot_.DHT().GetPublicNym(nym);
+
+    if (timeout > std::chrono::milliseconds(0)) {
+        auto start = std::chrono::high_resolution_clock::now();
+        auto end = start + timeout;
+        const auto interval = std::chrono::milliseconds(100);
+
+        while (std::chrono::high_resolution_clock::now() < end) {
+            std::this_thread::sleep_for(interval);
+
+            if (nym_map_.Contains(nym)) { break; }
+        }
+
+        return Nym(id);  // timeout of zero prevents infinite recursion
+    }
 
     return nullptr;
 }
@@ -1200,10 +1258,12 @@ ConstNym Wallet::Nym(const proto::CredentialIndex& publicNym) const
                 SaveCredentialIDs(*candidate);
                 nym_publisher_->Publish(id);
 
-                Lock mapLock(nym_map_lock_);
-                auto& pMapNym = nym_map_[id].second;
-                pMapNym.reset(candidate);
-                return ConstNym(pMapNym);
+                std::shared_ptr<class Nym> output(candidate);
+                nym_map_.Modify(id, [&](NymLock& entry) -> void {
+                    entry.second = output;
+                });
+
+                return output;
             }
         }
         constNym.reset(candidate);
@@ -1234,11 +1294,13 @@ ConstNym Wallet::Nym(
 
         SaveCredentialIDs(*pNym);
 
-        Lock mapLock(nym_map_lock_);
-        auto& pMapNym = nym_map_[pNym->ID().str()].second;
-        pMapNym.reset(pNym.release());
+        const auto id = pNym->ID().str();
+        std::shared_ptr<class Nym> output(pNym.release());
+        nym_map_.Modify(id, [&](NymLock& entry) -> void {
+            entry.second = output;
+        });
 
-        return ConstNym(pMapNym);
+        return output;
     } else {
         return nullptr;
     }
@@ -1254,17 +1316,25 @@ NymData Wallet::mutable_Nym(const Identifier& id) const
               << std::endl;
     }
 
-    Lock mapLock(nym_map_lock_);
-    auto it = nym_map_.find(nym);
+    if (false == nym_map_.Contains(nym)) { OT_FAIL }
 
-    if (nym_map_.end() == it) { OT_FAIL }
+    // Entries are never removed from nym_map_, so the per-nym mutex outlives
+    // the editor
+    std::mutex* mutex{nullptr};
+    std::shared_ptr<class Nym> pNym{nullptr};
+    nym_map_.Modify(nym, [&](NymLock& entry) -> void {
+        mutex = &entry.first;
+        pNym = entry.second;
+    });
+
+    OT_ASSERT(nullptr != mutex);
 
     std::function<void(NymData*, Lock&)> callback = [&](NymData* nymData,
                                                         Lock& lock) -> void {
         this->save(nymData, lock);
     };
 
-    return NymData(it->second.first, it->second.second, callback);
+    return NymData(*mutex, pNym, callback);
 }
 
 std::unique_ptr<const class NymFile> Wallet::Nymfile(
@@ -1312,28 +1382,42 @@ std::mutex& Wallet::nymfile_lock(const Identifier& nymID) const
 
 ConstNym Wallet::NymByIDPartialMatch(const std::string& partialId) const
 {
-    Lock mapLock(nym_map_lock_);
-    bool inMap = (nym_map_.find(partialId) != nym_map_.end());
-    bool valid = false;
+    std::shared_ptr<class Nym> exact{nullptr};
+    const bool inMap = nym_map_.Read(
+        partialId, [&](const NymLock& entry) -> void { exact = entry.second; });
 
-    if (!inMap) {
-        for (auto& it : nym_map_) {
-            if (it.first.compare(0, partialId.length(), partialId) == 0)
-                if (it.second.second->VerifyPseudonym())
-                    return it.second.second;
-        }
-        for (auto& it : nym_map_) {
-            if (it.second.second->Alias().compare(
-                    0, partialId.length(), partialId) == 0)
-                if (it.second.second->VerifyPseudonym())
-                    return it.second.second;
-        }
-    } else {
-        auto& pNym = nym_map_[partialId].second;
-        if (pNym) { valid = pNym->VerifyPseudonym(); }
+    if (inMap) {
+        if (exact && exact->VerifyPseudonym()) { return exact; }
+
+        return nullptr;
     }
 
-    if (valid) { return nym_map_[partialId].second; }
+    std::vector<std::shared_ptr<class Nym>> idMatches{};
+    std::vector<std::shared_ptr<class Nym>> aliasMatches{};
+    nym_map_.ForEach(
+        [&](const std::string& id, const NymLock& entry) -> void {
+            const auto& pNym = entry.second;
+
+            if (false == bool(pNym)) { return; }
+
+            if (0 == id.compare(0, partialId.length(), partialId)) {
+                idMatches.emplace_back(pNym);
+            }
+
+            if (0 ==
+                pNym->Alias().compare(0, partialId.length(), partialId)) {
+                aliasMatches.emplace_back(pNym);
+            }
+        });
+
+    // Verification happens after the map has been released
+    for (const auto& pNym : idMatches) {
+        if (pNym->VerifyPseudonym()) { return pNym; }
+    }
+
+    for (const auto& pNym : aliasMatches) {
+        if (pNym->VerifyPseudonym()) { return pNym; }
+    }
 
     return nullptr;
 }
@@ -1620,6 +1704,8 @@ bool Wallet::PeerReplyReceive(const Identifier& nym, const PeerObject& reply)
         return false;
     }
 
+    peer_reply_publisher_->Publish(nymID);
+
     const bool finishedRequest =
         ot_.DB().Store(*request, nymID, StorageBox::FINISHEDPEERREQUEST);
 
@@ -1789,9 +1875,12 @@ bool Wallet::PeerRequestReceive(
 
     const std::string nymID = nym.str();
     Lock lock(peer_lock(nymID));
-
-    return ot_.DB().Store(
+    const bool received = ot_.DB().Store(
         request.Request()->Contract(), nymID, StorageBox::INCOMINGPEERREQUEST);
+
+    if (received) { peer_request_publisher_->Publish(nymID); }
+
+    return received;
 }
 
 bool Wallet::PeerRequestUpdate(
@@ -1815,8 +1904,7 @@ bool Wallet::PeerRequestUpdate(
 bool Wallet::RemoveServer(const Identifier& id) const
 {
     std::string server(id.str());
-    Lock mapLock(server_map_lock_);
-    auto deleted = server_map_.erase(server);
+    auto deleted = server_map_.Erase(server);
 
     if (0 != deleted) { return ot_.DB().RemoveServer(server); }
 
@@ -1826,8 +1914,7 @@ bool Wallet::RemoveServer(const Identifier& id) const
 bool Wallet::RemoveUnitDefinition(const Identifier& id) const
 {
     std::string unit(id.str());
-    Lock mapLock(unit_map_lock_);
-    auto deleted = unit_map_.erase(unit);
+    auto deleted = unit_map_.Erase(unit);
 
     if (0 != deleted) { return ot_.DB().RemoveUnitDefinition(unit); }
 
@@ -1905,12 +1992,14 @@ void Wallet::save(class Context* context) const
     if (nullptr == context) { return; }
 
     Lock lock(context->lock_);
-
-    context->update_signature(lock);
-
-    OT_ASSERT(context->validate(lock));
-
-    ot_.DB().Store(context->contract(lock));
+    const auto serialized = context->SigVersion(lock);
+    const ContextID id{serialized.localnym(), serialized.remotenym()};
+    context_journal_.Add(id, serialized);
+    lock.unlock();
+    Lock dirtyLock(dirty_context_lock_);
+    dirty_contexts_.insert(id);
+    dirtyLock.unlock();
+    dirty_context_signal_.notify_all();
 }
 
 void Wallet::save(const Lock& lock, api::client::Issuer* in) const
@@ -1966,10 +2055,11 @@ bool Wallet::SaveCredentialIDs(const class Nym& nym) const
 
 bool Wallet::SetNymAlias(const Identifier& id, const std::string& alias) const
 {
-    Lock mapLock(nym_map_lock_);
-    auto& nym = nym_map_[id.str()].second;
+    std::shared_ptr<class Nym> nym{nullptr};
+    nym_map_.Read(
+        id.str(), [&](const NymLock& entry) -> void { nym = entry.second; });
 
-    nym->SetAlias(alias);
+    if (nym) { nym->SetAlias(alias); }
 
     return ot_.DB().SetNymAlias(id.str(), alias);
 }
@@ -1981,66 +2071,80 @@ std::shared_ptr<const class Nym> Wallet::signer_nym(const Identifier& id) const
     return Nym(id);
 }
 
+bool Wallet::store_context(const ContextID& id, class Context& context) const
+{
+    Lock lock(context.lock_);
+    context.update_signature(lock);
+
+    OT_ASSERT(context.validate(lock));
+
+    if (false == ot_.DB().Store(context.contract(lock))) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to store context."
+              << std::endl;
+
+        return false;
+    }
+
+    // The context lock is still held so that a newer journal entry for this
+    // context can not be removed by mistake.
+    context_journal_.Remove(id);
+
+    return true;
+}
+
 ConstServerContract Wallet::Server(
     const Identifier& id,
     const std::chrono::milliseconds& timeout) const
 {
     const std::string server = id.str();
-    Lock mapLock(server_map_lock_);
-    bool inMap = (server_map_.find(server) != server_map_.end());
-    bool valid = false;
+    std::shared_ptr<class ServerContract> pServer{nullptr};
 
-    if (!inMap) {
-        std::shared_ptr<proto::ServerContract> serialized;
+    if (server_map_.Get(server, pServer) && pServer) {
+        if (pServer->Validate()) { return pServer; }
 
-        std::string alias;
-        bool loaded = ot_.DB().Load(server, serialized, alias, true);
+        return nullptr;
+    }
 
-        if (loaded) {
-            auto nym = Nym(Identifier::Factory(serialized->nymid()));
+    std::shared_ptr<proto::ServerContract> serialized;
+    std::string alias;
+    const bool loaded = ot_.DB().Load(server, serialized, alias, true);
 
-            if (!nym && serialized->has_publicnym()) {
-                nym = Nym(serialized->publicnym());
-            }
+    if (loaded) {
+        auto nym = Nym(Identifier::Factory(serialized->nymid()));
 
-            if (nym) {
-                auto& pServer = server_map_[server];
-                pServer.reset(ServerContract::Factory(nym, *serialized));
+        if (!nym && serialized->has_publicnym()) {
+            nym = Nym(serialized->publicnym());
+        }
 
-                if (pServer) {
-                    valid = true;  // Factory() performs validation
-                    pServer->Signable::SetAlias(alias);
-                }
-            }
-        } else {
-            ot_.DHT().GetServerContract(server);
-
-            if (timeout > std::chrono::milliseconds(0)) {
-                mapLock.unlock();
-                auto start = std::chrono::high_resolution_clock::now();
-                auto end = start + timeout;
-                const auto interval = std::chrono::milliseconds(100);
-
-                while (std::chrono::high_resolution_clock::now() < end) {
-                    std::this_thread::sleep_for(interval);
-                    mapLock.lock();
-                    bool found =
-                        (server_map_.find(server) != server_map_.end());
-                    mapLock.unlock();
-
-                    if (found) { break; }
-                }
+        if (false == bool(nym)) { return nullptr; }
 
-                return Server(id);  // timeout of zero prevents infinite
-                                    // recursion
-            }
-        }
-    } else {
-        auto& pServer = server_map_[server];
-        if (pServer) { valid = pServer->Validate(); }
+        pServer.reset(ServerContract::Factory(nym, *serialized));
+
+        // Factory() performs validation
+        if (false == bool(pServer)) { return nullptr; }
+
+        pServer->Signable::SetAlias(alias);
+
+        // If another thread loaded the same contract first, use its instance
+        return server_map_.Add(server, pServer);
     }
 
-    if (valid) { return server_map_[server]; }
+    ot_.DHT().GetServerContract(server);
+
+    if (timeout > std::chrono::milliseconds(0)) {
+        auto start = std::chrono::high_resolution_clock::now();
+        auto end = start + timeout;
+        const auto interval = std::chrono::milliseconds(100);
+
+        while (std::chrono::high_resolution_clock::now() < end) {
+            std::this_thread::sleep_for(interval);
+
+            if (server_map_.Contains(server)) { break; }
+        }
+
+        return Server(id);  // timeout of zero prevents infinite
+                            // recursion
+    }
 
     return nullptr;
 }
@@ -2053,9 +2157,7 @@ ConstServerContract Wallet::Server(
     if (contract) {
         if (contract->Validate()) {
             if (ot_.DB().Store(contract->Contract(), contract->Alias())) {
-                Lock mapLock(server_map_lock_);
-                server_map_[server].reset(contract.release());
-                mapLock.unlock();
+                server_map_.Set(server, std::move(contract));
             }
         }
     }
@@ -2077,9 +2179,7 @@ ConstServerContract Wallet::Server(const proto::ServerContract& contract) const
         if (candidate) {
             if (candidate->Validate()) {
                 if (ot_.DB().Store(candidate->Contract(), candidate->Alias())) {
-                    Lock mapLock(server_map_lock_);
-                    server_map_[server].reset(candidate.release());
-                    mapLock.unlock();
+                    server_map_.Set(server, std::move(candidate));
                 }
             }
         }
@@ -2165,8 +2265,7 @@ bool Wallet::SetServerAlias(const Identifier& id, const std::string& alias)
     const bool saved = ot_.DB().SetServerAlias(server, alias);
 
     if (saved) {
-        Lock mapLock(server_map_lock_);
-        server_map_.erase(server);
+        server_map_.Erase(server);
 
         return true;
     }
@@ -2182,8 +2281,7 @@ bool Wallet::SetUnitDefinitionAlias(
     const bool saved = ot_.DB().SetUnitDefinitionAlias(unit, alias);
 
     if (saved) {
-        Lock mapLock(unit_map_lock_);
-        unit_map_.erase(unit);
+        unit_map_.Erase(unit);
 
         return true;
     }
@@ -2201,60 +2299,54 @@ const ConstUnitDefinition Wallet::UnitDefinition(
     const std::chrono::milliseconds& timeout) const
 {
     const std::string unit = id.str();
-    Lock mapLock(unit_map_lock_);
-    bool inMap = (unit_map_.find(unit) != unit_map_.end());
-    bool valid = false;
+    std::shared_ptr<class UnitDefinition> pUnit{nullptr};
 
-    if (!inMap) {
-        std::shared_ptr<proto::UnitDefinition> serialized;
+    if (unit_map_.Get(unit, pUnit) && pUnit) {
+        if (pUnit->Validate()) { return pUnit; }
 
-        std::string alias;
-        bool loaded = ot_.DB().Load(unit, serialized, alias, true);
+        return nullptr;
+    }
 
-        if (loaded) {
-            auto nym = Nym(Identifier::Factory(serialized->nymid()));
+    std::shared_ptr<proto::UnitDefinition> serialized;
+    std::string alias;
+    const bool loaded = ot_.DB().Load(unit, serialized, alias, true);
 
-            if (!nym && serialized->has_publicnym()) {
-                nym = Nym(serialized->publicnym());
-            }
+    if (loaded) {
+        auto nym = Nym(Identifier::Factory(serialized->nymid()));
 
-            if (nym) {
-                auto& pUnit = unit_map_[unit];
-                pUnit.reset(UnitDefinition::Factory(nym, *serialized));
+        if (!nym && serialized->has_publicnym()) {
+            nym = Nym(serialized->publicnym());
+        }
 
-                if (pUnit) {
-                    valid = true;  // Factory() performs validation
-                    pUnit->Signable::SetAlias(alias);
-                }
-            }
-        } else {
-            ot_.DHT().GetUnitDefinition(unit);
+        if (false == bool(nym)) { return nullptr; }
 
-            if (timeout > std::chrono::milliseconds(0)) {
-                mapLock.unlock();
-                auto start = std::chrono::high_resolution_clock::now();
-                auto end = start + timeout;
-                const auto interval = std::chrono::milliseconds(100);
+        pUnit.reset(UnitDefinition::Factory(nym, *serialized));
 
-                while (std::chrono::high_resolution_clock::now() < end) {
-                    std::this_thread::sleep_for(interval);
-                    mapLock.lock();
-                    bool found = (unit_map_.find(unit) != unit_map_.end());
-                    mapLock.unlock();
+        // Factory() performs validation
+        if (false == bool(pUnit)) { return nullptr; }
 
-                    if (found) { break; }
-                }
+        pUnit->Signable::SetAlias(alias);
 
-                return UnitDefinition(id);  // timeout of zero prevents
-                                            // infinite recursion
-            }
-        }
-    } else {
-        auto& pUnit = unit_map_[unit];
-        if (pUnit) { valid = pUnit->Validate(); }
+        // If another thread loaded the same contract first, use its instance
+        return unit_map_.Add(unit, pUnit);
     }
 
-    if (valid) { return unit_map_[unit]; }
+    ot_.DHT().GetUnitDefinition(unit);
+
+    if (timeout > std::chrono::milliseconds(0)) {
+        auto start = std::chrono::high_resolution_clock::now();
+        auto end = start + timeout;
+        const auto interval = std::chrono::milliseconds(100);
+
+        while (std::chrono::high_resolution_clock::now() < end) {
+            std::this_thread::sleep_for(interval);
+
+            if (unit_map_.Contains(unit)) { break; }
+        }
+
+        return UnitDefinition(id);  // timeout of zero prevents
+                                    // infinite recursion
+    }
 
     return nullptr;
 }
@@ -2267,9 +2359,7 @@ ConstUnitDefinition Wallet::UnitDefinition(
     if (contract) {
         if (contract->Validate()) {
             if (ot_.DB().Store(contract->Contract(), contract->Alias())) {
-                Lock mapLock(unit_map_lock_);
-                unit_map_[unit].reset(contract.release());
-                mapLock.unlock();
+                unit_map_.Set(unit, std::move(contract));
             }
         }
     }
@@ -2292,9 +2382,7 @@ ConstUnitDefinition Wallet::UnitDefinition(
         if (candidate) {
             if (candidate->Validate()) {
                 if (ot_.DB().Store(candidate->Contract(), candidate->Alias())) {
-                    Lock mapLock(unit_map_lock_);
-                    unit_map_[unit].reset(candidate.release());
-                    mapLock.unlock();
+                    unit_map_.Set(unit, std::move(candidate));
                 }
             }
         }
@@ -2366,5 +2454,13 @@ ConstUnitDefinition Wallet::UnitDefinition(
     return UnitDefinition(Identifier::Factory(unit));
 }
 
-Wallet::~Wallet() {}
+Wallet::~Wallet()
+{
+    shutdown_.store(true);
+    dirty_context_signal_.notify_all();
+
+    if (context_flusher_.joinable()) { context_flusher_.join(); }
+
+    flush_contexts();
+}
 }  // namespace opentxs::api::client::implementation
@@ -41,6 +41,15 @@
 
 #include "Internal.hpp"
 
+#include "util/ShardedMap.hpp"
+
+#include "ContextJournal.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <set>
+#include <thread>
+
 namespace opentxs::api::client::implementation
 {
 class Wallet : virtual public opentxs::api::client::Wallet, Lockable
@@ -210,13 +219,24 @@ private:
         std::pair<std::shared_mutex, std::unique_ptr<class Account>>;
     using AccountMap = std::map<OTIdentifier, AccountLock>;
     using NymLock = std::pair<std::mutex, std::shared_ptr<class Nym>>;
-    using NymMap = std::map<std::string, NymLock>;
+    using NymMap = ShardedMap<std::string, NymLock>;
     using ServerMap =
-        std::map<std::string, std::shared_ptr<class ServerContract>>;
+        ShardedMap<std::string, std::shared_ptr<class ServerContract>>;
     using UnitMap =
-        std::map<std::string, std::shared_ptr<class UnitDefinition>>;
+        ShardedMap<std::string, std::shared_ptr<class UnitDefinition>>;
     using ContextID = std::pair<std::string, std::string>;
-    using ContextMap = std::map<ContextID, std::shared_ptr<class Context>>;
+
+    struct ContextHash {
+        std::size_t operator()(const ContextID& id) const
+        {
+            const std::hash<std::string> hash{};
+
+            return hash(id.first) ^ (hash(id.second) << 1);
+        }
+    };
+
+    using ContextMap =
+        ShardedMap<ContextID, std::shared_ptr<class Context>, ContextHash>;
     using IssuerID = std::pair<Identifier, Identifier>;
     using IssuerLock =
         std::pair<std::mutex, std::shared_ptr<api::client::Issuer>>;
@@ -234,10 +254,6 @@ private:
     mutable ContextMap context_map_;
     mutable IssuerMap issuer_map_;
     mutable std::mutex account_map_lock_;
-    mutable std::mutex nym_map_lock_;
-    mutable std::mutex server_map_lock_;
-    mutable std::mutex unit_map_lock_;
-    mutable std::mutex context_map_lock_;
     mutable std::mutex issuer_map_lock_;
     mutable std::mutex peer_map_lock_;
     mutable std::map<std::string, std::mutex> peer_lock_;
@@ -245,6 +261,14 @@ private:
     mutable std::map<Identifier, std::mutex> nymfile_lock_;
     OTZMQPublishSocket nym_publisher_;
     OTZMQPublishSocket account_publisher_;
+    OTZMQPublishSocket peer_reply_publisher_;
+    OTZMQPublishSocket peer_request_publisher_;
+    mutable ContextJournal context_journal_;
+    mutable std::mutex dirty_context_lock_;
+    mutable std::condition_variable dirty_context_signal_;
+    mutable std::set<ContextID> dirty_contexts_;
+    std::atomic<bool> shutdown_{false};
+    std::thread context_flusher_;
 
     std::string account_alias(const std::string& accountID) const;
     opentxs::Account* account_factory(
@@ -252,6 +276,9 @@ private:
         const std::string& alias,
         const std::string& serialized) const;
     proto::ContactItemType extract_unit(const Identifier& contractID) const;
+    /** Signs and stores every context modified since the last flush */
+    void flush_contexts() const;
+    void flush_contexts_thread();
     proto::ContactItemType extract_unit(
         const opentxs::UnitDefinition& contract) const;
     bool load_legacy_account(
@@ -272,6 +299,7 @@ private:
     void save(class NymFile* nym, const Lock& lock) const;
     bool SaveCredentialIDs(const class Nym& nym) const;
     std::shared_ptr<const class Nym> signer_nym(const Identifier& id) const;
+    bool store_context(const ContextID& id, class Context& context) const;
 
     /* Throws std::out_of_range for missing accounts */
     AccountLock& account(
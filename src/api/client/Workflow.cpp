@@ -1071,6 +1071,23 @@ std::vector<OTIdentifier> Workflow::WorkflowsByAccount(
     return output;
 }
 
+std::vector<OTIdentifier> Workflow::WorkflowsByQuery(
+    const Identifier& nymID,
+    const PaymentWorkflowQuery& query) const
+{
+    std::vector<OTIdentifier> output{};
+    const auto workflows = storage_.PaymentWorkflowsByQuery(nymID.str(), query);
+    std::transform(
+        workflows.begin(),
+        workflows.end(),
+        std::inserter(output, output.end()),
+        [](const std::string& id) -> OTIdentifier {
+            return Identifier::Factory(id);
+        });
+
+    return output;
+}
+
 OTIdentifier Workflow::WriteCheque(const opentxs::Cheque& cheque) const
 {
     if (false == isCheque(cheque)) { return Identifier::Factory(); }
@@ -92,6 +92,9 @@ public:
     std::vector<OTIdentifier> WorkflowsByAccount(
         const Identifier& nymID,
         const Identifier& accountID) const override;
+    std::vector<OTIdentifier> WorkflowsByQuery(
+        const Identifier& nymID,
+        const PaymentWorkflowQuery& query) const override;
     OTIdentifier WriteCheque(const opentxs::Cheque& cheque) const override;
 
     ~Workflow() = default;
@@ -55,6 +55,8 @@
 #if OT_CRYPTO_USING_OPENSSL
 #include "opentxs/core/crypto/OpenSSL.hpp"
 #endif
+#include "opentxs/core/crypto/OTAsymmetricKey.hpp"
+#include "opentxs/core/crypto/OTPasswordData.hpp"
 #include "opentxs/core/crypto/SymmetricKey.hpp"
 #if OT_CRYPTO_USING_TREZOR
 #include "opentxs/core/crypto/OTCachedKey.hpp"
@@ -64,8 +66,14 @@
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
 
+#include "core/crypto/VerificationCache.hpp"
+#include "util/ThreadPool.hpp"
+
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <ostream>
+#include <tuple>
 #include <vector>
 
 extern "C" {
@@ -79,12 +87,14 @@ extern "C" {
 #include "Hash.hpp"
 #include "Symmetric.hpp"
 
+#define OT_VERIFICATION_CACHE_SIZE 16384
+
 #define OT_METHOD "opentxs::Crypto::"
 
 namespace opentxs::api::implementation
 {
 
-Crypto::Crypto(api::Native& native)
+Crypto::Crypto(api::Native& native, const ThreadPool& pool)
     : native_(native)
     , cached_key_lock_()
     , primary_key_(nullptr)
@@ -94,6 +104,8 @@ Crypto::Crypto(api::Native& native)
 #endif
     , ed25519_(new Curve25519)
     , ssl_(new SSLImplementation)
+    , pool_(pool)
+    , verify_cache_(nullptr)
 {
     Init();
 }
@@ -165,7 +177,9 @@ const OTCachedKey& Crypto::CachedKey(const OTCachedKey& source) const
 
 void Crypto::Cleanup()
 {
+    ed25519_->verification_cache_ = nullptr;
 #if OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+    secp256k1_->verification_cache_ = nullptr;
     secp256k1_->Cleanup();
 #endif
     ssl_->Cleanup();
@@ -229,6 +243,12 @@ void Crypto::Init()
 #endif
         ));
     symmetric_.reset(new api::crypto::implementation::Symmetric(*ed25519_));
+    verify_cache_.reset(
+        new VerificationCache(*hash_, OT_VERIFICATION_CACHE_SIZE));
+    ed25519_->verification_cache_ = verify_cache_.get();
+#if OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+    secp256k1_->verification_cache_ = verify_cache_.get();
+#endif
 
     otWarn << OT_METHOD << __FUNCTION__
            << ": Setting up rlimits, and crypto libraries...\n";
@@ -357,5 +377,80 @@ std::unique_ptr<SymmetricKey> Crypto::GetStorageKey(__attribute__((unused))
 #endif
 }
 
+Crypto::VerificationStats Crypto::VerificationCacheStats() const
+{
+    OT_ASSERT(verify_cache_);
+
+    return verify_cache_->Stats();
+}
+
+bool Crypto::Verify(
+    const Data& plaintext,
+    const OTAsymmetricKey& key,
+    const Data& signature,
+    const proto::HashType hashType,
+    const OTPasswordData* pPWData) const
+{
+    return key.engine().VerifyWithCache(
+        plaintext, key, signature, hashType, pPWData);
+}
+
+bool Crypto::verify(const SignatureCheck& check)
+{
+    const auto& key = std::get<0>(check);
+    const auto& contents = std::get<1>(check);
+    const auto& signature = std::get<2>(check);
+    const auto& hashType = std::get<3>(check);
+
+    if ((nullptr == key) || (nullptr == contents) || (nullptr == signature)) {
+
+        return false;
+    }
+
+    OTPasswordData password("Crypto::VerifyBatch");
+
+    return key->engine().VerifyContractSignature(
+        *contents, *key, *signature, hashType, &password);
+}
+
+std::vector<bool> Crypto::VerifyBatch(
+    const std::vector<SignatureCheck>& checks) const
+{
+    std::vector<std::function<bool()>> tasks{};
+
+    for (const auto& check : checks) {
+        tasks.emplace_back([&check]() -> bool { return verify(check); });
+    }
+
+    return VerifyBatch(tasks);
+}
+
+std::vector<bool> Crypto::VerifyBatch(
+    const std::vector<std::function<bool()>>& checks) const
+{
+    const auto count = checks.size();
+    // std::vector<bool> can not be written to concurrently
+    std::vector<std::uint8_t> results(count, 0);
+    const auto chunks = std::min(count, pool_.Size());
+
+    if (1 < chunks) {
+        std::vector<ThreadPool::Task> tasks{};
+
+        for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+            tasks.emplace_back([&checks, &results, chunk, chunks, count]() {
+                for (auto i = chunk; i < count; i += chunks) {
+                    results[i] = checks[i]();
+                }
+            });
+        }
+
+        pool_.Wait(tasks);
+    } else {
+        for (std::size_t i = 0; i < count; ++i) { results[i] = checks[i](); }
+    }
+
+    return std::vector<bool>(results.begin(), results.end());
+}
+
 Crypto::~Crypto() { Cleanup(); }
 }  // namespace opentxs::api::implementation
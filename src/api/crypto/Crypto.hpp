@@ -46,9 +46,11 @@
 #include "opentxs/Proto.hpp"
 #include "opentxs/Types.hpp"
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 namespace opentxs
 {
@@ -122,6 +124,18 @@ public:
     std::unique_ptr<SymmetricKey> GetStorageKey(
         std::string& seed) const override;
 
+    std::vector<bool> VerifyBatch(
+        const std::vector<SignatureCheck>& checks) const override;
+    std::vector<bool> VerifyBatch(
+        const std::vector<std::function<bool()>>& checks) const override;
+    bool Verify(
+        const Data& plaintext,
+        const OTAsymmetricKey& key,
+        const Data& signature,
+        const proto::HashType hashType,
+        const OTPasswordData* pPWData = nullptr) const override;
+    VerificationStats VerificationCacheStats() const override;
+
     ~Crypto();
 
 private:
@@ -142,13 +156,17 @@ private:
     std::unique_ptr<crypto::Encode> encode_;
     std::unique_ptr<crypto::Hash> hash_;
     std::unique_ptr<crypto::Symmetric> symmetric_;
+    const ThreadPool& pool_;
+    std::unique_ptr<VerificationCache> verify_cache_;
+
+    static bool verify(const SignatureCheck& check);
 
     void init_default_key(const Lock& lock) const;
 
     void Init();
     void Cleanup();
 
-    Crypto(api::Native& native);
+    Crypto(api::Native& native, const ThreadPool& pool);
     Crypto() = delete;
     Crypto(const Crypto&) = delete;
     Crypto(Crypto&&) = delete;
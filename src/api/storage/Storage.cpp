@@ -723,7 +723,8 @@ bool Storage::MoveThreadItem(
     const std::string& nymId,
     const std::string& fromThreadID,
     const std::string& toThreadID,
-    const std::string& itemID) const
+    const std::string& itemID,
+    proto::StorageThreadItem* moved) const
 {
     const bool fromExists =
         Root().Tree().NymNode().Nym(nymId).Threads().Exists(fromThreadID);
@@ -761,12 +762,14 @@ bool Storage::MoveThreadItem(
     bool found = false;
     std::uint64_t time{};
     StorageBox box{};
+    std::string account{};
 
     for (const auto& item : thread.item()) {
         if (item.id() == itemID) {
             found = true;
             time = item.time();
             box = static_cast<StorageBox>(item.box());
+            account = item.account();
 
             break;
         }
@@ -799,7 +802,7 @@ bool Storage::MoveThreadItem(
                          .mutable_Thread(toThreadID)
                          .It();
 
-    if (false == toThread.Add(itemID, time, box, {}, {})) {
+    if (false == toThread.Add(itemID, time, box, {}, {}, 0, account, moved)) {
         otErr << OT_METHOD << __FUNCTION__ << ": Failed to insert item."
               << std::endl;
 
@@ -881,6 +884,13 @@ ObjectList Storage::NymBoxList(const std::string& nymID, const StorageBox box)
 
 ObjectList Storage::NymList() const { return Root().Tree().NymNode().List(); }
 
+Storage::CacheStats Storage::ObjectCacheStats() const
+{
+    const auto stats = multiplex_.ObjectCacheStats();
+
+    return CacheStats{stats.hits_, stats.misses_, stats.size_};
+}
+
 ObjectList Storage::PaymentWorkflowList(const std::string& nymID) const
 {
     if (false == Root().Tree().NymNode().Exists(nymID)) {
@@ -923,6 +933,20 @@ std::set<std::string> Storage::PaymentWorkflowsByAccount(
         accountID);
 }
 
+std::vector<std::string> Storage::PaymentWorkflowsByQuery(
+    const std::string& nymID,
+    const PaymentWorkflowQuery& query) const
+{
+    if (false == Root().Tree().NymNode().Exists(nymID)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Nym " << nymID
+              << " doesn't exist." << std::endl;
+
+        return {};
+    }
+
+    return Root().Tree().NymNode().Nym(nymID).PaymentWorkflows().Query(query);
+}
+
 std::set<std::string> Storage::PaymentWorkflowsByState(
     const std::string& nymID,
     const proto::PaymentWorkflowType type,
@@ -986,7 +1010,8 @@ bool Storage::RelabelThread(
 bool Storage::RemoveNymBoxItem(
     const std::string& nymID,
     const StorageBox box,
-    const std::string& itemID) const
+    const std::string& itemID,
+    std::map<std::string, proto::StorageThreadItem>* removed) const
 {
     switch (box) {
         case StorageBox::SENTPEERREQUEST: {
@@ -1104,7 +1129,7 @@ bool Storage::RemoveNymBoxItem(
                                            .It()
                                            .mutable_Threads()
                                            .It()
-                                           .FindAndDeleteItem(itemID);
+                                           .FindAndDeleteItem(itemID, removed);
             bool foundInBox = false;
 
             if (!foundInThread) {
@@ -1134,7 +1159,7 @@ bool Storage::RemoveNymBoxItem(
                                            .It()
                                            .mutable_Threads()
                                            .It()
-                                           .FindAndDeleteItem(itemID);
+                                           .FindAndDeleteItem(itemID, removed);
             bool foundInBox = false;
 
             if (!foundInThread) {
@@ -1605,7 +1630,8 @@ bool Storage::Store(
     const std::string& alias,
     const std::string& data,
     const StorageBox box,
-    const std::string& account) const
+    const std::string& account,
+    proto::StorageThreadItem* stored) const
 {
     return mutable_Root()
         .It()
@@ -1619,7 +1645,7 @@ bool Storage::Store(
         .It()
         .mutable_Thread(threadid)
         .It()
-        .Add(itemid, time, box, alias, data, 0, account);
+        .Add(itemid, time, box, alias, data, 0, account, stored);
 }
 
 bool Storage::Store(
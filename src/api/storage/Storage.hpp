@@ -220,10 +220,12 @@ public:
         const std::string& nymId,
         const std::string& fromThreadID,
         const std::string& toThreadID,
-        const std::string& itemID) const override;
+        const std::string& itemID,
+        proto::StorageThreadItem* moved = nullptr) const override;
     ObjectList NymBoxList(const std::string& nymID, const StorageBox box)
         const override;
     ObjectList NymList() const override;
+    CacheStats ObjectCacheStats() const override;
     ObjectList PaymentWorkflowList(const std::string& nymID) const override;
     std::string PaymentWorkflowLookup(
         const std::string& nymID,
@@ -231,6 +233,9 @@ public:
     std::set<std::string> PaymentWorkflowsByAccount(
         const std::string& nymID,
         const std::string& accountID) const override;
+    std::vector<std::string> PaymentWorkflowsByQuery(
+        const std::string& nymID,
+        const PaymentWorkflowQuery& query) const override;
     std::set<std::string> PaymentWorkflowsByState(
         const std::string& nymID,
         const proto::PaymentWorkflowType type,
@@ -247,7 +252,9 @@ public:
     bool RemoveNymBoxItem(
         const std::string& nymID,
         const StorageBox box,
-        const std::string& itemID) const override;
+        const std::string& itemID,
+        std::map<std::string, proto::StorageThreadItem>* removed =
+            nullptr) const override;
     bool RemoveServer(const std::string& id) const override;
     bool RemoveUnitDefinition(const std::string& id) const override;
     bool RenameThread(
@@ -314,7 +321,8 @@ public:
         const std::string& alias,
         const std::string& data,
         const StorageBox box,
-        const std::string& account = std::string("")) const override;
+        const std::string& account = std::string(""),
+        proto::StorageThreadItem* stored = nullptr) const override;
     bool Store(
         const proto::PeerReply& data,
         const std::string& nymid,
@@ -6117,6 +6117,8 @@ bool OTClient::processServerReply(
         return false;
     }
 
+    if (theReply.RangeStatements()) { context.SetRangeStatements(); }
+
     // TODO it's not possible to use the message outbuffer to detect duplicate
     // or unsolicited server replies. The processing function for each
     // individual message type must be capable properly detecting this
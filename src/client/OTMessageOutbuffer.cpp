@@ -41,7 +41,6 @@
 #include "opentxs/client/OTMessageOutbuffer.hpp"
 
 #include "opentxs/consensus/ServerContext.hpp"
-#include "opentxs/core/crypto/OTASCIIArmor.hpp"
 #include "opentxs/core/util/Assert.hpp"
 #include "opentxs/core/util/OTDataFolder.hpp"
 #include "opentxs/core/util/OTFolders.hpp"
@@ -55,19 +54,33 @@
 #include "opentxs/core/OTTransaction.hpp"
 #include "opentxs/core/String.hpp"
 
-#include <cinttypes>
+#include "util/Journal.hpp"
+
+#include <cerrno>
 #include <cstdint>
+#include <cstdlib>
+#include <limits>
 #include <map>
 #include <memory>
 #include <ostream>
+#include <set>
 #include <string>
 #include <utility>
+#include <vector>
+
+#define OT_OUTBUFFER_JOURNAL "outbuffer.journal"
+#define OT_OUTBUFFER_MIN_COMPACT 256
+
+#define OT_METHOD "opentxs::OTMessageOutbuffer::"
 
 namespace opentxs
 {
 OTMessageOutbuffer::OTMessageOutbuffer()
-    : messagesMap_()
+    : messages_()
+    , imported_()
     , dataFolder_(OTDataFolder::Get())
+    , journal_(nullptr)
+    , loaded_(false)
 {
     OT_ASSERT(dataFolder_.Exists());
 }
@@ -76,6 +89,7 @@ void OTMessageOutbuffer::AddSentMessage(Message& theMessage)  // must be heap
                                                               // allocated.
 {
     Lock lock(lock_);
+    std::unique_ptr<Message> message(&theMessage);
     std::int64_t lRequestNum = 0;
 
     if (theMessage.m_strRequestNum.Exists())
@@ -84,140 +98,86 @@ void OTMessageOutbuffer::AddSentMessage(Message& theMessage)  // must be heap
                                                             // number on the
                                                             // message itself.
 
+    const std::string notaryID{theMessage.m_strNotaryID.Get()};
+    const std::string nymID{theMessage.m_strNymID.Get()};
+    load(lock);
+    import_legacy(lock, notaryID, nymID);
+
     // It's technically possible to have TWO messages (from two different
-    // servers) that happen to have the same request number. So we verify
-    // that here, before removing any old ones with the same number and IDs.
-    //
-    auto it = messagesMap_.begin();
+    // servers) that happen to have the same request number. The index is keyed
+    // on the server and Nym IDs as well, so only a message with the same
+    // request number AND the same IDs is replaced here.
+    auto& entry = messages_[Key{notaryID, nymID, lRequestNum}];
+    entry.message_ = std::move(message);
+    entry.serialized_.clear();
 
-    for (; it != messagesMap_.end(); ++it) {
+    // Save it to local storage, in case we don't see the reply until the next
+    // run.
+    append(
+        lock,
+        make_record(notaryID, nymID, lRequestNum, serialize(theMessage)));
+}
 
-        const std::int64_t& lTempReqNum = it->first;
+bool OTMessageOutbuffer::append(const Lock& lock, const std::string& record)
+{
+    OT_ASSERT(lock.owns_lock());
 
-        if (lTempReqNum != lRequestNum) { continue; }
+    if (false == bool(journal_)) { return false; }
 
-        Message* pMsg = it->second;
-        OT_ASSERT(nullptr != pMsg);
+    if (false == journal_->Append(record)) { return false; }
 
-        //
-        // If a server ID was passed in, but doesn't match the server ID on this
-        // message,
-        // Then skip this one. (Same with the NymID.)
-        //
-        if (!theMessage.m_strNotaryID.Compare(pMsg->m_strNotaryID) ||
-            !theMessage.m_strNymID.Compare(pMsg->m_strNymID)) {
-            continue;
-        } else {
-            delete pMsg;
-            pMsg = nullptr;
-            messagesMap_.erase(it);
-            break;
-        }
-    }
-    // Whatever it was, it's gone now!
+    // The record is already stored, so a failed compaction is harmless
+    if (journal_->ShouldCompact(messages_.size())) { compact(lock); }
 
-    // Now that we KNOW there's nothing already there with that request number
-    // (for that
-    // server ID and Nym ID), we go ahead and add the new message to the map.
-    // (And take ownership.)
-    //
-    messagesMap_.insert(
-        std::pair<std::int64_t, Message*>(lRequestNum, &theMessage));
+    return true;
+}
 
-    //
-    // Save it to local storage, in case we don't see the reply until the next
-    // run.
-    //
-    bool bAlreadyExists = false, bIsNewFolder = false;
-    String strFolder, strFolder1, strFolder2;
-    strFolder1.Format(
-        "%s%s%s",
-        OTFolders::Nym().Get(),
-        Log::PathSeparator(),
-        theMessage.m_strNotaryID.Get());
-    strFolder2.Format(
-        "%s%s%s",
-        strFolder1.Get(),
-        Log::PathSeparator(),
-        "sent" /*todo hardcoding*/);
+bool OTMessageOutbuffer::compact(const Lock& lock)
+{
+    OT_ASSERT(lock.owns_lock());
+    OT_ASSERT(journal_);
+
+    std::vector<std::string> records{};
+    records.reserve(messages_.size());
+
+    for (const auto& [key, entry] : messages_) {
+        const auto& [notaryID, nymID, number] = key;
+        records.emplace_back(make_record(
+            notaryID,
+            nymID,
+            number,
+            entry.message_ ? serialize(*entry.message_) : entry.serialized_));
+    }
 
-    strFolder.Format(
-        "%s%s%s",
-        strFolder2.Get(),
-        Log::PathSeparator(),
-        theMessage.m_strNymID.Get());
+    return journal_->Rewrite(records);
+}
 
-    String strFolderPath = "", strFolder1Path = "", strFolder2Path = "";
+Message* OTMessageOutbuffer::get(const Lock& lock, Entry& entry)
+{
+    OT_ASSERT(lock.owns_lock());
 
-    OTPaths::AppendFolder(strFolderPath, dataFolder_, strFolder);
-    OTPaths::AppendFolder(strFolder1Path, dataFolder_, strFolder1);
-    OTPaths::AppendFolder(strFolder2Path, dataFolder_, strFolder2);
+    if (entry.message_) { return entry.message_.get(); }
 
-    OTPaths::ConfirmCreateFolder(strFolderPath, bAlreadyExists, bIsNewFolder);
-    OTPaths::ConfirmCreateFolder(strFolder1Path, bAlreadyExists, bIsNewFolder);
-    OTPaths::ConfirmCreateFolder(strFolder2Path, bAlreadyExists, bIsNewFolder);
+    if (entry.serialized_.empty()) { return nullptr; }
 
-    String strFile;
-    strFile.Format("%s.msg", theMessage.m_strRequestNum.Get());
+    // Messages restored from the journal are only parsed the first time they
+    // are needed.
+    const String raw(entry.serialized_);
+    std::unique_ptr<Message> message(new Message);
 
-    theMessage.SaveContract(strFolder.Get(), strFile.Get());
+    OT_ASSERT(message);
 
-    // We also keep a list of the request numbers, so let's load it up, add the
-    // number
-    // to that list, and then save it again.
-    //
-    NumList theNumList;
-    std::string str_data_filename("sent.dat");  // todo hardcoding.
-    if (OTDB::Exists(strFolder.Get(), str_data_filename)) {
-        String strNumList(
-            OTDB::QueryPlainString(strFolder.Get(), str_data_filename));
-        if (strNumList.Exists()) theNumList.Add(strNumList);
-        theNumList.Add(lRequestNum);  // Add the new request number to it.
-    } else  // it doesn't exist on disk, so let's just create it from the list
-            // we
-            // have in RAM so we can store it to disk.
-    {
-        it = messagesMap_.begin();
-        while (it != messagesMap_.end()) {
-
-            const std::int64_t& lTempReqNum = it->first;
-
-            Message* pMsg = it->second;
-            OT_ASSERT(nullptr != pMsg);
-
-            //
-            // If a server ID was passed in, but doesn't match the server ID on
-            // this message,
-            // Then skip this one. (Same with the NymID.)
-            //
-            if (!theMessage.m_strNotaryID.Compare(pMsg->m_strNotaryID) ||
-                !theMessage.m_strNymID.Compare(pMsg->m_strNymID)) {
-                ++it;
-                continue;
-            } else {
-                theNumList.Add(lTempReqNum);
-            }
-            ++it;
-        }
-    }  // else
-
-    // By this point, theNumList has either been loaded from local storage and
-    // had the new number added,
-    // or it wasn't in local storage and thus we created it and added all the
-    // numnbers to it (including new one.)
-    // Therefore nothing left to do here, but save it back again!
-    //
-    String strOutput;
-    theNumList.Output(strOutput);
-
-    if (!OTDB::StorePlainString(
-            strOutput.Get(),
-            strFolder.Get(),
-            str_data_filename))  // todo hardcoding.
-    {
-        otErr << "OTMessageOutbuffer::AddSentMessage: Error: failed writing "
-                 "list of request numbers to storage.\n";
+    if (false == message->LoadContractFromString(raw)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to load buffered message." << std::endl;
+
+        return nullptr;
     }
+
+    entry.message_ = std::move(message);
+    entry.serialized_.clear();
+
+    return entry.message_.get();
 }
 
 // You are NOT responsible to delete the OTMessage object
@@ -230,80 +190,203 @@ Message* OTMessageOutbuffer::GetSentMessage(
     const String& strNymID)
 {
     Lock lock(lock_);
-    auto it = messagesMap_.begin();
+    const std::string notaryID{strNotaryID.Get()};
+    const std::string nymID{strNymID.Get()};
+    load(lock);
+    import_legacy(lock, notaryID, nymID);
+    auto it = messages_.find(Key{notaryID, nymID, lRequestNum});
 
-    for (; it != messagesMap_.end(); ++it) {
+    if (messages_.end() == it) { return nullptr; }
 
-        const std::int64_t& lTempReqNum = it->first;
+    return get(lock, it->second);
+}
 
-        if (lTempReqNum != lRequestNum) { continue; }
+// Messages buffered by older versions were stored one file per message, with
+// a list of request numbers alongside them. They are moved into the journal
+// the first time the buffer is used for a given server and Nym. A legacy file
+// is only erased once its message is in the journal.
+void OTMessageOutbuffer::import_legacy(
+    const Lock& lock,
+    const std::string& notaryID,
+    const std::string& nymID)
+{
+    OT_ASSERT(lock.owns_lock());
 
-        Message* pMsg = it->second;
-        OT_ASSERT(nullptr != pMsg);
+    if (false == imported_.emplace(notaryID, nymID).second) { return; }
 
-        //
-        // If a server ID was passed in, but doesn't match the server ID on this
-        // message,
-        // Then skip this one. (Same with the NymID.)
-        if (!strNotaryID.Compare(pMsg->m_strNotaryID) ||
-            !strNymID.Compare(pMsg->m_strNymID)) {
-            continue;
-        } else {
-            return pMsg;
-        }
-    }
-
-    // Didn't find it? Okay let's load it from local storage, if it's there...
-    //
-    String strFolder, strFile;
+    String strFolder;
     strFolder.Format(
         "%s%s%s%s%s%s%s",
         OTFolders::Nym().Get(),
         Log::PathSeparator(),
-        strNotaryID.Get(),
+        notaryID.c_str(),
         Log::PathSeparator(),
         "sent",
         /*todo hardcoding*/ Log::PathSeparator(),
-        strNymID.Get());
-    strFile.Format("%" PRId64 ".msg", lRequestNum);
+        nymID.c_str());
+    const std::string str_data_filename("sent.dat");  // todo hardcoding.
+
+    if (false == OTDB::Exists(strFolder.Get(), str_data_filename)) { return; }
 
-    // Check the existing list, if it exists.
-    //
     NumList theNumList;
-    std::string str_data_filename("sent.dat");
-    if (OTDB::Exists(strFolder.Get(), str_data_filename))  // todo hardcoding.
-    {
-        String strNumList(
-            OTDB::QueryPlainString(strFolder.Get(), str_data_filename));
-
-        if (strNumList.Exists()) theNumList.Add(strNumList);
-
-        if (theNumList.Verify(lRequestNum)) {
-            // Even if the outgoing message was stored, we still act like it
-            // "doesn't exist" if it doesn't appear on the official list.
-            // The list is what matters -- the message is just the contents
-            // referenced
-            // by that list.
-
-            Message* pMsg = new Message;
-            OT_ASSERT(nullptr != pMsg);
-            std::unique_ptr<Message> theMsgAngel(pMsg);
-
-            if (OTDB::Exists(strFolder.Get(), strFile.Get()) &&
-                pMsg->LoadContract(strFolder.Get(), strFile.Get())) {
-                // Since we had to load it from local storage, let's add it to
-                // the list in RAM.
-                //
-                messagesMap_.insert(std::pair<std::int64_t, Message*>(
-                    lRequestNum, theMsgAngel.release()));
-                return pMsg;
+    std::set<std::int64_t> numbers{};
+    String strNumList(
+        OTDB::QueryPlainString(strFolder.Get(), str_data_filename));
+
+    if (strNumList.Exists()) { theNumList.Add(strNumList); }
+
+    theNumList.Output(numbers);
+
+    bool imported{true};
+
+    for (const auto& number : numbers) {
+        const std::string strFile = std::to_string(number) + ".msg";
+
+        if (false == OTDB::Exists(strFolder.Get(), strFile)) { continue; }
+
+        const Key key{notaryID, nymID, number};
+        bool stored{0 < messages_.count(key)};
+
+        if (false == stored) {
+            std::unique_ptr<Message> message(new Message);
+
+            OT_ASSERT(message);
+
+            if (message->LoadContract(strFolder.Get(), strFile.c_str())) {
+                const auto serialized = serialize(*message);
+                auto& entry = messages_[key];
+                entry.message_ = std::move(message);
+                stored = append(
+                    lock, make_record(notaryID, nymID, number, serialized));
+            } else {
+                otErr << OT_METHOD << __FUNCTION__ << ": Failed to load "
+                      << strFile << std::endl;
             }
         }
+
+        if (stored) {
+            OTDB::EraseValueByKey(strFolder.Get(), strFile);
+        } else {
+            imported = false;
+        }
     }
 
-    // STILL didn't find it? (Failure.)
-    //
-    return nullptr;
+    if (imported) {
+        OTDB::EraseValueByKey(strFolder.Get(), str_data_filename);
+    } else {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Legacy messages which could not be imported were kept in "
+              << strFolder.Get() << std::endl;
+    }
+}
+
+void OTMessageOutbuffer::load(const Lock& lock)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    if (loaded_) { return; }
+
+    loaded_ = true;
+    std::string path{};
+    const auto found = OTDB::FormPathString(
+        path, OTFolders::Nym().Get(), OT_OUTBUFFER_JOURNAL);
+
+    if (0 > found) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Unable to construct path for message journal."
+              << std::endl;
+
+        return;
+    }
+
+    bool created{false};
+    OTPaths::BuildFilePath(String(path), created);
+    journal_.reset(new Journal(path, OT_OUTBUFFER_MIN_COMPACT));
+
+    OT_ASSERT(journal_);
+
+    std::vector<std::string> records{};
+
+    if (false == journal_->Load(records)) { return; }
+
+    std::vector<std::string> fields{};
+
+    for (const auto& record : records) {
+        const bool add = (0 == record.compare(0, 2, "+\t"));
+        const bool remove = (0 == record.compare(0, 2, "-\t"));
+        bool valid = (add || remove) &&
+                     Journal::Split(record, add ? 5 : 4, fields) &&
+                     (false == fields.at(1).empty()) &&
+                     (false == fields.at(2).empty()) &&
+                     (remove || (false == fields.at(4).empty()));
+        std::int64_t number{0};
+
+        if (valid) {
+            const auto& text = fields.at(3);
+            char* end{nullptr};
+            errno = 0;
+            number = std::strtoll(text.c_str(), &end, 10);
+            valid = (false == text.empty()) && (0 == errno) &&
+                    (text.c_str() + text.size() == end);
+        }
+
+        if (false == valid) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Ignoring invalid record in " << path << std::endl;
+
+            continue;
+        }
+
+        const Key key{fields.at(1), fields.at(2), number};
+
+        if (add) {
+            auto& entry = messages_[key];
+            entry.message_.reset();
+            entry.serialized_ = fields.at(4);
+        } else {
+            messages_.erase(key);
+        }
+    }
+
+    if (journal_->ShouldCompact(messages_.size())) { compact(lock); }
+}
+
+std::string OTMessageOutbuffer::make_record(
+    const std::string& notaryID,
+    const std::string& nymID,
+    const std::int64_t number,
+    const std::string& serialized)
+{
+    const std::string output =
+        notaryID + "\t" + nymID + "\t" + std::to_string(number);
+
+    if (serialized.empty()) { return "-\t" + output; }
+
+    return "+\t" + output + "\t" + serialized;
+}
+
+std::map<OTMessageOutbuffer::Key, OTMessageOutbuffer::Entry>::iterator
+OTMessageOutbuffer::remove(
+    const Lock& lock,
+    std::map<Key, Entry>::iterator it)
+{
+    OT_ASSERT(lock.owns_lock());
+    OT_ASSERT(messages_.end() != it);
+
+    const auto& [notaryID, nymID, number] = it->first;
+    const auto removed = make_record(notaryID, nymID, number, "");
+    auto output = messages_.erase(it);
+    append(lock, removed);
+
+    return output;
+}
+
+std::string OTMessageOutbuffer::serialize(const Message& message)
+{
+    String raw;
+    message.SaveContractRaw(raw);
+
+    return raw.Get();
 }
 
 // WARNING: ONLY call this (with arguments) directly after a successful
@@ -322,22 +405,28 @@ void OTMessageOutbuffer::Clear(
     OT_ASSERT(nymID == Identifier::Factory(pstrNymID));
 
     Lock lock(lock_);
-    auto it = messagesMap_.begin();
-
-    while (it != messagesMap_.end()) {
-        const std::int64_t& lRequestNum = it->first;
-        Message* pThisMsg = it->second;
+    const std::string notary{pstrNotaryID.Get()};
+    const std::string nym{pstrNymID.Get()};
+    load(lock);
+    import_legacy(lock, notary, nym);
+    auto it = messages_.lower_bound(
+        Key{notary, nym, std::numeric_limits<std::int64_t>::min()});
+
+    while (messages_.end() != it) {
+        const auto& key = it->first;
+
+        // Only the messages for this server ID and Nym ID are cleared. They
+        // are adjacent in the index, so stop at the first one that doesn't
+        // match.
+        if ((notary != std::get<0>(key)) || (nym != std::get<1>(key))) {
+            break;
+        }
 
-        OT_ASSERT(nullptr != pThisMsg);
+        Message* pThisMsg = get(lock, it->second);
 
-        // If a server ID was passed in, but doesn't match the server ID on this
-        // message, Then skip this one. (Same with the NymID.)
-        const bool notaryMatch = pstrNotaryID.Compare(pThisMsg->m_strNotaryID);
-        const bool nymMatch = pstrNymID.Compare(pThisMsg->m_strNymID);
-        const bool match = notaryMatch && nymMatch;
+        if (nullptr == pThisMsg) {
+            it = remove(lock, it);
 
-        if (!match) {
-            ++it;
             continue;
         }
 
@@ -470,54 +559,9 @@ void OTMessageOutbuffer::Clear(
                 bTransactionWasFailure);
         }  // if there's a transaction to be harvested inside this message.
 
-        String strFolder, strFile;
-        strFolder.Format(
-            "%s%s%s%s%s%s%s",
-            OTFolders::Nym().Get(),
-            Log::PathSeparator(),
-            pstrNotaryID.Get(),
-            Log::PathSeparator(),
-            "sent",
-            Log::PathSeparator(),
-            pstrNymID.Get());
-        strFile.Format("%" PRId64 ".msg", lRequestNum);
-        NumList theNumList;
-        std::string str_data_filename("sent.dat");
-
-        if (OTDB::Exists(strFolder.Get(), str_data_filename)) {
-            String strNumList(
-                OTDB::QueryPlainString(strFolder.Get(), str_data_filename));
-
-            if (strNumList.Exists()) { theNumList.Add(strNumList); }
-
-            theNumList.Remove(lRequestNum);
-        }
-
-        String strOutput;
-        theNumList.Output(strOutput);
-        const bool saved = OTDB::StorePlainString(
-            strOutput.Get(), strFolder.Get(), str_data_filename);
-
-        if (!saved) {
-            otErr << "OTMessageOutbuffer::Clear: Error: failed writing list of "
-                  << "request numbers to storage." << std::endl;
-        }
-
         // Make sure any messages being erased here, are also erased from local
         // storage.
-        std::unique_ptr<Message> storedMessage(new Message);
-
-        OT_ASSERT(storedMessage);
-
-        if (OTDB::Exists(strFolder.Get(), strFile.Get()) &&
-            storedMessage->LoadContract(strFolder.Get(), strFile.Get())) {
-            OTDB::EraseValueByKey(strFolder.Get(), strFile.Get());
-        }
-
-        delete pThisMsg;
-        pThisMsg = nullptr;
-
-        it = messagesMap_.erase(it);
+        it = remove(lock, it);
     }
 }
 
@@ -529,132 +573,17 @@ bool OTMessageOutbuffer::RemoveSentMessage(
     const String& strNymID)
 {
     Lock lock(lock_);
-    String strFolder, strFile;
-    strFolder.Format(
-        "%s%s%s%s%s%s%s",
-        OTFolders::Nym().Get(),
-        Log::PathSeparator(),
-        strNotaryID.Get(),
-        Log::PathSeparator(),
-        "sent",
-        /*todo hardcoding*/ Log::PathSeparator(),
-        strNymID.Get());
-    strFile.Format("%" PRId64 ".msg", lRequestNum);
-
-    auto it = messagesMap_.begin();
-
-    bool bReturnValue = false;
-
-    while (it != messagesMap_.end()) {
-
-        const std::int64_t& lTempReqNum = it->first;
-
-        if (lTempReqNum != lRequestNum) {
-            ++it;
-            continue;
-        }
-
-        Message* pMsg = it->second;
-        OT_ASSERT(nullptr != pMsg);
-
-        //
-        // If a server ID was passed in, but doesn't match the server ID on this
-        // message,
-        // Then skip this one. (Same with the NymID.)
-        if (!strNotaryID.Compare(pMsg->m_strNotaryID) ||
-            !strNymID.Compare(pMsg->m_strNymID)) {
-            ++it;
-            continue;
-        } else {
-            delete pMsg;
-            pMsg = nullptr;
+    const std::string notaryID{strNotaryID.Get()};
+    const std::string nymID{strNymID.Get()};
+    load(lock);
+    import_legacy(lock, notaryID, nymID);
+    auto it = messages_.find(Key{notaryID, nymID, lRequestNum});
 
-            auto temp_it = it;
-            ++temp_it;
-            messagesMap_.erase(it);
-            it = temp_it;  // here's where it gets incremented. (During the
-                           // erase, basically.)
-
-            bReturnValue = true;
-            break;
-        }
-    }
+    if (messages_.end() == it) { return false; }
 
-    // Whether we found it in RAM or not, let's make sure to delete it from
-    // local storage, if it's there... (Since there's a list there we have to
-    // update,
-    // anyway.)
-    // We keep a list of the request numbers, so let's load it up, remove the
-    // number
-    // from that list, and then save it again.
-
-    NumList theNumList;
-    std::string str_data_filename("sent.dat");  // todo hardcoding.
-    if (OTDB::Exists(strFolder.Get(), str_data_filename)) {
-        String strNumList(
-            OTDB::QueryPlainString(strFolder.Get(), str_data_filename));
-        if (strNumList.Exists()) theNumList.Add(strNumList);
-        theNumList.Remove(lRequestNum);
-    } else  // it doesn't exist on disk, so let's just create it from the list
-            // we
-            // have in RAM so we can store it to disk.
-    {
-        it = messagesMap_.begin();
-        while (it != messagesMap_.end()) {
-
-            const std::int64_t& lTempReqNum = it->first;
-
-            Message* pMsg = it->second;
-            OT_ASSERT(nullptr != pMsg);
-
-            //
-            // If a server ID was passed in, but doesn't match the server ID on
-            // this message,
-            // Then skip this one. (Same with the NymID.)
-            //
-            if (!strNotaryID.Compare(pMsg->m_strNotaryID) ||
-                !strNymID.Compare(pMsg->m_strNymID)) {
-                ++it;
-                continue;
-            } else {
-                theNumList.Add(lTempReqNum);
-            }
-            ++it;
-        }
-    }  // else
-
-    // By this point, theNumList has either been loaded from local storage and
-    // had the number removed,
-    // or it wasn't in local storage and thus we created it and added all the
-    // numbers to it from RAM (not
-    // including the one being erased, since it was already removed from the RAM
-    // list, above.) So either
-    // way, the number being removed is now ABSENT from theNumList.
-    //
-    // Therefore nothing left to do here, but save it back again!
-    //
-    String strOutput;
-    theNumList.Output(strOutput);
-    if (!OTDB::StorePlainString(
-            strOutput.Get(), strFolder.Get(), str_data_filename)) {
-        otErr << "OTMessageOutbuffer::RemoveSentMessage: Error: failed writing "
-                 "list of request numbers to storage.\n";
-    }
-
-    // Now that we've updated the numlist in local storage, let's
-    // erase the sent message itself...
-    //
-    Message* pMsg = new Message;
-    OT_ASSERT(nullptr != pMsg);
-    std::unique_ptr<Message> theMsgAngel(pMsg);
-
-    if (OTDB::Exists(strFolder.Get(), strFile.Get()) &&
-        pMsg->LoadContract(strFolder.Get(), strFile.Get())) {
-        OTDB::EraseValueByKey(strFolder.Get(), strFile.Get());
-        return true;
-    }
+    remove(lock, it);
 
-    return bReturnValue;
+    return true;
 }
 
 Message* OTMessageOutbuffer::GetSentMessage(const OTTransaction& theTransaction)
@@ -677,6 +606,6 @@ bool OTMessageOutbuffer::RemoveSentMessage(const OTTransaction& theTransaction)
     return RemoveSentMessage(lRequestNum, strNotaryID, strNymID);
 }
 
-OTMessageOutbuffer::~OTMessageOutbuffer() { messagesMap_.clear(); }
+OTMessageOutbuffer::~OTMessageOutbuffer() { messages_.clear(); }
 
 }  // namespace opentxs
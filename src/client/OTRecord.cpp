@@ -876,13 +876,17 @@ bool OTRecord::DeleteRecord() const
     }
     // Accept it.
     //
-    return SwigWrap::ClearRecord(
+    const bool cleared = SwigWrap::ClearRecord(
         // m_str_msg_notary_id,
         theNotaryID->str(),
         m_str_nym_id,
         str_using_account,
         nIndex,
         false);  // clear all = false. We're only clearing one record.
+
+    if (cleared) { backlink_.Invalidate(str_using_account); }
+
+    return cleared;
 }
 
 bool OTRecord::accept_inbox_items(
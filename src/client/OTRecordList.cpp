@@ -42,6 +42,8 @@
 
 #include "opentxs/api/client/Cash.hpp"
 #include "opentxs/api/client/ServerAction.hpp"
+#include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
 #include "opentxs/api/Activity.hpp"
 #include "opentxs/api/Api.hpp"
 #include "opentxs/api/ContactManager.hpp"
@@ -61,13 +63,16 @@
 #include "opentxs/core/script/OTSmartContract.hpp"
 #include "opentxs/core/util/Assert.hpp"
 #include "opentxs/core/util/Common.hpp"
+#include "opentxs/core/util/OTFolders.hpp"
 #include "opentxs/core/Account.hpp"
 #include "opentxs/core/Cheque.hpp"
+#include "opentxs/core/Data.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Ledger.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/Message.hpp"
 #include "opentxs/core/Nym.hpp"
+#include "opentxs/core/OTStorage.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/ext/Helpers.hpp"
 #include "opentxs/ext/OTPayment.hpp"
@@ -76,12 +81,14 @@
 
 #include <cinttypes>
 #include <cstdint>
+#include <functional>
 #include <iterator>
 #include <map>
 #include <memory>
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace
 {
@@ -421,6 +428,7 @@ void OTRecordList::SetNotaryID(std::string str_id)
 
 void OTRecordList::AddNotaryID(std::string str_id)
 {
+    box_cache_.clear();
     m_servers.insert(m_servers.end(), str_id);
 }
 
@@ -429,6 +437,7 @@ void OTRecordList::AddNotaryID(std::string str_id)
 void OTRecordList::ClearServers()
 {
     ClearContents();
+    box_cache_.clear();
     m_servers.clear();
 }
 
@@ -465,6 +474,7 @@ void OTRecordList::AddInstrumentDefinitionID(std::string str_id)
         str_asset_name = SwigWrap::GetAssetType_Name(
             str_id);  // Otherwise we try to grab the name.
     // (Otherwise we just leave it blank. The ID is too big to cram in here.)
+    box_cache_.clear();
     m_assets.insert(
         std::pair<std::string, std::string>(str_id, str_asset_name));
 }
@@ -472,6 +482,7 @@ void OTRecordList::AddInstrumentDefinitionID(std::string str_id)
 void OTRecordList::ClearAssets()
 {
     ClearContents();
+    box_cache_.clear();
     m_assets.clear();
 }
 
@@ -483,12 +494,14 @@ void OTRecordList::SetNymID(std::string str_id)
 
 void OTRecordList::AddNymID(std::string str_id)
 {
+    box_cache_.clear();
     m_nyms.insert(m_nyms.end(), str_id);
 }
 
 void OTRecordList::ClearNyms()
 {
     ClearContents();
+    box_cache_.clear();
     m_nyms.clear();
 }
 
@@ -1922,12 +1935,14 @@ std::int32_t OTRecordList::acceptFromInbox(  // a static method
 
 void OTRecordList::AddAccountID(std::string str_id)
 {
+    box_cache_.clear();
     m_accounts.insert(m_accounts.end(), str_id);
 }
 
 void OTRecordList::ClearAccounts()
 {
     ClearContents();
+    box_cache_.clear();
     m_accounts.clear();
 }
 
@@ -2640,301 +2655,575 @@ bool OTRecordList::PerformAutoAccept()
 
 // POPULATE:
 
-// Populates m_contents from OT API. Calls ClearContents().
+// Each box is identified in the cache by a digest of its stored form. Boxes
+// which do not exist yet hash to an empty string.
+std::string OTRecordList::box_hash(
+    const char* folder,
+    const std::string& notaryID,
+    const std::string& boxID)
+{
+    if (notaryID.empty() || boxID.empty() ||
+        (false == OTDB::Exists(folder, notaryID, boxID))) {
+        return {};
+    }
 
-bool OTRecordList::Populate()
+    return digest(OTDB::QueryPlainString(folder, notaryID, boxID));
+}
+
+std::string OTRecordList::digest(const std::string& input)
 {
-    OT_ASSERT(nullptr != m_pLookup);
-    ClearContents();
-    // Loop through all the accounts.
-    //
-    // From Open-Transactions.h:
-    // OT::App().API().OTAPI().GetServerCount()
-    //
-    // From OTAPI.h:
-    // SwigWrap::GetServerCount()  // wraps the above call.
-    //
-    // Before populating, process out any items we're supposed to accept
-    // automatically.
-    //
-    PerformAutoAccept();
-    // OUTPAYMENTS, OUTMAIL, MAIL, PAYMENTS INBOX, and RECORD BOX (2 kinds.)
-    // Loop through the Nyms.
+    auto output = Data::Factory();
+    const bool hashed = OT::App().Crypto().Hash().Digest(
+        proto::HASHTYPE_BLAKE2B256, String(input), output);
+
+    if (false == hashed) { return {}; }
+
+    return std::string(
+        static_cast<const char*>(output->GetPointer()), output->GetSize());
+}
+
+void OTRecordList::emit(
+    const vec_OTRecordList& records,
+    const OTRecordCallback& callback)
+{
+    for (const auto& record : records) { callback(record); }
+}
+
+// The settings which change the records produced from an unchanged box are
+// folded into every hash.
+std::string OTRecordList::flags() const
+{
+    std::string output{};
+    output += m_bRunFast ? 'f' : 's';
+    output += m_bIgnoreMail ? 'i' : 'm';
+
+    return output;
+}
+
+// Reads the IDs needed to locate the boxes of an account, along with the
+// inbox and outbox hashes recorded in the account. The record box has no
+// recorded hash, so it is hashed from its stored form.
+void OTRecordList::hash_account(AccountBoxes& boxes) const
+{
+    boxes.hash_ = flags();
+    const auto& accountID = boxes.account_id_;
+    auto account = wallet_.Account(Identifier::Factory(accountID));
+
+    if (false == bool(account)) { return; }
+
+    boxes.nym_id_ = account.get().GetNymID().str();
+    boxes.notary_id_ = account.get().GetPurportedNotaryID().str();
+    auto inbox = Identifier::Factory();
+    auto outbox = Identifier::Factory();
+    const bool haveInbox = account.get().GetRecordedInboxHash(inbox);
+    const bool haveOutbox = account.get().GetRecordedOutboxHash(outbox);
+    account.Release();
+
+    if (haveInbox) {
+        boxes.hash_ += inbox->str();
+    } else {
+        boxes.hash_ += box_hash(
+            OTFolders::Inbox().Get(), boxes.notary_id_, accountID);
+    }
+
+    boxes.hash_ += '/';
+
+    if (haveOutbox) {
+        boxes.hash_ += outbox->str();
+    } else {
+        boxes.hash_ += box_hash(
+            OTFolders::Outbox().Get(), boxes.notary_id_, accountID);
+    }
+
+    boxes.hash_ += '/';
+    boxes.hash_ += box_hash(
+        OTFolders::RecordBox().Get(), boxes.notary_id_, accountID);
+}
+
+// Covers everything populate_nym reads: outpayments, mail, and the payment
+// inbox, record box, and expired box on each server.
+std::string OTRecordList::hash_nym(const std::string& nymID) const
+{
+    std::string output = flags();
+    String outpayments;
+    const std::int32_t count = SwigWrap::GetNym_OutpaymentsCount(nymID);
+
+    for (std::int32_t index = 0; index < count; ++index) {
+        outpayments.Concatenate(
+            String(SwigWrap::GetNym_OutpaymentsContentsByIndex(nymID, index)));
+    }
+
+    output += digest(outpayments.Get());
+
+    if (!m_bIgnoreMail) {
+        // Mail items are stored by ID and never modified, so the list of IDs
+        // is enough.
+        auto& exec = OT::App().API().Exec();
+
+        for (const auto& id : exec.GetNym_MailCount(nymID)) { output += id; }
+
+        output += '/';
+
+        for (const auto& id : exec.GetNym_OutmailCount(nymID)) {
+            output += id;
+        }
+    }
+
+    for (const auto& server : m_servers) {
+        output += box_hash(OTFolders::PaymentInbox().Get(), server, nymID);
+        output += box_hash(OTFolders::RecordBox().Get(), server, nymID);
+        output += box_hash(OTFolders::ExpiredBox().Get(), server, nymID);
+    }
+
+    return output;
+}
+
+void OTRecordList::load_account(AccountBoxes& boxes) const
+{
+    if (boxes.nym_id_.empty()) { return; }
+
+    const auto theNotaryID = Identifier::Factory(boxes.notary_id_);
+    const auto theNymID = Identifier::Factory(boxes.nym_id_);
+    const auto theAccountID = Identifier::Factory(boxes.account_id_);
+    auto& api = OT::App().API().OTAPI();
+    boxes.inbox_.reset(
+        m_bRunFast
+            ? api.LoadInboxNoVerify(theNotaryID, theNymID, theAccountID)
+            : api.LoadInbox(theNotaryID, theNymID, theAccountID));
+    boxes.outbox_.reset(
+        m_bRunFast
+            ? api.LoadOutboxNoVerify(theNotaryID, theNymID, theAccountID)
+            : api.LoadOutbox(theNotaryID, theNymID, theAccountID));
+    boxes.recordbox_.reset(
+        m_bRunFast
+            ? api.LoadRecordBoxNoVerify(theNotaryID, theNymID, theAccountID)
+            : api.LoadRecordBox(theNotaryID, theNymID, theAccountID));
+}
+
+// Produces the records for one Nym from the OUTPAYMENTS, OUTMAIL, MAIL,
+// PAYMENTS INBOX, and RECORD BOX (2 kinds.)
+void OTRecordList::populate_nym(
+    const std::string& str_nym_id,
+    const std::int32_t nNymIndex,
+    vec_OTRecordList& output)
+{
+    const auto theNymID = Identifier::Factory(str_nym_id);
+    ConstNym pNym = wallet_.Nym(theNymID);
+    if (!pNym) { return; }
+
+    // For each Nym, loop through his OUTPAYMENTS box.
     //
-    std::int32_t nNymIndex = -1;
-    for (auto& it_nym : m_nyms) {
-        ++nNymIndex;
-        if (0 == nNymIndex)
-            otInfo << "=============== " << __FUNCTION__
-                   << ": Beginning loop through Nyms...\n";
-        const std::string& str_nym_id(it_nym);
-        const auto theNymID = Identifier::Factory(str_nym_id);
-        ConstNym pNym = wallet_.Nym(theNymID);
-        if (!pNym) continue;
+    const std::int32_t nOutpaymentsCount =
+        SwigWrap::GetNym_OutpaymentsCount(str_nym_id);
+
+    otInfo << "--------\n"
+           << __FUNCTION__ << ": Nym " << nNymIndex
+           << ", nOutpaymentsCount: " << nOutpaymentsCount
+           << ", ID: " << theNymID->str() << "\n";
+    for (std::int32_t nCurrentOutpayment = 0;
+         nCurrentOutpayment < nOutpaymentsCount;
+         ++nCurrentOutpayment) {
+        otInfo << __FUNCTION__
+               << ": Outpayment instrument: " << nCurrentOutpayment << "\n";
+        const String strOutpayment(
+            SwigWrap::GetNym_OutpaymentsContentsByIndex(
+                str_nym_id, nCurrentOutpayment));
+        std::string str_memo;
+        OTPayment theOutPayment(strOutpayment);
+
+        if (!theOutPayment.IsValid() || !theOutPayment.SetTempValues()) {
+            otErr << __FUNCTION__
+                  << ": Skipping: Unable to load outpayments "
+                     "instrument from string:\n"
+                  << strOutpayment.Get() << "\n";
+            continue;
+        }
+        Amount lAmount = 0;
+        std::string str_amount;  // <========== AMOUNT
+
+        if (theOutPayment.GetAmount(lAmount)) {
+            if (((OTPayment::CHEQUE == theOutPayment.GetType()) ||
+                 (OTPayment::PURSE == theOutPayment.GetType()) ||
+                 (OTPayment::VOUCHER == theOutPayment.GetType())) &&
+                (lAmount > 0))
+                lAmount *= (-1);
+
+            if ((OTPayment::INVOICE == theOutPayment.GetType()) &&
+                (lAmount < 0))
+                lAmount *= (-1);
+
+            String strTemp;
+            strTemp.Format("%" PRId64 "", lAmount);
+            str_amount = strTemp.Get();
+        }
+        auto theInstrumentDefinitionID = Identifier::Factory();
+        const std::string* p_str_asset_type =
+            &OTRecordList::s_blank;  // <========== ASSET TYPE
+        const std::string* p_str_asset_name =
+            &OTRecordList::s_blank;  // instrument definition display name.
+        std::string str_outpmt_asset;  // The instrument definition we found
+                                       // on the payment (if we found
+                                       // anything.)
+        // --------------------------------------------------
+        auto paymentNotaryId = Identifier::Factory();
+        const bool bGotPaymentNotary =
+            theOutPayment.GetNotaryID(paymentNotaryId);
 
-        // For each Nym, loop through his OUTPAYMENTS box.
-        //
-        const std::int32_t nOutpaymentsCount =
-            SwigWrap::GetNym_OutpaymentsCount(str_nym_id);
-
-        otInfo << "--------\n"
-               << __FUNCTION__ << ": Nym " << nNymIndex
-               << ", nOutpaymentsCount: " << nOutpaymentsCount
-               << ", ID: " << theNymID->str() << "\n";
-        for (std::int32_t nCurrentOutpayment = 0;
-             nCurrentOutpayment < nOutpaymentsCount;
-             ++nCurrentOutpayment) {
-            otInfo << __FUNCTION__
-                   << ": Outpayment instrument: " << nCurrentOutpayment << "\n";
-            const String strOutpayment(
-                SwigWrap::GetNym_OutpaymentsContentsByIndex(
-                    str_nym_id, nCurrentOutpayment));
-            std::string str_memo;
-            OTPayment theOutPayment(strOutpayment);
+        std::string str_outpayment_notary_id;
+
+        if (bGotPaymentNotary) {
+            str_outpayment_notary_id = paymentNotaryId->str();
+        }
+        if (str_outpayment_notary_id.empty()) {
+            otErr << __FUNCTION__
+                  << ": Error: Failed while trying to "
+                     "get Notary ID from payment. (Skipping.)\n";
+            continue;
+        }
+        // --------------------------------------------------
+        if (theOutPayment.GetInstrumentDefinitionID(
+                theInstrumentDefinitionID)) {
+            String strTemp(theInstrumentDefinitionID);
+            str_outpmt_asset = strTemp.Get();
+            auto it_asset = m_assets.find(str_outpmt_asset);
+            if (it_asset != m_assets.end())  // Found it on the map of asset
+                                             // types we care about.
+            {
+                p_str_asset_type = &(
+                    it_asset->first);  // Set the instrument definition ID.
+                p_str_asset_name = &(it_asset->second);  // The CurrencyTLA.
+                                                         // Examples: USD,
+                                                         // BTC, etc.
+            } else {
+                // There was definitely an instrument definition on the
+                // instrument, and it definitely did not match any of the
+                // assets that we care about. Therefore, skip.
+                //
+                otInfo << __FUNCTION__
+                       << ": Skipping outpayment (we don't care "
+                          "about this unit type "
+                       << str_outpmt_asset.c_str() << ")\n";
 
-            if (!theOutPayment.IsValid() || !theOutPayment.SetTempValues()) {
                 otErr << __FUNCTION__
-                      << ": Skipping: Unable to load outpayments "
-                         "instrument from string:\n"
-                      << strOutpayment.Get() << "\n";
+                      << ": Skipping outpayment (we don't care "
+                         "about this unit type "
+                      << str_outpmt_asset.c_str() << ")\n";
+
                 continue;
             }
-            Amount lAmount = 0;
-            std::string str_amount;  // <========== AMOUNT
+        }
+        // By this point, p_str_asset_type and p_str_asset_name are
+        // definitely set.
+        OT_ASSERT(nullptr != p_str_asset_type);  // and it's either blank,
+                                                 // or
+        // it's one of the instrument definitions
+        // we care about.
+        OT_ASSERT(nullptr != p_str_asset_name);  // and it's either blank,
+                                                 // or
+        // it's one of the instrument definitions
+        // we care about.
+        auto theAccountID = Identifier::Factory();
+        const std::string* p_str_account =
+            &OTRecordList::s_blank;      // <========== ACCOUNT
+        std::string str_outpmt_account;  // The accountID we found on the
+                                         // payment (if we found anything.)
+
+        // (In Outpayments, the SENDER's account is MY acct.)
+        // UPDATE: UNLESS IT'S A PAYMENT PLAN. In which case the "Sender" of
+        // money is the payer aka customer aka the RECIPIENT of the payment
+        // plan proposal that was sent to him from the merchant. In that
+        // case, the merchant is the "SENDER" of the proposal but on the
+        // financial instrument the customer is the "SENDER" of the money!
+        // OTRecordList needs to handle this case so that the user can see
+        // his outbox contents displayed properly.
+        //
+        if ((theOutPayment.IsPaymentPlan() &&
+             theOutPayment.GetRecipientAcctID(theAccountID)) ||
+            // Otherwise if it's not a payment plan then we're looking
+            // for the Sender (not Recipient) account. See above comment.
+            // Also: Since Nym is ME, the Account must be MY account.
+            //
+            theOutPayment.GetSenderAcctIDForDisplay(theAccountID)) {
+            str_outpmt_account = theAccountID->str();
+            auto it_acct = std::find(
+                m_accounts.begin(), m_accounts.end(), str_outpmt_account);
+            if (it_acct != m_accounts.end())  // Found it on the list of
+                                              // accounts we care about.
+            {
+                p_str_account = &(*it_acct);
+            }
+            // We don't skip vouchers since the sender account (e.g. the
+            // server's account) is definitely not one of my accounts --
+            // so the voucher would end up getting skipped every single
+            // time.
+            //              else if (OTPayment::VOUCHER !=
+            //              theOutPayment.GetType())
+            else {
+                // There was definitely an account on the instrument, and it
+                // definitely did not match any of the accounts that we care
+                // about. Therefore, skip.
+                //
+                otInfo << __FUNCTION__
+                       << ": Skipping outpayment (we don't care "
+                          "about this account "
+                       << str_outpmt_account.c_str() << ")\n";
 
-            if (theOutPayment.GetAmount(lAmount)) {
-                if (((OTPayment::CHEQUE == theOutPayment.GetType()) ||
-                     (OTPayment::PURSE == theOutPayment.GetType()) ||
-                     (OTPayment::VOUCHER == theOutPayment.GetType())) &&
-                    (lAmount > 0))
-                    lAmount *= (-1);
+                otErr << __FUNCTION__
+                      << ": Skipping outpayment (we don't care "
+                         "about this account "
+                      << str_outpmt_account.c_str() << ")\n";
+                continue;
+            }
+        }
+        // By this point, p_str_account is definitely set.
+        OT_ASSERT(nullptr != p_str_account);  // and it's either blank, or
+                                              // it's one of the accounts we
+                                              // care about.
+        // strOutpayment contains the actual outgoing payment instrument.
+        //
+        const std::string str_outpmt_transport_server =
+            SwigWrap::GetNym_OutpaymentsNotaryIDByIndex(
+                str_nym_id, nCurrentOutpayment);
+        const std::string str_outpmt_recipientID =  // Notice here, unlike
+                                                    // the sender account id
+                                                    // above (which is
+                                                    // gleaned from the
+                                                    // instrument itself)
+            SwigWrap::GetNym_OutpaymentsRecipientIDByIndex(  // instead we
+                                                             // get the
+                                                             // recipient
+                                                             // Nym ID
+                                                             // from the
+                                                             // outgoing
+                                                             // message.
+                                                             // This is
+                                                             // good,
+                                                             // because
+                str_nym_id,
+                nCurrentOutpayment);  // otherwise we'd have to check to see
+                                      // if it's a payment plan here, and
+                                      // get the "sender" (payer aka
+                                      // customer) NymID and set it here as
+                                      // the recipient! (Since the merchant
+                                      // "sends" the proposal in a message
+                                      // to the customer, who then "sends"
+                                      // the payments to the merchant acct.)
+                                      // See above comment about this.
+        // str_outpmt_server is the server for this outpayment.
+        // But is that server on our list of servers that we care about?
+        // Let's see if that server is on m_servers (otherwise we can skip
+        // it.)
+        // Also, let's do the same for instrument definitions.
+        //
+        auto it_server = std::find(
+            m_servers.begin(),
+            m_servers.end(),
+            str_outpmt_transport_server);
+
+        if (it_server != m_servers.end())  // Found the notaryID on the list
+                                           // of servers we care about.
+        {
+            // TODO OPTIMIZE: instead of looking up the Nym's name every
+            // time, look it up ONCE when first adding the NymID. Add it to
+            //  a map, instead of a list, and add the Nym's name as the
+            // second item in the map's pair. (Just like I already did with
+            // the instrument definition.)
+            //
+            String strName(
+                m_pLookup->GetNymName(str_outpmt_recipientID, *it_server)),
+                strNameTemp;
+            std::string str_name;
+
+            if (strName.Exists())
+                strNameTemp.Format(OTRecordList::textTo(), strName.Get());
+            else
+                strNameTemp.Format(
+                    OTRecordList::textTo(), str_outpmt_recipientID.c_str());
+
+            str_name = strNameTemp.Get();
+            String strMemo;
+            if (theOutPayment.GetMemo(strMemo)) {
+                str_memo = strMemo.Get();
+            }
+            // For the "date" on this record we're using the "valid from"
+            // date on the instrument.
+            std::string str_date = "0";
+            time64_t tFrom = OT_TIME_ZERO;
+            time64_t tTo = OT_TIME_ZERO;
+
+            if (theOutPayment.GetValidFrom(tFrom)) {
+                const std::uint64_t lFrom = OTTimeGetSecondsFromTime(tFrom);
+                String strFrom;
+                strFrom.Format("%" PRIu64 "", lFrom);
+                str_date = strFrom.Get();
+            }
+            theOutPayment.GetValidTo(tTo);
+            // Instrument type (cheque, voucher, etc)
+            //
+            std::int32_t nType =
+                static_cast<int32_t>(theOutPayment.GetType());
 
-                if ((OTPayment::INVOICE == theOutPayment.GetType()) &&
-                    (lAmount < 0))
-                    lAmount *= (-1);
+            const std::string& str_type = GetTypeString(nType);
+            // CREATE A OTRecord AND POPULATE IT...
+            //
+            otInfo << __FUNCTION__
+                   << ": ADDED: pending outgoing instrument (str_type: "
+                   << str_type.c_str() << ")\n";
+
+            shared_ptr_OTRecord sp_Record(new OTRecord(
+                *this,
+                str_outpmt_transport_server,  // Transport Notary
+                str_outpayment_notary_id,     // The Payment Notary
+                *p_str_asset_type,
+                *p_str_asset_name,
+                str_nym_id,      // This is the Nym WHOSE BOX IT IS.
+                *p_str_account,  // This is the Nym's account according
+                                 // to
+                // the payment instrument, IF that account
+                // was found on our list of accounts we care
+                // about. Or it's blank if no account was
+                // found on the payment instrument.
+                // Everything above this line, it stores a reference to
+                // an
+                // external string.
+                // Everything below this line, it makes its own internal
+                // copy of the string.
+                str_name,  // name of recipient (since its in
+                           // outpayments
+                           // box.)
+                str_date,  // the "valid from" date on the instrument.
+                str_amount,
+                str_type,  // cheque, voucher, smart contract, etc
+                true,      // bIsPending=true since its in the outpayments
+                           // box.
+                true,      // bIsOutgoing=true. Otherwise it'd be in record
+                           // box
+                           // already.
+                false,     // IsRecord
+                false,     // IsReceipt
+                OTRecord::Instrument));
+            sp_Record->SetContents(strOutpayment.Get());
+            sp_Record->SetOtherNymID(str_outpmt_recipientID);
+            if (!str_memo.empty()) sp_Record->SetMemo(str_memo);
+            sp_Record->SetDateRange(tFrom, tTo);
+            sp_Record->SetBoxIndex(nCurrentOutpayment);
+
+            TransactionNumber lTransNum = 0, lTransNumDisplay = 0;
+            theOutPayment.GetOpeningNum(lTransNum, theNymID);
+            theOutPayment.GetTransNumDisplay(lTransNumDisplay);
+
+            if (lTransNumDisplay <= 0) lTransNumDisplay = lTransNum;
+
+            sp_Record->SetTransactionNum(lTransNum);
+            sp_Record->SetTransNumForDisplay(lTransNumDisplay);
+
+            output.push_back(sp_Record);
+
+            //                otErr << "DEBUGGING! Added pending outgoing: "
+            //                << str_type.c_str() << "."
+            //                "\n lTransNum: " << lTransNum << "\n";
+
+        } else  // the server for this outpayment is not on the list of
+                // servers we care about. Skip this outpayment.
+        {
+            otInfo << __FUNCTION__
+                   << ": Skipping outgoing instrument (we don't "
+                      "care about this notary "
+                   << str_outpayment_notary_id.c_str() << ")\n";
+            continue;
+        }
+    }  // for outpayments.
+    // --------------------------------------------------
+    if (!m_bIgnoreMail) {
+        // For each Nym, loop through his MAIL box.
+        auto& exec = OT::App().API().Exec();
+        const auto mail = exec.GetNym_MailCount(str_nym_id);
+        std::int32_t index = 0;
+
+        for (const auto& id : mail) {
+            otInfo << __FUNCTION__ << ": Mail index: " << index << "\n";
+            const auto nymID = Identifier::Factory(str_nym_id);
+
+            if (id.empty()) {
+                index++;
 
-                String strTemp;
-                strTemp.Format("%" PRId64 "", lAmount);
-                str_amount = strTemp.Get();
-            }
-            auto theInstrumentDefinitionID = Identifier::Factory();
-            const std::string* p_str_asset_type =
-                &OTRecordList::s_blank;  // <========== ASSET TYPE
-            const std::string* p_str_asset_name =
-                &OTRecordList::s_blank;  // instrument definition display name.
-            std::string str_outpmt_asset;  // The instrument definition we found
-                                           // on the payment (if we found
-                                           // anything.)
-            // --------------------------------------------------
-            auto paymentNotaryId = Identifier::Factory();
-            const bool bGotPaymentNotary =
-                theOutPayment.GetNotaryID(paymentNotaryId);
-
-            std::string str_outpayment_notary_id;
-
-            if (bGotPaymentNotary) {
-                str_outpayment_notary_id = paymentNotaryId->str();
+                continue;
             }
-            if (str_outpayment_notary_id.empty()) {
+
+            auto message = OT::App().Activity().Mail(
+                nymID, Identifier::Factory(id), StorageBox::MAILINBOX);
+
+            if (!message) {
                 otErr << __FUNCTION__
-                      << ": Error: Failed while trying to "
-                         "get Notary ID from payment. (Skipping.)\n";
+                      << ": Failed to load mail message with "
+                      << "ID " << id << " from inbox." << std::endl;
+                index++;
+
                 continue;
             }
-            // --------------------------------------------------
-            if (theOutPayment.GetInstrumentDefinitionID(
-                    theInstrumentDefinitionID)) {
-                String strTemp(theInstrumentDefinitionID);
-                str_outpmt_asset = strTemp.Get();
-                auto it_asset = m_assets.find(str_outpmt_asset);
-                if (it_asset != m_assets.end())  // Found it on the map of asset
-                                                 // types we care about.
-                {
-                    p_str_asset_type = &(
-                        it_asset->first);  // Set the instrument definition ID.
-                    p_str_asset_name = &(it_asset->second);  // The CurrencyTLA.
-                                                             // Examples: USD,
-                                                             // BTC, etc.
-                } else {
-                    // There was definitely an instrument definition on the
-                    // instrument, and it definitely did not match any of the
-                    // assets that we care about. Therefore, skip.
-                    //
-                    otInfo << __FUNCTION__
-                           << ": Skipping outpayment (we don't care "
-                              "about this unit type "
-                           << str_outpmt_asset.c_str() << ")\n";
 
-                    otErr << __FUNCTION__
-                          << ": Skipping outpayment (we don't care "
-                             "about this unit type "
-                          << str_outpmt_asset.c_str() << ")\n";
+            OT_ASSERT(message);
 
-                    continue;
-                }
-            }
-            // By this point, p_str_asset_type and p_str_asset_name are
-            // definitely set.
-            OT_ASSERT(nullptr != p_str_asset_type);  // and it's either blank,
-                                                     // or
-            // it's one of the instrument definitions
-            // we care about.
-            OT_ASSERT(nullptr != p_str_asset_name);  // and it's either blank,
-                                                     // or
-            // it's one of the instrument definitions
-            // we care about.
-            auto theAccountID = Identifier::Factory();
-            const std::string* p_str_account =
-                &OTRecordList::s_blank;      // <========== ACCOUNT
-            std::string str_outpmt_account;  // The accountID we found on the
-                                             // payment (if we found anything.)
-
-            // (In Outpayments, the SENDER's account is MY acct.)
-            // UPDATE: UNLESS IT'S A PAYMENT PLAN. In which case the "Sender" of
-            // money is the payer aka customer aka the RECIPIENT of the payment
-            // plan proposal that was sent to him from the merchant. In that
-            // case, the merchant is the "SENDER" of the proposal but on the
-            // financial instrument the customer is the "SENDER" of the money!
-            // OTRecordList needs to handle this case so that the user can see
-            // his outbox contents displayed properly.
-            //
-            if ((theOutPayment.IsPaymentPlan() &&
-                 theOutPayment.GetRecipientAcctID(theAccountID)) ||
-                // Otherwise if it's not a payment plan then we're looking
-                // for the Sender (not Recipient) account. See above comment.
-                // Also: Since Nym is ME, the Account must be MY account.
-                //
-                theOutPayment.GetSenderAcctIDForDisplay(theAccountID)) {
-                str_outpmt_account = theAccountID->str();
-                auto it_acct = std::find(
-                    m_accounts.begin(), m_accounts.end(), str_outpmt_account);
-                if (it_acct != m_accounts.end())  // Found it on the list of
-                                                  // accounts we care about.
-                {
-                    p_str_account = &(*it_acct);
-                }
-                // We don't skip vouchers since the sender account (e.g. the
-                // server's account) is definitely not one of my accounts --
-                // so the voucher would end up getting skipped every single
-                // time.
-                //              else if (OTPayment::VOUCHER !=
-                //              theOutPayment.GetType())
-                else {
-                    // There was definitely an account on the instrument, and it
-                    // definitely did not match any of the accounts that we care
-                    // about. Therefore, skip.
-                    //
-                    otInfo << __FUNCTION__
-                           << ": Skipping outpayment (we don't care "
-                              "about this account "
-                           << str_outpmt_account.c_str() << ")\n";
-
-                    otErr << __FUNCTION__
-                          << ": Skipping outpayment (we don't care "
-                             "about this account "
-                          << str_outpmt_account.c_str() << ")\n";
-                    continue;
-                }
-            }
-            // By this point, p_str_account is definitely set.
-            OT_ASSERT(nullptr != p_str_account);  // and it's either blank, or
-                                                  // it's one of the accounts we
-                                                  // care about.
-            // strOutpayment contains the actual outgoing payment instrument.
-            //
-            const std::string str_outpmt_transport_server =
-                SwigWrap::GetNym_OutpaymentsNotaryIDByIndex(
-                    str_nym_id, nCurrentOutpayment);
-            const std::string str_outpmt_recipientID =  // Notice here, unlike
-                                                        // the sender account id
-                                                        // above (which is
-                                                        // gleaned from the
-                                                        // instrument itself)
-                SwigWrap::GetNym_OutpaymentsRecipientIDByIndex(  // instead we
-                                                                 // get the
-                                                                 // recipient
-                                                                 // Nym ID
-                                                                 // from the
-                                                                 // outgoing
-                                                                 // message.
-                                                                 // This is
-                                                                 // good,
-                                                                 // because
-                    str_nym_id,
-                    nCurrentOutpayment);  // otherwise we'd have to check to see
-                                          // if it's a payment plan here, and
-                                          // get the "sender" (payer aka
-                                          // customer) NymID and set it here as
-                                          // the recipient! (Since the merchant
-                                          // "sends" the proposal in a message
-                                          // to the customer, who then "sends"
-                                          // the payments to the merchant acct.)
-                                          // See above comment about this.
-            // str_outpmt_server is the server for this outpayment.
+            const std::string str_mail_server =
+                exec.GetNym_MailNotaryIDByIndex(str_nym_id, id);
+            const std::string str_mail_senderID =
+                exec.GetNym_MailSenderIDByIndex(str_nym_id, id);
+            // str_mail_server is the server for this mail.
             // But is that server on our list of servers that we care about?
-            // Let's see if that server is on m_servers (otherwise we can skip
-            // it.)
-            // Also, let's do the same for instrument definitions.
+            // Let's see if that server is on m_servers (otherwise we can
+            // skip it.)
             //
             auto it_server = std::find(
-                m_servers.begin(),
-                m_servers.end(),
-                str_outpmt_transport_server);
+                m_servers.begin(), m_servers.end(), str_mail_server);
 
-            if (it_server != m_servers.end())  // Found the notaryID on the list
-                                               // of servers we care about.
+            if (it_server != m_servers.end())  // Found the notaryID on the
+                                               // list of servers we care
+                                               // about.
             {
                 // TODO OPTIMIZE: instead of looking up the Nym's name every
-                // time, look it up ONCE when first adding the NymID. Add it to
-                //  a map, instead of a list, and add the Nym's name as the
-                // second item in the map's pair. (Just like I already did with
-                // the instrument definition.)
+                // time, look it
+                // up ONCE when first adding the NymID. Add it to a map,
+                // instead of a list, and add the Nym's name as the second
+                // item in the map's pair. (Just like I already did with the
+                // instrument definition.)
                 //
                 String strName(
-                    m_pLookup->GetNymName(str_outpmt_recipientID, *it_server)),
+                    m_pLookup->GetNymName(str_mail_senderID, *it_server)),
                     strNameTemp;
                 std::string str_name;
 
                 if (strName.Exists())
-                    strNameTemp.Format(OTRecordList::textTo(), strName.Get());
+                    strNameTemp.Format(
+                        OTRecordList::textFrom(), strName.Get());
                 else
                     strNameTemp.Format(
-                        OTRecordList::textTo(), str_outpmt_recipientID.c_str());
+                        OTRecordList::textFrom(),
+                        str_mail_senderID.c_str());
 
                 str_name = strNameTemp.Get();
-                String strMemo;
-                if (theOutPayment.GetMemo(strMemo)) {
-                    str_memo = strMemo.Get();
-                }
-                // For the "date" on this record we're using the "valid from"
-                // date on the instrument.
-                std::string str_date = "0";
-                time64_t tFrom = OT_TIME_ZERO;
-                time64_t tTo = OT_TIME_ZERO;
-
-                if (theOutPayment.GetValidFrom(tFrom)) {
-                    const std::uint64_t lFrom = OTTimeGetSecondsFromTime(tFrom);
-                    String strFrom;
-                    strFrom.Format("%" PRIu64 "", lFrom);
-                    str_date = strFrom.Get();
-                }
-                theOutPayment.GetValidTo(tTo);
-                // Instrument type (cheque, voucher, etc)
-                //
-                std::int32_t nType =
-                    static_cast<int32_t>(theOutPayment.GetType());
-
-                const std::string& str_type = GetTypeString(nType);
+                const std::string* p_str_asset_type =
+                    &OTRecordList::s_blank;  // <========== ASSET TYPE
+                const std::string* p_str_asset_name =
+                    &OTRecordList::s_blank;  // instrument definition
+                                             // display name.
+                const std::string* p_str_account =
+                    &OTRecordList::s_blank;  // <========== ACCOUNT
+
+                std::string str_amount;  // There IS NO amount, on mail. (So
+                                         // we leave this empty.)
+
+                std::uint64_t lDate = message->m_lTime;
+                String strDate;
+                strDate.Format("%" PRIu64 "", lDate);
+                const std::string str_date(strDate.Get());
                 // CREATE A OTRecord AND POPULATE IT...
                 //
-                otInfo << __FUNCTION__
-                       << ": ADDED: pending outgoing instrument (str_type: "
-                       << str_type.c_str() << ")\n";
+                otInfo << __FUNCTION__ << ": ADDED: incoming mail.\n";
 
                 shared_ptr_OTRecord sp_Record(new OTRecord(
                     *this,
-                    str_outpmt_transport_server,  // Transport Notary
-                    str_outpayment_notary_id,     // The Payment Notary
+                    *it_server,             // Transport Notary
+                    OTRecordList::s_blank,  // Payment notary blank (mail)
                     *p_str_asset_type,
                     *p_str_asset_name,
                     str_nym_id,      // This is the Nym WHOSE BOX IT IS.
@@ -2949,917 +3238,666 @@ bool OTRecordList::Populate()
                     // external string.
                     // Everything below this line, it makes its own internal
                     // copy of the string.
-                    str_name,  // name of recipient (since its in
-                               // outpayments
+                    str_name,  // name of sender (since its in incoming mail
                                // box.)
-                    str_date,  // the "valid from" date on the instrument.
+                    str_date,  // How do we get the date from a mail?
                     str_amount,
-                    str_type,  // cheque, voucher, smart contract, etc
-                    true,      // bIsPending=true since its in the outpayments
-                               // box.
-                    true,      // bIsOutgoing=true. Otherwise it'd be in record
-                               // box
-                               // already.
-                    false,     // IsRecord
-                    false,     // IsReceipt
-                    OTRecord::Instrument));
-                sp_Record->SetContents(strOutpayment.Get());
-                sp_Record->SetOtherNymID(str_outpmt_recipientID);
-                if (!str_memo.empty()) sp_Record->SetMemo(str_memo);
-                sp_Record->SetDateRange(tFrom, tTo);
-                sp_Record->SetBoxIndex(nCurrentOutpayment);
+                    OTRecordList::s_message_type,  // "message"
+                    false,  // bIsPending=false since its already received.
+                    false,  // bIsOutgoing=false. It's incoming mail, not
+                            // outgoing mail.
+                    false,  // IsRecord
+                    false,  // IsReceipt
+                    OTRecord::Mail));
+                const String strMail(
+                    SwigWrap::GetNym_MailContentsByIndex(str_nym_id, id));
+                sp_Record->SetContents(strMail.Get());
+                sp_Record->SetOtherNymID(str_mail_senderID);
+                sp_Record->SetBoxIndex(index);
+                sp_Record->SetThreadItemId(id);
+                sp_Record->SetDateRange(
+                    OTTimeGetTimeFromSeconds(message->m_lTime),
+                    OTTimeGetTimeFromSeconds(message->m_lTime));
+                output.push_back(sp_Record);
+            }
 
-                TransactionNumber lTransNum = 0, lTransNumDisplay = 0;
-                theOutPayment.GetOpeningNum(lTransNum, theNymID);
-                theOutPayment.GetTransNumDisplay(lTransNumDisplay);
+            index++;
+        }  // loop through incoming Mail.
+        // Outmail
+        //
+        const auto outmail = exec.GetNym_OutmailCount(str_nym_id);
+        index = 0;
 
-                if (lTransNumDisplay <= 0) lTransNumDisplay = lTransNum;
+        for (const auto& id : outmail) {
+            otInfo << __FUNCTION__ << ": Outmail index: " << index << "\n";
+            const auto nymID = Identifier::Factory(str_nym_id);
 
-                sp_Record->SetTransactionNum(lTransNum);
-                sp_Record->SetTransNumForDisplay(lTransNumDisplay);
+            if (id.empty()) {
+                index++;
 
-                m_contents.push_back(sp_Record);
+                continue;
+            }
 
-                //                otErr << "DEBUGGING! Added pending outgoing: "
-                //                << str_type.c_str() << "."
-                //                "\n lTransNum: " << lTransNum << "\n";
+            auto message = OT::App().Activity().Mail(
+                nymID, Identifier::Factory(id), StorageBox::MAILOUTBOX);
+
+            if (!message) {
+                otErr << __FUNCTION__
+                      << ": Failed to load mail message with "
+                      << "ID " << id << " from outbox." << std::endl;
+                index++;
 
-            } else  // the server for this outpayment is not on the list of
-                    // servers we care about. Skip this outpayment.
-            {
-                otInfo << __FUNCTION__
-                       << ": Skipping outgoing instrument (we don't "
-                          "care about this notary "
-                       << str_outpayment_notary_id.c_str() << ")\n";
                 continue;
             }
-        }  // for outpayments.
-        // --------------------------------------------------
-        if (!m_bIgnoreMail) {
-            // For each Nym, loop through his MAIL box.
-            auto& exec = OT::App().API().Exec();
-            const auto mail = exec.GetNym_MailCount(str_nym_id);
-            std::int32_t index = 0;
 
-            for (const auto& id : mail) {
-                otInfo << __FUNCTION__ << ": Mail index: " << index << "\n";
-                const auto nymID = Identifier::Factory(str_nym_id);
+            OT_ASSERT(message);
 
-                if (id.empty()) {
-                    index++;
+            const std::string str_mail_server =
+                SwigWrap::GetNym_OutmailNotaryIDByIndex(str_nym_id, id);
+            const std::string str_mail_recipientID =
+                SwigWrap::GetNym_OutmailRecipientIDByIndex(str_nym_id, id);
+            // str_mail_server is the server for this mail.
+            // But is that server on our list of servers that we care about?
+            // Let's see if that server is on m_servers (otherwise we can
+            // skip it.)
+            //
+            auto it_server = std::find(
+                m_servers.begin(), m_servers.end(), str_mail_server);
 
-                    continue;
-                }
+            if (it_server != m_servers.end())  // Found the notaryID on the
+                                               // list of servers we care
+                                               // about.
+            {
+                // TODO OPTIMIZE: instead of looking up the Nym's name every
+                // time, look it
+                // up ONCE when first adding the NymID. Add it to a map,
+                // instead of a list, and add the Nym's name as the second
+                // item in the map's pair. (Just like I already did with the
+                // instrument definition.)
+                //
+                String strName(m_pLookup->GetNymName(
+                    str_mail_recipientID, *it_server)),
+                    strNameTemp;
+                std::string str_name;
 
-                auto message = OT::App().Activity().Mail(
-                    nymID, Identifier::Factory(id), StorageBox::MAILINBOX);
+                if (strName.Exists())
+                    strNameTemp.Format(
+                        OTRecordList::textTo(), strName.Get());
+                else
+                    strNameTemp.Format(
+                        OTRecordList::textTo(),
+                        str_mail_recipientID.c_str());
 
-                if (!message) {
-                    otErr << __FUNCTION__
-                          << ": Failed to load mail message with "
-                          << "ID " << id << " from inbox." << std::endl;
-                    index++;
+                str_name = strNameTemp.Get();
+                const std::string* p_str_asset_type =
+                    &OTRecordList::s_blank;  // <========== ASSET TYPE
+                const std::string* p_str_asset_name =
+                    &OTRecordList::s_blank;  // instrument definition
+                                             // display name.
+                const std::string* p_str_account =
+                    &OTRecordList::s_blank;  // <========== ACCOUNT
+
+                std::string str_amount;  // There IS NO amount, on mail. (So
+                                         // we leave this empty.)
+
+                std::uint64_t lDate = message->m_lTime;
+                String strDate;
+                strDate.Format("%" PRIu64 "", lDate);
+                const std::string str_date(strDate.Get());
+                // CREATE A OTRecord AND POPULATE IT...
+                //
+                otInfo << __FUNCTION__ << ": ADDED: sent mail.\n";
 
-                    continue;
-                }
+                shared_ptr_OTRecord sp_Record(new OTRecord(
+                    *this,
+                    *it_server,             // Transport Notary
+                    OTRecordList::s_blank,  // Payment notary blank (mail)
+                    *p_str_asset_type,
+                    *p_str_asset_name,
+                    str_nym_id,      // This is the Nym WHOSE BOX IT IS.
+                    *p_str_account,  // This is the Nym's account according
+                                     // to
+                    // the payment instrument, IF that account
+                    // was found on our list of accounts we care
+                    // about. Or it's blank if no account was
+                    // found on the payment instrument.
+                    // Everything above this line, it stores a reference to
+                    // an
+                    // external string.
+                    // Everything below this line, it makes its own internal
+                    // copy of the string.
+                    str_name,  // name of recipient (since its in outgoing
+                               // mail
+                               // box.)
+                    str_date,  // How do we get the date from a mail?
+                    str_amount,
+                    OTRecordList::s_message_type,  // "message"
+                    false,  // bIsPending=false since its already sent.
+                    true,   // bIsOutgoing=true. It's OUTGOING mail.
+                    false,  // IsRecord (it's not in the record box.)
+                    false,  // IsReceipt
+                    OTRecord::Mail));
+                const String strOutmail(
+                    SwigWrap::GetNym_OutmailContentsByIndex(
+                        str_nym_id, id));
+                sp_Record->SetContents(strOutmail.Get());
+                sp_Record->SetThreadItemId(id);
+                sp_Record->SetBoxIndex(index);
+                sp_Record->SetOtherNymID(str_mail_recipientID);
+                sp_Record->SetDateRange(
+                    OTTimeGetTimeFromSeconds(message->m_lTime),
+                    OTTimeGetTimeFromSeconds(message->m_lTime));
+                output.push_back(sp_Record);
+            }
+            index++;
+        }  // loop through outgoing Mail.
+    }      // If not ignoring mail.
 
-                OT_ASSERT(message);
+    // For each nym, for each server, loop through its payments inbox and
+    // record box.
+    //
+    std::int32_t nServerIndex = -1;
+    for (auto& it_server : m_servers) {
+        ++nServerIndex;
+        const auto theMsgNotaryID = Identifier::Factory(it_server);
+        auto pServer = wallet_.Server(theMsgNotaryID);
+        if (!pServer) {
+            // This can happen if the user erases the server contract
+            // from the wallet. Therefore we just need to skip it.
+            otInfo << __FUNCTION__ << ": Skipping a notary server ("
+                   << it_server.c_str()
+                   << ") since the contract has disappeared from the "
+                      "wallet. (Probably deleted by the user.)\n";
+            continue;
+        }
+        const String strMsgNotaryID(theMsgNotaryID);
+        otInfo << __FUNCTION__ << ": Transport Notary " << nServerIndex
+               << ", ID: " << strMsgNotaryID.Get() << "\n";
+        // OPTIMIZE FYI:
+        // The "NoVerify" version is much faster, but you will lose the
+        // ability to get the
+        // sender/recipient name from the receipts in the box. The code
+        // will, however, work
+        // either way.
+        Ledger* pInbox{nullptr};
 
-                const std::string str_mail_server =
-                    exec.GetNym_MailNotaryIDByIndex(str_nym_id, id);
-                const std::string str_mail_senderID =
-                    exec.GetNym_MailSenderIDByIndex(str_nym_id, id);
-                // str_mail_server is the server for this mail.
-                // But is that server on our list of servers that we care about?
-                // Let's see if that server is on m_servers (otherwise we can
-                // skip it.)
-                //
-                auto it_server = std::find(
-                    m_servers.begin(), m_servers.end(), str_mail_server);
+        if (false == theNymID->empty()) {
+            pInbox = m_bRunFast
+                         ? OT::App().API().OTAPI().LoadPaymentInboxNoVerify(
+                               theMsgNotaryID, theNymID)
+                         : OT::App().API().OTAPI().LoadPaymentInbox(
+                               theMsgNotaryID, theNymID);
+        }
 
-                if (it_server != m_servers.end())  // Found the notaryID on the
-                                                   // list of servers we care
-                                                   // about.
-                {
-                    // TODO OPTIMIZE: instead of looking up the Nym's name every
-                    // time, look it
-                    // up ONCE when first adding the NymID. Add it to a map,
-                    // instead of a list, and add the Nym's name as the second
-                    // item in the map's pair. (Just like I already did with the
-                    // instrument definition.)
-                    //
-                    String strName(
-                        m_pLookup->GetNymName(str_mail_senderID, *it_server)),
-                        strNameTemp;
-                    std::string str_name;
+        std::unique_ptr<Ledger> theInboxAngel(pInbox);
 
-                    if (strName.Exists())
-                        strNameTemp.Format(
-                            OTRecordList::textFrom(), strName.Get());
-                    else
-                        strNameTemp.Format(
-                            OTRecordList::textFrom(),
-                            str_mail_senderID.c_str());
+        std::int32_t nIndex = (-1);
+        // It loaded up, so let's loop through it.
+        if (pInbox) {
+            for (auto& it : pInbox->GetTransactionMap()) {
+                const TransactionNumber lReceiptId = it.first;
+                OTTransaction* pBoxTrans = it.second;
+                OT_ASSERT(nullptr != pBoxTrans);
+                ++nIndex;  // 0 on first iteration.
+                otInfo << __FUNCTION__ << ": Incoming payment: " << nIndex
+                       << "\n";
+                std::string str_name;  // name of sender (since its in the
+                                       // payments inbox.)
+                std::string str_sender_nym_id;
+                std::string str_sender_acct_id;
 
-                    str_name = strNameTemp.Get();
-                    const std::string* p_str_asset_type =
-                        &OTRecordList::s_blank;  // <========== ASSET TYPE
-                    const std::string* p_str_asset_name =
-                        &OTRecordList::s_blank;  // instrument definition
-                                                 // display name.
-                    const std::string* p_str_account =
-                        &OTRecordList::s_blank;  // <========== ACCOUNT
-
-                    std::string str_amount;  // There IS NO amount, on mail. (So
-                                             // we leave this empty.)
-
-                    std::uint64_t lDate = message->m_lTime;
-                    String strDate;
-                    strDate.Format("%" PRIu64 "", lDate);
-                    const std::string str_date(strDate.Get());
-                    // CREATE A OTRecord AND POPULATE IT...
-                    //
-                    otInfo << __FUNCTION__ << ": ADDED: incoming mail.\n";
-
-                    shared_ptr_OTRecord sp_Record(new OTRecord(
-                        *this,
-                        *it_server,             // Transport Notary
-                        OTRecordList::s_blank,  // Payment notary blank (mail)
-                        *p_str_asset_type,
-                        *p_str_asset_name,
-                        str_nym_id,      // This is the Nym WHOSE BOX IT IS.
-                        *p_str_account,  // This is the Nym's account according
-                                         // to
-                        // the payment instrument, IF that account
-                        // was found on our list of accounts we care
-                        // about. Or it's blank if no account was
-                        // found on the payment instrument.
-                        // Everything above this line, it stores a reference to
-                        // an
-                        // external string.
-                        // Everything below this line, it makes its own internal
-                        // copy of the string.
-                        str_name,  // name of sender (since its in incoming mail
-                                   // box.)
-                        str_date,  // How do we get the date from a mail?
-                        str_amount,
-                        OTRecordList::s_message_type,  // "message"
-                        false,  // bIsPending=false since its already received.
-                        false,  // bIsOutgoing=false. It's incoming mail, not
-                                // outgoing mail.
-                        false,  // IsRecord
-                        false,  // IsReceipt
-                        OTRecord::Mail));
-                    const String strMail(
-                        SwigWrap::GetNym_MailContentsByIndex(str_nym_id, id));
-                    sp_Record->SetContents(strMail.Get());
-                    sp_Record->SetOtherNymID(str_mail_senderID);
-                    sp_Record->SetBoxIndex(index);
-                    sp_Record->SetThreadItemId(id);
-                    sp_Record->SetDateRange(
-                        OTTimeGetTimeFromSeconds(message->m_lTime),
-                        OTTimeGetTimeFromSeconds(message->m_lTime));
-                    m_contents.push_back(sp_Record);
-                }
+                std::string str_payment_notary;
+                const std::string str_transport_notary =
+                    strMsgNotaryID.Get();
 
-                index++;
-            }  // loop through incoming Mail.
-            // Outmail
-            //
-            const auto outmail = exec.GetNym_OutmailCount(str_nym_id);
-            index = 0;
+                if (!pBoxTrans->IsAbbreviated()) {
+                    auto theSenderID = Identifier::Factory();
 
-            for (const auto& id : outmail) {
-                otInfo << __FUNCTION__ << ": Outmail index: " << index << "\n";
-                const auto nymID = Identifier::Factory(str_nym_id);
+                    if (pBoxTrans->GetSenderNymIDForDisplay(theSenderID)) {
+                        const String strSenderID(theSenderID);
+                        str_sender_nym_id = strSenderID.Get();
 
-                if (id.empty()) {
-                    index++;
+                        String strName(m_pLookup->GetNymName(
+                            str_sender_nym_id, it_server)),
+                            strNameTemp;
 
-                    continue;
-                }
+                        if (strName.Exists())
+                            strNameTemp.Format(
+                                OTRecordList::textFrom(), strName.Get());
+                        else
+                            strNameTemp.Format(
+                                OTRecordList::textFrom(),
+                                str_sender_nym_id.c_str());
 
-                auto message = OT::App().Activity().Mail(
-                    nymID, Identifier::Factory(id), StorageBox::MAILOUTBOX);
+                        str_name = strNameTemp.Get();
+                    }
 
-                if (!message) {
-                    otErr << __FUNCTION__
-                          << ": Failed to load mail message with "
-                          << "ID " << id << " from outbox." << std::endl;
-                    index++;
+                    theSenderID->Release();
 
-                    continue;
+                    if (pBoxTrans->GetSenderAcctIDForDisplay(theSenderID)) {
+                        const String strSenderID(theSenderID);
+                        str_sender_acct_id = strSenderID.Get();
+                    }
                 }
+                time64_t tValidFrom = OT_TIME_ZERO, tValidTo = OT_TIME_ZERO;
+                std::string str_date =
+                    "0";  // the "date signed" on the transaction receipt.
+                time64_t tDateSigned = pBoxTrans->GetDateSigned();
 
-                OT_ASSERT(message);
+                if (tDateSigned > OT_TIME_ZERO) {
+                    tValidFrom = tDateSigned;
+                    const std::uint64_t lDateSigned =
+                        OTTimeGetSecondsFromTime(tDateSigned);
+                    String strDateSigned;
+                    strDateSigned.Format("%" PRIu64 "", lDateSigned);
+                    str_date = strDateSigned.Get();
+                }
+                const std::string* p_str_asset_type =
+                    &OTRecordList::s_blank;  // <========== ASSET TYPE
+                const std::string* p_str_asset_name =
+                    &OTRecordList::s_blank;  // instrument definition
+                                             // display name.
+                std::string str_amount;      // <========== AMOUNT
+                std::string str_type;        // Instrument type.
+                std::string str_memo;
+                String strContents;  // Instrument contents.
 
-                const std::string str_mail_server =
-                    SwigWrap::GetNym_OutmailNotaryIDByIndex(str_nym_id, id);
-                const std::string str_mail_recipientID =
-                    SwigWrap::GetNym_OutmailRecipientIDByIndex(str_nym_id, id);
-                // str_mail_server is the server for this mail.
-                // But is that server on our list of servers that we care about?
-                // Let's see if that server is on m_servers (otherwise we can
-                // skip it.)
-                //
-                auto it_server = std::find(
-                    m_servers.begin(), m_servers.end(), str_mail_server);
+                TransactionNumber lPaymentInstrumentTransNumDisplay = 0;
 
-                if (it_server != m_servers.end())  // Found the notaryID on the
-                                                   // list of servers we care
-                                                   // about.
-                {
-                    // TODO OPTIMIZE: instead of looking up the Nym's name every
-                    // time, look it
-                    // up ONCE when first adding the NymID. Add it to a map,
-                    // instead of a list, and add the Nym's name as the second
-                    // item in the map's pair. (Just like I already did with the
-                    // instrument definition.)
-                    //
-                    String strName(m_pLookup->GetNymName(
-                        str_mail_recipientID, *it_server)),
-                        strNameTemp;
-                    std::string str_name;
+                if (pBoxTrans->IsAbbreviated()) {
+                    str_type =
+                        pBoxTrans->GetTypeString();  // instrumentNotice,
+                                                     // etc.
+                    Amount lAmount = pBoxTrans->GetAbbrevDisplayAmount();
 
-                    if (strName.Exists())
-                        strNameTemp.Format(
-                            OTRecordList::textTo(), strName.Get());
-                    else
-                        strNameTemp.Format(
-                            OTRecordList::textTo(),
-                            str_mail_recipientID.c_str());
-
-                    str_name = strNameTemp.Get();
-                    const std::string* p_str_asset_type =
-                        &OTRecordList::s_blank;  // <========== ASSET TYPE
-                    const std::string* p_str_asset_name =
-                        &OTRecordList::s_blank;  // instrument definition
-                                                 // display name.
-                    const std::string* p_str_account =
-                        &OTRecordList::s_blank;  // <========== ACCOUNT
-
-                    std::string str_amount;  // There IS NO amount, on mail. (So
-                                             // we leave this empty.)
-
-                    std::uint64_t lDate = message->m_lTime;
-                    String strDate;
-                    strDate.Format("%" PRIu64 "", lDate);
-                    const std::string str_date(strDate.Get());
-                    // CREATE A OTRecord AND POPULATE IT...
+                    if (0 != lAmount) {
+                        String strTemp;
+                        strTemp.Format("%" PRId64 "", lAmount);
+                        str_amount = strTemp.Get();
+                    }
+                } else  // NOT abbreviated. (Full box receipt is already
+                        // loaded.)
+                {
+                    OTPayment* pPayment = GetInstrumentByReceiptID(
+                        *pNym, lReceiptId, *pInbox);
+                    std::unique_ptr<OTPayment> thePaymentAngel(pPayment);
+                    if (!pPayment)  // then we treat it like it's
+                                    // abbreviated.
+                    {
+                        str_type =
+                            pBoxTrans
+                                ->GetTypeString();  // instrumentNotice,
+                                                    // etc.
+                        Amount lAmount =
+                            pBoxTrans->GetAbbrevDisplayAmount();
+
+                        if (0 == lAmount)
+                            lAmount = pBoxTrans->GetReceiptAmount();
+                        if (0 != lAmount) {
+                            String strTemp;
+                            strTemp.Format("%" PRId64 "", lAmount);
+                            str_amount = strTemp.Get();
+                        }
+                    }
+                    // We have pPayment, the instrument accompanying the
+                    // receipt in the payments inbox.
                     //
-                    otInfo << __FUNCTION__ << ": ADDED: sent mail.\n";
-
-                    shared_ptr_OTRecord sp_Record(new OTRecord(
-                        *this,
-                        *it_server,             // Transport Notary
-                        OTRecordList::s_blank,  // Payment notary blank (mail)
-                        *p_str_asset_type,
-                        *p_str_asset_name,
-                        str_nym_id,      // This is the Nym WHOSE BOX IT IS.
-                        *p_str_account,  // This is the Nym's account according
-                                         // to
-                        // the payment instrument, IF that account
-                        // was found on our list of accounts we care
-                        // about. Or it's blank if no account was
-                        // found on the payment instrument.
-                        // Everything above this line, it stores a reference to
-                        // an
-                        // external string.
-                        // Everything below this line, it makes its own internal
-                        // copy of the string.
-                        str_name,  // name of recipient (since its in outgoing
-                                   // mail
-                                   // box.)
-                        str_date,  // How do we get the date from a mail?
-                        str_amount,
-                        OTRecordList::s_message_type,  // "message"
-                        false,  // bIsPending=false since its already sent.
-                        true,   // bIsOutgoing=true. It's OUTGOING mail.
-                        false,  // IsRecord (it's not in the record box.)
-                        false,  // IsReceipt
-                        OTRecord::Mail));
-                    const String strOutmail(
-                        SwigWrap::GetNym_OutmailContentsByIndex(
-                            str_nym_id, id));
-                    sp_Record->SetContents(strOutmail.Get());
-                    sp_Record->SetThreadItemId(id);
-                    sp_Record->SetBoxIndex(index);
-                    sp_Record->SetOtherNymID(str_mail_recipientID);
-                    sp_Record->SetDateRange(
-                        OTTimeGetTimeFromSeconds(message->m_lTime),
-                        OTTimeGetTimeFromSeconds(message->m_lTime));
-                    m_contents.push_back(sp_Record);
-                }
-                index++;
-            }  // loop through outgoing Mail.
-        }      // If not ignoring mail.
-
-        // For each nym, for each server, loop through its payments inbox and
-        // record box.
-        //
-        std::int32_t nServerIndex = -1;
-        for (auto& it_server : m_servers) {
-            ++nServerIndex;
-            const auto theMsgNotaryID = Identifier::Factory(it_server);
-            auto pServer = wallet_.Server(theMsgNotaryID);
-            if (!pServer) {
-                // This can happen if the user erases the server contract
-                // from the wallet. Therefore we just need to skip it.
-                otInfo << __FUNCTION__ << ": Skipping a notary server ("
-                       << it_server.c_str()
-                       << ") since the contract has disappeared from the "
-                          "wallet. (Probably deleted by the user.)\n";
-                continue;
-            }
-            const String strMsgNotaryID(theMsgNotaryID);
-            otInfo << __FUNCTION__ << ": Transport Notary " << nServerIndex
-                   << ", ID: " << strMsgNotaryID.Get() << "\n";
-            // OPTIMIZE FYI:
-            // The "NoVerify" version is much faster, but you will lose the
-            // ability to get the
-            // sender/recipient name from the receipts in the box. The code
-            // will, however, work
-            // either way.
-            Ledger* pInbox{nullptr};
+                    else if (pPayment->SetTempValues()) {
+                        TransactionNumber lPaymentInstrumentTransNum = 0;
+                        TransactionNumber lOpeningNum = 0;
+                        // It may be that the Nym has a transaction number
+                        // of his own
+                        // on this instrument, even if it's not the main
+                        // transaction
+                        // number of the instrument. So we check for that
+                        // first. Otherwise
+                        // we just grab the main transaction number for the
+                        // instrument,
+                        // regardless of which Nym it belongs to. (It will
+                        // be used "for display"
+                        // purposes only.)
+                        //
+                        // UPDATE: The point of having a transaction number
+                        // "For Display"
+                        // is so Alice can look in her outbox, and Bob can
+                        // look in his inbox,
+                        // and they can each find the same transaction based
+                        // on the same
+                        // transaction number that's displayed.
+                        //
+                        // THEREFORE, it's much better to have a number they
+                        // both agree
+                        // is used "for display" versus having them both use
+                        // their own
+                        // personal numbers, which are useless for matching
+                        // up to other
+                        // users.
+                        //
+                        if (pPayment->GetOpeningNum(lOpeningNum, theNymID))
+                            lPaymentInstrumentTransNum = lOpeningNum;
+                        else
+                            pPayment->GetTransactionNum(
+                                lPaymentInstrumentTransNum);
 
-            if (false == theNymID->empty()) {
-                pInbox = m_bRunFast
-                             ? OT::App().API().OTAPI().LoadPaymentInboxNoVerify(
-                                   theMsgNotaryID, theNymID)
-                             : OT::App().API().OTAPI().LoadPaymentInbox(
-                                   theMsgNotaryID, theNymID);
-            }
+                        pPayment->GetTransNumDisplay(
+                            lPaymentInstrumentTransNumDisplay);
 
-            std::unique_ptr<Ledger> theInboxAngel(pInbox);
+                        if (lPaymentInstrumentTransNumDisplay <= 0)
+                            lPaymentInstrumentTransNumDisplay =
+                                lPaymentInstrumentTransNum;
 
-            std::int32_t nIndex = (-1);
-            // It loaded up, so let's loop through it.
-            if (pInbox) {
-                for (auto& it : pInbox->GetTransactionMap()) {
-                    const TransactionNumber lReceiptId = it.first;
-                    OTTransaction* pBoxTrans = it.second;
-                    OT_ASSERT(nullptr != pBoxTrans);
-                    ++nIndex;  // 0 on first iteration.
-                    otInfo << __FUNCTION__ << ": Incoming payment: " << nIndex
-                           << "\n";
-                    std::string str_name;  // name of sender (since its in the
-                                           // payments inbox.)
-                    std::string str_sender_nym_id;
-                    std::string str_sender_acct_id;
-
-                    std::string str_payment_notary;
-                    const std::string str_transport_notary =
-                        strMsgNotaryID.Get();
-
-                    if (!pBoxTrans->IsAbbreviated()) {
-                        auto theSenderID = Identifier::Factory();
-
-                        if (pBoxTrans->GetSenderNymIDForDisplay(theSenderID)) {
-                            const String strSenderID(theSenderID);
-                            str_sender_nym_id = strSenderID.Get();
+                        pPayment->GetValidFrom(tValidFrom);
+                        pPayment->GetValidTo(tValidTo);
 
-                            String strName(m_pLookup->GetNymName(
-                                str_sender_nym_id, it_server)),
-                                strNameTemp;
+                        if (tValidFrom > OT_TIME_ZERO) {
+                            const std::uint64_t lFrom =
+                                OTTimeGetSecondsFromTime(tValidFrom);
+                            String strFrom;
+                            strFrom.Format("%" PRIu64 "", lFrom);
+                            str_date = strFrom.Get();
+                        }
+                        String strMemo;
+                        if (pPayment->GetMemo(strMemo)) {
+                            str_memo = strMemo.Get();
+                        }
 
-                            if (strName.Exists())
-                                strNameTemp.Format(
-                                    OTRecordList::textFrom(), strName.Get());
-                            else
-                                strNameTemp.Format(
-                                    OTRecordList::textFrom(),
-                                    str_sender_nym_id.c_str());
+                        auto paymentNotaryId = Identifier::Factory();
+                        bool bGotPaymentNotary =
+                            pPayment->GetNotaryID(paymentNotaryId);
 
-                            str_name = strNameTemp.Get();
+                        if (bGotPaymentNotary) {
+                            str_payment_notary = paymentNotaryId->str();
                         }
 
-                        theSenderID->Release();
+                        pPayment->GetPaymentContents(strContents);
+                        auto theInstrumentDefinitionID =
+                                 Identifier::Factory(),
+                             theSenderAcctID = Identifier::Factory();
 
-                        if (pBoxTrans->GetSenderAcctIDForDisplay(theSenderID)) {
-                            const String strSenderID(theSenderID);
-                            str_sender_acct_id = strSenderID.Get();
+                        if (pPayment->GetInstrumentDefinitionID(
+                                theInstrumentDefinitionID)) {
+                            String strTemp(theInstrumentDefinitionID);
+                            const std::string str_inpmt_asset(
+                                strTemp.Get());  // The instrument
+                                                 // definition we found
+                            // on the payment (if we found anything.)
+                            auto it_asset = m_assets.find(str_inpmt_asset);
+                            if (it_asset != m_assets.end())  // Found it on
+                                                             // the map of
+                                                             // instrument
+                            // definitions we care about.
+                            {
+                                p_str_asset_type =
+                                    &(it_asset->first);  // Set the asset
+                                                         // type ID.
+                                p_str_asset_name = &(
+                                    it_asset->second);  // The CurrencyTLA.
+                                                        // Examples: USD,
+                                                        // BTC, etc.
+                            } else {
+                                // There was definitely an instrument
+                                // definition on the
+                                // instrument, and it definitely
+                                // did not match any of the assets that we
+                                // care about.
+                                // Therefore, skip.
+                                //
+                                otErr << __FUNCTION__
+                                      << ": Skipping: Incoming payment (we "
+                                         "don't care about asset "
+                                      << str_inpmt_asset.c_str() << ")\n";
+                                continue;
+                            }
                         }
-                    }
-                    time64_t tValidFrom = OT_TIME_ZERO, tValidTo = OT_TIME_ZERO;
-                    std::string str_date =
-                        "0";  // the "date signed" on the transaction receipt.
-                    time64_t tDateSigned = pBoxTrans->GetDateSigned();
-
-                    if (tDateSigned > OT_TIME_ZERO) {
-                        tValidFrom = tDateSigned;
-                        const std::uint64_t lDateSigned =
-                            OTTimeGetSecondsFromTime(tDateSigned);
-                        String strDateSigned;
-                        strDateSigned.Format("%" PRIu64 "", lDateSigned);
-                        str_date = strDateSigned.Get();
-                    }
-                    const std::string* p_str_asset_type =
-                        &OTRecordList::s_blank;  // <========== ASSET TYPE
-                    const std::string* p_str_asset_name =
-                        &OTRecordList::s_blank;  // instrument definition
-                                                 // display name.
-                    std::string str_amount;      // <========== AMOUNT
-                    std::string str_type;        // Instrument type.
-                    std::string str_memo;
-                    String strContents;  // Instrument contents.
-
-                    TransactionNumber lPaymentInstrumentTransNumDisplay = 0;
-
-                    if (pBoxTrans->IsAbbreviated()) {
-                        str_type =
-                            pBoxTrans->GetTypeString();  // instrumentNotice,
-                                                         // etc.
-                        Amount lAmount = pBoxTrans->GetAbbrevDisplayAmount();
-
-                        if (0 != lAmount) {
+                        if (str_sender_acct_id.empty() &&
+                            pPayment->GetSenderAcctIDForDisplay(
+                                theSenderAcctID)) {
+                            String strTemp(theSenderAcctID);
+                            str_sender_acct_id = strTemp.Get();
+                        }
+                        // By this point, p_str_asset_type and
+                        // p_str_asset_name are definitely set.
+                        OT_ASSERT(nullptr != p_str_asset_type);  // and it's
+                                                                 // either
+                        // blank, or
+                        // it's one of
+                        // the asset
+                        // types we
+                        // care about.
+                        OT_ASSERT(nullptr != p_str_asset_name);  // and it's
+                                                                 // either
+                        // blank, or
+                        // it's one of
+                        // the asset
+                        // types we
+                        // care about.
+                        // Instrument type (cheque, voucher, etc)
+                        std::int32_t nType =
+                            static_cast<std::int32_t>(pPayment->GetType());
+
+                        str_type = GetTypeString(nType);
+                        Amount lAmount = 0;
+
+                        if (pPayment->GetAmount(lAmount)) {
                             String strTemp;
                             strTemp.Format("%" PRId64 "", lAmount);
                             str_amount = strTemp.Get();
                         }
-                    } else  // NOT abbreviated. (Full box receipt is already
-                            // loaded.)
-                    {
-                        OTPayment* pPayment = GetInstrumentByReceiptID(
-                            *pNym, lReceiptId, *pInbox);
-                        std::unique_ptr<OTPayment> thePaymentAngel(pPayment);
-                        if (!pPayment)  // then we treat it like it's
-                                        // abbreviated.
-                        {
-                            str_type =
-                                pBoxTrans
-                                    ->GetTypeString();  // instrumentNotice,
-                                                        // etc.
-                            Amount lAmount =
-                                pBoxTrans->GetAbbrevDisplayAmount();
-
-                            if (0 == lAmount)
-                                lAmount = pBoxTrans->GetReceiptAmount();
-                            if (0 != lAmount) {
-                                String strTemp;
-                                strTemp.Format("%" PRId64 "", lAmount);
-                                str_amount = strTemp.Get();
-                            }
-                        }
-                        // We have pPayment, the instrument accompanying the
-                        // receipt in the payments inbox.
-                        //
-                        else if (pPayment->SetTempValues()) {
-                            TransactionNumber lPaymentInstrumentTransNum = 0;
-                            TransactionNumber lOpeningNum = 0;
-                            // It may be that the Nym has a transaction number
-                            // of his own
-                            // on this instrument, even if it's not the main
-                            // transaction
-                            // number of the instrument. So we check for that
-                            // first. Otherwise
-                            // we just grab the main transaction number for the
-                            // instrument,
-                            // regardless of which Nym it belongs to. (It will
-                            // be used "for display"
-                            // purposes only.)
-                            //
-                            // UPDATE: The point of having a transaction number
-                            // "For Display"
-                            // is so Alice can look in her outbox, and Bob can
-                            // look in his inbox,
-                            // and they can each find the same transaction based
-                            // on the same
-                            // transaction number that's displayed.
-                            //
-                            // THEREFORE, it's much better to have a number they
-                            // both agree
-                            // is used "for display" versus having them both use
-                            // their own
-                            // personal numbers, which are useless for matching
-                            // up to other
-                            // users.
-                            //
-                            if (pPayment->GetOpeningNum(lOpeningNum, theNymID))
-                                lPaymentInstrumentTransNum = lOpeningNum;
-                            else
-                                pPayment->GetTransactionNum(
-                                    lPaymentInstrumentTransNum);
-
-                            pPayment->GetTransNumDisplay(
-                                lPaymentInstrumentTransNumDisplay);
-
-                            if (lPaymentInstrumentTransNumDisplay <= 0)
-                                lPaymentInstrumentTransNumDisplay =
-                                    lPaymentInstrumentTransNum;
-
-                            pPayment->GetValidFrom(tValidFrom);
-                            pPayment->GetValidTo(tValidTo);
+                    }
+                }
+                otInfo << __FUNCTION__
+                       << ": ADDED: pending incoming payment (str_type: "
+                       << str_type.c_str() << ")\n";
 
-                            if (tValidFrom > OT_TIME_ZERO) {
-                                const std::uint64_t lFrom =
-                                    OTTimeGetSecondsFromTime(tValidFrom);
-                                String strFrom;
-                                strFrom.Format("%" PRIu64 "", lFrom);
-                                str_date = strFrom.Get();
-                            }
-                            String strMemo;
-                            if (pPayment->GetMemo(strMemo)) {
-                                str_memo = strMemo.Get();
-                            }
+                shared_ptr_OTRecord sp_Record(new OTRecord(
+                    *this,
+                    str_transport_notary,
+                    str_payment_notary,
+                    *p_str_asset_type,
+                    *p_str_asset_name,
+                    str_nym_id,  // This is the Nym WHOSE BOX IT IS.
+                    OTRecordList::s_blank,  // This is the Nym's account
+                                            // for
+                    // this box. (Blank for payments
+                    // inbox.)
+                    // Everything above this line, it stores a reference
+                    // to
+                    // an external string.
+                    // Everything below this line, it makes its own
+                    // internal
+                    // copy of the string.
+                    str_name,  // name of sender (since its in the
+                               // inbox.)
+                    str_date,  // the "valid from" date on the
+                               // instrument.
+                    str_amount,
+                    str_type,  // pending, chequeReceipt, etc.
+                    true,      // I believe all incoming "payment inbox"
+                    // items are pending. (Cheques waiting to be cashed,
+                    // smart contracts waiting to be signed, etc.)
+                    false,  // bIsOutgoing=false. (Since this is the
+                            // payment
+                            // INbox, nothing is outgoing...)
+                    false,  // bIsRecord
+                    false,  // bIsReceipt
+                    OTRecord::Instrument));
+                if (strContents.Exists())
+                    sp_Record->SetContents(strContents.Get());
+                sp_Record->SetDateRange(tValidFrom, tValidTo);
+                sp_Record->SetBoxIndex(nIndex);
+                if (!str_memo.empty()) sp_Record->SetMemo(str_memo);
+                if (!str_sender_nym_id.empty())
+                    sp_Record->SetOtherNymID(str_sender_nym_id);
+                if (!str_sender_acct_id.empty())
+                    sp_Record->SetOtherAccountID(str_sender_acct_id);
+
+                if (lPaymentInstrumentTransNumDisplay > 0)
+                    sp_Record->SetTransNumForDisplay(
+                        lPaymentInstrumentTransNumDisplay);
+                else
+                    sp_Record->SetTransNumForDisplay(
+                        pBoxTrans->GetReferenceNumForDisplay());
+                sp_Record->SetTransactionNum(
+                    pBoxTrans->GetTransactionNum());
+
+                //                    otErr << "DEBUGGING! Added pending
+                //                    incoming payment. str_type: " <<
+                //                    str_type.c_str() <<
+                //                    "\n pBoxTrans->GetTransactionNum(): "
+                //                    << pBoxTrans->GetTransactionNum() <<
+                //                    "\n
+                //                    pBoxTrans->GetReferenceNumForDisplay()"
+                //                    <<
+                //                    pBoxTrans->GetReferenceNumForDisplay()
+                //                    << "\n";
+
+                output.push_back(sp_Record);
+
+            }  // looping through inbox.
+        } else
+            otWarn << __FUNCTION__
+                   << ": Failed loading payments inbox. "
+                      "(Probably just doesn't exist yet.)\n";
+        nIndex = (-1);
+
+        // Also loop through its record box. For this record box, pass the
+        // NYM_ID twice, since it's the recordbox for the Nym.
+        // OPTIMIZE FYI: m_bRunFast impacts run speed here.
+        Ledger* pRecordbox{nullptr};
 
-                            auto paymentNotaryId = Identifier::Factory();
-                            bool bGotPaymentNotary =
-                                pPayment->GetNotaryID(paymentNotaryId);
+        if (false == theNymID->empty()) {
+            pRecordbox =
+                m_bRunFast
+                    ? OT::App().API().OTAPI().LoadRecordBoxNoVerify(
+                          theMsgNotaryID, theNymID, theNymID)  // twice.
+                    : OT::App().API().OTAPI().LoadRecordBox(
+                          theMsgNotaryID, theNymID, theNymID);
+        }
 
-                            if (bGotPaymentNotary) {
-                                str_payment_notary = paymentNotaryId->str();
-                            }
+        std::unique_ptr<Ledger> theRecordBoxAngel(pRecordbox);
 
-                            pPayment->GetPaymentContents(strContents);
-                            auto theInstrumentDefinitionID =
-                                     Identifier::Factory(),
-                                 theSenderAcctID = Identifier::Factory();
+        // It loaded up, so let's loop through it.
+        if (pRecordbox) {
+            for (auto& it : pRecordbox->GetTransactionMap()) {
+                const TransactionNumber lReceiptId = it.first;
+                OTTransaction* pBoxTrans = it.second;
+                OT_ASSERT(nullptr != pBoxTrans);
+                bool bOutgoing = false;
 
-                            if (pPayment->GetInstrumentDefinitionID(
-                                    theInstrumentDefinitionID)) {
-                                String strTemp(theInstrumentDefinitionID);
-                                const std::string str_inpmt_asset(
-                                    strTemp.Get());  // The instrument
-                                                     // definition we found
-                                // on the payment (if we found anything.)
-                                auto it_asset = m_assets.find(str_inpmt_asset);
-                                if (it_asset != m_assets.end())  // Found it on
-                                                                 // the map of
-                                                                 // instrument
-                                // definitions we care about.
-                                {
-                                    p_str_asset_type =
-                                        &(it_asset->first);  // Set the asset
-                                                             // type ID.
-                                    p_str_asset_name = &(
-                                        it_asset->second);  // The CurrencyTLA.
-                                                            // Examples: USD,
-                                                            // BTC, etc.
-                                } else {
-                                    // There was definitely an instrument
-                                    // definition on the
-                                    // instrument, and it definitely
-                                    // did not match any of the assets that we
-                                    // care about.
-                                    // Therefore, skip.
-                                    //
-                                    otErr << __FUNCTION__
-                                          << ": Skipping: Incoming payment (we "
-                                             "don't care about asset "
-                                          << str_inpmt_asset.c_str() << ")\n";
-                                    continue;
-                                }
-                            }
-                            if (str_sender_acct_id.empty() &&
-                                pPayment->GetSenderAcctIDForDisplay(
-                                    theSenderAcctID)) {
-                                String strTemp(theSenderAcctID);
-                                str_sender_acct_id = strTemp.Get();
-                            }
-                            // By this point, p_str_asset_type and
-                            // p_str_asset_name are definitely set.
-                            OT_ASSERT(nullptr != p_str_asset_type);  // and it's
-                                                                     // either
-                            // blank, or
-                            // it's one of
-                            // the asset
-                            // types we
-                            // care about.
-                            OT_ASSERT(nullptr != p_str_asset_name);  // and it's
-                                                                     // either
-                            // blank, or
-                            // it's one of
-                            // the asset
-                            // types we
-                            // care about.
-                            // Instrument type (cheque, voucher, etc)
-                            std::int32_t nType =
-                                static_cast<std::int32_t>(pPayment->GetType());
+                originType theOriginType = pBoxTrans->GetOriginType();
 
-                            str_type = GetTypeString(nType);
-                            Amount lAmount = 0;
+                // Let's say Alice sends a payment plan to Bob, and then Bob
+                // activates it. Alice will receive a notice, via her
+                // Nymbox,
+                // which will be placed in her Nym record box. (The pending
+                // outgoing
+                // plan is removed, since the notice means it's no longer
+                // "pending"
+                // but instead, now officially activated or canceled.) My
+                // point? The
+                // notice in her record box relates to her SENT plan, not a
+                // received
+                // plan. It needs to show up as outgoing/sent, NOT
+                // incoming/received.
+                //
+                // UPDATE: The above is true, but not in the case of Bob! He
+                // had a "pending"
+                // in his inbox, so that needs to become an "activated" in
+                // his inbox! (Not outbox.)
+                //
+                //                  if (OTTransaction::notice ==
+                //                  pBoxTrans->GetType())
+                //                     bOutgoing = true;
+                // -------------------------------------------
+                bool bHasSuccess = false;
+                bool bIsSuccess = false;
 
-                            if (pPayment->GetAmount(lAmount)) {
-                                String strTemp;
-                                strTemp.Format("%" PRId64 "", lAmount);
-                                str_amount = strTemp.Get();
-                            }
-                        }
-                    }
-                    otInfo << __FUNCTION__
-                           << ": ADDED: pending incoming payment (str_type: "
-                           << str_type.c_str() << ")\n";
-
-                    shared_ptr_OTRecord sp_Record(new OTRecord(
-                        *this,
-                        str_transport_notary,
-                        str_payment_notary,
-                        *p_str_asset_type,
-                        *p_str_asset_name,
-                        str_nym_id,  // This is the Nym WHOSE BOX IT IS.
-                        OTRecordList::s_blank,  // This is the Nym's account
-                                                // for
-                        // this box. (Blank for payments
-                        // inbox.)
-                        // Everything above this line, it stores a reference
-                        // to
-                        // an external string.
-                        // Everything below this line, it makes its own
-                        // internal
-                        // copy of the string.
-                        str_name,  // name of sender (since its in the
-                                   // inbox.)
-                        str_date,  // the "valid from" date on the
-                                   // instrument.
-                        str_amount,
-                        str_type,  // pending, chequeReceipt, etc.
-                        true,      // I believe all incoming "payment inbox"
-                        // items are pending. (Cheques waiting to be cashed,
-                        // smart contracts waiting to be signed, etc.)
-                        false,  // bIsOutgoing=false. (Since this is the
-                                // payment
-                                // INbox, nothing is outgoing...)
-                        false,  // bIsRecord
-                        false,  // bIsReceipt
-                        OTRecord::Instrument));
-                    if (strContents.Exists())
-                        sp_Record->SetContents(strContents.Get());
-                    sp_Record->SetDateRange(tValidFrom, tValidTo);
-                    sp_Record->SetBoxIndex(nIndex);
-                    if (!str_memo.empty()) sp_Record->SetMemo(str_memo);
-                    if (!str_sender_nym_id.empty())
-                        sp_Record->SetOtherNymID(str_sender_nym_id);
-                    if (!str_sender_acct_id.empty())
-                        sp_Record->SetOtherAccountID(str_sender_acct_id);
-
-                    if (lPaymentInstrumentTransNumDisplay > 0)
-                        sp_Record->SetTransNumForDisplay(
-                            lPaymentInstrumentTransNumDisplay);
-                    else
-                        sp_Record->SetTransNumForDisplay(
-                            pBoxTrans->GetReferenceNumForDisplay());
-                    sp_Record->SetTransactionNum(
-                        pBoxTrans->GetTransactionNum());
-
-                    //                    otErr << "DEBUGGING! Added pending
-                    //                    incoming payment. str_type: " <<
-                    //                    str_type.c_str() <<
-                    //                    "\n pBoxTrans->GetTransactionNum(): "
-                    //                    << pBoxTrans->GetTransactionNum() <<
-                    //                    "\n
-                    //                    pBoxTrans->GetReferenceNumForDisplay()"
-                    //                    <<
-                    //                    pBoxTrans->GetReferenceNumForDisplay()
-                    //                    << "\n";
-
-                    m_contents.push_back(sp_Record);
-
-                }  // looping through inbox.
-            } else
-                otWarn << __FUNCTION__
-                       << ": Failed loading payments inbox. "
-                          "(Probably just doesn't exist yet.)\n";
-            nIndex = (-1);
-
-            // Also loop through its record box. For this record box, pass the
-            // NYM_ID twice, since it's the recordbox for the Nym.
-            // OPTIMIZE FYI: m_bRunFast impacts run speed here.
-            Ledger* pRecordbox{nullptr};
-
-            if (false == theNymID->empty()) {
-                pRecordbox =
-                    m_bRunFast
-                        ? OT::App().API().OTAPI().LoadRecordBoxNoVerify(
-                              theMsgNotaryID, theNymID, theNymID)  // twice.
-                        : OT::App().API().OTAPI().LoadRecordBox(
-                              theMsgNotaryID, theNymID, theNymID);
-            }
+                bool bCanceled = false;
+                // (A transaction object containing a notice of a success is
+                // not the same thing
+                // as a transaction object containing a successful
+                // transaction. In the latter
+                // case, it's the transaction itself. In the former, it's a
+                // separate object that
+                // serves notice that something has occurred. A notice, for
+                // example, does not
+                // contain a balance agreement. So you couldn't say it's a
+                // "successful transaction"
+                // even though it is serving notice to various parties that
+                // a cron item was successfully
+                // (or not) activated.)
+                // -------------------------------------------
+                ++nIndex;  // 0 on first iteration.
+                otInfo << __FUNCTION__
+                       << ": Payment RECORD index: " << nIndex << "\n";
+                std::string str_name;  // name of sender OR recipient
+                // (depending on whether it was originally incoming or
+                // outgoing.)
+                std::string str_other_nym_id;
+                std::string str_other_acct_id;
 
-            std::unique_ptr<Ledger> theRecordBoxAngel(pRecordbox);
+                OTRecord::OTRecordType recordType = OTRecord::Instrument;
 
-            // It loaded up, so let's loop through it.
-            if (pRecordbox) {
-                for (auto& it : pRecordbox->GetTransactionMap()) {
-                    const TransactionNumber lReceiptId = it.first;
-                    OTTransaction* pBoxTrans = it.second;
-                    OT_ASSERT(nullptr != pBoxTrans);
-                    bool bOutgoing = false;
-
-                    originType theOriginType = pBoxTrans->GetOriginType();
-
-                    // Let's say Alice sends a payment plan to Bob, and then Bob
-                    // activates it. Alice will receive a notice, via her
-                    // Nymbox,
-                    // which will be placed in her Nym record box. (The pending
-                    // outgoing
-                    // plan is removed, since the notice means it's no longer
-                    // "pending"
-                    // but instead, now officially activated or canceled.) My
-                    // point? The
-                    // notice in her record box relates to her SENT plan, not a
-                    // received
-                    // plan. It needs to show up as outgoing/sent, NOT
-                    // incoming/received.
-                    //
-                    // UPDATE: The above is true, but not in the case of Bob! He
-                    // had a "pending"
-                    // in his inbox, so that needs to become an "activated" in
-                    // his inbox! (Not outbox.)
+                if (!pBoxTrans->IsAbbreviated()) {
+                    // We ignore the return value of GetSuccess, since it's
+                    // not
+                    // detailed enough for our needs here.
                     //
-                    //                  if (OTTransaction::notice ==
-                    //                  pBoxTrans->GetType())
-                    //                     bOutgoing = true;
-                    // -------------------------------------------
-                    bool bHasSuccess = false;
-                    bool bIsSuccess = false;
-
-                    bool bCanceled = false;
-                    // (A transaction object containing a notice of a success is
-                    // not the same thing
-                    // as a transaction object containing a successful
-                    // transaction. In the latter
-                    // case, it's the transaction itself. In the former, it's a
-                    // separate object that
-                    // serves notice that something has occurred. A notice, for
-                    // example, does not
-                    // contain a balance agreement. So you couldn't say it's a
-                    // "successful transaction"
-                    // even though it is serving notice to various parties that
-                    // a cron item was successfully
-                    // (or not) activated.)
-                    // -------------------------------------------
-                    ++nIndex;  // 0 on first iteration.
-                    otInfo << __FUNCTION__
-                           << ": Payment RECORD index: " << nIndex << "\n";
-                    std::string str_name;  // name of sender OR recipient
-                    // (depending on whether it was originally incoming or
-                    // outgoing.)
-                    std::string str_other_nym_id;
-                    std::string str_other_acct_id;
-
-                    OTRecord::OTRecordType recordType = OTRecord::Instrument;
-
-                    if (!pBoxTrans->IsAbbreviated()) {
-                        // We ignore the return value of GetSuccess, since it's
-                        // not
-                        // detailed enough for our needs here.
-                        //
-                        pBoxTrans->GetSuccess(&bHasSuccess, &bIsSuccess);
-
-                        if (OTTransaction::notice == pBoxTrans->GetType()) {
-                            recordType = OTRecord::Notice;
-
-                            if (pBoxTrans->IsCancelled()) bCanceled = true;
-                        }
-                        // ----------------------------------------
-                        auto theSenderID = Identifier::Factory(),
-                             theSenderAcctID = Identifier::Factory();
-                        auto theRecipientID = Identifier::Factory(),
-                             theRecipientAcctID = Identifier::Factory();
-
-                        if (pBoxTrans->GetSenderNymIDForDisplay(theSenderID)) {
-                            const String strSenderID(theSenderID);
-                            const std::string str_sender_id(strSenderID.Get());
-
-                            // Usually, Nym is the RECIPIENT. Sometimes he's the
-                            // sender.
-                            // Either way, we want the OTHER ID (the other Nym)
-                            // for display.
-                            // So here, if Nym's CLEARLY the sender, then we
-                            // want the RECIPIENT.
-                            // Whereas if Nym were the recipient, then we'd want
-                            // the SENDER. (For display.)
-                            //
-                            if (0 == str_nym_id.compare(
-                                         str_sender_id))  // str_nym_id IS
-                                                          // str_sender_id.
-                                                          // (Therefore we want
-                                                          // recipient.)
-                            {
-                                if (OTTransaction::notice ==
-                                    pBoxTrans->GetType()) {
-                                    if (originType::origin_payment_plan ==
-                                        theOriginType)
-                                        bOutgoing =
-                                            false;  // Payment Plan "sender"
-                                                    // of funds (payer) is
-                                                    // the recipient of the
-                                                    // plan.
-                                    if (originType::origin_smart_contract ==
-                                        theOriginType)
-                                        bOutgoing =
-                                            true;  // TODO: smart contracts?
-                                } else
-                                    bOutgoing = true;  // if Nym is the sender,
-                                                       // then it must have been
-                                                       // outgoing.
-
-                                if (pBoxTrans->GetRecipientNymIDForDisplay(
-                                        theRecipientID)) {
-                                    const String strRecipientID(theRecipientID);
-                                    const std::string str_recipient_id(
-                                        strRecipientID.Get());
-
-                                    String strName(m_pLookup->GetNymName(
-                                        str_recipient_id, it_server)),
-                                        strNameTemp;
-
-                                    if (strName.Exists())
-                                        strNameTemp.Format(
-                                            OTRecordList::textTo(),
-                                            strName.Get());
-                                    else
-                                        strNameTemp.Format(
-                                            OTRecordList::textTo(),
-                                            str_recipient_id.c_str());
-
-                                    str_name = strNameTemp.Get();
-                                    str_other_nym_id = str_recipient_id;
-
-                                    if (pBoxTrans->GetRecipientAcctIDForDisplay(
-                                            theRecipientAcctID)) {
-                                        const String strRecipientAcctID(
-                                            theRecipientAcctID);
-                                        str_other_acct_id =
-                                            strRecipientAcctID.Get();
-                                    }
-                                }
-                            } else  // str_nym_id IS NOT str_sender_id.
-                                    // (Therefore we want sender.)
-                            {  // In this case, some OTHER Nym is the sender, so
-                                // it must have been incoming.
-                                // (And bOutgoing is already false.)
-
-                                if (OTTransaction::notice ==
-                                    pBoxTrans->GetType()) {
-                                    if (originType::origin_payment_plan ==
-                                        theOriginType)
-                                        bOutgoing =
-                                            true;  // Payment Plan "recipient"
-                                                   // of funds (merchant) is the
-                                                   // sender of the plan.
-                                    if (originType::origin_smart_contract ==
-                                        theOriginType)
-                                        bOutgoing =
-                                            false;  // TODO: Smart contracts?
-                                } else
-                                    bOutgoing = false;
+                    pBoxTrans->GetSuccess(&bHasSuccess, &bIsSuccess);
 
-                                String strName(m_pLookup->GetNymName(
-                                    str_sender_id, it_server)),
-                                    strNameTemp;
+                    if (OTTransaction::notice == pBoxTrans->GetType()) {
+                        recordType = OTRecord::Notice;
 
-                                if (strName.Exists())
-                                    strNameTemp.Format(
-                                        OTRecordList::textFrom(),
-                                        strName.Get());
-                                else
-                                    strNameTemp.Format(
-                                        OTRecordList::textFrom(),
-                                        str_sender_id.c_str());
+                        if (pBoxTrans->IsCancelled()) bCanceled = true;
+                    }
+                    // ----------------------------------------
+                    auto theSenderID = Identifier::Factory(),
+                         theSenderAcctID = Identifier::Factory();
+                    auto theRecipientID = Identifier::Factory(),
+                         theRecipientAcctID = Identifier::Factory();
 
-                                str_name = strNameTemp.Get();
-                                str_other_nym_id = str_sender_id;
+                    if (pBoxTrans->GetSenderNymIDForDisplay(theSenderID)) {
+                        const String strSenderID(theSenderID);
+                        const std::string str_sender_id(strSenderID.Get());
 
-                                if (pBoxTrans->GetSenderAcctIDForDisplay(
-                                        theSenderAcctID)) {
-                                    const String strSenderAcctID(
-                                        theSenderAcctID);
-                                    str_other_acct_id = strSenderAcctID.Get();
-                                }
-                            }
-                        }
-                        // In this block below, we already KNOW
-                        // GetSenderNymIDForDisplay is EMPTY.
-                        // (So it's "recipient or bust.")
-                        else if (pBoxTrans->GetRecipientNymIDForDisplay(
-                                     theRecipientID)) {
-                            const String strRecipientID(theRecipientID);
-                            const std::string str_recipient_id(
-                                strRecipientID.Get());
+                        // Usually, Nym is the RECIPIENT. Sometimes he's the
+                        // sender.
+                        // Either way, we want the OTHER ID (the other Nym)
+                        // for display.
+                        // So here, if Nym's CLEARLY the sender, then we
+                        // want the RECIPIENT.
+                        // Whereas if Nym were the recipient, then we'd want
+                        // the SENDER. (For display.)
+                        //
+                        if (0 == str_nym_id.compare(
+                                     str_sender_id))  // str_nym_id IS
+                                                      // str_sender_id.
+                                                      // (Therefore we want
+                                                      // recipient.)
+                        {
+                            if (OTTransaction::notice ==
+                                pBoxTrans->GetType()) {
+                                if (originType::origin_payment_plan ==
+                                    theOriginType)
+                                    bOutgoing =
+                                        false;  // Payment Plan "sender"
+                                                // of funds (payer) is
+                                                // the recipient of the
+                                                // plan.
+                                if (originType::origin_smart_contract ==
+                                    theOriginType)
+                                    bOutgoing =
+                                        true;  // TODO: smart contracts?
+                            } else
+                                bOutgoing = true;  // if Nym is the sender,
+                                                   // then it must have been
+                                                   // outgoing.
 
-                            if (0 !=
-                                str_nym_id.compare(
-                                    str_recipient_id))  // str_nym_id is NOT
-                                                        // str_recipient_id.
-                                                        // (Therefore we want
-                                                        // str_recipient_id.)
-                            {
-                                // If Nym is not the recipient, then he must be
-                                // the sender.
-                                // (Therefore it must be outgoing.)
-                                //
-                                if (OTTransaction::notice ==
-                                    pBoxTrans->GetType())
-                                    bOutgoing = false;  // Payment Plan "sender"
-                                                        // of funds (payer) is
-                                                        // the recipient of the
-                                                        // plan.
-                                // TODO: Smart contracts?
-                                else
-                                    bOutgoing = true;  // if Nym is the sender,
-                                                       // then it must have been
-                                                       // outgoing.
+                            if (pBoxTrans->GetRecipientNymIDForDisplay(
+                                    theRecipientID)) {
+                                const String strRecipientID(theRecipientID);
+                                const std::string str_recipient_id(
+                                    strRecipientID.Get());
 
                                 String strName(m_pLookup->GetNymName(
                                     str_recipient_id, it_server)),
@@ -3867,7 +3905,8 @@ bool OTRecordList::Populate()
 
                                 if (strName.Exists())
                                     strNameTemp.Format(
-                                        OTRecordList::textTo(), strName.Get());
+                                        OTRecordList::textTo(),
+                                        strName.Get());
                                 else
                                     strNameTemp.Format(
                                         OTRecordList::textTo(),
@@ -3875,6 +3914,7 @@ bool OTRecordList::Populate()
 
                                 str_name = strNameTemp.Get();
                                 str_other_nym_id = str_recipient_id;
+
                                 if (pBoxTrans->GetRecipientAcctIDForDisplay(
                                         theRecipientAcctID)) {
                                     const String strRecipientAcctID(
@@ -3883,1146 +3923,635 @@ bool OTRecordList::Populate()
                                         strRecipientAcctID.Get();
                                 }
                             }
-                        }
-                    }  // if not abbreviated.
-                    time64_t tValidFrom = OT_TIME_ZERO, tValidTo = OT_TIME_ZERO;
-                    std::string str_date =
-                        "0";  // the "date signed" on the transaction receipt.
-                    time64_t tDateSigned = pBoxTrans->GetDateSigned();
-
-                    if (tDateSigned > OT_TIME_ZERO) {
-                        tValidFrom = tDateSigned;
-                        const std::uint64_t lDateSigned =
-                            OTTimeGetSecondsFromTime(tDateSigned);
-                        String strDateSigned;
-                        strDateSigned.Format("%" PRIu64 "", lDateSigned);
-                        str_date = strDateSigned.Get();
-                    }
-                    const std::string* p_str_asset_type =
-                        &OTRecordList::s_blank;  // <========== ASSET TYPE
-                    const std::string* p_str_asset_name =
-                        &OTRecordList::s_blank;  // instrument definition
-                                                 // display name.
-                    const std::string* p_str_account =
-                        &OTRecordList::s_blank;  // <========== ACCOUNT
-                    std::string str_amount;      // <========== AMOUNT
-                    std::string str_type;        // Instrument type.
-                    std::string str_memo;  // Instrument memo (if applicable.)
-                    String strContents;    // Instrument contents.
-
-                    std::string str_payment_notary_id;
-                    TransactionNumber lPaymentInstrumentTransNumDisplay = 0;
-
-                    if (pBoxTrans->IsAbbreviated()) {
-                        str_type =
-                            pBoxTrans->GetTypeString();  // instrumentNotice,
-                                                         // etc.
-                        Amount lAmount = pBoxTrans->GetAbbrevDisplayAmount();
-
-                        if (0 != lAmount) {
-                            String strTemp;
-                            strTemp.Format("%" PRId64 "", lAmount);
-                            str_amount = strTemp.Get();
-                        }
-                    } else  // NOT abbreviated. (Full box receipt is already
-                            // loaded.)
-                    {
-                        OTPayment* pPayment = GetInstrumentByReceiptID(
-                            *pNym, lReceiptId, *pRecordbox);
-                        std::unique_ptr<OTPayment> thePaymentAngel(pPayment);
+                        } else  // str_nym_id IS NOT str_sender_id.
+                                // (Therefore we want sender.)
+                        {  // In this case, some OTHER Nym is the sender, so
+                            // it must have been incoming.
+                            // (And bOutgoing is already false.)
+
+                            if (OTTransaction::notice ==
+                                pBoxTrans->GetType()) {
+                                if (originType::origin_payment_plan ==
+                                    theOriginType)
+                                    bOutgoing =
+                                        true;  // Payment Plan "recipient"
+                                               // of funds (merchant) is the
+                                               // sender of the plan.
+                                if (originType::origin_smart_contract ==
+                                    theOriginType)
+                                    bOutgoing =
+                                        false;  // TODO: Smart contracts?
+                            } else
+                                bOutgoing = false;
 
-                        if (nullptr == pPayment)  // then we treat it like it's
-                                                  // abbreviated.
-                        {
-                            str_type =
-                                pBoxTrans
-                                    ->GetTypeString();  // instrumentNotice,
-                                                        // etc.
-                            Amount lAmount =
-                                pBoxTrans->GetAbbrevDisplayAmount();
-
-                            if (0 != lAmount) {
-                                String strTemp;
-                                strTemp.Format("%" PRId64 "", lAmount);
-                                str_amount = strTemp.Get();
-                            }
-                        }
-                        // We have pPayment, the instrument accompanying the
-                        // receipt in the payments recordbox.
-                        else if (pPayment->SetTempValues()) {
-                            TransactionNumber lPaymentInstrumentTransNum = 0;
-                            TransactionNumber lOpeningNum = 0;
+                            String strName(m_pLookup->GetNymName(
+                                str_sender_id, it_server)),
+                                strNameTemp;
 
-                            if (pPayment->GetOpeningNum(lOpeningNum, theNymID))
-                                lPaymentInstrumentTransNum = lOpeningNum;
+                            if (strName.Exists())
+                                strNameTemp.Format(
+                                    OTRecordList::textFrom(),
+                                    strName.Get());
                             else
-                                pPayment->GetTransactionNum(
-                                    lPaymentInstrumentTransNum);
-
-                            pPayment->GetTransNumDisplay(
-                                lPaymentInstrumentTransNumDisplay);
-
-                            if (lPaymentInstrumentTransNumDisplay <= 0)
-                                lPaymentInstrumentTransNumDisplay =
-                                    lPaymentInstrumentTransNum;
-
-                            pPayment->GetValidFrom(tValidFrom);
-                            pPayment->GetValidTo(tValidTo);
-
-                            if (tValidFrom > OT_TIME_ZERO) {
-                                const std::uint64_t lFrom =
-                                    OTTimeGetSecondsFromTime(tValidFrom);
-                                String strFrom;
-                                strFrom.Format("%" PRIu64 "", lFrom);
-                                str_date = strFrom.Get();
-                            }
-                            pPayment->GetPaymentContents(strContents);
-                            auto theAccountID = Identifier::Factory();
-
-                            if (bOutgoing)  // Nym is sender.
-                            {
-                                if (((pPayment->IsPaymentPlan() ||
-                                      pPayment->IsNotice()) &&
-                                     pPayment->GetRecipientAcctID(
-                                         theAccountID)) ||
-                                    pPayment->GetSenderAcctIDForDisplay(
-                                        theAccountID))  // Since Nym is ME, the
-                                                        // Account must be MY
-                                                        // acct.
-                                {  // (If this record was originally OUTgoing,
-                                    // then the SENDER's account is MY acct.)
-                                    //
-                                    // UPDATE: Unless I sent a payment plan
-                                    // proposal. In which case I, the merchant,
-                                    // am the "sender" of the proposal, but the
-                                    // "sender" on the instrument is the
-                                    // customer,
-                                    // since he will be "sending" me the money!
-                                    // So the "Recipient" of the proposal
-                                    // message
-                                    // (outgoing from my perspective) is
-                                    // actually the "Sender" of the money
-                                    // according to the
-                                    // instrument (which will be incoming,
-                                    // according to my perspective, when those
-                                    // payments
-                                    // start to arrive.) Thus, though the
-                                    // merchant is the "sender" of the proposal,
-                                    // he's the
-                                    // "recipient" on the instrument.
-                                    String strTemp(theAccountID);
-                                    std::string str_outpmt_account =
-                                        strTemp.Get();  // The accountID we
-                                                        // found on the payment
-                                                        // (only applies to
-                                                        // outgoing payments.)
-                                    auto it_acct = std::find(
-                                        m_accounts.begin(),
-                                        m_accounts.end(),
-                                        str_outpmt_account);
-                                    if (it_acct !=
-                                        m_accounts.end())  // Found it on the
-                                                           // list of accounts
-                                                           // we care about.
-                                    {
-                                        p_str_account = &(*it_acct);
-                                    } else {
-                                        // There was definitely an account on
-                                        // the instrument, and it definitely
-                                        // did not match any of the accounts
-                                        // that we care about. Therefore, skip.
-                                        //
-                                        otInfo << __FUNCTION__
-                                               << ": Skipping 'sent payment' "
-                                                  "record. (We don't care "
-                                                  "about account "
-                                               << str_outpmt_account.c_str()
-                                               << ")\n";
-                                        continue;
-                                    }
-                                }
-                            } else  // Nym is recipient.
-                            {
-                                // Why is this here? Because if Nym is
-                                // recipient, let's say he received
-                                // an instrumentNotice containing a
-                                // sendNymInstrument message containing
-                                // an incoming cheque. Well... that incoming
-                                // cheque (the payload on
-                                // sendNymInstrument message) is ENCRYPTED.
-                                // Meaning the above calls to
-                                // pBoxReceipt->GetSenderAcctID on the
-                                // instrumentNotice transaction will
-                                // FAIL. One option is to pass pNym into
-                                // GetSenderAcctID so it can
-                                // decrypt the payload and return the value. But
-                                // since we already have
-                                // the payload decrypted here (we already have
-                                // the cheque loaded up
-                                // here) we can just grab the senderAcctID
-                                // directly from the cheque.
-                                // That's why this is here -- because this is
-                                // where we KNOW we have the
-                                // account ID -- so we grab it.
-                                //
-                                if (str_other_acct_id.empty() &&
-                                    (((pPayment->IsPaymentPlan() ||
-                                       pPayment->IsNotice()) &&
-                                      pPayment->GetRecipientAcctID(
-                                          theAccountID)) ||
-                                     pPayment->GetSenderAcctIDForDisplay(
-                                         theAccountID))) {
-                                    String strTemp(theAccountID);
-                                    str_other_acct_id = strTemp.Get();
-                                }
-                            }
-                            // By this point, p_str_account is definitely set.
-                            OT_ASSERT(nullptr != p_str_account);  // and it's
-                                                                  // either
-                                                                  // blank, or
-                                                                  // it's one of
-                                                                  // the
-                                                                  // accounts we
-                                                                  // care about.
-                            auto theInstrumentDefinitionID =
-                                Identifier::Factory();
-
-                            if (pPayment->GetInstrumentDefinitionID(
-                                    theInstrumentDefinitionID)) {
-                                String strTemp(theInstrumentDefinitionID);
-                                const std::string str_inpmt_asset(
-                                    strTemp.Get());  // The instrument
-                                                     // definition we found on
-                                                     // the payment (if we found
-                                                     // anything.)
-                                auto it_asset = m_assets.find(str_inpmt_asset);
-                                if (it_asset !=
-                                    m_assets.end())  // Found it on the map of
-                                                     // instrument definitions
-                                                     // we care about.
-                                {
-                                    p_str_asset_type =
-                                        &(it_asset->first);  // Set the asset
-                                                             // type ID.
-                                    p_str_asset_name =
-                                        &(it_asset->second);  // The
-                                                              // CurrencyTLA.
-                                                              // Examples: USD,
-                                                              // BTC, etc.
-                                } else {
-                                    // There was definitely an instrument
-                                    // definition on the instrument, and it
-                                    // definitely
-                                    // did not match any of the assets that we
-                                    // care about. Therefore, skip.
-                                    //
-                                    otErr << __FUNCTION__
-                                          << ": Skipping: Payment record (we "
-                                             "don't care about instrument "
-                                             "definition "
-                                          << str_inpmt_asset.c_str() << ")\n";
-                                    continue;
-                                }
-                            }
-                            // By this point, p_str_asset_type and
-                            // p_str_asset_name are definitely set.
-                            OT_ASSERT(nullptr != p_str_asset_type);  // and it's
-                            // either blank,
-                            // or it's one of
-                            // the asset
-                            // types we care
-                            // about.
-                            OT_ASSERT(nullptr != p_str_asset_name);  // and it's
-                            // either blank,
-                            // or it's one of
-                            // the asset
-                            // types we care
-                            // about.
-
-                            String strMemo;
-                            if (pPayment->GetMemo(strMemo)) {
-                                str_memo = strMemo.Get();
-                            }
-                            // Instrument type (cheque, voucher, etc)
-                            std::int32_t nType =
-                                static_cast<std::int32_t>(pPayment->GetType());
-
-                            str_type = GetTypeString(nType);
-                            Amount lAmount = 0;
+                                strNameTemp.Format(
+                                    OTRecordList::textFrom(),
+                                    str_sender_id.c_str());
 
-                            if (pPayment->GetAmount(lAmount)) {
-                                String strTemp;
-                                strTemp.Format("%" PRId64 "", lAmount);
-                                str_amount = strTemp.Get();
-                            }
+                            str_name = strNameTemp.Get();
+                            str_other_nym_id = str_sender_id;
 
-                            auto paymentNotaryId = Identifier::Factory();
-                            if (pPayment->GetNotaryID(paymentNotaryId)) {
-                                str_payment_notary_id = paymentNotaryId->str();
+                            if (pBoxTrans->GetSenderAcctIDForDisplay(
+                                    theSenderAcctID)) {
+                                const String strSenderAcctID(
+                                    theSenderAcctID);
+                                str_other_acct_id = strSenderAcctID.Get();
                             }
                         }
                     }
-                    otInfo << __FUNCTION__ << ": ADDED: Payment record "
-                           << (bOutgoing ? "(sent)" : "(received)")
-                           << " (str_type: " << str_type.c_str() << ")\n";
-
-                    shared_ptr_OTRecord sp_Record(new OTRecord(
-                        *this,
-                        theMsgNotaryID->str(),  // Transport Notary
-                        str_payment_notary_id,  // Payment Notary
-                        *p_str_asset_type,
-                        *p_str_asset_name,
-                        str_nym_id,      // This is the Nym WHOSE BOX IT IS.
-                        *p_str_account,  // This is the Nym's account for
-                                         // this box. (Blank for incoming,
-                                         // set for outgoing.)
-                        // Everything above this line, it stores a reference
-                        // to an external string.
-                        // Everything below this line, it makes its own
-                        // internal copy of the string.
-                        str_name,  // name of sender or recipient (since its
-                                   // in the recordbox.)
-                        str_date,  // the "date signed" on the receipt.
-                        str_amount,
-                        str_type,   // pending, chequeReceipt, etc.
-                        false,      // Everything in the recordbox is finished.
-                                    // (NOT pending.)
-                        bOutgoing,  // Since it's the recordbox, it contains
-                                    // both incoming and outgoing receipts.
-                        true,       // IsRecord
-                        false,      // IsReceipt,
-                        recordType));
-
-                    if (strContents.Exists())
-                        sp_Record->SetContents(strContents.Get());
-
-                    sp_Record->SetDateRange(tValidFrom, tValidTo);
-                    sp_Record->SetBoxIndex(nIndex);
-
-                    if (!str_memo.empty()) sp_Record->SetMemo(str_memo);
-                    if (!str_other_nym_id.empty())
-                        sp_Record->SetOtherNymID(str_other_nym_id);
-                    if (!str_other_acct_id.empty())
-                        sp_Record->SetOtherAccountID(str_other_acct_id);
-
-                    if (lPaymentInstrumentTransNumDisplay > 0)
-                        sp_Record->SetTransNumForDisplay(
-                            lPaymentInstrumentTransNumDisplay);
-                    else
-                        sp_Record->SetTransNumForDisplay(
-                            pBoxTrans->GetReferenceNumForDisplay());
-                    sp_Record->SetTransactionNum(
-                        pBoxTrans->GetTransactionNum());
-
-                    if (bHasSuccess) sp_Record->SetSuccess(bIsSuccess);
-
-                    if (bCanceled) sp_Record->SetCanceled();
-
-                    sp_Record->SetOriginType(theOriginType);
-
-                    //                    otErr << "DEBUGGING! RECORD LIST:
-                    //                    Added " << (bOutgoing ? "sent":
-                    //                    "received") << " payment record: " <<
-                    //                    pBoxTrans->GetTypeString() << "\n
-                    //                    str_nym_id: " << str_nym_id << "\n
-                    //                    str_other_nym_id: " <<
-                    //                    str_other_nym_id <<
-                    //                    "\n pBoxTrans->GetTransactionNum(): "
-                    //                    << pBoxTrans->GetTransactionNum() <<
-                    //                    "\n
-                    //                    pBoxTrans->GetReferenceNumForDisplay()"
-                    //                    <<
-                    //                    pBoxTrans->GetReferenceNumForDisplay()
-                    //                    << "\n";
-
-                    m_contents.push_back(sp_Record);
-
-                }  // Loop through Recordbox
-            } else
-                otWarn << __FUNCTION__
-                       << ": Failed loading payments record "
-                          "box. (Probably just doesn't exist "
-                          "yet.)\n";
-
-            // EXPIRED RECORDS:
-            nIndex = (-1);
-
-            // Also loop through its expired record box.
-            // OPTIMIZE FYI: m_bRunFast impacts run speed here.
-            Ledger* pExpiredbox{nullptr};
-
-            if (false == theNymID->empty()) {
-                pExpiredbox =
-                    m_bRunFast ? OT::App().API().OTAPI().LoadExpiredBoxNoVerify(
-                                     theMsgNotaryID, theNymID)
-                               : OT::App().API().OTAPI().LoadExpiredBox(
-                                     theMsgNotaryID, theNymID);
-            }
-
-            std::unique_ptr<Ledger> theExpiredBoxAngel(pExpiredbox);
-
-            // It loaded up, so let's loop through it.
-            if (pExpiredbox) {
-                for (auto& it : pExpiredbox->GetTransactionMap()) {
-                    const TransactionNumber lReceiptId = it.first;
-                    OTTransaction* pBoxTrans = it.second;
-                    OT_ASSERT(nullptr != pBoxTrans);
-                    bool bOutgoing{false};
-
-                    // Let's say Alice sends a payment plan to Bob, and then Bob
-                    // activates it. Alice will receive a notice, via her
-                    // Nymbox,
-                    // which will be placed in her Nym record box. (The pending
-                    // outgoing
-                    // plan is removed, since the notice means it's no longer
-                    // "pending" but instead, now officially activated or
-                    // canceled.) My point? The notice in her record box relates
-                    // to her SENT plan, not a received plan. It needs to show
-                    // up as outgoing/sent, NOT incoming/received.
-                    //
-                    //                  if (OTTransaction::notice ==
-                    //                  pBoxTrans->GetType())
-                    //                      bOutgoing = true;
-                    // -------------------------------------------
-                    bool bHasSuccess{false};
-                    bool bIsSuccess{false};
-
-                    bool bCanceled{false};
-                    // (A transaction object containing a notice of a success is
-                    // not the same thing as a transaction object containing a
-                    // successful transaction. In the latter case, it's the
-                    // transaction itself. In the former, it's a separate object
-                    // that serves notice that something has occurred. A notice,
-                    // for example, does not contain a balance agreement. So you
-                    // couldn't say it's a "successful transaction" even though
-                    // it is serving notice to various parties that a cron item
-                    // was successfully (or not) activated.)
-                    //
-                    // -------------------------------------------
-                    ++nIndex;  // 0 on first iteration.
-                    otInfo << __FUNCTION__
-                           << ": Expired payment RECORD index: " << nIndex
-                           << "\n";
-                    std::string str_name;  // name of sender OR recipient
-                                           // (depending on whether it was
-                                           // originally incoming or outgoing.)
-                    std::string str_other_nym_id;
-                    std::string str_other_acct_id;
-
-                    OTRecord::OTRecordType recordType = OTRecord::Instrument;
-
-                    if (!pBoxTrans->IsAbbreviated()) {
-                        // We ignore the return value of GetSuccess, since it's
-                        // not detailed enough for our needs here.
-                        //
-                        pBoxTrans->GetSuccess(&bHasSuccess, &bIsSuccess);
-
-                        if (OTTransaction::notice == pBoxTrans->GetType()) {
-                            recordType = OTRecord::Notice;
-
-                            if (pBoxTrans->IsCancelled()) bCanceled = true;
-                        }
-                        // ----------------------------------------
-                        auto theSenderID = Identifier::Factory(),
-                             theSenderAcctID = Identifier::Factory();
-                        auto theRecipientID = Identifier::Factory(),
-                             theRecipientAcctID = Identifier::Factory();
+                    // In this block below, we already KNOW
+                    // GetSenderNymIDForDisplay is EMPTY.
+                    // (So it's "recipient or bust.")
+                    else if (pBoxTrans->GetRecipientNymIDForDisplay(
+                                 theRecipientID)) {
+                        const String strRecipientID(theRecipientID);
+                        const std::string str_recipient_id(
+                            strRecipientID.Get());
 
-                        if (pBoxTrans->GetSenderNymIDForDisplay(theSenderID)) {
-                            const String strSenderID(theSenderID);
-                            const std::string str_sender_id(strSenderID.Get());
-
-                            // Usually, Nym is the RECIPIENT. Sometimes he's the
-                            // sender.
-                            // Either way, we want the OTHER ID (the other Nym)
-                            // for display.
-                            // So here, if Nym's CLEARLY the sender, then we
-                            // want the RECIPIENT.
-                            // Whereas if Nym were the recipient, then we'd want
-                            // the SENDER. (For display.)
+                        if (0 !=
+                            str_nym_id.compare(
+                                str_recipient_id))  // str_nym_id is NOT
+                                                    // str_recipient_id.
+                                                    // (Therefore we want
+                                                    // str_recipient_id.)
+                        {
+                            // If Nym is not the recipient, then he must be
+                            // the sender.
+                            // (Therefore it must be outgoing.)
                             //
-                            if (0 == str_nym_id.compare(
-                                         str_sender_id))  // str_nym_id IS
-                                                          // str_sender_id.
-                                                          // (Therefore we want
-                                                          // recipient.)
-                            {
-                                if (OTTransaction::notice ==
-                                    pBoxTrans->GetType())
-                                    bOutgoing = false;  // Payment Plan "sender"
-                                                        // of funds (payer) is
-                                                        // the recipient of the
-                                                        // plan.
-                                // TODO: Smart contracts?
-                                else
-                                    bOutgoing = true;  // if Nym is the sender,
-                                                       // then it must have been
-                                                       // outgoing.
-
-                                if (pBoxTrans->GetRecipientNymIDForDisplay(
-                                        theRecipientID)) {
-                                    const String strRecipientID(theRecipientID);
-                                    const std::string str_recipient_id(
-                                        strRecipientID.Get());
-
-                                    String strName(m_pLookup->GetNymName(
-                                        str_recipient_id, it_server)),
-                                        strNameTemp;
-
-                                    if (strName.Exists())
-                                        strNameTemp.Format(
-                                            OTRecordList::textTo(),
-                                            strName.Get());
-                                    else
-                                        strNameTemp.Format(
-                                            OTRecordList::textTo(),
-                                            str_recipient_id.c_str());
-
-                                    str_name = strNameTemp.Get();
-                                    str_other_nym_id = str_recipient_id;
-
-                                    if (pBoxTrans->GetRecipientAcctIDForDisplay(
-                                            theRecipientAcctID)) {
-                                        const String strRecipientAcctID(
-                                            theRecipientAcctID);
-                                        str_other_acct_id =
-                                            strRecipientAcctID.Get();
-                                    }
-                                }
-                            } else  // str_nym_id IS NOT str_sender_id.
-                                    // (Therefore we want sender.)
-                            {  // In this case, some OTHER Nym is the sender, so
-                                // it must have been incoming.
-                                // (And bOutgoing is already false.)
-
-                                if (OTTransaction::notice ==
-                                    pBoxTrans->GetType())
-                                    bOutgoing = true;  // Payment Plan
-                                                       // "recipient" of funds
-                                                       // (merchant) is the
-                                                       // sender of the plan.
-                                                       // TODO: Smart contracts?
-                                else
-                                    bOutgoing = false;
-
-                                String strName(m_pLookup->GetNymName(
-                                    str_sender_id, it_server)),
-                                    strNameTemp;
+                            if (OTTransaction::notice ==
+                                pBoxTrans->GetType())
+                                bOutgoing = false;  // Payment Plan "sender"
+                                                    // of funds (payer) is
+                                                    // the recipient of the
+                                                    // plan.
+                            // TODO: Smart contracts?
+                            else
+                                bOutgoing = true;  // if Nym is the sender,
+                                                   // then it must have been
+                                                   // outgoing.
 
-                                if (strName.Exists())
-                                    strNameTemp.Format(
-                                        OTRecordList::textFrom(),
-                                        strName.Get());
-                                else
-                                    strNameTemp.Format(
-                                        OTRecordList::textFrom(),
-                                        str_sender_id.c_str());
+                            String strName(m_pLookup->GetNymName(
+                                str_recipient_id, it_server)),
+                                strNameTemp;
 
-                                str_name = strNameTemp.Get();
-                                str_other_nym_id = str_sender_id;
+                            if (strName.Exists())
+                                strNameTemp.Format(
+                                    OTRecordList::textTo(), strName.Get());
+                            else
+                                strNameTemp.Format(
+                                    OTRecordList::textTo(),
+                                    str_recipient_id.c_str());
 
-                                if (pBoxTrans->GetSenderAcctIDForDisplay(
-                                        theSenderAcctID)) {
-                                    const String strSenderAcctID(
-                                        theSenderAcctID);
-                                    str_other_acct_id = strSenderAcctID.Get();
-                                }
+                            str_name = strNameTemp.Get();
+                            str_other_nym_id = str_recipient_id;
+                            if (pBoxTrans->GetRecipientAcctIDForDisplay(
+                                    theRecipientAcctID)) {
+                                const String strRecipientAcctID(
+                                    theRecipientAcctID);
+                                str_other_acct_id =
+                                    strRecipientAcctID.Get();
                             }
                         }
-                        // In this block below, we already KNOW
-                        // GetSenderNymIDForDisplay is EMPTY.
-                        // (So it's "recipient or bust.")
-                        else if (pBoxTrans->GetRecipientNymIDForDisplay(
-                                     theRecipientID)) {
-                            const String strRecipientID(theRecipientID);
-                            const std::string str_recipient_id(
-                                strRecipientID.Get());
-
-                            if (0 !=
-                                str_nym_id.compare(
-                                    str_recipient_id))  // str_nym_id is NOT
-                                                        // str_recipient_id.
-                            {  // (Therefore we want str_recipient_id.)
-                                // If Nym is not the recipient, then he must be
-                                // the sender.
-                                // (Therefore it must be outgoing.)
-
-                                if (OTTransaction::notice ==
-                                    pBoxTrans->GetType())
-                                    bOutgoing = false;  // Payment Plan "sender"
-                                                        // of funds (payer) is
-                                                        // the recipient of the
-                                                        // plan.
-                                // TODO: Smart contracts?
-                                else
-                                    bOutgoing = true;  // if Nym is the sender,
-                                                       // then it must have been
-                                                       // outgoing.
-
-                                String strName(m_pLookup->GetNymName(
-                                    str_recipient_id, it_server)),
-                                    strNameTemp;
-
-                                if (strName.Exists())
-                                    strNameTemp.Format(
-                                        OTRecordList::textTo(), strName.Get());
-                                else
-                                    strNameTemp.Format(
-                                        OTRecordList::textTo(),
-                                        str_recipient_id.c_str());
-
-                                str_name = strNameTemp.Get();
-                                str_other_nym_id = str_recipient_id;
+                    }
+                }  // if not abbreviated.
+                time64_t tValidFrom = OT_TIME_ZERO, tValidTo = OT_TIME_ZERO;
+                std::string str_date =
+                    "0";  // the "date signed" on the transaction receipt.
+                time64_t tDateSigned = pBoxTrans->GetDateSigned();
 
-                                if (pBoxTrans->GetRecipientAcctIDForDisplay(
-                                        theRecipientAcctID)) {
-                                    const String strRecipientAcctID(
-                                        theRecipientAcctID);
-                                    str_other_acct_id =
-                                        strRecipientAcctID.Get();
-                                }
-                            }
-                        }
-                    }  // if not abbreviated.
-                    time64_t tValidFrom = OT_TIME_ZERO, tValidTo = OT_TIME_ZERO;
-                    std::string str_date =
-                        "0";  // the "date signed" on the transaction receipt.
-                    time64_t tDateSigned = pBoxTrans->GetDateSigned();
-
-                    if (tDateSigned > OT_TIME_ZERO) {
-                        tValidFrom = tDateSigned;
-                        const std::uint64_t lDateSigned =
-                            OTTimeGetSecondsFromTime(tDateSigned);
-                        String strDateSigned;
-                        strDateSigned.Format("%" PRIu64 "", lDateSigned);
-                        str_date = strDateSigned.Get();
+                if (tDateSigned > OT_TIME_ZERO) {
+                    tValidFrom = tDateSigned;
+                    const std::uint64_t lDateSigned =
+                        OTTimeGetSecondsFromTime(tDateSigned);
+                    String strDateSigned;
+                    strDateSigned.Format("%" PRIu64 "", lDateSigned);
+                    str_date = strDateSigned.Get();
+                }
+                const std::string* p_str_asset_type =
+                    &OTRecordList::s_blank;  // <========== ASSET TYPE
+                const std::string* p_str_asset_name =
+                    &OTRecordList::s_blank;  // instrument definition
+                                             // display name.
+                const std::string* p_str_account =
+                    &OTRecordList::s_blank;  // <========== ACCOUNT
+                std::string str_amount;      // <========== AMOUNT
+                std::string str_type;        // Instrument type.
+                std::string str_memo;  // Instrument memo (if applicable.)
+                String strContents;    // Instrument contents.
+
+                std::string str_payment_notary_id;
+                TransactionNumber lPaymentInstrumentTransNumDisplay = 0;
+
+                if (pBoxTrans->IsAbbreviated()) {
+                    str_type =
+                        pBoxTrans->GetTypeString();  // instrumentNotice,
+                                                     // etc.
+                    Amount lAmount = pBoxTrans->GetAbbrevDisplayAmount();
+
+                    if (0 != lAmount) {
+                        String strTemp;
+                        strTemp.Format("%" PRId64 "", lAmount);
+                        str_amount = strTemp.Get();
                     }
-                    const std::string* p_str_asset_type =
-                        &OTRecordList::s_blank;  // <========== ASSET TYPE
-                    const std::string* p_str_asset_name =
-                        &OTRecordList::s_blank;  // instrument definition
-                                                 // display name.
-                    const std::string* p_str_account =
-                        &OTRecordList::s_blank;  // <========== ACCOUNT
-                    std::string str_amount;      // <========== AMOUNT
-                    std::string str_type;        // Instrument type.
-                    std::string str_memo;  // Instrument memo (if applicable.)
-                    String strContents;    // Instrument contents.
-
-                    std::string str_payment_notary_id;
-
-                    TransactionNumber lPaymentInstrumentTransNumDisplay = 0;
-
-                    if (pBoxTrans->IsAbbreviated()) {
+                } else  // NOT abbreviated. (Full box receipt is already
+                        // loaded.)
+                {
+                    OTPayment* pPayment = GetInstrumentByReceiptID(
+                        *pNym, lReceiptId, *pRecordbox);
+                    std::unique_ptr<OTPayment> thePaymentAngel(pPayment);
+
+                    if (nullptr == pPayment)  // then we treat it like it's
+                                              // abbreviated.
+                    {
                         str_type =
-                            pBoxTrans->GetTypeString();  // instrumentNotice,
-                                                         // etc.
-                        Amount lAmount = pBoxTrans->GetAbbrevDisplayAmount();
+                            pBoxTrans
+                                ->GetTypeString();  // instrumentNotice,
+                                                    // etc.
+                        Amount lAmount =
+                            pBoxTrans->GetAbbrevDisplayAmount();
 
                         if (0 != lAmount) {
                             String strTemp;
                             strTemp.Format("%" PRId64 "", lAmount);
                             str_amount = strTemp.Get();
                         }
-                    } else  // NOT abbreviated. (Full box receipt is already
-                            // loaded.)
-                    {
-                        OTPayment* pPayment = GetInstrumentByReceiptID(
-                            *pNym, lReceiptId, *pExpiredbox);
-                        std::unique_ptr<OTPayment> thePaymentAngel(pPayment);
-
-                        if (nullptr == pPayment)  // then we treat it like it's
-                                                  // abbreviated.
-                        {
-                            str_type =
-                                pBoxTrans
-                                    ->GetTypeString();  // instrumentNotice,
-                                                        // etc.
-                            Amount lAmount =
-                                pBoxTrans->GetAbbrevDisplayAmount();
-
-                            if (0 != lAmount) {
-                                String strTemp;
-                                strTemp.Format("%" PRId64 "", lAmount);
-                                str_amount = strTemp.Get();
-                            }
-                        }
-                        // We have pPayment, the instrument accompanying the
-                        // receipt in the payments recordbox.
-                        else if (pPayment->SetTempValues()) {
-                            TransactionNumber lPaymentInstrumentTransNum = 0;
-                            TransactionNumber lOpeningNum = 0;
-
-                            if (pPayment->GetOpeningNum(lOpeningNum, theNymID))
-                                lPaymentInstrumentTransNum = lOpeningNum;
-                            else
-                                pPayment->GetTransactionNum(
-                                    lPaymentInstrumentTransNum);
-
-                            pPayment->GetTransNumDisplay(
-                                lPaymentInstrumentTransNumDisplay);
+                    }
+                    // We have pPayment, the instrument accompanying the
+                    // receipt in the payments recordbox.
+                    else if (pPayment->SetTempValues()) {
+                        TransactionNumber lPaymentInstrumentTransNum = 0;
+                        TransactionNumber lOpeningNum = 0;
+
+                        if (pPayment->GetOpeningNum(lOpeningNum, theNymID))
+                            lPaymentInstrumentTransNum = lOpeningNum;
+                        else
+                            pPayment->GetTransactionNum(
+                                lPaymentInstrumentTransNum);
 
-                            if (lPaymentInstrumentTransNumDisplay <= 0)
-                                lPaymentInstrumentTransNumDisplay =
-                                    lPaymentInstrumentTransNum;
+                        pPayment->GetTransNumDisplay(
+                            lPaymentInstrumentTransNumDisplay);
 
-                            pPayment->GetValidFrom(tValidFrom);
-                            pPayment->GetValidTo(tValidTo);
+                        if (lPaymentInstrumentTransNumDisplay <= 0)
+                            lPaymentInstrumentTransNumDisplay =
+                                lPaymentInstrumentTransNum;
 
-                            if (tValidFrom > OT_TIME_ZERO) {
-                                const std::uint64_t lFrom =
-                                    OTTimeGetSecondsFromTime(tValidFrom);
-                                String strFrom;
-                                strFrom.Format("%" PRIu64 "", lFrom);
-                                str_date = strFrom.Get();
-                            }
-                            pPayment->GetPaymentContents(strContents);
-                            auto theAccountID = Identifier::Factory();
+                        pPayment->GetValidFrom(tValidFrom);
+                        pPayment->GetValidTo(tValidTo);
 
-                            auto paymentNotaryId = Identifier::Factory();
-                            if (pPayment->GetNotaryID(paymentNotaryId)) {
-                                str_payment_notary_id = paymentNotaryId->str();
-                            }
+                        if (tValidFrom > OT_TIME_ZERO) {
+                            const std::uint64_t lFrom =
+                                OTTimeGetSecondsFromTime(tValidFrom);
+                            String strFrom;
+                            strFrom.Format("%" PRIu64 "", lFrom);
+                            str_date = strFrom.Get();
+                        }
+                        pPayment->GetPaymentContents(strContents);
+                        auto theAccountID = Identifier::Factory();
 
-                            if (bOutgoing)  // Nym is sender.
-                            {
-                                if (((pPayment->IsPaymentPlan() ||
-                                      pPayment->IsNotice()) &&
-                                     pPayment->GetRecipientAcctID(
-                                         theAccountID)) ||
-                                    pPayment->GetSenderAcctIDForDisplay(
-                                        theAccountID))  // Since Nym is ME, the
-                                                        // Account must be MY
-                                                        // acct.
-                                {  // (If this record was originally OUTgoing,
-                                    // then the SENDER's account is MY acct.)
-                                    // UPDATE: Unless I sent a payment plan
-                                    // proposal. In which case I, the merchant,
-                                    // am the "sender" of the proposal, but the
-                                    // "sender" on the instrument is the
-                                    // customer,
-                                    // since he will be "sending" me the money!
-                                    // So the "Recipient" of the proposal
-                                    // message
-                                    // (outgoing from my perspective) is
-                                    // actually the "Sender" of the money
-                                    // according to the
-                                    // instrument (which will be incoming,
-                                    // according to my perspective, when those
-                                    // payments
-                                    // start to arrive.) Thus, though the
-                                    // merchant is the "sender" of the proposal,
-                                    // he's the
-                                    // "recipient" on the instrument.
-                                    String strTemp(theAccountID);
-                                    std::string str_outpmt_account =
-                                        strTemp.Get();  // The accountID we
-                                                        // found on the payment
-                                                        // (only applies to
-                                                        // outgoing payments.)
-                                    auto it_acct = std::find(
-                                        m_accounts.begin(),
-                                        m_accounts.end(),
-                                        str_outpmt_account);
-                                    if (it_acct !=
-                                        m_accounts.end())  // Found it on the
-                                                           // list of accounts
-                                                           // we care about.
-                                    {
-                                        p_str_account = &(*it_acct);
-                                    } else {
-                                        // There was definitely an account on
-                                        // the instrument, and it definitely
-                                        // did not match any of the accounts
-                                        // that we care about.
-                                        // Therefore, skip.
-                                        //
-                                        otInfo << __FUNCTION__
-                                               << ": Skipping 'sent payment' "
-                                                  "expired record. (We don't "
-                                                  "care about account "
-                                               << str_outpmt_account.c_str()
-                                               << ")\n";
-                                        continue;
-                                    }
-                                }
-                            } else  // Nym is recipient.
-                            {
-                                // Why is this here? Because if Nym is
-                                // recipient, let's say he received
-                                // an instrumentNotice containing a
-                                // sendNymInstrument message containing
-                                // an incoming cheque. Well... that incoming
-                                // cheque (the payload on
-                                // sendNymInstrument message) is ENCRYPTED.
-                                // Meaning the above calls to
-                                // pBoxReceipt->GetSenderAcctID on the
-                                // instrumentNotice transaction will
-                                // FAIL. One option is to pass pNym into
-                                // GetSenderAcctID so it can
-                                // decrypt the payload and return the value. But
-                                // since we already have
-                                // the payload decrypted here (we already have
-                                // the cheque loaded up
-                                // here) we can just grab the senderAcctID
-                                // directly from the cheque.
-                                // That's why this is here -- because this is
-                                // where we KNOW we have the
-                                // account ID -- so we grab it.
+                        if (bOutgoing)  // Nym is sender.
+                        {
+                            if (((pPayment->IsPaymentPlan() ||
+                                  pPayment->IsNotice()) &&
+                                 pPayment->GetRecipientAcctID(
+                                     theAccountID)) ||
+                                pPayment->GetSenderAcctIDForDisplay(
+                                    theAccountID))  // Since Nym is ME, the
+                                                    // Account must be MY
+                                                    // acct.
+                            {  // (If this record was originally OUTgoing,
+                                // then the SENDER's account is MY acct.)
                                 //
-                                if (str_other_acct_id.empty() &&
-                                    (((pPayment->IsPaymentPlan() ||
-                                       pPayment->IsNotice()) &&
-                                      pPayment->GetRecipientAcctID(
-                                          theAccountID)) ||
-                                     pPayment->GetSenderAcctIDForDisplay(
-                                         theAccountID))) {
-                                    String strTemp(theAccountID);
-                                    str_other_acct_id = strTemp.Get();
-                                }
-                            }
-                            // By this point, p_str_account is definitely set.
-                            OT_ASSERT(nullptr != p_str_account);  // and it's
-                                                                  // either
-                                                                  // blank, or
-                                                                  // it's one of
-                                                                  // the
-                                                                  // accounts we
-                                                                  // care about.
-                            auto theInstrumentDefinitionID =
-                                Identifier::Factory();
-
-                            if (pPayment->GetInstrumentDefinitionID(
-                                    theInstrumentDefinitionID)) {
-                                String strTemp(theInstrumentDefinitionID);
-                                const std::string str_inpmt_asset(
-                                    strTemp.Get());  // The instrument
-                                                     // definition we found on
-                                                     // the payment (if we found
-                                                     // anything.)
-                                auto it_asset = m_assets.find(str_inpmt_asset);
-                                if (it_asset !=
-                                    m_assets.end())  // Found it on the map of
-                                                     // instrument definitions
-                                                     // we care about.
+                                // UPDATE: Unless I sent a payment plan
+                                // proposal. In which case I, the merchant,
+                                // am the "sender" of the proposal, but the
+                                // "sender" on the instrument is the
+                                // customer,
+                                // since he will be "sending" me the money!
+                                // So the "Recipient" of the proposal
+                                // message
+                                // (outgoing from my perspective) is
+                                // actually the "Sender" of the money
+                                // according to the
+                                // instrument (which will be incoming,
+                                // according to my perspective, when those
+                                // payments
+                                // start to arrive.) Thus, though the
+                                // merchant is the "sender" of the proposal,
+                                // he's the
+                                // "recipient" on the instrument.
+                                String strTemp(theAccountID);
+                                std::string str_outpmt_account =
+                                    strTemp.Get();  // The accountID we
+                                                    // found on the payment
+                                                    // (only applies to
+                                                    // outgoing payments.)
+                                auto it_acct = std::find(
+                                    m_accounts.begin(),
+                                    m_accounts.end(),
+                                    str_outpmt_account);
+                                if (it_acct !=
+                                    m_accounts.end())  // Found it on the
+                                                       // list of accounts
+                                                       // we care about.
                                 {
-                                    p_str_asset_type =
-                                        &(it_asset->first);  // Set the asset
-                                                             // type ID.
-                                    p_str_asset_name =
-                                        &(it_asset->second);  // The
-                                                              // CurrencyTLA.
-                                                              // Examples: USD,
-                                                              // BTC, etc.
+                                    p_str_account = &(*it_acct);
                                 } else {
-                                    // There was definitely an instrument
-                                    // definition on the instrument, and
-                                    // it definitely did not match any of the
-                                    // assets that we care about.
-                                    // Therefore, skip.
+                                    // There was definitely an account on
+                                    // the instrument, and it definitely
+                                    // did not match any of the accounts
+                                    // that we care about. Therefore, skip.
                                     //
-                                    otErr << __FUNCTION__
-                                          << ": Skipping: Expired payment "
-                                             "record (we don't care about "
-                                             "instrument definition "
-                                          << str_inpmt_asset.c_str() << ")\n";
+                                    otInfo << __FUNCTION__
+                                           << ": Skipping 'sent payment' "
+                                              "record. (We don't care "
+                                              "about account "
+                                           << str_outpmt_account.c_str()
+                                           << ")\n";
                                     continue;
                                 }
                             }
-                            // By this point, p_str_asset_type and
-                            // p_str_asset_name are definitely set.
-                            OT_ASSERT(nullptr != p_str_asset_type);  // and it's
-                            // either blank,
-                            // or it's one of
-                            // the asset
-                            // types we care
-                            // about.
-                            OT_ASSERT(nullptr != p_str_asset_name);  // and it's
-                            // either blank,
-                            // or it's one of
-                            // the asset
-                            // types we care
-                            // about.
-                            String strMemo;
-                            if (pPayment->GetMemo(strMemo)) {
-                                str_memo = strMemo.Get();
+                        } else  // Nym is recipient.
+                        {
+                            // Why is this here? Because if Nym is
+                            // recipient, let's say he received
+                            // an instrumentNotice containing a
+                            // sendNymInstrument message containing
+                            // an incoming cheque. Well... that incoming
+                            // cheque (the payload on
+                            // sendNymInstrument message) is ENCRYPTED.
+                            // Meaning the above calls to
+                            // pBoxReceipt->GetSenderAcctID on the
+                            // instrumentNotice transaction will
+                            // FAIL. One option is to pass pNym into
+                            // GetSenderAcctID so it can
+                            // decrypt the payload and return the value. But
+                            // since we already have
+                            // the payload decrypted here (we already have
+                            // the cheque loaded up
+                            // here) we can just grab the senderAcctID
+                            // directly from the cheque.
+                            // That's why this is here -- because this is
+                            // where we KNOW we have the
+                            // account ID -- so we grab it.
+                            //
+                            if (str_other_acct_id.empty() &&
+                                (((pPayment->IsPaymentPlan() ||
+                                   pPayment->IsNotice()) &&
+                                  pPayment->GetRecipientAcctID(
+                                      theAccountID)) ||
+                                 pPayment->GetSenderAcctIDForDisplay(
+                                     theAccountID))) {
+                                String strTemp(theAccountID);
+                                str_other_acct_id = strTemp.Get();
+                            }
+                        }
+                        // By this point, p_str_account is definitely set.
+                        OT_ASSERT(nullptr != p_str_account);  // and it's
+                                                              // either
+                                                              // blank, or
+                                                              // it's one of
+                                                              // the
+                                                              // accounts we
+                                                              // care about.
+                        auto theInstrumentDefinitionID =
+                            Identifier::Factory();
+
+                        if (pPayment->GetInstrumentDefinitionID(
+                                theInstrumentDefinitionID)) {
+                            String strTemp(theInstrumentDefinitionID);
+                            const std::string str_inpmt_asset(
+                                strTemp.Get());  // The instrument
+                                                 // definition we found on
+                                                 // the payment (if we found
+                                                 // anything.)
+                            auto it_asset = m_assets.find(str_inpmt_asset);
+                            if (it_asset !=
+                                m_assets.end())  // Found it on the map of
+                                                 // instrument definitions
+                                                 // we care about.
+                            {
+                                p_str_asset_type =
+                                    &(it_asset->first);  // Set the asset
+                                                         // type ID.
+                                p_str_asset_name =
+                                    &(it_asset->second);  // The
+                                                          // CurrencyTLA.
+                                                          // Examples: USD,
+                                                          // BTC, etc.
+                            } else {
+                                // There was definitely an instrument
+                                // definition on the instrument, and it
+                                // definitely
+                                // did not match any of the assets that we
+                                // care about. Therefore, skip.
+                                //
+                                otErr << __FUNCTION__
+                                      << ": Skipping: Payment record (we "
+                                         "don't care about instrument "
+                                         "definition "
+                                      << str_inpmt_asset.c_str() << ")\n";
+                                continue;
                             }
-                            // Instrument type (cheque, voucher, etc)
-                            std::int32_t nType =
-                                static_cast<std::int32_t>(pPayment->GetType());
+                        }
+                        // By this point, p_str_asset_type and
+                        // p_str_asset_name are definitely set.
+                        OT_ASSERT(nullptr != p_str_asset_type);  // and it's
+                        // either blank,
+                        // or it's one of
+                        // the asset
+                        // types we care
+                        // about.
+                        OT_ASSERT(nullptr != p_str_asset_name);  // and it's
+                        // either blank,
+                        // or it's one of
+                        // the asset
+                        // types we care
+                        // about.
 
-                            str_type = GetTypeString(nType);
-                            Amount lAmount = 0;
+                        String strMemo;
+                        if (pPayment->GetMemo(strMemo)) {
+                            str_memo = strMemo.Get();
+                        }
+                        // Instrument type (cheque, voucher, etc)
+                        std::int32_t nType =
+                            static_cast<std::int32_t>(pPayment->GetType());
 
-                            if (pPayment->GetAmount(lAmount)) {
-                                String strTemp;
-                                strTemp.Format("%" PRId64 "", lAmount);
-                                str_amount = strTemp.Get();
-                            }
+                        str_type = GetTypeString(nType);
+                        Amount lAmount = 0;
+
+                        if (pPayment->GetAmount(lAmount)) {
+                            String strTemp;
+                            strTemp.Format("%" PRId64 "", lAmount);
+                            str_amount = strTemp.Get();
+                        }
+
+                        auto paymentNotaryId = Identifier::Factory();
+                        if (pPayment->GetNotaryID(paymentNotaryId)) {
+                            str_payment_notary_id = paymentNotaryId->str();
                         }
                     }
-                    otInfo << __FUNCTION__ << ": ADDED: Expired payment record "
-                           << (bOutgoing ? "(sent)" : "(received)")
-                           << " (str_type: " << str_type.c_str() << ")\n";
+                }
+                otInfo << __FUNCTION__ << ": ADDED: Payment record "
+                       << (bOutgoing ? "(sent)" : "(received)")
+                       << " (str_type: " << str_type.c_str() << ")\n";
 
-                    shared_ptr_OTRecord sp_Record(new OTRecord(
-                        *this,
-                        theMsgNotaryID->str(),  // Transport Notary
-                        str_payment_notary_id,  // Payment Notary
-                        *p_str_asset_type,
-                        *p_str_asset_name,
-                        str_nym_id,      // This is the Nym WHOSE BOX IT IS.
-                        *p_str_account,  // This is the Nym's account for
-                                         // this box. (Blank for incoming,
-                                         // set for outgoing.)
-                        // Everything above this line, it stores a reference
-                        // to an external string.
-                        // Everything below this line, it makes its own
-                        // internal copy of the string.
-                        str_name,  // name of sender or recipient (since its
-                                   // in the recordbox.)
-                        str_date,  // the "date signed" on the receipt.
-                        str_amount,
-                        str_type,   // pending, chequeReceipt, etc.
-                        false,      // Everything in the recordbox is finished.
-                                    // (NOT pending.)
-                        bOutgoing,  // Since it's the recordbox, it contains
-                                    // both incoming and outgoing receipts.
-                        true,       // IsRecord
-                        false,      // IsReceipt,
-                        recordType));
-                    if (strContents.Exists())
-                        sp_Record->SetContents(strContents.Get());
-
-                    sp_Record->SetDateRange(tValidFrom, tValidTo);
-                    sp_Record->SetExpired();
-                    sp_Record->SetBoxIndex(nIndex);
-
-                    if (!str_memo.empty()) sp_Record->SetMemo(str_memo);
-                    if (!str_other_nym_id.empty())
-                        sp_Record->SetOtherNymID(str_other_nym_id);
-                    if (!str_other_acct_id.empty())
-                        sp_Record->SetOtherAccountID(str_other_acct_id);
-
-                    if (lPaymentInstrumentTransNumDisplay > 0)
-                        sp_Record->SetTransNumForDisplay(
-                            lPaymentInstrumentTransNumDisplay);
-                    else
-                        sp_Record->SetTransNumForDisplay(
-                            pBoxTrans->GetReferenceNumForDisplay());
-                    sp_Record->SetTransactionNum(
-                        pBoxTrans->GetTransactionNum());
+                shared_ptr_OTRecord sp_Record(new OTRecord(
+                    *this,
+                    theMsgNotaryID->str(),  // Transport Notary
+                    str_payment_notary_id,  // Payment Notary
+                    *p_str_asset_type,
+                    *p_str_asset_name,
+                    str_nym_id,      // This is the Nym WHOSE BOX IT IS.
+                    *p_str_account,  // This is the Nym's account for
+                                     // this box. (Blank for incoming,
+                                     // set for outgoing.)
+                    // Everything above this line, it stores a reference
+                    // to an external string.
+                    // Everything below this line, it makes its own
+                    // internal copy of the string.
+                    str_name,  // name of sender or recipient (since its
+                               // in the recordbox.)
+                    str_date,  // the "date signed" on the receipt.
+                    str_amount,
+                    str_type,   // pending, chequeReceipt, etc.
+                    false,      // Everything in the recordbox is finished.
+                                // (NOT pending.)
+                    bOutgoing,  // Since it's the recordbox, it contains
+                                // both incoming and outgoing receipts.
+                    true,       // IsRecord
+                    false,      // IsReceipt,
+                    recordType));
+
+                if (strContents.Exists())
+                    sp_Record->SetContents(strContents.Get());
 
-                    if (bHasSuccess) sp_Record->SetSuccess(bIsSuccess);
+                sp_Record->SetDateRange(tValidFrom, tValidTo);
+                sp_Record->SetBoxIndex(nIndex);
 
-                    if (bCanceled) sp_Record->SetCanceled();
+                if (!str_memo.empty()) sp_Record->SetMemo(str_memo);
+                if (!str_other_nym_id.empty())
+                    sp_Record->SetOtherNymID(str_other_nym_id);
+                if (!str_other_acct_id.empty())
+                    sp_Record->SetOtherAccountID(str_other_acct_id);
 
-                    m_contents.push_back(sp_Record);
+                if (lPaymentInstrumentTransNumDisplay > 0)
+                    sp_Record->SetTransNumForDisplay(
+                        lPaymentInstrumentTransNumDisplay);
+                else
+                    sp_Record->SetTransNumForDisplay(
+                        pBoxTrans->GetReferenceNumForDisplay());
+                sp_Record->SetTransactionNum(
+                    pBoxTrans->GetTransactionNum());
 
-                }  // Loop through ExpiredBox
-            } else
-                otWarn << __FUNCTION__
-                       << ": Failed loading expired payments box. "
-                          "(Probably just doesn't exist yet.)\n";
+                if (bHasSuccess) sp_Record->SetSuccess(bIsSuccess);
 
-        }  // Loop through servers for each Nym.
-    }      // Loop through Nyms.
-           // ASSET ACCOUNT -- INBOX/OUTBOX + RECORD BOX
-           // Loop through the Accounts.
-           //
-    otInfo << "================ " << __FUNCTION__
-           << ": Looping through the accounts in the wallet...\n";
-    std::int32_t nAccountIndex = -1;
-    for (auto& it_acct : m_accounts) {
-        ++nAccountIndex;  // (0 on first iteration.)
-        // For each account, loop through its inbox, outbox, and record box.
-        //
-        const std::string& str_account_id(it_acct);
-        const auto theAccountID = Identifier::Factory(str_account_id);
-        auto account = wallet_.Account(theAccountID);
-
-        if (false == bool(account)) {
-            // This can happen if the user erases the account.
-            // Therefore we just need to skip it.
-            otInfo << __FUNCTION__ << ": Skipping an account ("
-                   << str_account_id.c_str()
-                   << ") since it has disappeared from the wallet. (Probably "
-                      "deleted by the user.)\n";
-            continue;
-        }
-        const Identifier& theNymID = account.get().GetNymID();
-        const Identifier& theNotaryID = account.get().GetPurportedNotaryID();
-        const Identifier& theInstrumentDefinitionID =
-            account.get().GetInstrumentDefinitionID();
-        account.Release();
-        const String strNymID(theNymID);
-        const String strNotaryID(theNotaryID);
-        const String strInstrumentDefinitionID(theInstrumentDefinitionID);
-        otInfo << "------------\n"
-               << __FUNCTION__ << ": Account: " << nAccountIndex
-               << ", ID: " << str_account_id.c_str() << "\n";
-        const std::string str_nym_id(strNymID.Get());
-        const std::string str_notary_id(strNotaryID.Get());
-        const std::string str_instrument_definition_id(
-            strInstrumentDefinitionID.Get());
-        const std::string* pstr_nym_id = &OTRecordList::s_blank;
-        const std::string* pstr_notary_id = &OTRecordList::s_blank;
-        const std::string* pstr_instrument_definition_id =
-            &OTRecordList::s_blank;
-        const std::string* pstr_asset_name = &OTRecordList::s_blank;
-        // NOTE: Since this account is already on my "care about" list for
-        // accounts,
-        // I wouldn't bother double-checking my "care about" lists for servers,
-        // nyms,
-        // and instrument definitions. But I still look up the appropriate
-        // string for each,
-        // since
-        // I have to pass a reference to it into the constructor for OTRecord.
-        // (To a version
-        // that won't be deleted, since the OTRecord will reference it. And the
-        // "care about"
-        // list definitely contains a copy of the string that won't be deleted.)
-        //
-        auto it_nym = std::find(m_nyms.begin(), m_nyms.end(), str_nym_id);
-        auto it_server =
-            std::find(m_servers.begin(), m_servers.end(), str_notary_id);
-        auto it_asset = m_assets.find(str_instrument_definition_id);
-        if ((m_nyms.end() == it_nym) || (m_servers.end() == it_server) ||
-            (m_assets.end() == it_asset)) {
-            otInfo << __FUNCTION__ << ": Skipping an account ("
-                   << str_account_id.c_str()
-                   << ") since its Nym, or Server, "
-                      "or Asset Type wasn't on my list.\n";
-            continue;
-        }
-        // These pointers are what we'll use to construct each OTRecord.
-        //
-        pstr_nym_id = &(*it_nym);
-        pstr_notary_id = &(*it_server);
-        pstr_instrument_definition_id = &(it_asset->first);
-        pstr_asset_name = &(it_asset->second);
-        // Loop through asset account INBOX.
-        //
-        // OPTIMIZE FYI:
-        // NOTE: LoadInbox is much SLOWER than LoadInboxNoVerify, but it also
-        // lets you get
-        // the NAME off of the box receipt. So if you are willing to GIVE UP the
-        // NAME, in
-        // return for FASTER PERFORMANCE, then call SetFastMode() before
-        // Populating.
-        //
-        Ledger* pInbox{nullptr};
+                if (bCanceled) sp_Record->SetCanceled();
+
+                sp_Record->SetOriginType(theOriginType);
 
-        if (false == theNymID.empty()) {
-            pInbox = m_bRunFast ? OT::App().API().OTAPI().LoadInboxNoVerify(
-                                      theNotaryID, theNymID, theAccountID)
-                                : OT::App().API().OTAPI().LoadInbox(
-                                      theNotaryID, theNymID, theAccountID);
+                //                    otErr << "DEBUGGING! RECORD LIST:
+                //                    Added " << (bOutgoing ? "sent":
+                //                    "received") << " payment record: " <<
+                //                    pBoxTrans->GetTypeString() << "\n
+                //                    str_nym_id: " << str_nym_id << "\n
+                //                    str_other_nym_id: " <<
+                //                    str_other_nym_id <<
+                //                    "\n pBoxTrans->GetTransactionNum(): "
+                //                    << pBoxTrans->GetTransactionNum() <<
+                //                    "\n
+                //                    pBoxTrans->GetReferenceNumForDisplay()"
+                //                    <<
+                //                    pBoxTrans->GetReferenceNumForDisplay()
+                //                    << "\n";
+
+                output.push_back(sp_Record);
+
+            }  // Loop through Recordbox
+        } else
+            otWarn << __FUNCTION__
+                   << ": Failed loading payments record "
+                      "box. (Probably just doesn't exist "
+                      "yet.)\n";
+
+        // EXPIRED RECORDS:
+        nIndex = (-1);
+
+        // Also loop through its expired record box.
+        // OPTIMIZE FYI: m_bRunFast impacts run speed here.
+        Ledger* pExpiredbox{nullptr};
+
+        if (false == theNymID->empty()) {
+            pExpiredbox =
+                m_bRunFast ? OT::App().API().OTAPI().LoadExpiredBoxNoVerify(
+                                 theMsgNotaryID, theNymID)
+                           : OT::App().API().OTAPI().LoadExpiredBox(
+                                 theMsgNotaryID, theNymID);
         }
 
-        std::unique_ptr<Ledger> theInboxAngel(pInbox);
+        std::unique_ptr<Ledger> theExpiredBoxAngel(pExpiredbox);
 
         // It loaded up, so let's loop through it.
-        if (pInbox) {
-            std::int32_t nInboxIndex = -1;
-            for (auto& it : pInbox->GetTransactionMap()) {
-                ++nInboxIndex;  // (0 on first iteration.)
-                if (0 == nInboxIndex)
-                    otInfo
-                        << __FUNCTION__
-                        << ": Beginning loop through asset account INBOX...\n";
+        if (pExpiredbox) {
+            for (auto& it : pExpiredbox->GetTransactionMap()) {
+                const TransactionNumber lReceiptId = it.first;
                 OTTransaction* pBoxTrans = it.second;
                 OT_ASSERT(nullptr != pBoxTrans);
-                otInfo << __FUNCTION__ << ": Inbox index: " << nInboxIndex
+                bool bOutgoing{false};
+
+                // Let's say Alice sends a payment plan to Bob, and then Bob
+                // activates it. Alice will receive a notice, via her
+                // Nymbox,
+                // which will be placed in her Nym record box. (The pending
+                // outgoing
+                // plan is removed, since the notice means it's no longer
+                // "pending" but instead, now officially activated or
+                // canceled.) My point? The notice in her record box relates
+                // to her SENT plan, not a received plan. It needs to show
+                // up as outgoing/sent, NOT incoming/received.
+                //
+                //                  if (OTTransaction::notice ==
+                //                  pBoxTrans->GetType())
+                //                      bOutgoing = true;
+                // -------------------------------------------
+                bool bHasSuccess{false};
+                bool bIsSuccess{false};
+
+                bool bCanceled{false};
+                // (A transaction object containing a notice of a success is
+                // not the same thing as a transaction object containing a
+                // successful transaction. In the latter case, it's the
+                // transaction itself. In the former, it's a separate object
+                // that serves notice that something has occurred. A notice,
+                // for example, does not contain a balance agreement. So you
+                // couldn't say it's a "successful transaction" even though
+                // it is serving notice to various parties that a cron item
+                // was successfully (or not) activated.)
+                //
+                // -------------------------------------------
+                ++nIndex;  // 0 on first iteration.
+                otInfo << __FUNCTION__
+                       << ": Expired payment RECORD index: " << nIndex
                        << "\n";
-                bool bCanceled = false;
-                std::string str_name;  // name of sender (since its in the
-                                       // inbox.)
+                std::string str_name;  // name of sender OR recipient
+                                       // (depending on whether it was
+                                       // originally incoming or outgoing.)
                 std::string str_other_nym_id;
                 std::string str_other_acct_id;
-                std::string str_memo;
 
-                bool bHasSuccess = false;
-                bool bIsSuccess = false;
+                OTRecord::OTRecordType recordType = OTRecord::Instrument;
 
                 if (!pBoxTrans->IsAbbreviated()) {
-                    String strMemo;
+                    // We ignore the return value of GetSuccess, since it's
+                    // not detailed enough for our needs here.
+                    //
+                    pBoxTrans->GetSuccess(&bHasSuccess, &bIsSuccess);
 
-                    if (pBoxTrans->GetMemo(strMemo)) str_memo = strMemo.Get();
-
-                    if (OTTransaction::pending == pBoxTrans->GetType()) {
-                        // NOTE: REMOVE THE BELOW CODE. (Found a better way,
-                        // above this block.)
-                        //                      const OTString
-                        //                      strBoxTrans(*pBoxTrans);
-                        //                      if (strBoxTrans.Exists())
-                        //                         str_memo =
-                        //            SwigWrap::Pending_GetNote(*pstr_notary_id,
-                        //                                      *pstr_nym_id,
-                        //                                      str_account_id,
-                        //                                   strBoxTrans.Get());
-                        auto theSenderID = Identifier::Factory(),
-                             theSenderAcctID = Identifier::Factory();
+                    if (OTTransaction::notice == pBoxTrans->GetType()) {
+                        recordType = OTRecord::Notice;
 
-                        if (pBoxTrans->GetSenderAcctIDForDisplay(
-                                theSenderAcctID))  // ACCOUNT name.
+                        if (pBoxTrans->IsCancelled()) bCanceled = true;
+                    }
+                    // ----------------------------------------
+                    auto theSenderID = Identifier::Factory(),
+                         theSenderAcctID = Identifier::Factory();
+                    auto theRecipientID = Identifier::Factory(),
+                         theRecipientAcctID = Identifier::Factory();
+
+                    if (pBoxTrans->GetSenderNymIDForDisplay(theSenderID)) {
+                        const String strSenderID(theSenderID);
+                        const std::string str_sender_id(strSenderID.Get());
+
+                        // Usually, Nym is the RECIPIENT. Sometimes he's the
+                        // sender.
+                        // Either way, we want the OTHER ID (the other Nym)
+                        // for display.
+                        // So here, if Nym's CLEARLY the sender, then we
+                        // want the RECIPIENT.
+                        // Whereas if Nym were the recipient, then we'd want
+                        // the SENDER. (For display.)
+                        //
+                        if (0 == str_nym_id.compare(
+                                     str_sender_id))  // str_nym_id IS
+                                                      // str_sender_id.
+                                                      // (Therefore we want
+                                                      // recipient.)
                         {
-                            if (pBoxTrans->GetSenderNymIDForDisplay(
-                                    theSenderID)) {
-                                const String strSenderID(theSenderID);
-                                str_other_nym_id = strSenderID.Get();
-                            }
-                            const String strSenderAcctID(theSenderAcctID);
-                            const std::string str_sender_acct_id(
-                                strSenderAcctID.Get());
-
-                            str_other_acct_id = str_sender_acct_id;
-
-                            String strName(m_pLookup->GetAcctName(
-                                str_other_acct_id,
-                                str_other_nym_id,  // nym ID if known
-                                *pstr_notary_id,   // server ID if known.
-                                *pstr_instrument_definition_id)),  // instrument
-                                                                   // definition
-                                                                   // id if
-                                                                   // known.
-                                strNameTemp;
+                            if (OTTransaction::notice ==
+                                pBoxTrans->GetType())
+                                bOutgoing = false;  // Payment Plan "sender"
+                                                    // of funds (payer) is
+                                                    // the recipient of the
+                                                    // plan.
+                            // TODO: Smart contracts?
+                            else
+                                bOutgoing = true;  // if Nym is the sender,
+                                                   // then it must have been
+                                                   // outgoing.
+
+                            if (pBoxTrans->GetRecipientNymIDForDisplay(
+                                    theRecipientID)) {
+                                const String strRecipientID(theRecipientID);
+                                const std::string str_recipient_id(
+                                    strRecipientID.Get());
+
+                                String strName(m_pLookup->GetNymName(
+                                    str_recipient_id, it_server)),
+                                    strNameTemp;
+
+                                if (strName.Exists())
+                                    strNameTemp.Format(
+                                        OTRecordList::textTo(),
+                                        strName.Get());
+                                else
+                                    strNameTemp.Format(
+                                        OTRecordList::textTo(),
+                                        str_recipient_id.c_str());
 
-                            if (strName.Exists()) {
-                                strNameTemp.Format(
-                                    OTRecordList::textFrom(), strName.Get());
                                 str_name = strNameTemp.Get();
-                            } else if (!str_other_nym_id.empty()) {
-                                String strNymName(m_pLookup->GetNymName(
-                                    str_other_nym_id, *it_server)),
-                                    strNymNameTemp;
-
-                                if (strNymName.Exists()) {
-                                    strNymNameTemp.Format(
-                                        OTRecordList::textFrom(),
-                                        strNymName.Get());
-                                    str_name = strNameTemp.Get();
+                                str_other_nym_id = str_recipient_id;
+
+                                if (pBoxTrans->GetRecipientAcctIDForDisplay(
+                                        theRecipientAcctID)) {
+                                    const String strRecipientAcctID(
+                                        theRecipientAcctID);
+                                    str_other_acct_id =
+                                        strRecipientAcctID.Get();
                                 }
                             }
-                            if (str_name.empty()) {
-                                strNameTemp.Format(
-                                    OTRecordList::textFrom(),
-                                    str_sender_acct_id.c_str());
-                                str_name = strNameTemp.Get();
-                            }
-                        } else if (pBoxTrans->GetSenderNymIDForDisplay(
-                                       theSenderID))  // NYM name.
-                        {
-                            const String strSenderID(theSenderID);
-                            const std::string str_sender_id(strSenderID.Get());
+                        } else  // str_nym_id IS NOT str_sender_id.
+                                // (Therefore we want sender.)
+                        {  // In this case, some OTHER Nym is the sender, so
+                            // it must have been incoming.
+                            // (And bOutgoing is already false.)
+
+                            if (OTTransaction::notice ==
+                                pBoxTrans->GetType())
+                                bOutgoing = true;  // Payment Plan
+                                                   // "recipient" of funds
+                                                   // (merchant) is the
+                                                   // sender of the plan.
+                                                   // TODO: Smart contracts?
+                            else
+                                bOutgoing = false;
 
                             String strName(m_pLookup->GetNymName(
-                                str_sender_id, *it_server)),
+                                str_sender_id, it_server)),
                                 strNameTemp;
 
                             if (strName.Exists())
                                 strNameTemp.Format(
-                                    OTRecordList::textFrom(), strName.Get());
+                                    OTRecordList::textFrom(),
+                                    strName.Get());
                             else
                                 strNameTemp.Format(
                                     OTRecordList::textFrom(),
@@ -5030,34 +4559,47 @@ bool OTRecordList::Populate()
 
                             str_name = strNameTemp.Get();
                             str_other_nym_id = str_sender_id;
-                        } else {
-                            String strName(SwigWrap::GetAccountWallet_Name(
-                                str_account_id)),
-                                strNameTemp;
 
-                            if (strName.Exists())
-                                strNameTemp = strName;
-                            else
-                                strNameTemp = String(str_account_id);
-
-                            str_name = strNameTemp.Get();
+                            if (pBoxTrans->GetSenderAcctIDForDisplay(
+                                    theSenderAcctID)) {
+                                const String strSenderAcctID(
+                                    theSenderAcctID);
+                                str_other_acct_id = strSenderAcctID.Get();
+                            }
                         }
-                    }     // end: (if pending)
-                    else  // else it's a receipt.
-                    {
-                        pBoxTrans->GetSuccess(&bHasSuccess, &bIsSuccess);
-                        // -------------------------------
-                        auto theRecipientID = Identifier::Factory(),
-                             theRecipientAcctID = Identifier::Factory();
+                    }
+                    // In this block below, we already KNOW
+                    // GetSenderNymIDForDisplay is EMPTY.
+                    // (So it's "recipient or bust.")
+                    else if (pBoxTrans->GetRecipientNymIDForDisplay(
+                                 theRecipientID)) {
+                        const String strRecipientID(theRecipientID);
+                        const std::string str_recipient_id(
+                            strRecipientID.Get());
 
-                        if (pBoxTrans->GetRecipientNymIDForDisplay(
-                                theRecipientID)) {
-                            const String strRecipientID(theRecipientID);
-                            const std::string str_recipient_nym_id(
-                                strRecipientID.Get());
+                        if (0 !=
+                            str_nym_id.compare(
+                                str_recipient_id))  // str_nym_id is NOT
+                                                    // str_recipient_id.
+                        {  // (Therefore we want str_recipient_id.)
+                            // If Nym is not the recipient, then he must be
+                            // the sender.
+                            // (Therefore it must be outgoing.)
+
+                            if (OTTransaction::notice ==
+                                pBoxTrans->GetType())
+                                bOutgoing = false;  // Payment Plan "sender"
+                                                    // of funds (payer) is
+                                                    // the recipient of the
+                                                    // plan.
+                            // TODO: Smart contracts?
+                            else
+                                bOutgoing = true;  // if Nym is the sender,
+                                                   // then it must have been
+                                                   // outgoing.
 
                             String strName(m_pLookup->GetNymName(
-                                str_recipient_nym_id, *it_server)),
+                                str_recipient_id, it_server)),
                                 strNameTemp;
 
                             if (strName.Exists())
@@ -5066,46 +4608,21 @@ bool OTRecordList::Populate()
                             else
                                 strNameTemp.Format(
                                     OTRecordList::textTo(),
-                                    str_recipient_nym_id.c_str());
+                                    str_recipient_id.c_str());
 
                             str_name = strNameTemp.Get();
-                            str_other_nym_id = str_recipient_nym_id;
+                            str_other_nym_id = str_recipient_id;
+
                             if (pBoxTrans->GetRecipientAcctIDForDisplay(
                                     theRecipientAcctID)) {
                                 const String strRecipientAcctID(
                                     theRecipientAcctID);
-                                str_other_acct_id = strRecipientAcctID.Get();
+                                str_other_acct_id =
+                                    strRecipientAcctID.Get();
                             }
-                        } else if (pBoxTrans->GetRecipientAcctIDForDisplay(
-                                       theRecipientAcctID)) {
-                            const String strRecipientAcctID(theRecipientAcctID);
-                            const std::string str_recipient_acct_id(
-                                strRecipientAcctID.Get());
-
-                            String strName(m_pLookup->GetAcctName(
-                                str_recipient_acct_id,
-                                "",               // nym ID if known
-                                *pstr_notary_id,  // server ID if known.
-                                *pstr_instrument_definition_id)),  // instrument
-                                                                   // definition
-                                                                   // id if
-                                                                   // known.
-                                strNameTemp;
-
-                            if (strName.Exists())
-                                strNameTemp.Format(
-                                    OTRecordList::textTo(), strName.Get());
-                            else
-                                strNameTemp.Format(
-                                    OTRecordList::textTo(),
-                                    str_recipient_acct_id.c_str());
-
-                            str_name = strNameTemp.Get();
-                            str_other_acct_id = str_recipient_acct_id;
                         }
-                    }  // end: (else it's a receipt.)
-                }
-                bCanceled = pBoxTrans->IsCancelled();
+                    }
+                }  // if not abbreviated.
                 time64_t tValidFrom = OT_TIME_ZERO, tValidTo = OT_TIME_ZERO;
                 std::string str_date =
                     "0";  // the "date signed" on the transaction receipt.
@@ -5119,135 +4636,559 @@ bool OTRecordList::Populate()
                     strDateSigned.Format("%" PRIu64 "", lDateSigned);
                     str_date = strDateSigned.Get();
                 }
-                std::string str_amount;  // <========== AMOUNT
-                Amount lAmount = pBoxTrans->GetAbbrevDisplayAmount();
-
-                if (0 == lAmount) lAmount = pBoxTrans->GetReceiptAmount();
-                if (0 != lAmount) {
-                    String strTemp;
-                    strTemp.Format("%" PRId64 "", lAmount);
-                    str_amount = strTemp.Get();
+                const std::string* p_str_asset_type =
+                    &OTRecordList::s_blank;  // <========== ASSET TYPE
+                const std::string* p_str_asset_name =
+                    &OTRecordList::s_blank;  // instrument definition
+                                             // display name.
+                const std::string* p_str_account =
+                    &OTRecordList::s_blank;  // <========== ACCOUNT
+                std::string str_amount;      // <========== AMOUNT
+                std::string str_type;        // Instrument type.
+                std::string str_memo;  // Instrument memo (if applicable.)
+                String strContents;    // Instrument contents.
+
+                std::string str_payment_notary_id;
+
+                TransactionNumber lPaymentInstrumentTransNumDisplay = 0;
+
+                if (pBoxTrans->IsAbbreviated()) {
+                    str_type =
+                        pBoxTrans->GetTypeString();  // instrumentNotice,
+                                                     // etc.
+                    Amount lAmount = pBoxTrans->GetAbbrevDisplayAmount();
+
+                    if (0 != lAmount) {
+                        String strTemp;
+                        strTemp.Format("%" PRId64 "", lAmount);
+                        str_amount = strTemp.Get();
+                    }
+                } else  // NOT abbreviated. (Full box receipt is already
+                        // loaded.)
+                {
+                    OTPayment* pPayment = GetInstrumentByReceiptID(
+                        *pNym, lReceiptId, *pExpiredbox);
+                    std::unique_ptr<OTPayment> thePaymentAngel(pPayment);
+
+                    if (nullptr == pPayment)  // then we treat it like it's
+                                              // abbreviated.
+                    {
+                        str_type =
+                            pBoxTrans
+                                ->GetTypeString();  // instrumentNotice,
+                                                    // etc.
+                        Amount lAmount =
+                            pBoxTrans->GetAbbrevDisplayAmount();
+
+                        if (0 != lAmount) {
+                            String strTemp;
+                            strTemp.Format("%" PRId64 "", lAmount);
+                            str_amount = strTemp.Get();
+                        }
+                    }
+                    // We have pPayment, the instrument accompanying the
+                    // receipt in the payments recordbox.
+                    else if (pPayment->SetTempValues()) {
+                        TransactionNumber lPaymentInstrumentTransNum = 0;
+                        TransactionNumber lOpeningNum = 0;
+
+                        if (pPayment->GetOpeningNum(lOpeningNum, theNymID))
+                            lPaymentInstrumentTransNum = lOpeningNum;
+                        else
+                            pPayment->GetTransactionNum(
+                                lPaymentInstrumentTransNum);
+
+                        pPayment->GetTransNumDisplay(
+                            lPaymentInstrumentTransNumDisplay);
+
+                        if (lPaymentInstrumentTransNumDisplay <= 0)
+                            lPaymentInstrumentTransNumDisplay =
+                                lPaymentInstrumentTransNum;
+
+                        pPayment->GetValidFrom(tValidFrom);
+                        pPayment->GetValidTo(tValidTo);
+
+                        if (tValidFrom > OT_TIME_ZERO) {
+                            const std::uint64_t lFrom =
+                                OTTimeGetSecondsFromTime(tValidFrom);
+                            String strFrom;
+                            strFrom.Format("%" PRIu64 "", lFrom);
+                            str_date = strFrom.Get();
+                        }
+                        pPayment->GetPaymentContents(strContents);
+                        auto theAccountID = Identifier::Factory();
+
+                        auto paymentNotaryId = Identifier::Factory();
+                        if (pPayment->GetNotaryID(paymentNotaryId)) {
+                            str_payment_notary_id = paymentNotaryId->str();
+                        }
+
+                        if (bOutgoing)  // Nym is sender.
+                        {
+                            if (((pPayment->IsPaymentPlan() ||
+                                  pPayment->IsNotice()) &&
+                                 pPayment->GetRecipientAcctID(
+                                     theAccountID)) ||
+                                pPayment->GetSenderAcctIDForDisplay(
+                                    theAccountID))  // Since Nym is ME, the
+                                                    // Account must be MY
+                                                    // acct.
+                            {  // (If this record was originally OUTgoing,
+                                // then the SENDER's account is MY acct.)
+                                // UPDATE: Unless I sent a payment plan
+                                // proposal. In which case I, the merchant,
+                                // am the "sender" of the proposal, but the
+                                // "sender" on the instrument is the
+                                // customer,
+                                // since he will be "sending" me the money!
+                                // So the "Recipient" of the proposal
+                                // message
+                                // (outgoing from my perspective) is
+                                // actually the "Sender" of the money
+                                // according to the
+                                // instrument (which will be incoming,
+                                // according to my perspective, when those
+                                // payments
+                                // start to arrive.) Thus, though the
+                                // merchant is the "sender" of the proposal,
+                                // he's the
+                                // "recipient" on the instrument.
+                                String strTemp(theAccountID);
+                                std::string str_outpmt_account =
+                                    strTemp.Get();  // The accountID we
+                                                    // found on the payment
+                                                    // (only applies to
+                                                    // outgoing payments.)
+                                auto it_acct = std::find(
+                                    m_accounts.begin(),
+                                    m_accounts.end(),
+                                    str_outpmt_account);
+                                if (it_acct !=
+                                    m_accounts.end())  // Found it on the
+                                                       // list of accounts
+                                                       // we care about.
+                                {
+                                    p_str_account = &(*it_acct);
+                                } else {
+                                    // There was definitely an account on
+                                    // the instrument, and it definitely
+                                    // did not match any of the accounts
+                                    // that we care about.
+                                    // Therefore, skip.
+                                    //
+                                    otInfo << __FUNCTION__
+                                           << ": Skipping 'sent payment' "
+                                              "expired record. (We don't "
+                                              "care about account "
+                                           << str_outpmt_account.c_str()
+                                           << ")\n";
+                                    continue;
+                                }
+                            }
+                        } else  // Nym is recipient.
+                        {
+                            // Why is this here? Because if Nym is
+                            // recipient, let's say he received
+                            // an instrumentNotice containing a
+                            // sendNymInstrument message containing
+                            // an incoming cheque. Well... that incoming
+                            // cheque (the payload on
+                            // sendNymInstrument message) is ENCRYPTED.
+                            // Meaning the above calls to
+                            // pBoxReceipt->GetSenderAcctID on the
+                            // instrumentNotice transaction will
+                            // FAIL. One option is to pass pNym into
+                            // GetSenderAcctID so it can
+                            // decrypt the payload and return the value. But
+                            // since we already have
+                            // the payload decrypted here (we already have
+                            // the cheque loaded up
+                            // here) we can just grab the senderAcctID
+                            // directly from the cheque.
+                            // That's why this is here -- because this is
+                            // where we KNOW we have the
+                            // account ID -- so we grab it.
+                            //
+                            if (str_other_acct_id.empty() &&
+                                (((pPayment->IsPaymentPlan() ||
+                                   pPayment->IsNotice()) &&
+                                  pPayment->GetRecipientAcctID(
+                                      theAccountID)) ||
+                                 pPayment->GetSenderAcctIDForDisplay(
+                                     theAccountID))) {
+                                String strTemp(theAccountID);
+                                str_other_acct_id = strTemp.Get();
+                            }
+                        }
+                        // By this point, p_str_account is definitely set.
+                        OT_ASSERT(nullptr != p_str_account);  // and it's
+                                                              // either
+                                                              // blank, or
+                                                              // it's one of
+                                                              // the
+                                                              // accounts we
+                                                              // care about.
+                        auto theInstrumentDefinitionID =
+                            Identifier::Factory();
+
+                        if (pPayment->GetInstrumentDefinitionID(
+                                theInstrumentDefinitionID)) {
+                            String strTemp(theInstrumentDefinitionID);
+                            const std::string str_inpmt_asset(
+                                strTemp.Get());  // The instrument
+                                                 // definition we found on
+                                                 // the payment (if we found
+                                                 // anything.)
+                            auto it_asset = m_assets.find(str_inpmt_asset);
+                            if (it_asset !=
+                                m_assets.end())  // Found it on the map of
+                                                 // instrument definitions
+                                                 // we care about.
+                            {
+                                p_str_asset_type =
+                                    &(it_asset->first);  // Set the asset
+                                                         // type ID.
+                                p_str_asset_name =
+                                    &(it_asset->second);  // The
+                                                          // CurrencyTLA.
+                                                          // Examples: USD,
+                                                          // BTC, etc.
+                            } else {
+                                // There was definitely an instrument
+                                // definition on the instrument, and
+                                // it definitely did not match any of the
+                                // assets that we care about.
+                                // Therefore, skip.
+                                //
+                                otErr << __FUNCTION__
+                                      << ": Skipping: Expired payment "
+                                         "record (we don't care about "
+                                         "instrument definition "
+                                      << str_inpmt_asset.c_str() << ")\n";
+                                continue;
+                            }
+                        }
+                        // By this point, p_str_asset_type and
+                        // p_str_asset_name are definitely set.
+                        OT_ASSERT(nullptr != p_str_asset_type);  // and it's
+                        // either blank,
+                        // or it's one of
+                        // the asset
+                        // types we care
+                        // about.
+                        OT_ASSERT(nullptr != p_str_asset_name);  // and it's
+                        // either blank,
+                        // or it's one of
+                        // the asset
+                        // types we care
+                        // about.
+                        String strMemo;
+                        if (pPayment->GetMemo(strMemo)) {
+                            str_memo = strMemo.Get();
+                        }
+                        // Instrument type (cheque, voucher, etc)
+                        std::int32_t nType =
+                            static_cast<std::int32_t>(pPayment->GetType());
+
+                        str_type = GetTypeString(nType);
+                        Amount lAmount = 0;
+
+                        if (pPayment->GetAmount(lAmount)) {
+                            String strTemp;
+                            strTemp.Format("%" PRId64 "", lAmount);
+                            str_amount = strTemp.Get();
+                        }
+                    }
                 }
-                const std::string str_type(
-                    pBoxTrans->GetTypeString());  // pending, chequeReceipt,
-                                                  // etc.
-                otInfo << __FUNCTION__ << ": ADDED: incoming "
-                       << ((OTTransaction::pending == pBoxTrans->GetType())
-                               ? "pending transfer"
-                               : "receipt")
+                otInfo << __FUNCTION__ << ": ADDED: Expired payment record "
+                       << (bOutgoing ? "(sent)" : "(received)")
                        << " (str_type: " << str_type.c_str() << ")\n";
 
                 shared_ptr_OTRecord sp_Record(new OTRecord(
                     *this,
-                    *pstr_notary_id,
-                    *pstr_notary_id,
-                    *pstr_instrument_definition_id,
-                    *pstr_asset_name,
-                    *pstr_nym_id,    // This is the Nym WHOSE BOX IT IS.
-                    str_account_id,  // This is the Nym's account for this
-                                     // box.
-                    // Everything above this line, it stores a reference to
-                    // an external string.
-                    // Everything below this line, it makes its own internal
-                    // copy of the string.
-                    str_name,  // name of sender (since its in the inbox.)
-                    str_date,  // the "valid from" date on the instrument.
+                    theMsgNotaryID->str(),  // Transport Notary
+                    str_payment_notary_id,  // Payment Notary
+                    *p_str_asset_type,
+                    *p_str_asset_name,
+                    str_nym_id,      // This is the Nym WHOSE BOX IT IS.
+                    *p_str_account,  // This is the Nym's account for
+                                     // this box. (Blank for incoming,
+                                     // set for outgoing.)
+                    // Everything above this line, it stores a reference
+                    // to an external string.
+                    // Everything below this line, it makes its own
+                    // internal copy of the string.
+                    str_name,  // name of sender or recipient (since its
+                               // in the recordbox.)
+                    str_date,  // the "date signed" on the receipt.
                     str_amount,
-                    str_type,  // pending, chequeReceipt, etc.
-                    (OTTransaction::pending ==
-                     pBoxTrans->GetType()),  // Sometimes true, often false.
-                    (lAmount < 0) ? true : false,  // bIsOutgoing (this is
-                                                   // the inbox, but a
-                    // transferReceipt in the inbox represents
-                    // outgoing funds. Whereas a "pending" in the
-                    // inbox represents incoming funds. For now I'm
-                    // just going to go based on whether the amount
-                    // is negative or not, to determine incoming /
-                    // outgoing. We'll see how that works.)
-                    false,  // IsRecord
-                    (OTTransaction::pending !=
-                     pBoxTrans->GetType()),  // IsReceipt,
-                    (OTTransaction::pending == pBoxTrans->GetType())
-                        ? OTRecord::Transfer
-                        : OTRecord::Receipt));
-
-                const String strContents(*pBoxTrans);
-                sp_Record->SetContents(strContents.Get());
+                    str_type,   // pending, chequeReceipt, etc.
+                    false,      // Everything in the recordbox is finished.
+                                // (NOT pending.)
+                    bOutgoing,  // Since it's the recordbox, it contains
+                                // both incoming and outgoing receipts.
+                    true,       // IsRecord
+                    false,      // IsReceipt,
+                    recordType));
+                if (strContents.Exists())
+                    sp_Record->SetContents(strContents.Get());
+
                 sp_Record->SetDateRange(tValidFrom, tValidTo);
-                sp_Record->SetBoxIndex(nInboxIndex);
+                sp_Record->SetExpired();
+                sp_Record->SetBoxIndex(nIndex);
 
-                if (bCanceled) sp_Record->SetCanceled();
                 if (!str_memo.empty()) sp_Record->SetMemo(str_memo);
                 if (!str_other_nym_id.empty())
                     sp_Record->SetOtherNymID(str_other_nym_id);
                 if (!str_other_acct_id.empty())
                     sp_Record->SetOtherAccountID(str_other_acct_id);
 
-                sp_Record->SetTransNumForDisplay(
-                    pBoxTrans->GetReferenceNumForDisplay());
-                sp_Record->SetTransactionNum(pBoxTrans->GetTransactionNum());
+                if (lPaymentInstrumentTransNumDisplay > 0)
+                    sp_Record->SetTransNumForDisplay(
+                        lPaymentInstrumentTransNumDisplay);
+                else
+                    sp_Record->SetTransNumForDisplay(
+                        pBoxTrans->GetReferenceNumForDisplay());
+                sp_Record->SetTransactionNum(
+                    pBoxTrans->GetTransactionNum());
 
                 if (bHasSuccess) sp_Record->SetSuccess(bIsSuccess);
 
-                //                otErr << "DEBUGGING! Added " <<
-                //                pBoxTrans->GetTypeString() <<
-                //                "\n pBoxTrans->GetTransactionNum(): " <<
-                //                pBoxTrans->GetTransactionNum() <<
-                //                "\n pBoxTrans->GetReferenceNumForDisplay()" <<
-                //                pBoxTrans->GetReferenceNumForDisplay() <<
-                //                "\n";
+                if (bCanceled) sp_Record->SetCanceled();
 
-                m_contents.push_back(sp_Record);
-            }
-        }
-        // OPTIMIZE FYI:
-        // NOTE: LoadOutbox is much SLOWER than LoadOutboxNoVerify, but it also
-        // lets you get the NAME off of the box receipt. So if you are willing
-        // to GIVE UP the NAME, in return for FASTER PERFORMANCE, then call
-        // SetFastMode() before running Populate.
-        //
-        Ledger* pOutbox{nullptr};
+                output.push_back(sp_Record);
 
-        if (false == theNymID.empty()) {
-            pOutbox = m_bRunFast ? OT::App().API().OTAPI().LoadOutboxNoVerify(
-                                       theNotaryID, theNymID, theAccountID)
-                                 : OT::App().API().OTAPI().LoadOutbox(
-                                       theNotaryID, theNymID, theAccountID);
-        }
+            }  // Loop through ExpiredBox
+        } else
+            otWarn << __FUNCTION__
+                   << ": Failed loading expired payments box. "
+                      "(Probably just doesn't exist yet.)\n";
+    }  // Loop through servers for each Nym.
+}
 
-        std::unique_ptr<Ledger> theOutboxAngel(pOutbox);
+// Produces the records for one asset account from its INBOX, OUTBOX, and
+// RECORD BOX, which have already been loaded by load_account().
+void OTRecordList::populate_account(
+    const std::string& str_account_id,
+    const std::int32_t nAccountIndex,
+    AccountBoxes& boxes,
+    vec_OTRecordList& output)
+{
+    // For each account, loop through its inbox, outbox, and record box.
+    //
+    const auto theAccountID = Identifier::Factory(str_account_id);
+    auto account = wallet_.Account(theAccountID);
 
-        // It loaded up, so let's loop through it.
-        if (pOutbox) {
-            std::int32_t nOutboxIndex{-1};
-            for (auto& it : pOutbox->GetTransactionMap()) {
-                ++nOutboxIndex;  // (0 on first iteration.)
-                if (0 == nOutboxIndex)
-                    otInfo
-                        << __FUNCTION__
-                        << ": Beginning loop through asset account OUTBOX...\n";
-                OTTransaction* pBoxTrans = it.second;
-                OT_ASSERT(nullptr != pBoxTrans);
-                otInfo << __FUNCTION__ << ": Outbox index: " << nOutboxIndex
-                       << "\n";
-                std::string str_name;  // name of recipient (since its in the
-                                       // outbox.)
-                std::string str_other_nym_id;
-                std::string str_other_acct_id;
-                std::string str_memo;
+    if (false == bool(account)) {
+        // This can happen if the user erases the account.
+        // Therefore we just need to skip it.
+        otInfo << __FUNCTION__ << ": Skipping an account ("
+               << str_account_id.c_str()
+               << ") since it has disappeared from the wallet. (Probably "
+                  "deleted by the user.)\n";
+        return;
+    }
+    const Identifier& theNymID = account.get().GetNymID();
+    const Identifier& theNotaryID = account.get().GetPurportedNotaryID();
+    const Identifier& theInstrumentDefinitionID =
+        account.get().GetInstrumentDefinitionID();
+    account.Release();
+    const String strNymID(theNymID);
+    const String strNotaryID(theNotaryID);
+    const String strInstrumentDefinitionID(theInstrumentDefinitionID);
+    otInfo << "------------\n"
+           << __FUNCTION__ << ": Account: " << nAccountIndex
+           << ", ID: " << str_account_id.c_str() << "\n";
+    const std::string str_nym_id(strNymID.Get());
+    const std::string str_notary_id(strNotaryID.Get());
+    const std::string str_instrument_definition_id(
+        strInstrumentDefinitionID.Get());
+    const std::string* pstr_nym_id = &OTRecordList::s_blank;
+    const std::string* pstr_notary_id = &OTRecordList::s_blank;
+    const std::string* pstr_instrument_definition_id =
+        &OTRecordList::s_blank;
+    const std::string* pstr_asset_name = &OTRecordList::s_blank;
+    // NOTE: Since this account is already on my "care about" list for
+    // accounts,
+    // I wouldn't bother double-checking my "care about" lists for servers,
+    // nyms,
+    // and instrument definitions. But I still look up the appropriate
+    // string for each,
+    // since
+    // I have to pass a reference to it into the constructor for OTRecord.
+    // (To a version
+    // that won't be deleted, since the OTRecord will reference it. And the
+    // "care about"
+    // list definitely contains a copy of the string that won't be deleted.)
+    //
+    auto it_nym = std::find(m_nyms.begin(), m_nyms.end(), str_nym_id);
+    auto it_server =
+        std::find(m_servers.begin(), m_servers.end(), str_notary_id);
+    auto it_asset = m_assets.find(str_instrument_definition_id);
+    if ((m_nyms.end() == it_nym) || (m_servers.end() == it_server) ||
+        (m_assets.end() == it_asset)) {
+        otInfo << __FUNCTION__ << ": Skipping an account ("
+               << str_account_id.c_str()
+               << ") since its Nym, or Server, "
+                  "or Asset Type wasn't on my list.\n";
+        return;
+    }
+    // These pointers are what we'll use to construct each OTRecord.
+    //
+    pstr_nym_id = &(*it_nym);
+    pstr_notary_id = &(*it_server);
+    pstr_instrument_definition_id = &(it_asset->first);
+    pstr_asset_name = &(it_asset->second);
+    // Loop through asset account INBOX.
+    //
+    // OPTIMIZE FYI:
+    // NOTE: LoadInbox is much SLOWER than LoadInboxNoVerify, but it also
+    // lets you get
+    // the NAME off of the box receipt. So if you are willing to GIVE UP the
+    // NAME, in
+    // return for FASTER PERFORMANCE, then call SetFastMode() before
+    // Populating.
+    //
+    Ledger* pInbox = boxes.inbox_.release();
+
+    std::unique_ptr<Ledger> theInboxAngel(pInbox);
+
+    // It loaded up, so let's loop through it.
+    if (pInbox) {
+        std::int32_t nInboxIndex = -1;
+        for (auto& it : pInbox->GetTransactionMap()) {
+            ++nInboxIndex;  // (0 on first iteration.)
+            if (0 == nInboxIndex)
+                otInfo
+                    << __FUNCTION__
+                    << ": Beginning loop through asset account INBOX...\n";
+            OTTransaction* pBoxTrans = it.second;
+            OT_ASSERT(nullptr != pBoxTrans);
+            otInfo << __FUNCTION__ << ": Inbox index: " << nInboxIndex
+                   << "\n";
+            bool bCanceled = false;
+            std::string str_name;  // name of sender (since its in the
+                                   // inbox.)
+            std::string str_other_nym_id;
+            std::string str_other_acct_id;
+            std::string str_memo;
 
-                if (!pBoxTrans->IsAbbreviated()) {
+            bool bHasSuccess = false;
+            bool bIsSuccess = false;
+
+            if (!pBoxTrans->IsAbbreviated()) {
+                String strMemo;
+
+                if (pBoxTrans->GetMemo(strMemo)) str_memo = strMemo.Get();
+
+                if (OTTransaction::pending == pBoxTrans->GetType()) {
+                    // NOTE: REMOVE THE BELOW CODE. (Found a better way,
+                    // above this block.)
+                    //                      const OTString
+                    //                      strBoxTrans(*pBoxTrans);
+                    //                      if (strBoxTrans.Exists())
+                    //                         str_memo =
+                    //            SwigWrap::Pending_GetNote(*pstr_notary_id,
+                    //                                      *pstr_nym_id,
+                    //                                      str_account_id,
+                    //                                   strBoxTrans.Get());
+                    auto theSenderID = Identifier::Factory(),
+                         theSenderAcctID = Identifier::Factory();
+
+                    if (pBoxTrans->GetSenderAcctIDForDisplay(
+                            theSenderAcctID))  // ACCOUNT name.
+                    {
+                        if (pBoxTrans->GetSenderNymIDForDisplay(
+                                theSenderID)) {
+                            const String strSenderID(theSenderID);
+                            str_other_nym_id = strSenderID.Get();
+                        }
+                        const String strSenderAcctID(theSenderAcctID);
+                        const std::string str_sender_acct_id(
+                            strSenderAcctID.Get());
+
+                        str_other_acct_id = str_sender_acct_id;
+
+                        String strName(m_pLookup->GetAcctName(
+                            str_other_acct_id,
+                            str_other_nym_id,  // nym ID if known
+                            *pstr_notary_id,   // server ID if known.
+                            *pstr_instrument_definition_id)),  // instrument
+                                                               // definition
+                                                               // id if
+                                                               // known.
+                            strNameTemp;
+
+                        if (strName.Exists()) {
+                            strNameTemp.Format(
+                                OTRecordList::textFrom(), strName.Get());
+                            str_name = strNameTemp.Get();
+                        } else if (!str_other_nym_id.empty()) {
+                            String strNymName(m_pLookup->GetNymName(
+                                str_other_nym_id, *it_server)),
+                                strNymNameTemp;
+
+                            if (strNymName.Exists()) {
+                                strNymNameTemp.Format(
+                                    OTRecordList::textFrom(),
+                                    strNymName.Get());
+                                str_name = strNameTemp.Get();
+                            }
+                        }
+                        if (str_name.empty()) {
+                            strNameTemp.Format(
+                                OTRecordList::textFrom(),
+                                str_sender_acct_id.c_str());
+                            str_name = strNameTemp.Get();
+                        }
+                    } else if (pBoxTrans->GetSenderNymIDForDisplay(
+                                   theSenderID))  // NYM name.
+                    {
+                        const String strSenderID(theSenderID);
+                        const std::string str_sender_id(strSenderID.Get());
+
+                        String strName(m_pLookup->GetNymName(
+                            str_sender_id, *it_server)),
+                            strNameTemp;
+
+                        if (strName.Exists())
+                            strNameTemp.Format(
+                                OTRecordList::textFrom(), strName.Get());
+                        else
+                            strNameTemp.Format(
+                                OTRecordList::textFrom(),
+                                str_sender_id.c_str());
+
+                        str_name = strNameTemp.Get();
+                        str_other_nym_id = str_sender_id;
+                    } else {
+                        String strName(SwigWrap::GetAccountWallet_Name(
+                            str_account_id)),
+                            strNameTemp;
+
+                        if (strName.Exists())
+                            strNameTemp = strName;
+                        else
+                            strNameTemp = String(str_account_id);
+
+                        str_name = strNameTemp.Get();
+                    }
+                }     // end: (if pending)
+                else  // else it's a receipt.
+                {
+                    pBoxTrans->GetSuccess(&bHasSuccess, &bIsSuccess);
+                    // -------------------------------
                     auto theRecipientID = Identifier::Factory(),
                          theRecipientAcctID = Identifier::Factory();
 
                     if (pBoxTrans->GetRecipientNymIDForDisplay(
                             theRecipientID)) {
                         const String strRecipientID(theRecipientID);
-                        const std::string str_recipient_id(
+                        const std::string str_recipient_nym_id(
                             strRecipientID.Get());
 
                         String strName(m_pLookup->GetNymName(
-                            str_recipient_id, *it_server)),
+                            str_recipient_nym_id, *it_server)),
                             strNameTemp;
 
                         if (strName.Exists())
@@ -5256,13 +5197,14 @@ bool OTRecordList::Populate()
                         else
                             strNameTemp.Format(
                                 OTRecordList::textTo(),
-                                str_recipient_id.c_str());
+                                str_recipient_nym_id.c_str());
 
                         str_name = strNameTemp.Get();
-                        str_other_nym_id = str_recipient_id;
+                        str_other_nym_id = str_recipient_nym_id;
                         if (pBoxTrans->GetRecipientAcctIDForDisplay(
                                 theRecipientAcctID)) {
-                            const String strRecipientAcctID(theRecipientAcctID);
+                            const String strRecipientAcctID(
+                                theRecipientAcctID);
                             str_other_acct_id = strRecipientAcctID.Get();
                         }
                     } else if (pBoxTrans->GetRecipientAcctIDForDisplay(
@@ -5276,8 +5218,9 @@ bool OTRecordList::Populate()
                             "",               // nym ID if known
                             *pstr_notary_id,  // server ID if known.
                             *pstr_instrument_definition_id)),  // instrument
-                            // definition id if
-                            // known.
+                                                               // definition
+                                                               // id if
+                                                               // known.
                             strNameTemp;
 
                         if (strName.Exists())
@@ -5291,468 +5234,573 @@ bool OTRecordList::Populate()
                         str_name = strNameTemp.Get();
                         str_other_acct_id = str_recipient_acct_id;
                     }
-                    if (OTTransaction::pending == pBoxTrans->GetType()) {
-                        String strMemo;
-
-                        if (pBoxTrans->GetMemo(strMemo))
-                            str_memo = strMemo.Get();
-
-                        // DELETE THE BELOW CODE (replaced by above code.)
-                        //                    const OTString
-                        //                    strBoxTrans(*pBoxTrans);
-                        //
-                        //                    if (strBoxTrans.Exists())
-                        //                        str_memo =
-                        //                        SwigWrap::Pending_GetNote(*pstr_notary_id,
-                        //                            *pstr_nym_id,
-                        //                            str_account_id,
-                        //                            strBoxTrans.Get());
-                    }
-                }
-                time64_t tValidFrom = OT_TIME_ZERO, tValidTo = OT_TIME_ZERO;
-                std::string str_date =
-                    "0";  // the "date signed" on the transaction receipt.
-                time64_t tDateSigned = pBoxTrans->GetDateSigned();
-
-                if (tDateSigned > OT_TIME_ZERO) {
-                    tValidFrom = tDateSigned;
-                    const std::uint64_t lDateSigned =
-                        OTTimeGetSecondsFromTime(tDateSigned);
-                    String strDateSigned;
-                    strDateSigned.Format("%" PRIu64 "", lDateSigned);
-                    str_date = strDateSigned.Get();
-                }
-                std::string str_amount;  // <========== AMOUNT
-                Amount lAmount = pBoxTrans->GetAbbrevDisplayAmount();
-
-                if (0 == lAmount) lAmount = pBoxTrans->GetReceiptAmount();
-                if (lAmount > 0)  // Outgoing transfer should display with
-                                  // negative amount
-                    lAmount *= (-1);
-                if (0 != lAmount) {
-                    String strTemp;
-                    strTemp.Format("%" PRId64 "", lAmount);
-                    str_amount = strTemp.Get();
-                }
-                std::string str_type(
-                    pBoxTrans->GetTypeString());  // pending, chequeReceipt,
-                                                  // etc.
-                if (0 == str_type.compare("pending")) str_type = "transfer";
-                otInfo << __FUNCTION__ << ": ADDED: "
-                       << ((OTTransaction::pending == pBoxTrans->GetType())
-                               ? "pending"
-                               : "ERROR")
-                       << " outgoing transfer (str_type: " << str_type.c_str()
-                       << ").\n";
-
-                shared_ptr_OTRecord sp_Record(new OTRecord(
-                    *this,
-                    *pstr_notary_id,  // Transport Notary.
-                    *pstr_notary_id,  // Payment Notary.
-                    *pstr_instrument_definition_id,
-                    *pstr_asset_name,
-                    *pstr_nym_id,    // This is the Nym WHOSE BOX IT IS.
-                    str_account_id,  // This is the Nym's account for this box.
-                    // Everything above this line, it stores a reference to
-                    // an external string.
-                    // Everything below this line, it makes its own internal
-                    // copy of the string.
-                    str_name,  // name of recipient (since its in the
-                               // outbox.)
-                    str_date,  // the "valid from" date on the instrument.
-                    str_amount,
-                    str_type,  // pending, chequeReceipt, etc.
-                    (OTTransaction::pending ==
-                     pBoxTrans->GetType()),  // Basically always true, in
-                                             // this case.
-                    true,   // bIsOutgoing=true. (Since this is the
-                            // outbox...)
-                    false,  // IsRecord
-                    false,  // IsReceipt
-                    OTRecord::Transfer));
-                const String strContents(*pBoxTrans);
-                sp_Record->SetContents(strContents.Get());
-                sp_Record->SetDateRange(tValidFrom, tValidTo);
-                sp_Record->SetBoxIndex(nOutboxIndex);
-                if (!str_memo.empty()) sp_Record->SetMemo(str_memo);
-                if (!str_other_nym_id.empty())
-                    sp_Record->SetOtherNymID(str_other_nym_id);
-                if (!str_other_acct_id.empty())
-                    sp_Record->SetOtherAccountID(str_other_acct_id);
-                sp_Record->SetTransNumForDisplay(
-                    pBoxTrans->GetReferenceNumForDisplay());
-                sp_Record->SetTransactionNum(pBoxTrans->GetTransactionNum());
-
-                //                otErr << "DEBUGGING! Added outgoing asset
-                //                account record: " <<
-                //                pBoxTrans->GetTypeString() <<
-                //                "\n pBoxTrans->GetTransactionNum(): " <<
-                //                pBoxTrans->GetTransactionNum() <<
-                //                "\n pBoxTrans->GetReferenceNumForDisplay()" <<
-                //                pBoxTrans->GetReferenceNumForDisplay() <<
-                //                "\n";
-
-                m_contents.push_back(sp_Record);
+                }  // end: (else it's a receipt.)
             }
-        }
-        // ---------------------------------------------------
-        // For this record box, pass a NymID AND an AcctID,
-        // since it's the recordbox for a SPECIFIC ACCOUNT.
-        //
-        // OPTIMIZE FYI:
-        // NOTE: LoadRecordBox is much SLOWER than LoadRecordBoxNoVerify, but it
-        // also lets you get the NAME off of the box receipt. So if you are
-        // willing to GIVE UP the NAME, in return for FASTER PERFORMANCE, then
-        // call SetFastMode() before Populating.
-        //
-        Ledger* pRecordbox{nullptr};
+            bCanceled = pBoxTrans->IsCancelled();
+            time64_t tValidFrom = OT_TIME_ZERO, tValidTo = OT_TIME_ZERO;
+            std::string str_date =
+                "0";  // the "date signed" on the transaction receipt.
+            time64_t tDateSigned = pBoxTrans->GetDateSigned();
+
+            if (tDateSigned > OT_TIME_ZERO) {
+                tValidFrom = tDateSigned;
+                const std::uint64_t lDateSigned =
+                    OTTimeGetSecondsFromTime(tDateSigned);
+                String strDateSigned;
+                strDateSigned.Format("%" PRIu64 "", lDateSigned);
+                str_date = strDateSigned.Get();
+            }
+            std::string str_amount;  // <========== AMOUNT
+            Amount lAmount = pBoxTrans->GetAbbrevDisplayAmount();
 
-        if (false == theNymID.empty()) {
-            pRecordbox = m_bRunFast
-                             ? OT::App().API().OTAPI().LoadRecordBoxNoVerify(
-                                   theNotaryID, theNymID, theAccountID)
-                             : OT::App().API().OTAPI().LoadRecordBox(
-                                   theNotaryID, theNymID, theAccountID);
+            if (0 == lAmount) lAmount = pBoxTrans->GetReceiptAmount();
+            if (0 != lAmount) {
+                String strTemp;
+                strTemp.Format("%" PRId64 "", lAmount);
+                str_amount = strTemp.Get();
+            }
+            const std::string str_type(
+                pBoxTrans->GetTypeString());  // pending, chequeReceipt,
+                                              // etc.
+            otInfo << __FUNCTION__ << ": ADDED: incoming "
+                   << ((OTTransaction::pending == pBoxTrans->GetType())
+                           ? "pending transfer"
+                           : "receipt")
+                   << " (str_type: " << str_type.c_str() << ")\n";
+
+            shared_ptr_OTRecord sp_Record(new OTRecord(
+                *this,
+                *pstr_notary_id,
+                *pstr_notary_id,
+                *pstr_instrument_definition_id,
+                *pstr_asset_name,
+                *pstr_nym_id,    // This is the Nym WHOSE BOX IT IS.
+                str_account_id,  // This is the Nym's account for this
+                                 // box.
+                // Everything above this line, it stores a reference to
+                // an external string.
+                // Everything below this line, it makes its own internal
+                // copy of the string.
+                str_name,  // name of sender (since its in the inbox.)
+                str_date,  // the "valid from" date on the instrument.
+                str_amount,
+                str_type,  // pending, chequeReceipt, etc.
+                (OTTransaction::pending ==
+                 pBoxTrans->GetType()),  // Sometimes true, often false.
+                (lAmount < 0) ? true : false,  // bIsOutgoing (this is
+                                               // the inbox, but a
+                // transferReceipt in the inbox represents
+                // outgoing funds. Whereas a "pending" in the
+                // inbox represents incoming funds. For now I'm
+                // just going to go based on whether the amount
+                // is negative or not, to determine incoming /
+                // outgoing. We'll see how that works.)
+                false,  // IsRecord
+                (OTTransaction::pending !=
+                 pBoxTrans->GetType()),  // IsReceipt,
+                (OTTransaction::pending == pBoxTrans->GetType())
+                    ? OTRecord::Transfer
+                    : OTRecord::Receipt));
+
+            const String strContents(*pBoxTrans);
+            sp_Record->SetContents(strContents.Get());
+            sp_Record->SetDateRange(tValidFrom, tValidTo);
+            sp_Record->SetBoxIndex(nInboxIndex);
+
+            if (bCanceled) sp_Record->SetCanceled();
+            if (!str_memo.empty()) sp_Record->SetMemo(str_memo);
+            if (!str_other_nym_id.empty())
+                sp_Record->SetOtherNymID(str_other_nym_id);
+            if (!str_other_acct_id.empty())
+                sp_Record->SetOtherAccountID(str_other_acct_id);
+
+            sp_Record->SetTransNumForDisplay(
+                pBoxTrans->GetReferenceNumForDisplay());
+            sp_Record->SetTransactionNum(pBoxTrans->GetTransactionNum());
+
+            if (bHasSuccess) sp_Record->SetSuccess(bIsSuccess);
+
+            //                otErr << "DEBUGGING! Added " <<
+            //                pBoxTrans->GetTypeString() <<
+            //                "\n pBoxTrans->GetTransactionNum(): " <<
+            //                pBoxTrans->GetTransactionNum() <<
+            //                "\n pBoxTrans->GetReferenceNumForDisplay()" <<
+            //                pBoxTrans->GetReferenceNumForDisplay() <<
+            //                "\n";
+
+            output.push_back(sp_Record);
         }
+    }
+    // OPTIMIZE FYI:
+    // NOTE: LoadOutbox is much SLOWER than LoadOutboxNoVerify, but it also
+    // lets you get the NAME off of the box receipt. So if you are willing
+    // to GIVE UP the NAME, in return for FASTER PERFORMANCE, then call
+    // SetFastMode() before running Populate.
+    //
+    Ledger* pOutbox = boxes.outbox_.release();
+
+    std::unique_ptr<Ledger> theOutboxAngel(pOutbox);
+
+    // It loaded up, so let's loop through it.
+    if (pOutbox) {
+        std::int32_t nOutboxIndex{-1};
+        for (auto& it : pOutbox->GetTransactionMap()) {
+            ++nOutboxIndex;  // (0 on first iteration.)
+            if (0 == nOutboxIndex)
+                otInfo
+                    << __FUNCTION__
+                    << ": Beginning loop through asset account OUTBOX...\n";
+            OTTransaction* pBoxTrans = it.second;
+            OT_ASSERT(nullptr != pBoxTrans);
+            otInfo << __FUNCTION__ << ": Outbox index: " << nOutboxIndex
+                   << "\n";
+            std::string str_name;  // name of recipient (since its in the
+                                   // outbox.)
+            std::string str_other_nym_id;
+            std::string str_other_acct_id;
+            std::string str_memo;
 
-        std::unique_ptr<Ledger> theRecordBoxAngel(pRecordbox);
-
-        // It loaded up, so let's loop through it.
-        if (pRecordbox) {
-            std::int32_t nRecordIndex{-1};
-            for (auto& it : pRecordbox->GetTransactionMap()) {
-                ++nRecordIndex;
-                OTTransaction* pBoxTrans = it.second;
-                OT_ASSERT(nullptr != pBoxTrans);
-                otInfo << __FUNCTION__
-                       << ": Account RECORD index: " << nRecordIndex << "\n";
-                bool bOutgoing{false};
-                bool bCanceled{false};
-                std::string str_name;  // name of sender OR recipient (depending
-                                       // on whether it was originally incoming
-                                       // or outgoing.)
-                std::string str_other_nym_id;
-                std::string str_other_acct_id;
-                std::string str_memo;
-
-                bool bHasSuccess{false};
-                bool bIsSuccess{false};
+            if (!pBoxTrans->IsAbbreviated()) {
+                auto theRecipientID = Identifier::Factory(),
+                     theRecipientAcctID = Identifier::Factory();
 
-                TransactionNumber lClosingNum{0};
-                originType theOriginType = pBoxTrans->GetOriginType();
+                if (pBoxTrans->GetRecipientNymIDForDisplay(
+                        theRecipientID)) {
+                    const String strRecipientID(theRecipientID);
+                    const std::string str_recipient_id(
+                        strRecipientID.Get());
 
-                const bool bIsFinalReceipt =
-                    (OTTransaction::finalReceipt == pBoxTrans->GetType());
-                if (bIsFinalReceipt) lClosingNum = pBoxTrans->GetClosingNum();
+                    String strName(m_pLookup->GetNymName(
+                        str_recipient_id, *it_server)),
+                        strNameTemp;
 
-                if (!pBoxTrans->IsAbbreviated()) {
-                    if (pBoxTrans->GetType() != OTTransaction::pending)
-                        pBoxTrans->GetSuccess(&bHasSuccess, &bIsSuccess);
-                    // ----------------------------------------
-                    auto theSenderID = Identifier::Factory(),
-                         theSenderAcctID = Identifier::Factory();
-                    auto theRecipientID = Identifier::Factory(),
-                         theRecipientAcctID = Identifier::Factory();
+                    if (strName.Exists())
+                        strNameTemp.Format(
+                            OTRecordList::textTo(), strName.Get());
+                    else
+                        strNameTemp.Format(
+                            OTRecordList::textTo(),
+                            str_recipient_id.c_str());
 
-                    if (pBoxTrans->GetSenderAcctIDForDisplay(theSenderAcctID)) {
-                        const String strSenderAcctID(theSenderAcctID);
-                        const std::string str_sender_acct_id(
-                            strSenderAcctID.Get());
+                    str_name = strNameTemp.Get();
+                    str_other_nym_id = str_recipient_id;
+                    if (pBoxTrans->GetRecipientAcctIDForDisplay(
+                            theRecipientAcctID)) {
+                        const String strRecipientAcctID(theRecipientAcctID);
+                        str_other_acct_id = strRecipientAcctID.Get();
+                    }
+                } else if (pBoxTrans->GetRecipientAcctIDForDisplay(
+                               theRecipientAcctID)) {
+                    const String strRecipientAcctID(theRecipientAcctID);
+                    const std::string str_recipient_acct_id(
+                        strRecipientAcctID.Get());
+
+                    String strName(m_pLookup->GetAcctName(
+                        str_recipient_acct_id,
+                        "",               // nym ID if known
+                        *pstr_notary_id,  // server ID if known.
+                        *pstr_instrument_definition_id)),  // instrument
+                        // definition id if
+                        // known.
+                        strNameTemp;
 
-                        // Usually, Nym is the RECIPIENT. Sometimes he's the
-                        // sender.
-                        // Either way, we want the OTHER ID (the other Nym) for
-                        // display.
-                        // So here, if Nym's CLEARLY the sender, then we want
-                        // the RECIPIENT.
-                        // Whereas if Nym were the recipient, then we'd want the
-                        // SENDER. (For display.)
-                        //
-                        if (0 ==
-                            str_account_id.compare(
-                                str_sender_acct_id))  // str_account_id IS
-                                                      // str_sender_acct_id.
-                        // (Therefore we want recipient.)
-                        {
-                            bOutgoing = true;  // if Nym is the sender, then it
-                                               // must have been outgoing.
+                    if (strName.Exists())
+                        strNameTemp.Format(
+                            OTRecordList::textTo(), strName.Get());
+                    else
+                        strNameTemp.Format(
+                            OTRecordList::textTo(),
+                            str_recipient_acct_id.c_str());
 
-                            const bool bGotRecipientNymIDForDisplay =
-                                pBoxTrans->GetRecipientNymIDForDisplay(
-                                    theRecipientID);
+                    str_name = strNameTemp.Get();
+                    str_other_acct_id = str_recipient_acct_id;
+                }
+                if (OTTransaction::pending == pBoxTrans->GetType()) {
+                    String strMemo;
 
-                            if (pBoxTrans->GetRecipientAcctIDForDisplay(
-                                    theRecipientAcctID)) {
-                                const String strRecipientAcctID(
-                                    theRecipientAcctID);
-                                const std::string str_recip_acct_id(
-                                    strRecipientAcctID.Get());
+                    if (pBoxTrans->GetMemo(strMemo))
+                        str_memo = strMemo.Get();
 
-                                String strRecipientNymID("");
-                                std::string str_recip_nym_id("");
+                    // DELETE THE BELOW CODE (replaced by above code.)
+                    //                    const OTString
+                    //                    strBoxTrans(*pBoxTrans);
+                    //
+                    //                    if (strBoxTrans.Exists())
+                    //                        str_memo =
+                    //                        SwigWrap::Pending_GetNote(*pstr_notary_id,
+                    //                            *pstr_nym_id,
+                    //                            str_account_id,
+                    //                            strBoxTrans.Get());
+                }
+            }
+            time64_t tValidFrom = OT_TIME_ZERO, tValidTo = OT_TIME_ZERO;
+            std::string str_date =
+                "0";  // the "date signed" on the transaction receipt.
+            time64_t tDateSigned = pBoxTrans->GetDateSigned();
+
+            if (tDateSigned > OT_TIME_ZERO) {
+                tValidFrom = tDateSigned;
+                const std::uint64_t lDateSigned =
+                    OTTimeGetSecondsFromTime(tDateSigned);
+                String strDateSigned;
+                strDateSigned.Format("%" PRIu64 "", lDateSigned);
+                str_date = strDateSigned.Get();
+            }
+            std::string str_amount;  // <========== AMOUNT
+            Amount lAmount = pBoxTrans->GetAbbrevDisplayAmount();
 
-                                if (bGotRecipientNymIDForDisplay) {
-                                    theRecipientID->GetString(
-                                        strRecipientNymID);
-                                    str_recip_nym_id = strRecipientNymID.Get();
-                                }
-                                // NOTE: We check for cancelled here so we don't
-                                // accidentally
-                                // cause the address book to falsely believe
-                                // that str_recip_nym_id
-                                // is the owner of str_recip_acct_id. (If the
-                                // cheque/invoice is cancelled,
-                                // the recipient account will be the sender
-                                // account, which is NOT owned
-                                // by the recipient, obviously...)
-                                //
-                                if (!pBoxTrans->IsCancelled()) {
-                                    String strName(m_pLookup->GetAcctName(
-                                        str_recip_acct_id,
-                                        // NOTE: we CANNOT pass
-                                        // str_recip_nym_id here with
-                                        // str_recip_acct_id
-                                        // if it's a cancelled instrument,
-                                        // since in that case, the SENDER
-                                        // ACCT
-                                        // is ALSO the RECIPIENT ACCT. So
-                                        // this logic is ONLY correct since
-                                        // we
-                                        // are inside the block of if
-                                        // (!pBoxTrans->IsCancelled())
-                                        // (Otherwise we'd be training the
-                                        // address book to falsely believe
-                                        // that
-                                        // the recipient Nym is the owner of
-                                        // the sender acct.)
-                                        bGotRecipientNymIDForDisplay
-                                            ? str_recip_nym_id
-                                            : "",         // nym ID if known
-                                        *pstr_notary_id,  // server ID if
-                                                          // known.
-                                        *pstr_instrument_definition_id)),  // asset
-                                                                           // ID
-                                                                           // if
-                                        // known.
-                                        strNameTemp;
-
-                                    if (strName.Exists())
-                                        strNameTemp.Format(
-                                            OTRecordList::textTo(),
-                                            strName.Get());
-                                    else
-                                        strNameTemp.Format(
-                                            OTRecordList::textTo(),
-                                            str_recip_acct_id.c_str());
-
-                                    str_name =
-                                        strNameTemp.Get();  // We don't want to
-                                                            // see our own name
-                                                            // on cancelled
-                                                            // cheques.
-                                }
-                                str_other_acct_id = str_recip_acct_id;
-                            }
-                            if (bGotRecipientNymIDForDisplay) {
-                                const String strRecipientID(theRecipientID);
-                                const std::string str_recipient_id(
-                                    strRecipientID.Get());
+            if (0 == lAmount) lAmount = pBoxTrans->GetReceiptAmount();
+            if (lAmount > 0)  // Outgoing transfer should display with
+                              // negative amount
+                lAmount *= (-1);
+            if (0 != lAmount) {
+                String strTemp;
+                strTemp.Format("%" PRId64 "", lAmount);
+                str_amount = strTemp.Get();
+            }
+            std::string str_type(
+                pBoxTrans->GetTypeString());  // pending, chequeReceipt,
+                                              // etc.
+            if (0 == str_type.compare("pending")) str_type = "transfer";
+            otInfo << __FUNCTION__ << ": ADDED: "
+                   << ((OTTransaction::pending == pBoxTrans->GetType())
+                           ? "pending"
+                           : "ERROR")
+                   << " outgoing transfer (str_type: " << str_type.c_str()
+                   << ").\n";
+
+            shared_ptr_OTRecord sp_Record(new OTRecord(
+                *this,
+                *pstr_notary_id,  // Transport Notary.
+                *pstr_notary_id,  // Payment Notary.
+                *pstr_instrument_definition_id,
+                *pstr_asset_name,
+                *pstr_nym_id,    // This is the Nym WHOSE BOX IT IS.
+                str_account_id,  // This is the Nym's account for this box.
+                // Everything above this line, it stores a reference to
+                // an external string.
+                // Everything below this line, it makes its own internal
+                // copy of the string.
+                str_name,  // name of recipient (since its in the
+                           // outbox.)
+                str_date,  // the "valid from" date on the instrument.
+                str_amount,
+                str_type,  // pending, chequeReceipt, etc.
+                (OTTransaction::pending ==
+                 pBoxTrans->GetType()),  // Basically always true, in
+                                         // this case.
+                true,   // bIsOutgoing=true. (Since this is the
+                        // outbox...)
+                false,  // IsRecord
+                false,  // IsReceipt
+                OTRecord::Transfer));
+            const String strContents(*pBoxTrans);
+            sp_Record->SetContents(strContents.Get());
+            sp_Record->SetDateRange(tValidFrom, tValidTo);
+            sp_Record->SetBoxIndex(nOutboxIndex);
+            if (!str_memo.empty()) sp_Record->SetMemo(str_memo);
+            if (!str_other_nym_id.empty())
+                sp_Record->SetOtherNymID(str_other_nym_id);
+            if (!str_other_acct_id.empty())
+                sp_Record->SetOtherAccountID(str_other_acct_id);
+            sp_Record->SetTransNumForDisplay(
+                pBoxTrans->GetReferenceNumForDisplay());
+            sp_Record->SetTransactionNum(pBoxTrans->GetTransactionNum());
+
+            //                otErr << "DEBUGGING! Added outgoing asset
+            //                account record: " <<
+            //                pBoxTrans->GetTypeString() <<
+            //                "\n pBoxTrans->GetTransactionNum(): " <<
+            //                pBoxTrans->GetTransactionNum() <<
+            //                "\n pBoxTrans->GetReferenceNumForDisplay()" <<
+            //                pBoxTrans->GetReferenceNumForDisplay() <<
+            //                "\n";
+
+            output.push_back(sp_Record);
+        }
+    }
+    // ---------------------------------------------------
+    // For this record box, pass a NymID AND an AcctID,
+    // since it's the recordbox for a SPECIFIC ACCOUNT.
+    //
+    // OPTIMIZE FYI:
+    // NOTE: LoadRecordBox is much SLOWER than LoadRecordBoxNoVerify, but it
+    // also lets you get the NAME off of the box receipt. So if you are
+    // willing to GIVE UP the NAME, in return for FASTER PERFORMANCE, then
+    // call SetFastMode() before Populating.
+    //
+    Ledger* pRecordbox = boxes.recordbox_.release();
 
-                                str_other_nym_id = str_recipient_id;
+    std::unique_ptr<Ledger> theRecordBoxAngel(pRecordbox);
 
-                                if (str_name.empty()) {
-                                    String strName(m_pLookup->GetNymName(
-                                        str_recipient_id, *it_server)),
-                                        strNameTemp;
-
-                                    if (strName.Exists())
-                                        strNameTemp.Format(
-                                            OTRecordList::textTo(),
-                                            strName.Get());
-                                    else
-                                        strNameTemp.Format(
-                                            OTRecordList::textTo(),
-                                            str_recipient_id.c_str());
-
-                                    str_name = strNameTemp.Get();
-                                }
-                            }
-                        } else  // str_account_id IS NOT str_sender_acct_id.
-                                // (Therefore we want sender.)
-                        {  // In this case, some OTHER Nym is the sender, so it
-                            // must have been incoming. (And bOutgoing is
-                            // already false.)
-
-                            if (pBoxTrans->GetSenderNymIDForDisplay(
-                                    theSenderID)) {
-                                const String strSenderNymID(theSenderID);
-                                str_other_nym_id = strSenderNymID.Get();
-                            }
-                            String strName(m_pLookup->GetAcctName(
-                                str_sender_acct_id,
-                                str_other_nym_id,  // nym ID if known
-                                *pstr_notary_id,   // server ID if known.
-                                *pstr_instrument_definition_id)),  // instrument
-                                                                   // definition
-                                                                   // id if
-                                                                   // known.
-                                strNameTemp;
+    // It loaded up, so let's loop through it.
+    if (pRecordbox) {
+        std::int32_t nRecordIndex{-1};
+        for (auto& it : pRecordbox->GetTransactionMap()) {
+            ++nRecordIndex;
+            OTTransaction* pBoxTrans = it.second;
+            OT_ASSERT(nullptr != pBoxTrans);
+            otInfo << __FUNCTION__
+                   << ": Account RECORD index: " << nRecordIndex << "\n";
+            bool bOutgoing{false};
+            bool bCanceled{false};
+            std::string str_name;  // name of sender OR recipient (depending
+                                   // on whether it was originally incoming
+                                   // or outgoing.)
+            std::string str_other_nym_id;
+            std::string str_other_acct_id;
+            std::string str_memo;
 
-                            if (strName.Exists())
-                                strNameTemp.Format(
-                                    OTRecordList::textFrom(), strName.Get());
-                            else
-                                strNameTemp.Format(
-                                    OTRecordList::textFrom(),
-                                    str_sender_acct_id.c_str());
+            bool bHasSuccess{false};
+            bool bIsSuccess{false};
+
+            TransactionNumber lClosingNum{0};
+            originType theOriginType = pBoxTrans->GetOriginType();
+
+            const bool bIsFinalReceipt =
+                (OTTransaction::finalReceipt == pBoxTrans->GetType());
+            if (bIsFinalReceipt) lClosingNum = pBoxTrans->GetClosingNum();
+
+            if (!pBoxTrans->IsAbbreviated()) {
+                if (pBoxTrans->GetType() != OTTransaction::pending)
+                    pBoxTrans->GetSuccess(&bHasSuccess, &bIsSuccess);
+                // ----------------------------------------
+                auto theSenderID = Identifier::Factory(),
+                     theSenderAcctID = Identifier::Factory();
+                auto theRecipientID = Identifier::Factory(),
+                     theRecipientAcctID = Identifier::Factory();
+
+                if (pBoxTrans->GetSenderAcctIDForDisplay(theSenderAcctID)) {
+                    const String strSenderAcctID(theSenderAcctID);
+                    const std::string str_sender_acct_id(
+                        strSenderAcctID.Get());
+
+                    // Usually, Nym is the RECIPIENT. Sometimes he's the
+                    // sender.
+                    // Either way, we want the OTHER ID (the other Nym) for
+                    // display.
+                    // So here, if Nym's CLEARLY the sender, then we want
+                    // the RECIPIENT.
+                    // Whereas if Nym were the recipient, then we'd want the
+                    // SENDER. (For display.)
+                    //
+                    if (0 ==
+                        str_account_id.compare(
+                            str_sender_acct_id))  // str_account_id IS
+                                                  // str_sender_acct_id.
+                    // (Therefore we want recipient.)
+                    {
+                        bOutgoing = true;  // if Nym is the sender, then it
+                                           // must have been outgoing.
 
-                            str_name = strNameTemp.Get();
-                            str_other_acct_id = str_sender_acct_id;
-                        }
-                    }
-                    // In this block below, we already KNOW
-                    // GetSenderAcctIDForDisplay is EMPTY.
-                    // (So it's "recipient or bust.")
-                    else if (pBoxTrans->GetRecipientAcctIDForDisplay(
-                                 theRecipientAcctID)) {
-                        if (pBoxTrans->GetRecipientNymIDForDisplay(
-                                theRecipientID)) {
-                            const String strRecipientID(theRecipientID);
-                            const std::string str_recipient_nym_id(
-                                strRecipientID.Get());
+                        const bool bGotRecipientNymIDForDisplay =
+                            pBoxTrans->GetRecipientNymIDForDisplay(
+                                theRecipientID);
 
-                            str_other_nym_id = str_recipient_nym_id;
-                        }
-                        const String strRecipientAcctID(theRecipientAcctID);
-                        const std::string str_recipient_acct_id(
-                            strRecipientAcctID.Get());
+                        if (pBoxTrans->GetRecipientAcctIDForDisplay(
+                                theRecipientAcctID)) {
+                            const String strRecipientAcctID(
+                                theRecipientAcctID);
+                            const std::string str_recip_acct_id(
+                                strRecipientAcctID.Get());
 
-                        if (0 != str_account_id.compare(
-                                     str_recipient_acct_id))  // str_account_id
-                                                              // is NOT
-                        // str_recipient_acct_id.
-                        {  // (Therefore we want str_recipient_acct_id.)
-                            // If Nym is not the recipient, then he must be the
-                            // sender.
-                            // (Therefore it must be outgoing.)
-                            bOutgoing = true;
-
-                            String strName(m_pLookup->GetAcctName(
-                                str_recipient_acct_id,
-                                str_other_nym_id,  // nym ID if known
-                                *pstr_notary_id,   // server ID if known.
-                                *pstr_instrument_definition_id)),  // instrument
-                                                                   // definition
-                                                                   // id if
-                                                                   // known.
-                                strNameTemp;
+                            String strRecipientNymID("");
+                            std::string str_recip_nym_id("");
 
-                            if (strName.Exists())
-                                strNameTemp.Format(
-                                    OTRecordList::textTo(), strName.Get());
-                            else
-                                strNameTemp.Format(
-                                    OTRecordList::textTo(),
-                                    str_recipient_acct_id.c_str());
+                            if (bGotRecipientNymIDForDisplay) {
+                                theRecipientID->GetString(
+                                    strRecipientNymID);
+                                str_recip_nym_id = strRecipientNymID.Get();
+                            }
+                            // NOTE: We check for cancelled here so we don't
+                            // accidentally
+                            // cause the address book to falsely believe
+                            // that str_recip_nym_id
+                            // is the owner of str_recip_acct_id. (If the
+                            // cheque/invoice is cancelled,
+                            // the recipient account will be the sender
+                            // account, which is NOT owned
+                            // by the recipient, obviously...)
+                            //
+                            if (!pBoxTrans->IsCancelled()) {
+                                String strName(m_pLookup->GetAcctName(
+                                    str_recip_acct_id,
+                                    // NOTE: we CANNOT pass
+                                    // str_recip_nym_id here with
+                                    // str_recip_acct_id
+                                    // if it's a cancelled instrument,
+                                    // since in that case, the SENDER
+                                    // ACCT
+                                    // is ALSO the RECIPIENT ACCT. So
+                                    // this logic is ONLY correct since
+                                    // we
+                                    // are inside the block of if
+                                    // (!pBoxTrans->IsCancelled())
+                                    // (Otherwise we'd be training the
+                                    // address book to falsely believe
+                                    // that
+                                    // the recipient Nym is the owner of
+                                    // the sender acct.)
+                                    bGotRecipientNymIDForDisplay
+                                        ? str_recip_nym_id
+                                        : "",         // nym ID if known
+                                    *pstr_notary_id,  // server ID if
+                                                      // known.
+                                    *pstr_instrument_definition_id)),  // asset
+                                                                       // ID
+                                                                       // if
+                                    // known.
+                                    strNameTemp;
 
-                            str_name = strNameTemp.Get();
-                            str_other_acct_id = str_recipient_acct_id;
-                        }
-                    } else if (pBoxTrans->GetSenderNymIDForDisplay(
-                                   theSenderID)) {
-                        const String strSenderID(theSenderID);
-                        const std::string str_sender_id(strSenderID.Get());
+                                if (strName.Exists())
+                                    strNameTemp.Format(
+                                        OTRecordList::textTo(),
+                                        strName.Get());
+                                else
+                                    strNameTemp.Format(
+                                        OTRecordList::textTo(),
+                                        str_recip_acct_id.c_str());
 
-                        // Usually, Nym is the RECIPIENT. Sometimes he's the
-                        // sender.
-                        // Either way, we want the OTHER ID (the other Nym) for
-                        // display.
-                        // So here, if Nym's CLEARLY the sender, then we want
-                        // the RECIPIENT.
-                        // Whereas if Nym were the recipient, then we'd want the
-                        // SENDER. (For display.)
-                        //
-                        if (0 == str_nym_id.compare(
-                                     str_sender_id))  // str_nym_id IS
-                                                      // str_sender_id.
-                        // (Therefore we want recipient.)
-                        {
-                            bOutgoing = true;  // if Nym is the sender, then it
-                                               // must have been outgoing.
+                                str_name =
+                                    strNameTemp.Get();  // We don't want to
+                                                        // see our own name
+                                                        // on cancelled
+                                                        // cheques.
+                            }
+                            str_other_acct_id = str_recip_acct_id;
+                        }
+                        if (bGotRecipientNymIDForDisplay) {
+                            const String strRecipientID(theRecipientID);
+                            const std::string str_recipient_id(
+                                strRecipientID.Get());
 
-                            if (pBoxTrans->GetRecipientNymIDForDisplay(
-                                    theRecipientID)) {
-                                const String strRecipientID(theRecipientID);
-                                const std::string str_recipient_id(
-                                    strRecipientID.Get());
+                            str_other_nym_id = str_recipient_id;
 
+                            if (str_name.empty()) {
                                 String strName(m_pLookup->GetNymName(
                                     str_recipient_id, *it_server)),
                                     strNameTemp;
 
                                 if (strName.Exists())
                                     strNameTemp.Format(
-                                        OTRecordList::textTo(), strName.Get());
+                                        OTRecordList::textTo(),
+                                        strName.Get());
                                 else
                                     strNameTemp.Format(
                                         OTRecordList::textTo(),
                                         str_recipient_id.c_str());
 
                                 str_name = strNameTemp.Get();
-                                str_other_nym_id = str_recipient_id;
-                                if (pBoxTrans->GetRecipientAcctIDForDisplay(
-                                        theRecipientAcctID)) {
-                                    const String strRecipientAcctID(
-                                        theRecipientAcctID);
-                                    str_other_acct_id =
-                                        strRecipientAcctID.Get();
-                                }
                             }
-                        } else  // str_nym_id IS NOT str_sender_id. (Therefore
-                                // we want sender.)
-                        {  // In this case, some OTHER Nym is the sender, so it
-                            // must have been incoming. (And bOutgoing is
-                            // already false.)
-
-                            String strName(m_pLookup->GetNymName(
-                                str_sender_id, *it_server)),
-                                strNameTemp;
+                        }
+                    } else  // str_account_id IS NOT str_sender_acct_id.
+                            // (Therefore we want sender.)
+                    {  // In this case, some OTHER Nym is the sender, so it
+                        // must have been incoming. (And bOutgoing is
+                        // already false.)
+
+                        if (pBoxTrans->GetSenderNymIDForDisplay(
+                                theSenderID)) {
+                            const String strSenderNymID(theSenderID);
+                            str_other_nym_id = strSenderNymID.Get();
+                        }
+                        String strName(m_pLookup->GetAcctName(
+                            str_sender_acct_id,
+                            str_other_nym_id,  // nym ID if known
+                            *pstr_notary_id,   // server ID if known.
+                            *pstr_instrument_definition_id)),  // instrument
+                                                               // definition
+                                                               // id if
+                                                               // known.
+                            strNameTemp;
 
-                            if (strName.Exists())
-                                strNameTemp.Format(
-                                    OTRecordList::textFrom(), strName.Get());
-                            else
-                                strNameTemp.Format(
-                                    OTRecordList::textFrom(),
-                                    str_sender_id.c_str());
+                        if (strName.Exists())
+                            strNameTemp.Format(
+                                OTRecordList::textFrom(), strName.Get());
+                        else
+                            strNameTemp.Format(
+                                OTRecordList::textFrom(),
+                                str_sender_acct_id.c_str());
 
-                            str_name = strNameTemp.Get();
-                            str_other_nym_id = str_sender_id;
-                            if (pBoxTrans->GetSenderAcctIDForDisplay(
-                                    theSenderAcctID)) {
-                                const String strSenderAcctID(theSenderAcctID);
-                                str_other_acct_id = strSenderAcctID.Get();
-                            }
-                        }
+                        str_name = strNameTemp.Get();
+                        str_other_acct_id = str_sender_acct_id;
                     }
-                    // In this block below, we already KNOW
-                    // GetSenderNymIDForDisplay is EMPTY.
-                    // (So it's "recipient or bust.")
-                    else if (pBoxTrans->GetRecipientNymIDForDisplay(
-                                 theRecipientID)) {
+                }
+                // In this block below, we already KNOW
+                // GetSenderAcctIDForDisplay is EMPTY.
+                // (So it's "recipient or bust.")
+                else if (pBoxTrans->GetRecipientAcctIDForDisplay(
+                             theRecipientAcctID)) {
+                    if (pBoxTrans->GetRecipientNymIDForDisplay(
+                            theRecipientID)) {
                         const String strRecipientID(theRecipientID);
-                        const std::string str_recipient_id(
+                        const std::string str_recipient_nym_id(
                             strRecipientID.Get());
 
-                        if (0 !=
-                            str_nym_id.compare(str_recipient_id))  // str_nym_id
-                                                                   // is NOT
-                        // str_recipient_id.
-                        {  // (Therefore we want str_recipient_id.)
-                            // If Nym is not the recipient, then he must be the
-                            // sender.
-                            // (Therefore it must be outgoing.)
-                            bOutgoing = true;
+                        str_other_nym_id = str_recipient_nym_id;
+                    }
+                    const String strRecipientAcctID(theRecipientAcctID);
+                    const std::string str_recipient_acct_id(
+                        strRecipientAcctID.Get());
+
+                    if (0 != str_account_id.compare(
+                                 str_recipient_acct_id))  // str_account_id
+                                                          // is NOT
+                    // str_recipient_acct_id.
+                    {  // (Therefore we want str_recipient_acct_id.)
+                        // If Nym is not the recipient, then he must be the
+                        // sender.
+                        // (Therefore it must be outgoing.)
+                        bOutgoing = true;
+
+                        String strName(m_pLookup->GetAcctName(
+                            str_recipient_acct_id,
+                            str_other_nym_id,  // nym ID if known
+                            *pstr_notary_id,   // server ID if known.
+                            *pstr_instrument_definition_id)),  // instrument
+                                                               // definition
+                                                               // id if
+                                                               // known.
+                            strNameTemp;
+
+                        if (strName.Exists())
+                            strNameTemp.Format(
+                                OTRecordList::textTo(), strName.Get());
+                        else
+                            strNameTemp.Format(
+                                OTRecordList::textTo(),
+                                str_recipient_acct_id.c_str());
+
+                        str_name = strNameTemp.Get();
+                        str_other_acct_id = str_recipient_acct_id;
+                    }
+                } else if (pBoxTrans->GetSenderNymIDForDisplay(
+                               theSenderID)) {
+                    const String strSenderID(theSenderID);
+                    const std::string str_sender_id(strSenderID.Get());
+
+                    // Usually, Nym is the RECIPIENT. Sometimes he's the
+                    // sender.
+                    // Either way, we want the OTHER ID (the other Nym) for
+                    // display.
+                    // So here, if Nym's CLEARLY the sender, then we want
+                    // the RECIPIENT.
+                    // Whereas if Nym were the recipient, then we'd want the
+                    // SENDER. (For display.)
+                    //
+                    if (0 == str_nym_id.compare(
+                                 str_sender_id))  // str_nym_id IS
+                                                  // str_sender_id.
+                    // (Therefore we want recipient.)
+                    {
+                        bOutgoing = true;  // if Nym is the sender, then it
+                                           // must have been outgoing.
+
+                        if (pBoxTrans->GetRecipientNymIDForDisplay(
+                                theRecipientID)) {
+                            const String strRecipientID(theRecipientID);
+                            const std::string str_recipient_id(
+                                strRecipientID.Get());
 
                             String strName(m_pLookup->GetNymName(
                                 str_recipient_id, *it_server)),
@@ -5772,155 +5820,346 @@ bool OTRecordList::Populate()
                                     theRecipientAcctID)) {
                                 const String strRecipientAcctID(
                                     theRecipientAcctID);
-                                str_other_acct_id = strRecipientAcctID.Get();
+                                str_other_acct_id =
+                                    strRecipientAcctID.Get();
                             }
                         }
-                    }
-                    // Get the Memo field for a transferReceipt and also for
-                    // other receipts.
-                    //
-                    String strMemo;
+                    } else  // str_nym_id IS NOT str_sender_id. (Therefore
+                            // we want sender.)
+                    {  // In this case, some OTHER Nym is the sender, so it
+                        // must have been incoming. (And bOutgoing is
+                        // already false.)
 
-                    if (pBoxTrans->GetMemo(strMemo)) str_memo = strMemo.Get();
+                        String strName(m_pLookup->GetNymName(
+                            str_sender_id, *it_server)),
+                            strNameTemp;
 
-                }  // if not abbreviated.
-                bCanceled = pBoxTrans->IsCancelled();
-                time64_t tValidFrom = OT_TIME_ZERO, tValidTo = OT_TIME_ZERO;
-                std::string str_date =
-                    "0";  // the "date signed" on the transaction receipt.
-                time64_t tDateSigned = pBoxTrans->GetDateSigned();
+                        if (strName.Exists())
+                            strNameTemp.Format(
+                                OTRecordList::textFrom(), strName.Get());
+                        else
+                            strNameTemp.Format(
+                                OTRecordList::textFrom(),
+                                str_sender_id.c_str());
 
-                if (tDateSigned > OT_TIME_ZERO) {
-                    tValidFrom = tDateSigned;
-                    const std::uint64_t lDateSigned =
-                        OTTimeGetSecondsFromTime(tDateSigned);
-                    String strDateSigned;
-                    strDateSigned.Format("%" PRIu64 "", lDateSigned);
-                    str_date = strDateSigned.Get();
+                        str_name = strNameTemp.Get();
+                        str_other_nym_id = str_sender_id;
+                        if (pBoxTrans->GetSenderAcctIDForDisplay(
+                                theSenderAcctID)) {
+                            const String strSenderAcctID(theSenderAcctID);
+                            str_other_acct_id = strSenderAcctID.Get();
+                        }
+                    }
                 }
-                std::string str_amount;  // <========== AMOUNT
-                Amount lAmount = pBoxTrans->GetAbbrevDisplayAmount();
+                // In this block below, we already KNOW
+                // GetSenderNymIDForDisplay is EMPTY.
+                // (So it's "recipient or bust.")
+                else if (pBoxTrans->GetRecipientNymIDForDisplay(
+                             theRecipientID)) {
+                    const String strRecipientID(theRecipientID);
+                    const std::string str_recipient_id(
+                        strRecipientID.Get());
+
+                    if (0 !=
+                        str_nym_id.compare(str_recipient_id))  // str_nym_id
+                                                               // is NOT
+                    // str_recipient_id.
+                    {  // (Therefore we want str_recipient_id.)
+                        // If Nym is not the recipient, then he must be the
+                        // sender.
+                        // (Therefore it must be outgoing.)
+                        bOutgoing = true;
 
-                if (0 == lAmount) lAmount = pBoxTrans->GetReceiptAmount();
-                const std::string str_type(
-                    pBoxTrans->GetTypeString());  // pending, chequeReceipt,
-                                                  // etc.
-                if (0 == str_type.compare("transferReceipt"))
-                    bOutgoing = true;  // only the sender of a transfer will
-                                       // have a transferReceipt. (The recipient
-                                       // will have the recipient will have his
-                                       // process inbox receipt from when he
-                                       // accepts the incoming transfer).
-                else if (0 == str_type.compare("pending"))
-                    bOutgoing = false;  // only the recipient of a transfer will
-                                        // have a pending in his recordbox.
-                if (0 != lAmount) {
-                    //              if (lAmount < 0)
-                    //                  bOutgoing = true;
-                    //              else
-                    //                  bOutgoing = false;
-
-                    // A transfer receipt ALWAYS represents an outgoing
-                    // transfer.
-                    // If the amount is over 0, we want to display it as a
-                    // negative since it represents money LEAVING my account.
-                    // if ((0 == str_type.compare("transferReceipt")) &&
-                    //     (lAmount > 0))
-                    //     lAmount *= (-1);
-
-                    String strTemp;
-                    strTemp.Format("%" PRId64 "", lAmount);
-                    str_amount = strTemp.Get();
+                        String strName(m_pLookup->GetNymName(
+                            str_recipient_id, *it_server)),
+                            strNameTemp;
+
+                        if (strName.Exists())
+                            strNameTemp.Format(
+                                OTRecordList::textTo(), strName.Get());
+                        else
+                            strNameTemp.Format(
+                                OTRecordList::textTo(),
+                                str_recipient_id.c_str());
+
+                        str_name = strNameTemp.Get();
+                        str_other_nym_id = str_recipient_id;
+                        if (pBoxTrans->GetRecipientAcctIDForDisplay(
+                                theRecipientAcctID)) {
+                            const String strRecipientAcctID(
+                                theRecipientAcctID);
+                            str_other_acct_id = strRecipientAcctID.Get();
+                        }
+                    }
                 }
-                otInfo << __FUNCTION__ << ": ADDED: "
-                       << ((pBoxTrans->GetType() != OTTransaction::pending)
-                               ? ""
-                               : (bOutgoing ? "sent" : "received"))
-                       << " (asset account) record (str_type: "
-                       << str_type.c_str() << ")\n";
-                // This line means: If it's a receipt, use a blank string.
-                // Otherwise if it's a transfer, then show sent/received. (This
-                // is the record box, so if it's a transfer, it's a completed
-                // one.)
+                // Get the Memo field for a transferReceipt and also for
+                // other receipts.
                 //
-                // FYI, for Receipts we don't say "sent transferReceipt",
-                // we just say "transferReceipt."
+                String strMemo;
 
-                shared_ptr_OTRecord sp_Record(new OTRecord(
-                    *this,
-                    *pstr_notary_id,
-                    *pstr_notary_id,
-                    *pstr_instrument_definition_id,
-                    *pstr_asset_name,
-                    *pstr_nym_id,    // This is the Nym WHOSE BOX IT IS.
-                    str_account_id,  // This is the Nym's account for this
-                                     // box.
-                    // Everything above this line, it stores a reference to
-                    // an
-                    // external string.
-                    // Everything below this line, it makes its own internal
-                    // copy of the string.
-                    str_name,  // name of sender or recipient (whichever is
-                               // NOT
-                               // the current Nym.)
-                    str_date,  // the "valid from" date on the instrument.
-                    str_amount,
-                    str_type,   // pending, chequeReceipt, etc.
-                    false,      // bPending=false. If it's in the record box,
-                                // then
-                                // it's finished (not pending.)
-                    bOutgoing,  // Record box stores both old incoming, AND
-                                // old
-                                // outgoing, receipts.
-                    true,       // IsRecord
-                    pBoxTrans->GetType() !=
-                        OTTransaction::pending,  // IsReceipt
-                    pBoxTrans->GetType() == OTTransaction::pending
-                        ? OTRecord::Transfer
-                        : OTRecord::Receipt));
-                const String strContents(*pBoxTrans);
-                sp_Record->SetContents(strContents.Get());
-                if (bCanceled) sp_Record->SetCanceled();
-                sp_Record->SetDateRange(tValidFrom, tValidTo);
-                sp_Record->SetBoxIndex(nRecordIndex);
-                if (!str_memo.empty()) sp_Record->SetMemo(str_memo);
-                if (!str_other_nym_id.empty())
-                    sp_Record->SetOtherNymID(str_other_nym_id);
-                if (!str_other_acct_id.empty())
-                    sp_Record->SetOtherAccountID(str_other_acct_id);
-                sp_Record->SetTransNumForDisplay(
-                    pBoxTrans->GetReferenceNumForDisplay());
-                sp_Record->SetTransactionNum(pBoxTrans->GetTransactionNum());
+                if (pBoxTrans->GetMemo(strMemo)) str_memo = strMemo.Get();
+
+            }  // if not abbreviated.
+            bCanceled = pBoxTrans->IsCancelled();
+            time64_t tValidFrom = OT_TIME_ZERO, tValidTo = OT_TIME_ZERO;
+            std::string str_date =
+                "0";  // the "date signed" on the transaction receipt.
+            time64_t tDateSigned = pBoxTrans->GetDateSigned();
+
+            if (tDateSigned > OT_TIME_ZERO) {
+                tValidFrom = tDateSigned;
+                const std::uint64_t lDateSigned =
+                    OTTimeGetSecondsFromTime(tDateSigned);
+                String strDateSigned;
+                strDateSigned.Format("%" PRIu64 "", lDateSigned);
+                str_date = strDateSigned.Get();
+            }
+            std::string str_amount;  // <========== AMOUNT
+            Amount lAmount = pBoxTrans->GetAbbrevDisplayAmount();
+
+            if (0 == lAmount) lAmount = pBoxTrans->GetReceiptAmount();
+            const std::string str_type(
+                pBoxTrans->GetTypeString());  // pending, chequeReceipt,
+                                              // etc.
+            if (0 == str_type.compare("transferReceipt"))
+                bOutgoing = true;  // only the sender of a transfer will
+                                   // have a transferReceipt. (The recipient
+                                   // will have the recipient will have his
+                                   // process inbox receipt from when he
+                                   // accepts the incoming transfer).
+            else if (0 == str_type.compare("pending"))
+                bOutgoing = false;  // only the recipient of a transfer will
+                                    // have a pending in his recordbox.
+            if (0 != lAmount) {
+                //              if (lAmount < 0)
+                //                  bOutgoing = true;
+                //              else
+                //                  bOutgoing = false;
+
+                // A transfer receipt ALWAYS represents an outgoing
+                // transfer.
+                // If the amount is over 0, we want to display it as a
+                // negative since it represents money LEAVING my account.
+                // if ((0 == str_type.compare("transferReceipt")) &&
+                //     (lAmount > 0))
+                //     lAmount *= (-1);
 
-                if (bHasSuccess) sp_Record->SetSuccess(bIsSuccess);
+                String strTemp;
+                strTemp.Format("%" PRId64 "", lAmount);
+                str_amount = strTemp.Get();
+            }
+            otInfo << __FUNCTION__ << ": ADDED: "
+                   << ((pBoxTrans->GetType() != OTTransaction::pending)
+                           ? ""
+                           : (bOutgoing ? "sent" : "received"))
+                   << " (asset account) record (str_type: "
+                   << str_type.c_str() << ")\n";
+            // This line means: If it's a receipt, use a blank string.
+            // Otherwise if it's a transfer, then show sent/received. (This
+            // is the record box, so if it's a transfer, it's a completed
+            // one.)
+            //
+            // FYI, for Receipts we don't say "sent transferReceipt",
+            // we just say "transferReceipt."
+
+            shared_ptr_OTRecord sp_Record(new OTRecord(
+                *this,
+                *pstr_notary_id,
+                *pstr_notary_id,
+                *pstr_instrument_definition_id,
+                *pstr_asset_name,
+                *pstr_nym_id,    // This is the Nym WHOSE BOX IT IS.
+                str_account_id,  // This is the Nym's account for this
+                                 // box.
+                // Everything above this line, it stores a reference to
+                // an
+                // external string.
+                // Everything below this line, it makes its own internal
+                // copy of the string.
+                str_name,  // name of sender or recipient (whichever is
+                           // NOT
+                           // the current Nym.)
+                str_date,  // the "valid from" date on the instrument.
+                str_amount,
+                str_type,   // pending, chequeReceipt, etc.
+                false,      // bPending=false. If it's in the record box,
+                            // then
+                            // it's finished (not pending.)
+                bOutgoing,  // Record box stores both old incoming, AND
+                            // old
+                            // outgoing, receipts.
+                true,       // IsRecord
+                pBoxTrans->GetType() !=
+                    OTTransaction::pending,  // IsReceipt
+                pBoxTrans->GetType() == OTTransaction::pending
+                    ? OTRecord::Transfer
+                    : OTRecord::Receipt));
+            const String strContents(*pBoxTrans);
+            sp_Record->SetContents(strContents.Get());
+            if (bCanceled) sp_Record->SetCanceled();
+            sp_Record->SetDateRange(tValidFrom, tValidTo);
+            sp_Record->SetBoxIndex(nRecordIndex);
+            if (!str_memo.empty()) sp_Record->SetMemo(str_memo);
+            if (!str_other_nym_id.empty())
+                sp_Record->SetOtherNymID(str_other_nym_id);
+            if (!str_other_acct_id.empty())
+                sp_Record->SetOtherAccountID(str_other_acct_id);
+            sp_Record->SetTransNumForDisplay(
+                pBoxTrans->GetReferenceNumForDisplay());
+            sp_Record->SetTransactionNum(pBoxTrans->GetTransactionNum());
+
+            if (bHasSuccess) sp_Record->SetSuccess(bIsSuccess);
+
+            if (bIsFinalReceipt) {
+                sp_Record->SetFinalReceipt();
+                sp_Record->SetClosingNum(lClosingNum);
+            }
+            sp_Record->SetOriginType(theOriginType);
+
+            //              otErr << "DEBUGGING! Added " << (bOutgoing ?
+            //              "sent": "received") << " asset account record:
+            //              " <<
+            //              pBoxTrans->GetTypeString() <<
+            //              "\n pBoxTrans->GetTransactionNum(): " <<
+            //              pBoxTrans->GetTransactionNum() <<
+            //              "\n pBoxTrans->GetReferenceNumForDisplay()" <<
+            //              pBoxTrans->GetReferenceNumForDisplay() <<
+            //              "\n";
+
+            output.push_back(sp_Record);
+        }
+    }
+}
 
-                if (bIsFinalReceipt) {
-                    sp_Record->SetFinalReceipt();
-                    sp_Record->SetClosingNum(lClosingNum);
-                }
-                sp_Record->SetOriginType(theOriginType);
+void OTRecordList::populate(const OTRecordCallback& callback)
+{
+    // Before populating, process out any items we're supposed to accept
+    // automatically.
+    //
+    PerformAutoAccept();
+    // Loop through the Nyms.
+    //
+    std::int32_t nNymIndex = -1;
+    for (auto& it_nym : m_nyms) {
+        ++nNymIndex;
+        if (0 == nNymIndex)
+            otInfo << "=============== " << __FUNCTION__
+                   << ": Beginning loop through Nyms...\n";
+        const auto hash = hash_nym(it_nym);
+        auto& cached = box_cache_[std::string("nym:") + it_nym];
 
-                //              otErr << "DEBUGGING! Added " << (bOutgoing ?
-                //              "sent": "received") << " asset account record:
-                //              " <<
-                //              pBoxTrans->GetTypeString() <<
-                //              "\n pBoxTrans->GetTransactionNum(): " <<
-                //              pBoxTrans->GetTransactionNum() <<
-                //              "\n pBoxTrans->GetReferenceNumForDisplay()" <<
-                //              pBoxTrans->GetReferenceNumForDisplay() <<
-                //              "\n";
-
-                m_contents.push_back(sp_Record);
-            }
+        if (cached.hash_ != hash) {
+            cached.records_.clear();
+            populate_nym(it_nym, nNymIndex, cached.records_);
+            cached.hash_ = hash;
+        }
+
+        emit(cached.records_, callback);
+    }  // Loop through Nyms.
+    // ASSET ACCOUNT -- INBOX/OUTBOX + RECORD BOX
+    // Loop through the Accounts.
+    //
+    // Only the accounts whose box hashes changed since the last refresh are
+    // loaded and rebuilt. The rest are emitted from the cache.
+    //
+    // Loading and verifying the boxes of the changed accounts is where nearly
+    // all the time goes, so they are loaded concurrently on the api's thread
+    // pool. Each OT_API box load holds the lock for its nym and notary, so
+    // boxes sharing a context still load one at a time. The records are then
+    // built in order on this thread, so that the address book callbacks only
+    // ever run here.
+    //
+    otInfo << "================ " << __FUNCTION__
+           << ": Looping through the accounts in the wallet...\n";
+    std::vector<AccountBoxes> accounts(m_accounts.size());
+    std::vector<std::function<bool()>> loads{};
+    std::size_t index{0};
+
+    for (auto& it_acct : m_accounts) {
+        auto& account = accounts[index++];
+        account.account_id_ = it_acct;
+        hash_account(account);
+        const auto& cached = box_cache_[std::string("account:") + it_acct];
+
+        if (cached.hash_ != account.hash_) {
+            loads.emplace_back([this, &account]() -> bool {
+                load_account(account);
+
+                return true;
+            });
+        }
+    }
+
+    if (1 < loads.size()) {
+        OT::App().Crypto().VerifyBatch(loads);
+    } else {
+        for (auto& load : loads) { load(); }
+    }
+
+    index = 0;
+
+    for (auto& it_acct : m_accounts) {
+        auto& account = accounts[index];
+        auto& cached = box_cache_[std::string("account:") + it_acct];
+
+        if (cached.hash_ != account.hash_) {
+            cached.records_.clear();
+            populate_account(
+                it_acct,
+                static_cast<std::int32_t>(index),
+                account,
+                cached.records_);
+            cached.hash_ = account.hash_;
         }
 
+        emit(cached.records_, callback);
+        ++index;
     }  // loop through the accounts.
+}
+
+// Populates m_contents from OT API. Calls ClearContents().
+
+bool OTRecordList::Populate()
+{
+    OT_ASSERT(nullptr != m_pLookup);
+    ClearContents();
+    box_cache_.clear();
+    populate([this](const shared_ptr_OTRecord& record) {
+        m_contents.push_back(record);
+    });
     // SORT the vector.
     //
     SortRecords();
     return true;
 }
 
+// Like Populate, but only re-reads the boxes which changed since the last
+// call.
+
+bool OTRecordList::Refresh()
+{
+    OT_ASSERT(nullptr != m_pLookup);
+    ClearContents();
+    populate([this](const shared_ptr_OTRecord& record) {
+        m_contents.push_back(record);
+    });
+    SortRecords();
+    return true;
+}
+
+bool OTRecordList::Refresh(const OTRecordCallback& callback)
+{
+    OT_ASSERT(nullptr != m_pLookup);
+    populate(callback);
+    return true;
+}
+
+void OTRecordList::Invalidate(const std::string& id)
+{
+    box_cache_.erase(std::string("nym:") + id);
+    box_cache_.erase(std::string("account:") + id);
+}
+
 const list_of_strings& OTRecordList::GetNyms() const { return m_nyms; }
 
 // Populate already sorts. But if you have to add some external records
@@ -12396,7 +12396,7 @@ NetworkReplyMessage OT_API::send_message(
         lock_callback_({context.Nym()->ID().str(), context.Server().str()}));
 
     m_pClient->QueueOutgoingMessage(message);
-    auto result = context.Connection().Send(message);
+    auto result = context.Connection().Send(message, *context.Nym());
 
     if (SendResult::VALID_REPLY == result.first) {
         m_pClient->processServerReply(pending, context, result.second);
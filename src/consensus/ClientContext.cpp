@@ -41,6 +41,7 @@
 #include "opentxs/consensus/ClientContext.hpp"
 
 #include "opentxs/consensus/TransactionStatement.hpp"
+#include "opentxs/core/util/IntervalSet.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
 
@@ -190,60 +191,68 @@ bool ClientContext::Verify(
 {
     Lock lock(lock_);
 
-    std::set<TransactionNumber> effective = issued_transaction_numbers_;
+    IntervalSet<TransactionNumber> effective(issued_transaction_numbers_);
+    const IntervalSet<TransactionNumber> adding(included);
+    const IntervalSet<TransactionNumber> burning(excluded);
 
-    for (const auto& number : included) {
-        const bool inserted = effective.insert(number).second;
-
-        if (!inserted) {
-            otOut << OT_METHOD << __FUNCTION__ << ": New transaction # "
-                  << number << " already exists in context." << std::endl;
+    if (false == effective.Add(adding)) {
+        for (const auto& number : included) {
+            if (issued_transaction_numbers_.count(number)) {
+                otOut << OT_METHOD << __FUNCTION__ << ": New transaction # "
+                      << number << " already exists in context." << std::endl;
 
-            return false;
+                break;
+            }
         }
 
+        return false;
+    }
+
+    for (const auto& number : included) {
         otWarn << OT_METHOD << __FUNCTION__ << ": Transaction statement MUST "
                << "include number " << number << " which IS NOT currently in "
                << "the context. " << std::endl;
     }
 
-    for (const auto& number : excluded) {
-        const bool removed = (1 == effective.erase(number));
-
-        if (!removed) {
-            otOut << OT_METHOD << __FUNCTION__ << ": Burned transaction # "
-                  << number << " does not exist in context." << std::endl;
+    if (false == effective.Remove(burning)) {
+        for (const auto& number : excluded) {
+            if (false == effective.Contains(number)) {
+                otOut << OT_METHOD << __FUNCTION__ << ": Burned transaction # "
+                      << number << " does not exist in context." << std::endl;
 
-            return false;
+                break;
+            }
         }
 
+        return false;
+    }
+
+    for (const auto& number : excluded) {
         otWarn << OT_METHOD << __FUNCTION__ << ": Transaction statement MUST "
                << "NOT include number " << number << " which IS currently in "
                << "the context. " << std::endl;
     }
 
-    for (const auto& number : statement.Issued()) {
-        const bool found = (1 == effective.count(number));
+    if (effective == statement.Issued()) { return true; }
 
-        if (!found) {
-            otOut << OT_METHOD << __FUNCTION__ << ": Issued transaction # "
-                  << number << " from statement not found on context."
-                  << std::endl;
+    const auto extra = statement.Issued().Difference(effective);
 
-            return false;
-        }
+    if (false == extra.Empty()) {
+        otOut << OT_METHOD << __FUNCTION__ << ": Issued transaction # "
+              << extra.Runs().front().first
+              << " from statement not found on context." << std::endl;
+
+        return false;
     }
 
-    for (const auto& number : effective) {
-        const bool found = (1 == statement.Issued().count(number));
+    const auto missing = effective.Difference(statement.Issued());
 
-        if (!found) {
-            otOut << OT_METHOD << __FUNCTION__ << ": Issued transaction # "
-                  << number << " from context not found on statement."
-                  << std::endl;
+    if (false == missing.Empty()) {
+        otOut << OT_METHOD << __FUNCTION__ << ": Issued transaction # "
+              << missing.Runs().front().first
+              << " from context not found on statement." << std::endl;
 
-            return false;
-        }
+        return false;
     }
 
     return true;
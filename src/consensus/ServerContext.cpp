@@ -44,6 +44,7 @@
 #include "opentxs/api/Native.hpp"
 #include "opentxs/consensus/TransactionStatement.hpp"
 #include "opentxs/core/crypto/OTASCIIArmor.hpp"
+#include "opentxs/core/util/IntervalSet.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Item.hpp"
 #include "opentxs/core/Log.hpp"
@@ -113,6 +114,7 @@ ServerContext::ServerContext(
     , admin_password_("")
     , admin_attempted_(Flag::Factory(false))
     , admin_success_(Flag::Factory(false))
+    , range_statements_(Flag::Factory(false))
     , revision_(0)
     , highest_transaction_number_(0)
     , tentative_transaction_numbers_()
@@ -137,6 +139,7 @@ ServerContext::ServerContext(
     , admin_attempted_(
           Flag::Factory(serialized.servercontext().adminattempted()))
     , admin_success_(Flag::Factory(serialized.servercontext().adminsuccess()))
+    , range_statements_(Flag::Factory(false))
     , revision_(serialized.servercontext().revision())
     , highest_transaction_number_(
           serialized.servercontext().highesttransactionnumber())
@@ -162,22 +165,23 @@ bool ServerContext::AcceptIssuedNumbers(const TransactionStatement& statement)
 {
     Lock lock(lock_);
     std::size_t added = 0;
-    const auto offered = statement.Issued().size();
+    const auto offered = statement.Issued().Count();
 
     if (0 == offered) { return false; }
 
     std::set<TransactionNumber> adding, accepted, rejected;
 
-    for (const auto& number : statement.Issued()) {
+    // Only tentative numbers can be accepted, so walk the tentative list
+    // rather than expanding every run on the statement.
+    for (const auto& number : tentative_transaction_numbers_) {
         // If number wasn't already on issued list, then add to BOTH
         // lists. Otherwise do nothing (it's already on the issued list,
         // and no longer valid on the available list--thus shouldn't be
         // re-added thereanyway.)
-        const bool tentative =
-            (1 == tentative_transaction_numbers_.count(number));
+        const bool offer = statement.Issued().Contains(number);
         const bool issued = (1 == issued_transaction_numbers_.count(number));
 
-        if (tentative && !issued) { adding.insert(number); }
+        if (offer && !issued) { adding.insert(number); }
     }
 
     // Looks like we found some numbers to accept (tentative numbers we had
@@ -273,7 +277,11 @@ std::unique_ptr<TransactionStatement> ServerContext::generate_statement(
     }
 
     std::unique_ptr<TransactionStatement> output(
-        new TransactionStatement(String(server_id_).Get(), issued, available));
+        new TransactionStatement(
+            String(server_id_).Get(),
+            issued,
+            available,
+            range_statements_.get()));
 
     return output;
 }
@@ -461,7 +469,7 @@ NetworkReplyMessage ServerContext::PingNotary()
         return {};
     }
 
-    return connection_.Send(*request);
+    return connection_.Send(*request, *nym_);
 }
 
 bool ServerContext::remove_acknowledged_number(
@@ -567,6 +575,8 @@ bool ServerContext::SetHighest(const TransactionNumber& highest)
     return false;
 }
 
+void ServerContext::SetRangeStatements() { range_statements_->On(); }
+
 void ServerContext::SetRevision(const std::uint64_t revision)
 {
     Lock lock(lock_);
@@ -811,7 +821,7 @@ RequestNumber ServerContext::UpdateRequestNumber(bool& sendStatus)
         return {};
     }
 
-    const auto response = connection_.Send(*request);
+    const auto response = connection_.Send(*request, *nym_);
     const auto& status = response.first;
     const auto& reply = response.second;
 
@@ -869,16 +879,15 @@ bool ServerContext::Verify(const TransactionStatement& statement) const
 {
     Lock lock(lock_);
 
-    for (const auto& number : issued_transaction_numbers_) {
-        const bool missing = (1 != statement.Issued().count(number));
+    const IntervalSet<TransactionNumber> issued(issued_transaction_numbers_);
+    const auto missing = issued.Difference(statement.Issued());
 
-        if (missing) {
-            otOut << OT_METHOD << __FUNCTION__ << ": Issued transaction # "
-                  << number << " on context not found on statement."
-                  << std::endl;
+    if (false == missing.Empty()) {
+        otOut << OT_METHOD << __FUNCTION__ << ": Issued transaction # "
+              << missing.Runs().front().first
+              << " on context not found on statement." << std::endl;
 
-            return false;
-        }
+        return false;
     }
 
     // Getting here means that, though issued numbers may have been removed from
@@ -50,13 +50,54 @@
 
 #include <irrxml/irrXML.hpp>
 
+// Version 1 statements list every number individually. Version 2 statements
+// list runs of consecutive numbers as "first-last", and are only written for
+// notaries which have advertised that they can read them.
+#define TRANSACTION_STATEMENT_LEGACY_VERSION "1.0"
+#define TRANSACTION_STATEMENT_VERSION "2.0"
+
 namespace opentxs
 {
+static bool decode_numbers(
+    const std::string& version,
+    const String& list,
+    IntervalSet<TransactionNumber>& output)
+{
+    if (list.empty()) { return true; }
+
+    if (TRANSACTION_STATEMENT_LEGACY_VERSION != version) {
+        return IntervalSet<TransactionNumber>::Decode(list.Get(), output);
+    }
+
+    std::set<TransactionNumber> numbers{};
+    NumList(list).Output(numbers);
+    output = IntervalSet<TransactionNumber>(numbers);
+
+    return true;
+}
+
+static std::string encode_numbers(
+    const std::string& version,
+    const IntervalSet<TransactionNumber>& numbers)
+{
+    if (TRANSACTION_STATEMENT_LEGACY_VERSION != version) {
+        return numbers.Encode();
+    }
+
+    String output;
+    NumList(numbers.Set()).Output(output);
+
+    return output.Get();
+}
+
 TransactionStatement::TransactionStatement(
     const std::string& notary,
     const std::set<TransactionNumber>& issued,
-    const std::set<TransactionNumber>& available)
-    : version_("1.0")
+    const std::set<TransactionNumber>& available,
+    const bool ranges)
+    : version_(
+          ranges ? TRANSACTION_STATEMENT_VERSION
+                 : TRANSACTION_STATEMENT_LEGACY_VERSION)
     , nym_id_("")
     , notary_(notary)
     , available_(available)
@@ -65,6 +106,11 @@ TransactionStatement::TransactionStatement(
 }
 
 TransactionStatement::TransactionStatement(const String& serialized)
+    : version_(TRANSACTION_STATEMENT_LEGACY_VERSION)
+    , nym_id_("")
+    , notary_("")
+    , available_()
+    , issued_()
 {
     auto raw = irr::io::createIrrXMLReader(OTStringXML(serialized));
     std::unique_ptr<irr::io::IrrXMLReader> xml(raw);
@@ -97,20 +143,16 @@ TransactionStatement::TransactionStatement(const String& serialized)
                         break;
                     }
 
-                    NumList numlist;
-
-                    if (!list.empty()) { numlist.Add(list); }
-
-                    TransactionNumber number = 0;
-
-                    while (numlist.Peek(number)) {
-                        numlist.Pop();
-
-                        otLog3 << "Transaction Number " << number
-                               << " ready-to-use for NotaryID: " << notary_
-                               << std::endl;
-                        available_.insert(number);
+                    if (false == decode_numbers(version_, list, available_)) {
+                        otErr << __FUNCTION__
+                              << ": Error: invalid transactionNums value."
+                              << std::endl;
+                        break;
                     }
+
+                    otLog3 << available_.Runs().size()
+                           << " runs of transaction numbers ready-to-use for "
+                           << "NotaryID: " << notary_ << std::endl;
                 } else if (nodeName.Compare("issuedNums")) {
                     notary_ = xml->getAttributeValue("notaryID");
                     String list;
@@ -124,20 +166,17 @@ TransactionStatement::TransactionStatement(const String& serialized)
                         break;
                     }
 
-                    NumList numlist;
-
-                    if (!list.empty()) { numlist.Add(list); }
-
-                    TransactionNumber number = 0;
-
-                    while (numlist.Peek(number)) {
-                        numlist.Pop();
-
-                        otLog3 << "Currently liable for issued trans# "
-                               << number << " at NotaryID: " << notary_
-                               << std::endl;
-                        issued_.insert(number);
+                    if (false == decode_numbers(version_, list, issued_)) {
+                        otErr << __FUNCTION__
+                              << ": Error: invalid issuedNums value."
+                              << std::endl;
+                        break;
                     }
+
+                    otLog3 << "Currently liable for "
+                           << issued_.Runs().size()
+                           << " runs of issued transaction numbers at "
+                           << "NotaryID: " << notary_ << std::endl;
                 } else {
                     otErr << "Unknown element type in " << __FUNCTION__ << ": "
                           << nodeName << std::endl;
@@ -161,19 +200,15 @@ TransactionStatement::operator String() const
     serialized.add_attribute("version", version_);
     serialized.add_attribute("nymID", nym_id_);
 
-    if (0 < issued_.size()) {
-        NumList issuedList(issued_);
-        String issued;
-        issuedList.Output(issued);
+    if (false == issued_.Empty()) {
+        const String issued(encode_numbers(version_, issued_));
         TagPtr issuedTag(new Tag("issuedNums", OTASCIIArmor(issued).Get()));
         issuedTag->add_attribute("notaryID", notary_);
         serialized.add_tag(issuedTag);
     }
 
-    if (0 < available_.size()) {
-        NumList availableList(available_);
-        String available;
-        availableList.Output(available);
+    if (false == available_.Empty()) {
+        const String available(encode_numbers(version_, available_));
         TagPtr availableTag(
             new Tag("transactionNums", OTASCIIArmor(available).Get()));
         availableTag->add_attribute("notaryID", notary_);
@@ -186,7 +221,7 @@ TransactionStatement::operator String() const
     return result.c_str();
 }
 
-const std::set<TransactionNumber>& TransactionStatement::Issued() const
+const IntervalSet<TransactionNumber>& TransactionStatement::Issued() const
 {
     return issued_;
 }
@@ -195,7 +230,7 @@ const std::string& TransactionStatement::Notary() const { return notary_; }
 
 void TransactionStatement::Remove(const TransactionNumber& number)
 {
-    available_.erase(number);
-    issued_.erase(number);
+    available_.Remove(number);
+    issued_.Remove(number);
 }
 }  // namespace opentxs
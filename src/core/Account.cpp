@@ -302,6 +302,28 @@ bool Account::GetOutboxHash(Identifier& output)
     return false;
 }
 
+bool Account::GetRecordedInboxHash(Identifier& output) const
+{
+    output.Release();
+
+    if (inboxHash_->IsEmpty()) { return false; }
+
+    output = inboxHash_;
+
+    return true;
+}
+
+bool Account::GetRecordedOutboxHash(Identifier& output) const
+{
+    output.Release();
+
+    if (outboxHash_->IsEmpty()) { return false; }
+
+    output = outboxHash_;
+
+    return true;
+}
+
 // TODO:  add an override so that OTAccount, when it loads up, it performs the
 // check to see the NotaryID, look at the Server Contract and make sure the
 // server hashes match.
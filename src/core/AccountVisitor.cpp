@@ -40,7 +40,13 @@
 
 #include "opentxs/core/AccountVisitor.hpp"
 
+#include "opentxs/core/Account.hpp"
 #include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/String.hpp"
+#include "opentxs/core/util/Assert.hpp"
+
+#define OT_METHOD "opentxs::AccountVisitor::"
 
 namespace opentxs
 {
@@ -48,4 +54,22 @@ AccountVisitor::AccountVisitor(const Identifier& notaryID)
     : notaryID_(Identifier::Factory(notaryID))
 {
 }
+
+bool AccountVisitor::TriggerBatch(const std::vector<const Account*>& accounts)
+{
+    bool output{true};
+
+    for (const auto* account : accounts) {
+        OT_ASSERT(nullptr != account);
+
+        if (false == Trigger(*account)) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Error: Trigger failed for account "
+                  << String(account->GetRealAccountID()) << std::endl;
+            output = false;
+        }
+    }
+
+    return output;
+}
 }  // namespace opentxs
@@ -41,6 +41,7 @@
 #include "opentxs/core/Contract.hpp"
 
 #include "opentxs/api/client/Wallet.hpp"
+#include "opentxs/api/crypto/Crypto.hpp"
 #include "opentxs/api/Native.hpp"
 #include "opentxs/core/crypto/CryptoAsymmetric.hpp"
 #include "opentxs/core/crypto/CryptoHash.hpp"
@@ -61,11 +62,14 @@
 #include "opentxs/Proto.hpp"
 #include "opentxs/core/String.hpp"
 
+#include "core/util/LineReader.hpp"
+
 #include <irrxml/irrXML.hpp>
 
 #include <cstdint>
 #include <cstring>
 #include <fstream>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -630,6 +634,22 @@ bool Contract::VerifySignature(const Nym& theNym, const OTPasswordData* pPWData)
     return false;
 }
 
+std::vector<bool> Contract::VerifySignatures(
+    const api::Crypto& crypto,
+    const std::vector<const Contract*>& contracts,
+    const Nym& theNym)
+{
+    std::vector<std::function<bool()>> checks{};
+
+    for (const auto* contract : contracts) {
+        checks.emplace_back([contract, &theNym]() -> bool {
+            return (nullptr != contract) && contract->VerifySignature(theNym);
+        });
+    }
+
+    return crypto.VerifyBatch(checks);
+}
+
 bool Contract::VerifyWithKey(
     const OTAsymmetricKey& theKey,
     const OTPasswordData* pPWData) const
@@ -1209,13 +1229,13 @@ bool Contract::LoadContractFromString(const String& theStr)
     return bSuccess;
 }
 
+// Walks m_strRawFile once, in place. Content and signature lines are
+// collected as views of the raw buffer and copied into their destination
+// strings only once, at the end of their respective sections.
 bool Contract::ParseRawFile()
 {
-    char buffer1[2100];  // a bit bigger than 2048, just for safety reasons.
     OTSignature* pSig = nullptr;
 
-    std::string line;
-
     bool bSignatureMode = false;           // "currently in signature mode"
     bool bContentMode = false;             // "currently in content mode"
     bool bHaveEnteredContentMode = false;  // "have yet to enter content mode"
@@ -1227,28 +1247,61 @@ bool Contract::ParseRawFile()
         return false;
     }
 
-    // This is redundant (I thought) but the problem hasn't cleared up yet.. so
-    // trying to really nail it now.
-    std::string str_Trim(m_strRawFile.Get());
-    std::string str_Trim2 = String::trim(str_Trim);
-    m_strRawFile.Set(str_Trim2.c_str());
+    // Equivalent to String::trim, but only reallocates m_strRawFile if there
+    // is actually whitespace to remove.
+    {
+        const char* whitespace = " \t\f\v\n\r";
+        const char* raw = m_strRawFile.Get();
+        std::size_t first = 0;
+        std::size_t last = m_strRawFile.GetLength();
+
+        while ((first < last) &&
+               (nullptr != std::strchr(whitespace, raw[first]))) {
+            ++first;
+        }
+
+        while ((last > first) &&
+               (nullptr != std::strchr(whitespace, raw[last - 1]))) {
+            --last;
+        }
+
+        if ((first < last) &&
+            ((0 < first) || (last < m_strRawFile.GetLength()))) {
+            const String trimmed(raw + first, last - first);
+            m_strRawFile.Set(trimmed);
+        }
+    }
 
-    bool bIsEOF = false;
-    m_strRawFile.reset();
+    LineReader reader(m_strRawFile.Get(), m_strRawFile.GetLength());
+    LineReader::View line{};
+    LineReader::View skipped{};
+    LineAccumulator content{};
+    std::unique_ptr<LineAccumulator> signature{};
+    bool bMore = true;
 
-    do {
-        // Just a fresh start at the top of the loop block... probably
-        // unnecessary.
-        memset(buffer1, 0, 2100);  // todo remove this in optimization. (might
-                                   // be removed already...)
+    // Header fields are followed by a line which is discarded
+    auto skip_line = [&]() -> bool {
+        if (false == bMore) { return false; }
 
-        // the call returns true if there's more to read, and false if there
-        // isn't.
-        bIsEOF = !(m_strRawFile.sgets(buffer1, 2048));
+        reader.Next(skipped, bMore);
 
-        line = buffer1;
-        const char* pBuf = line.c_str();
+        return bMore;
+    };
 
+    auto finish_signature = [&]() -> void {
+        OT_ASSERT(nullptr != pSig);
+        OT_ASSERT(signature);
+
+        if (false == signature->empty()) {
+            pSig->Set(
+                signature->data(),
+                static_cast<std::uint32_t>(signature->size()));
+        }
+
+        signature.reset();
+    };
+
+    while (bMore && reader.Next(line, bMore)) {
         if (line.length() < 2) {
             if (bSignatureMode) continue;
         }
@@ -1257,7 +1310,7 @@ bool Contract::ParseRawFile()
         else if (line.at(0) == '-') {
             if (bSignatureMode) {
                 // we just reached the end of a signature
-                //    otErr << "%s\n", pSig->Get());
+                finish_signature();
                 pSig = nullptr;
                 bSignatureMode = false;
                 continue;
@@ -1270,12 +1323,9 @@ bool Contract::ParseRawFile()
             // a. I have not yet even entered content mode, and just now
             // entering it for the first time.
             if (!bHaveEnteredContentMode) {
-                if ((line.length() > 3) &&
-                    (line.find("BEGIN") != std::string::npos) &&
+                if ((line.length() > 3) && line.Contains("BEGIN") &&
                     line.at(1) == '-' && line.at(2) == '-' &&
                     line.at(3) == '-') {
-                    //                    otErr << "\nProcessing contract...
-                    // \n";
                     bHaveEnteredContentMode = true;
                     bContentMode = true;
                     continue;
@@ -1287,15 +1337,8 @@ bool Contract::ParseRawFile()
 
             // b. I am now entering signature mode!
             else if (
-                line.length() > 3 &&
-                line.find("SIGNATURE") != std::string::npos &&
+                line.length() > 3 && line.Contains("SIGNATURE") &&
                 line.at(1) == '-' && line.at(2) == '-' && line.at(3) == '-') {
-                // if (bContentMode)
-                //    otLog3 << "Finished reading contract.\n\nReading a
-                // signature at the bottom of the contract...\n");
-                // else
-                //    otLog3 << "Reading another signature...\n");
-
                 bSignatureMode = true;
                 bContentMode = false;
 
@@ -1308,6 +1351,9 @@ bool Contract::ParseRawFile()
                     "Contract::ParseRawFile\n");
 
                 m_listSignatures.push_back(pSig);
+                signature.reset(new LineAccumulator);
+
+                OT_ASSERT(signature);
 
                 continue;
             }
@@ -1321,34 +1367,18 @@ bool Contract::ParseRawFile()
                     << m_strRawFile << "\n";
                 return false;
             }
-            // d. It is an escaped dash, and therefore kosher, so I merely
-            // remove the escape and add it.
-            // I've decided not to remove the dashes but to keep them as part of
-            // the signed content.
-            // It's just much easier to deal with that way. The input code will
-            // insert the extra dashes.
-            // pBuf += 2;
+            // d. It is an escaped dash, and therefore kosher. The dashes are
+            // kept as part of the signed content.
         }
 
         // Else we're on a normal line, not a dashed line.
         else {
             if (bHaveEnteredContentMode) {
                 if (bSignatureMode) {
-                    if (line.length() < 2) {
-                        otLog3 << "Skipping short line...\n";
-
-                        if (bIsEOF || !m_strRawFile.sgets(buffer1, 2048)) {
-                            otOut << "Error in signature for contract "
-                                  << m_strFilename
-                                  << ": Unexpected EOF after short line.\n";
-                            return false;
-                        }
-
-                        continue;
-                    } else if (line.compare(0, 8, "Version:") == 0) {
+                    if (line.StartsWith("Version:")) {
                         otLog3 << "Skipping version section...\n";
 
-                        if (bIsEOF || !m_strRawFile.sgets(buffer1, 2048)) {
+                        if (false == skip_line()) {
                             otOut << "Error in signature for contract "
                                   << m_strFilename
                                   << ": Unexpected EOF after \"Version:\"\n";
@@ -1356,10 +1386,10 @@ bool Contract::ParseRawFile()
                         }
 
                         continue;
-                    } else if (line.compare(0, 8, "Comment:") == 0) {
+                    } else if (line.StartsWith("Comment:")) {
                         otLog3 << "Skipping comment section...\n";
 
-                        if (bIsEOF || !m_strRawFile.sgets(buffer1, 2048)) {
+                        if (false == skip_line()) {
                             otOut << "Error in signature for contract "
                                   << m_strFilename
                                   << ": Unexpected EOF after \"Comment:\"\n";
@@ -1368,7 +1398,7 @@ bool Contract::ParseRawFile()
 
                         continue;
                     }
-                    if (line.compare(0, 5, "Meta:") == 0) {
+                    if (line.StartsWith("Meta:")) {
                         otLog3 << "Collecting signature metadata...\n";
 
                         if (line.length() != 13)  // "Meta:    knms" (It will
@@ -1397,11 +1427,11 @@ bool Contract::ParseRawFile()
                                   << m_strFilename
                                   << ": Unexpected metadata in the \"Meta:\" "
                                      "comment.\nLine: "
-                                  << line << "\n";
+                                  << line.str() << "\n";
                             return false;
                         }
 
-                        if (bIsEOF || !m_strRawFile.sgets(buffer1, 2048)) {
+                        if (false == skip_line()) {
                             otOut << "Error in signature for contract "
                                   << m_strFilename
                                   << ": Unexpected EOF after \"Meta:\"\n";
@@ -1412,18 +1442,18 @@ bool Contract::ParseRawFile()
                     }
                 }
                 if (bContentMode) {
-                    if (line.compare(0, 6, "Hash: ") == 0) {
+                    if (line.StartsWith("Hash: ")) {
                         otLog3 << "Collecting message digest algorithm from "
                                   "contract header...\n";
 
-                        std::string strTemp = line.substr(6);
-                        String strHashType = strTemp.c_str();
+                        String strHashType(
+                            std::string(line.data() + 6, line.length() - 6));
                         strHashType.ConvertToUpperCase();
 
                         m_strSigHashType =
                             CryptoHash::StringToHashType(strHashType);
 
-                        if (bIsEOF || !m_strRawFile.sgets(buffer1, 2048)) {
+                        if (false == skip_line()) {
                             otOut << "Error in contract " << m_strFilename
                                   << ": Unexpected EOF after \"Hash:\"\n";
                             return false;
@@ -1441,11 +1471,27 @@ bool Contract::ParseRawFile()
                 "Error: Null Signature pointer WHILE "
                 "processing signature, in "
                 "Contract::ParseRawFile");
+            OT_ASSERT(signature);
+
+            signature->Add(line);
+        } else if (bContentMode) {
+            content.Add(line);
+        }
+    }
+
+    // An unterminated signature keeps the lines read so far, as the
+    // line-by-line parser did, even though the contract is rejected below
+    if (signature) { finish_signature(); }
 
-            pSig->Concatenate("%s\n", pBuf);
-        } else if (bContentMode)
-            m_xmlUnsigned.Concatenate("%s\n", pBuf);
-    } while (!bIsEOF);
+    if (false == content.empty()) {
+        const auto size = static_cast<std::uint32_t>(content.size());
+
+        if (m_xmlUnsigned.Exists()) {
+            m_xmlUnsigned.Concatenate(String(content.data(), size));
+        } else {
+            m_xmlUnsigned.Set(content.data(), size);
+        }
+    }
 
     if (!bHaveEnteredContentMode) {
         otErr << "Error in Contract::ParseRawFile: Found no BEGIN for signed "
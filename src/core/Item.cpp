@@ -63,6 +63,8 @@
 #include "opentxs/OT.hpp"
 #include "opentxs/Types.hpp"
 
+#include "util/Arena.hpp"
+
 #include <irrxml/irrXML.hpp>
 
 #include <cstdint>
@@ -1215,6 +1217,10 @@ Item::Item(
     if (nullptr != pDestinationAcctID) { m_AcctToID = *pDestinationAcctID; }
 }
 
+void* Item::operator new(std::size_t size) { return Arena::Allocate(size); }
+
+void Item::operator delete(void* pointer) { Arena::Deallocate(pointer); }
+
 Item::~Item() { Release_Item(); }
 
 void Item::Release()
@@ -66,6 +66,9 @@
 #include "opentxs/OT.hpp"
 #include "opentxs/Types.hpp"
 
+#include "core/util/MerkleTree.hpp"
+#include "util/Arena.hpp"
+
 #include <stdlib.h>
 #include <sys/types.h>
 #include <cstdint>
@@ -76,8 +79,16 @@
 #include <string>
 #include <utility>
 
+// Box format version in which the box hash is a Merkle root over the receipts
+#define OT_LEDGER_MERKLE_VERSION "3.0"
+
+#define OT_METHOD "opentxs::Ledger::"
+
 namespace opentxs
 {
+std::mutex Ledger::merkle_lock_{};
+std::set<std::string> Ledger::merkle_notaries_{};
+std::atomic<bool> Ledger::arena_allocation_{false};
 
 char const* const __TypeStringsLedger[] = {
     "nymbox",  // the nymbox is per user account (versus per asset account) and
@@ -673,6 +684,8 @@ bool Ledger::SaveGeneric(Ledger::ledgerType theType)
 //
 bool Ledger::CalculateHash(Identifier& theOutput)
 {
+    if (IsMerkleBox()) { return calculate_merkle_hash(theOutput); }
+
     theOutput.Release();
 
     bool bCalcDigest = theOutput.CalculateDigest(m_xmlUnsigned);
@@ -686,6 +699,125 @@ bool Ledger::CalculateHash(Identifier& theOutput)
     return bCalcDigest;
 }
 
+Arena* Ledger::arena()
+{
+    if (false == arena_allocation_.load()) { return nullptr; }
+
+    if (false == bool(arena_)) { arena_ = Arena::Factory(); }
+
+    return arena_.get();
+}
+
+// Each receipt's hash is compared with the one its leaf was built from, so
+// receipts which were replaced or changed in place are picked up along with
+// those added or removed. Only leaves whose receipt hash changed are rehashed,
+// and each invalidates a single path through the tree. Receipts loaded from a
+// saved box are abbreviated records which carry their receipt hash, so
+// checking them hashes nothing. The hash of a full receipt is a digest of its
+// serialized form, the same one saving the box computes for its record.
+bool Ledger::calculate_merkle_hash(Identifier& theOutput)
+{
+    theOutput.Release();
+
+    if (false == bool(merkle_tree_)) {
+        merkle_tree_.reset(new MerkleTree);
+        merkle_leaves_.clear();
+    }
+
+    OT_ASSERT(merkle_tree_);
+
+    auto& tree = *merkle_tree_;
+    auto leaf = merkle_leaves_.begin();
+
+    for (const auto& it : m_mapTransactions) {
+        const auto number = it.first;
+        const OTTransaction* pTransaction = it.second;
+
+        OT_ASSERT(nullptr != pTransaction);
+
+        // Receipts which have left the box since the last call
+        while ((merkle_leaves_.end() != leaf) && (leaf->first < number)) {
+            tree.Remove(static_cast<std::uint64_t>(leaf->first));
+            leaf = merkle_leaves_.erase(leaf);
+        }
+
+        auto receiptHash = Identifier::Factory();
+        pTransaction->GetReceiptHash(receiptHash);
+        const auto preimage = receiptHash->str();
+
+        if ((merkle_leaves_.end() != leaf) && (number == leaf->first)) {
+            if (preimage == leaf->second) {
+                ++leaf;
+
+                continue;
+            }
+
+            leaf->second = preimage;
+            ++leaf;
+        } else {
+            merkle_leaves_.emplace_hint(leaf, number, preimage);
+        }
+
+        if (false == tree.Set(static_cast<std::uint64_t>(number), preimage)) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Failed to hash receipt " << number << " (for a "
+                  << GetTypeString() << ")" << std::endl;
+            merkle_tree_.reset();
+            merkle_leaves_.clear();
+
+            return false;
+        }
+    }
+
+    while (merkle_leaves_.end() != leaf) {
+        tree.Remove(static_cast<std::uint64_t>(leaf->first));
+        leaf = merkle_leaves_.erase(leaf);
+    }
+
+    std::string root{};
+
+    if (false == tree.Root(root)) {
+        merkle_tree_.reset();
+        merkle_leaves_.clear();
+
+        return false;
+    }
+
+    return theOutput.CalculateDigest(Data::Factory(root.data(), root.size()));
+}
+
+bool Ledger::IsMerkleBox() const
+{
+    switch (m_Type) {
+        case Ledger::nymbox:
+        case Ledger::inbox:
+        case Ledger::outbox: {
+
+            return m_strVersion.Compare(OT_LEDGER_MERKLE_VERSION);
+        }
+        default: {
+
+            return false;
+        }
+    }
+}
+
+void Ledger::SetMerkleBoxes(const Identifier& notaryID, const bool enabled)
+{
+    Lock lock(merkle_lock_);
+
+    if (enabled) {
+        merkle_notaries_.emplace(notaryID.str());
+    } else {
+        merkle_notaries_.erase(notaryID.str());
+    }
+}
+
+void Ledger::SetArenaAllocation(const bool enabled)
+{
+    arena_allocation_.store(enabled);
+}
+
 bool Ledger::CalculateInboxHash(Identifier& theOutput)
 {
     if (m_Type != Ledger::inbox) {
@@ -1067,6 +1199,10 @@ Ledger::Ledger(
     : OTTransactionType(theNymID, theAccountID, theNotaryID)
     , m_Type(Ledger::message)
     , m_bLoadedLegacyData(false)
+    , m_mapTransactions()
+    , merkle_tree_(nullptr)
+    , merkle_leaves_()
+    , arena_(nullptr)
 {
     InitLedger();
 }
@@ -1082,6 +1218,10 @@ Ledger::Ledger(const Identifier& theAccountID, const Identifier& theNotaryID)
     : OTTransactionType()
     , m_Type(Ledger::message)
     , m_bLoadedLegacyData(false)
+    , m_mapTransactions()
+    , merkle_tree_(nullptr)
+    , merkle_leaves_()
+    , arena_(nullptr)
 {
     InitLedger();
 
@@ -1094,6 +1234,10 @@ Ledger::Ledger()
     : OTTransactionType()
     , m_Type(Ledger::message)
     , m_bLoadedLegacyData(false)
+    , m_mapTransactions()
+    , merkle_tree_(nullptr)
+    , merkle_leaves_()
+    , arena_(nullptr)
 {
     InitLedger();
 }
@@ -1739,6 +1883,20 @@ bool Ledger::LoadLedgerFromString(const String& theStr)
 void Ledger::UpdateContents()  // Before transmission or serialization, this is
                                // where the ledger saves its contents
 {
+    switch (GetType()) {
+        case Ledger::nymbox:
+        case Ledger::inbox:
+        case Ledger::outbox: {
+            Lock lock(merkle_lock_);
+
+            if (0 < merkle_notaries_.count(GetRealNotaryID().str())) {
+                m_strVersion = OT_LEDGER_MERKLE_VERSION;
+            }
+        } break;
+        default: {
+        }
+    }
+
     switch (GetType()) {
         case Ledger::message:
         case Ledger::nymbox:
@@ -2099,26 +2257,33 @@ std::int32_t Ledger::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
                     // constructor for abbreviated transactions
                     // which is ONLY used here.
                     //
-                    OTTransaction* pTransaction = new OTTransaction(
-                        NYM_ID,
-                        ACCOUNT_ID,
-                        NOTARY_ID,
-                        lNumberOfOrigin,
-                        static_cast<originType>(theOriginType),
-                        lTransactionNum,
-                        lInRefTo,  // lInRefTo
-                        lInRefDisplay,
-                        the_DATE_SIGNED,
-                        static_cast<OTTransaction::transactionType>(theType),
-                        strHash,
-                        lAdjustment,
-                        lDisplayValue,
-                        lClosingNum,
-                        lRequestNum,
-                        bReplyTransSuccess,
-                        pNumList);  // This is for "OTTransaction::blank" and
-                                    // "OTTransaction::successNotice", otherwise
-                                    // nullptr.
+                    OTTransaction* pTransaction{nullptr};
+
+                    {
+                        Arena::Scope scope(arena());
+                        pTransaction = new OTTransaction(
+                            NYM_ID,
+                            ACCOUNT_ID,
+                            NOTARY_ID,
+                            lNumberOfOrigin,
+                            static_cast<originType>(theOriginType),
+                            lTransactionNum,
+                            lInRefTo,  // lInRefTo
+                            lInRefDisplay,
+                            the_DATE_SIGNED,
+                            static_cast<OTTransaction::transactionType>(
+                                theType),
+                            strHash,
+                            lAdjustment,
+                            lDisplayValue,
+                            lClosingNum,
+                            lRequestNum,
+                            bReplyTransSuccess,
+                            pNumList);  // This is for "OTTransaction::blank"
+                                        // and "OTTransaction::successNotice",
+                                        // otherwise nullptr.
+                    }
+
                     OT_ASSERT(nullptr != pTransaction);
                     //
                     // NOTE: For THIS CONSTRUCTOR ONLY, we DO set the purported
@@ -2296,21 +2461,30 @@ std::int32_t Ledger::ProcessXMLNode(irr::io::IrrXMLReader*& xml)
             //            OTTransaction * pTransaction = new
             // OTTransaction(GetNymID(), GetRealAccountID(),
             // GetRealNotaryID());
-            OTTransaction* pTransaction = new OTTransaction(
-                GetNymID(), GetPurportedAccountID(), GetPurportedNotaryID());
-            OT_ASSERT(nullptr != pTransaction);
+            OTTransaction* pTransaction{nullptr};
+            bool bLoaded{false};
 
-            // Need this set before the LoadContractFromString().
-            //
-            if (!m_bLoadSecurely) pTransaction->SetLoadInsecure();
+            {
+                Arena::Scope scope(arena());
+                pTransaction = new OTTransaction(
+                    GetNymID(),
+                    GetPurportedAccountID(),
+                    GetPurportedNotaryID());
+                OT_ASSERT(nullptr != pTransaction);
+
+                // Need this set before the LoadContractFromString().
+                //
+                if (!m_bLoadSecurely) pTransaction->SetLoadInsecure();
+
+                bLoaded = strTransaction.Exists() &&
+                          pTransaction->LoadContractFromString(strTransaction);
+            }
 
             // If we're able to successfully base64-decode the string and load
             // it up as
             // a transaction, then let's add it to the ledger's list of
             // transactions
-            if (strTransaction.Exists() &&
-                pTransaction->LoadContractFromString(strTransaction) &&
-                pTransaction->VerifyContractID())
+            if (bLoaded && pTransaction->VerifyContractID())
             // I responsible here to call pTransaction->VerifyContractID()
             // since
             // I am loading it here and adding it to the ledger. (So I do.)
@@ -2433,6 +2607,9 @@ Ledger::~Ledger() { Release_Ledger(); }
 void Ledger::ReleaseTransactions()
 {
     // If there were any dynamically allocated objects, clean them up here.
+    // In arena mode the destructors still have to run, since the receipts
+    // own heap memory of their own, but each delete only drops a reference
+    // to an arena block and the blocks are freed as they empty.
 
     while (!m_mapTransactions.empty()) {
         OTTransaction* pTransaction = m_mapTransactions.begin()->second;
@@ -2440,6 +2617,13 @@ void Ledger::ReleaseTransactions()
         delete pTransaction;
         pTransaction = nullptr;
     }
+
+    merkle_tree_.reset();
+    merkle_leaves_.clear();
+
+    // Any transaction which was removed without being deleted keeps its
+    // arena block alive until it is deleted
+    arena_.reset();
 }
 
 void Ledger::Release_Ledger() { ReleaseTransactions(); }
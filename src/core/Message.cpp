@@ -42,12 +42,15 @@
 
 #include "opentxs/consensus/Context.hpp"
 #include "opentxs/consensus/ServerContext.hpp"
+#include "opentxs/core/crypto/CryptoAsymmetric.hpp"
 #include "opentxs/core/crypto/OTASCIIArmor.hpp"
 #include "opentxs/core/crypto/OTAsymmetricKey.hpp"
+#include "opentxs/core/crypto/OTPasswordData.hpp"
 #include "opentxs/core/util/Assert.hpp"
 #include "opentxs/core/util/Common.hpp"
 #include "opentxs/core/util/Tag.hpp"
 #include "opentxs/core/Contract.hpp"
+#include "opentxs/core/Data.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Ledger.hpp"
 #include "opentxs/core/Log.hpp"
@@ -60,14 +63,22 @@
 
 #include <irrxml/irrXML.hpp>
 
+#include "NotaryMessage.pb.h"
+
 #include <cstdint>
 #include <fstream>
 #include <map>
 #include <memory>
+#include <set>
 #include <stdexcept>
 #include <string>
 #include <utility>
 
+#define BINARY_ENVELOPE_VERSION 1
+#define BINARY_MESSAGE_VERSION 1
+// Messages from senders which read range-encoded transaction statements
+#define RANGE_STATEMENT_MESSAGE_VERSION "3.0"
+
 #define ERROR_STRING "error"
 #define PING_NOTARY "pingNotary"
 #define PING_NOTARY_RESPONSE "pingNotaryResponse"
@@ -279,6 +290,22 @@ MessageType Message::reply_command(const MessageType& type)
     }
 }
 
+bool Message::BinaryFormatAllowed(const MessageType type)
+{
+    switch (type) {
+        case MessageType::getRequestNumber:
+        case MessageType::getNymbox:
+        case MessageType::getBoxReceipt: {
+
+            return true;
+        }
+        default: {
+
+            return false;
+        }
+    }
+}
+
 std::string Message::Command(const MessageType type)
 {
     try {
@@ -423,18 +450,36 @@ void Message::SetAcknowledgments(const std::set<RequestNumber>& numbers)
     for (const auto& it : numbers) { m_AcknowledgedReplies.Add(it); }
 }
 
+// True when the sender of this message can read version 2.0 transaction
+// statements, which store issued and available numbers as ranges.
+bool Message::RangeStatements() const
+{
+    return m_strVersion.Compare(RANGE_STATEMENT_MESSAGE_VERSION);
+}
+
+// Advertises to the recipient that the sender of this message can read
+// version 2.0 transaction statements.
+void Message::SetRangeStatements()
+{
+    m_strVersion.Set(RANGE_STATEMENT_MESSAGE_VERSION);
+}
+
 // The framework (Contract) will call this function at the appropriate time.
 // OTMessage is special because it actually does something here, when most
 // contracts are read-only and thus never update their contents.
 // Messages, obviously, are different every time, and this function will be
 // called just prior to the signing of the message, in Contract::SignContract.
 void Message::UpdateContents()
+{
+    m_lTime = OTTimeGetCurrentTime();
+    update_xml();
+}
+
+void Message::update_xml()
 {
     // I release this because I'm about to repopulate it.
     m_xmlUnsigned.Release();
 
-    m_lTime = OTTimeGetCurrentTime();
-
     Tag tag("notaryMessage");
 
     tag.add_attribute("version", m_strVersion.Get());
@@ -604,6 +649,8 @@ bool Message::SignContract(const Nym& theNym, const OTPasswordData* pPWData)
     // I release these, I assume, because a message only has one signer.
     ReleaseSignatures();  // Note: this might change with credentials. We might
                           // require multiple signatures.
+    binary_message_.clear();
+    binary_signature_.clear();
 
     // Use the authentication key instead of the signing key.
     //
@@ -638,6 +685,11 @@ bool Message::VerifySignature(const Nym& theNym, const OTPasswordData* pPWData)
     // probably be
     // the same way. (Maybe it already is, by the time you are reading this.)
     //
+    if (false == binary_message_.empty()) {
+
+        return verify_binary(theNym, pPWData);
+    }
+
     return VerifySigAuthent(theNym, pPWData);
 }
 
@@ -654,9 +706,174 @@ bool Message::VerifySignature(const Nym& theNym, const OTPasswordData* pPWData)
 //
 bool Message::VerifyContractID() const { return true; }
 
+bool Message::LoadBinary(const std::string& serialized)
+{
+    Release();
+    OTDB::NotaryEnvelope_InternalPB envelope{};
+    OTDB::NotaryMessage_InternalPB message{};
+
+    if (false == envelope.ParseFromString(serialized)) {
+        otErr << __FUNCTION__ << ": Invalid envelope." << std::endl;
+
+        return false;
+    }
+
+    if (BINARY_ENVELOPE_VERSION != envelope.version()) {
+        otErr << __FUNCTION__ << ": Unsupported envelope version "
+              << envelope.version() << std::endl;
+
+        return false;
+    }
+
+    if (false == message.ParseFromString(envelope.message())) {
+        otErr << __FUNCTION__ << ": Invalid message." << std::endl;
+
+        return false;
+    }
+
+    binary_message_ = envelope.message();
+    binary_signature_ = envelope.signature();
+    binary_hash_type_ = static_cast<proto::HashType>(envelope.hashtype());
+    m_strVersion.Set(message.contract_version().c_str());
+    m_lTime = message.time();
+    m_strCommand.Set(message.command().c_str());
+    m_strNotaryID.Set(message.notary_id().c_str());
+    m_strNymID.Set(message.nym_id().c_str());
+    m_strNymboxHash.Set(message.nymbox_hash().c_str());
+    m_strInboxHash.Set(message.inbox_hash().c_str());
+    m_strOutboxHash.Set(message.outbox_hash().c_str());
+    m_strNymID2.Set(message.nym_id2().c_str());
+    m_strNymPublicKey.Set(message.nym_public_key().c_str());
+    m_strInstrumentDefinitionID.Set(
+        message.instrument_definition_id().c_str());
+    m_strAcctID.Set(message.acct_id().c_str());
+    m_strType.Set(message.type().c_str());
+    m_strRequestNum.Set(message.request_num().c_str());
+    m_ascInReferenceTo.Set(message.in_reference_to().c_str());
+    m_ascPayload.Set(message.payload().c_str());
+    m_ascPayload2.Set(message.payload2().c_str());
+    m_ascPayload3.Set(message.payload3().c_str());
+    m_AcknowledgedReplies.Release();
+
+    for (const auto& number : message.acknowledged_replies()) {
+        m_AcknowledgedReplies.Add(number);
+    }
+
+    m_lNewRequestNum = message.new_request_num();
+    m_lDepth = message.depth();
+    m_lTransactionNum = message.transaction_num();
+    keytypeAuthent_ = message.keytype_authent();
+    keytypeEncrypt_ = message.keytype_encrypt();
+    enum_ = static_cast<std::uint8_t>(message.enum_value());
+    enum2_ = message.enum_value2();
+    m_bSuccess = message.success();
+    m_bBool = message.boolean();
+    m_bIsSigned = (false == binary_signature_.empty());
+
+    // Consumers which need the text form of the message (for example to
+    // store it or attach it to a receipt) get an equivalent XML document.
+    update_xml();
+
+    return SaveContract();
+}
+
+bool Message::SaveBinary(
+    const Nym& theNym,
+    std::string& serialized,
+    const OTPasswordData* pPWData) const
+{
+    OTDB::NotaryMessage_InternalPB message{};
+    message.set_version(BINARY_MESSAGE_VERSION);
+    message.set_contract_version(m_strVersion.Get());
+    message.set_time(m_lTime);
+    message.set_command(m_strCommand.Get());
+    message.set_notary_id(m_strNotaryID.Get());
+    message.set_nym_id(m_strNymID.Get());
+    message.set_nymbox_hash(m_strNymboxHash.Get());
+    message.set_inbox_hash(m_strInboxHash.Get());
+    message.set_outbox_hash(m_strOutboxHash.Get());
+    message.set_nym_id2(m_strNymID2.Get());
+    message.set_nym_public_key(m_strNymPublicKey.Get());
+    message.set_instrument_definition_id(m_strInstrumentDefinitionID.Get());
+    message.set_acct_id(m_strAcctID.Get());
+    message.set_type(m_strType.Get());
+    message.set_request_num(m_strRequestNum.Get());
+    message.set_in_reference_to(
+        m_ascInReferenceTo.Get(), m_ascInReferenceTo.GetLength());
+    message.set_payload(m_ascPayload.Get(), m_ascPayload.GetLength());
+    message.set_payload2(m_ascPayload2.Get(), m_ascPayload2.GetLength());
+    message.set_payload3(m_ascPayload3.Get(), m_ascPayload3.GetLength());
+    std::set<std::int64_t> acknowledged{};
+    m_AcknowledgedReplies.Output(acknowledged);
+
+    for (const auto& number : acknowledged) {
+        message.add_acknowledged_replies(number);
+    }
+
+    message.set_new_request_num(m_lNewRequestNum);
+    message.set_depth(m_lDepth);
+    message.set_transaction_num(m_lTransactionNum);
+    message.set_keytype_authent(keytypeAuthent_);
+    message.set_keytype_encrypt(keytypeEncrypt_);
+    message.set_enum_value(enum_);
+    message.set_enum_value2(enum2_);
+    message.set_success(m_bSuccess);
+    message.set_boolean(m_bBool);
+
+    OTDB::NotaryEnvelope_InternalPB envelope{};
+    envelope.set_version(BINARY_ENVELOPE_VERSION);
+
+    if (false == message.SerializeToString(envelope.mutable_message())) {
+        otErr << __FUNCTION__ << ": Failed to serialize message." << std::endl;
+
+        return false;
+    }
+
+    const auto& key = theNym.GetPrivateAuthKey();
+    const auto hashType = key.SigHashType();
+    const auto& bytes = envelope.message();
+    auto signature = Data::Factory();
+    const bool signedMessage = key.engine().Sign(
+        Data::Factory(bytes.data(), bytes.size()),
+        key,
+        hashType,
+        signature,
+        pPWData);
+
+    if (false == signedMessage) {
+        otErr << __FUNCTION__ << ": Failed to sign message." << std::endl;
+
+        return false;
+    }
+
+    envelope.set_hashtype(hashType);
+    envelope.set_signature(signature->GetPointer(), signature->GetSize());
+
+    return envelope.SerializeToString(&serialized);
+}
+
+bool Message::verify_binary(const Nym& theNym, const OTPasswordData* pPWData)
+    const
+{
+    if (binary_signature_.empty()) { return false; }
+
+    OTPasswordData thePWData("Message::verify_binary");
+    const auto& key = theNym.GetPublicAuthKey();
+
+    return key.engine().Verify(
+        Data::Factory(binary_message_.data(), binary_message_.size()),
+        key,
+        Data::Factory(binary_signature_.data(), binary_signature_.size()),
+        binary_hash_type_,
+        (nullptr != pPWData) ? pPWData : &thePWData);
+}
+
 Message::Message()
     : Contract()
     , m_bIsSigned(false)
+    , binary_message_()
+    , binary_signature_()
+    , binary_hash_type_(proto::HASHTYPE_ERROR)
     , m_lNewRequestNum(0)
     , m_lDepth(0)
     , m_lTransactionNum(0)
@@ -71,6 +71,8 @@
 #include "opentxs/OT.hpp"
 #include "opentxs/Types.hpp"
 
+#include "util/Arena.hpp"
+
 #include <irrxml/irrXML.hpp>
 
 #include <cstdint>
@@ -2473,7 +2475,7 @@ bool OTTransaction::VerifyBalanceReceipt(const ServerContext& context)
         // signed the instrument at some point in the past does NOT mean that
         // I'm still responsible for the transaction number that's listed on the
         // instrument. Maybe I already used it up a long time ago...)
-        const bool missing = (1 != statement.Issued().count(lIssuedNum));
+        const bool missing = (false == statement.Issued().Contains(lIssuedNum));
 
         if (missing) {
             otErr << "OTTransaction::" << __FUNCTION__
@@ -2810,6 +2812,15 @@ bool OTTransaction::SaveBoxReceipt(Ledger& theLedger)
     return SaveBoxReceipt(lLedgerType);
 }
 
+void OTTransaction::GetReceiptHash(Identifier& theOutput) const
+{
+    if (IsAbbreviated()) {
+        theOutput = m_Hash.get();
+    } else {
+        CalculateContractID(theOutput);
+    }
+}
+
 bool OTTransaction::VerifyBoxReceipt(OTTransaction& theFullVersion)
 {
     if (!m_bIsAbbreviated || theFullVersion.IsAbbreviated()) {
@@ -2876,7 +2887,9 @@ bool OTTransaction::VerifyBoxReceipt(OTTransaction& theFullVersion)
 // make sure that the items on it also have the right owner, as well as that
 // owner's signature, and a matching transaction number to boot.
 //
-bool OTTransaction::VerifyItems(const Nym& theNym)
+bool OTTransaction::VerifyItems(
+    const api::Crypto& crypto,
+    const Nym& theNym)
 {
     const Identifier NYM_ID(theNym);
 
@@ -2891,9 +2904,8 @@ bool OTTransaction::VerifyItems(const Nym& theNym)
     // items
     // and the transaction both have the same owner: Nym.
 
-    // if pointer not null, and it's a withdrawal, and it's an acknowledgement
-    // (not a rejection or error)
-    //
+    std::vector<const Contract*> items{};
+
     for (auto& it : GetItemList()) {
         // loop through the ALL items that make up this transaction and check
         // to see if a response to deposit.
@@ -2904,13 +2916,15 @@ bool OTTransaction::VerifyItems(const Nym& theNym)
 
         if (NYM_ID != pItem->GetNymID()) return false;
 
-        if (!pItem->VerifySignature(theNym))  // NO need to call
-                                              // VerifyAccount since
-                                              // VerifyContractID is
-                                              // ALREADY called and now
-                                              // here's
-                                              // VerifySignature().
-            return false;
+        items.push_back(pItem);
+    }
+
+    // NO need to call VerifyAccount since VerifyContractID is ALREADY called
+    // and now here's VerifySignature(), for all the items at once.
+    const auto verified = Contract::VerifySignatures(crypto, items, theNym);
+
+    for (const auto result : verified) {
+        if (false == result) { return false; }
     }
 
     return true;
@@ -3231,6 +3245,16 @@ OTTransaction* OTTransaction::GenerateTransaction(
     return pTransaction;
 }
 
+void* OTTransaction::operator new(std::size_t size)
+{
+    return Arena::Allocate(size);
+}
+
+void OTTransaction::operator delete(void* pointer)
+{
+    Arena::Deallocate(pointer);
+}
+
 OTTransaction::~OTTransaction()
 {
     while (!m_listItems.empty()) {
@@ -50,6 +50,8 @@
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/Nym.hpp"
 
+#include "util/Arena.hpp"
+
 #if !(                                                                         \
     defined(_WIN32) || (defined(TARGET_OS_IPHONE) && TARGET_OS_IPHONE) ||      \
     defined(ANDROID))
@@ -60,14 +62,70 @@
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <cstring>
 #include <map>
+#include <memory>
+#include <new>
 #include <sstream>
 #include <string>
 #include <utility>
 
 namespace opentxs
 {
+#define OT_STRING_FORMAT_BUFFER 512
+
+namespace
+{
+// Per thread so that counting costs the allocating thread nothing more than
+// a local increment.
+thread_local std::uint64_t allocations_{0};
+
+/** Header of a heap buffer, followed by capacity + 1 characters
+ *
+ *  Buffers come from Arena so that strings belonging to receipts parsed by
+ *  a ledger in arena mode share its arena.
+ */
+struct Buffer {
+    std::atomic<std::uint32_t> references_;
+    std::uint32_t capacity_;
+
+    static char* Allocate(const std::uint32_t capacity)
+    {
+        auto* memory = Arena::Allocate(sizeof(Buffer) + capacity + 1);
+        auto* buffer = new (memory) Buffer{};
+        buffer->references_.store(1);
+        buffer->capacity_ = capacity;
+        ++allocations_;
+
+        return reinterpret_cast<char*>(buffer + 1);
+    }
+
+    static Buffer& Get(char* data)
+    {
+        return *(reinterpret_cast<Buffer*>(data) - 1);
+    }
+
+    /** The last reference wipes length characters before freeing */
+    static void Release(char* data, const std::uint32_t length)
+    {
+        auto& buffer = Get(data);
+
+        if (1 == buffer.references_.fetch_sub(1, std::memory_order_acq_rel)) {
+            OTPassword::zeroMemory(data, length);
+            buffer.~Buffer();
+            Arena::Deallocate(&buffer);
+        }
+    }
+
+    static bool Shared(char* data)
+    {
+        return 1 < Get(data).references_.load(std::memory_order_acquire);
+    }
+};
+}  // namespace
 
 std::ostream& operator<<(std::ostream& os, const String& obj)
 {
@@ -75,6 +133,9 @@ std::ostream& operator<<(std::ostream& os, const String& obj)
     return os;
 }
 
+// static
+std::uint64_t String::Allocations() { return allocations_; }
+
 // static
 std::string String::LongToString(const std::int64_t& lNumber)
 {
@@ -605,25 +666,148 @@ std::int32_t String::ToInt() const
  // zero it out similarly.
  */
 
+// Other copies sharing the buffer keep their contents, as they would have if
+// each copy had its own buffer.
 void String::zeroMemory() const
 {
-    if (nullptr != data_) { OTPassword::zeroMemory(data_, length_); }
+    if (nullptr == data_) { return; }
+
+    detach();
+    OTPassword::zeroMemory(data_, length_);
 }
 
-void String::Release_String(void)
+void String::detach() const
 {
-    if (nullptr != data_) {
-        // for security purposes.
-        //
-        OTPassword::zeroMemory(data_, length_);
-        //        memset(data_, 0, length_);
-        delete[] data_;
+    if ((nullptr == data_) || is_inline() || (false == Buffer::Shared(data_))) {
+        return;
+    }
+
+    auto* output = Buffer::Allocate(length_);
+    std::memcpy(output, data_, length_ + 1);
+    Buffer::Release(data_, length_);
+    data_ = output;
+}
+
+void String::release_buffer()
+{
+    if (nullptr == data_) { return; }
+
+    // for security purposes.
+    //
+    if (is_inline()) {
+        OTPassword::zeroMemory(small_, length_);
+    } else {
+        Buffer::Release(data_, length_);
     }
+
     data_ = nullptr;
+}
+
+void String::Release_String(void)
+{
+    release_buffer();
     position_ = 0;
     length_ = 0;
 }
 
+void String::reserve(const std::uint32_t size)
+{
+    if (nullptr == data_) {
+        if ((sizeof(small_) - 1) >= size) {
+            data_ = small_;
+        } else {
+            data_ = Buffer::Allocate(size);
+        }
+
+        data_[0] = '\0';
+
+        return;
+    }
+
+    std::uint32_t capacity{sizeof(small_) - 1};
+
+    if (is_inline()) {
+        if (capacity >= size) { return; }
+    } else {
+        capacity = Buffer::Get(data_).capacity_;
+
+        if ((capacity >= size) && (false == Buffer::Shared(data_))) { return; }
+    }
+
+    OT_ASSERT(size < MAX_STRING_LENGTH);
+
+    const std::uint32_t grown =
+        std::min<std::uint32_t>(2 * capacity, MAX_STRING_LENGTH - 1);
+    auto* output = Buffer::Allocate(std::max(size, grown));
+    std::memcpy(output, data_, length_ + 1);
+    release_buffer();
+    data_ = output;
+}
+
+void String::append(const char* data, const std::uint32_t size)
+{
+    if (0 == size) { return; }
+
+    reserve(length_ + size);
+    std::memcpy(data_ + length_, data, size);
+    length_ += size;
+    data_[length_] = '\0';
+}
+
+// The arguments may point into this object, so the output is formatted into
+// a separate buffer before this object is modified
+void String::append_format(
+    const char* fmt,
+    std::va_list* pvl,
+    const bool replace)
+{
+    OT_ASSERT(nullptr != fmt);
+    OT_ASSERT(nullptr != pvl);
+
+    char buffer[OT_STRING_FORMAT_BUFFER];
+    std::unique_ptr<char[]> large{};
+    char* output = buffer;
+    std::va_list args;
+    va_copy(args, *pvl);
+    const auto size = vsnprintf(buffer, sizeof(buffer), fmt, args);
+    va_end(args);
+
+    OT_ASSERT(0 <= size);
+
+    if (sizeof(buffer) <= static_cast<std::size_t>(size)) {
+        large.reset(new char[size + 1]);
+        output = large.get();
+        const auto written = vsnprintf(output, size + 1, fmt, *pvl);
+
+        OT_ASSERT(written == size);
+    }
+
+    if (replace) { Release(); }
+
+    append(output, static_cast<std::uint32_t>(size));
+    OTPassword::zeroMemory(output, size);
+}
+
+void String::take(String& rhs)
+{
+    OT_ASSERT(nullptr == data_);
+
+    length_ = rhs.length_;
+    position_ = rhs.position_;
+
+    if (rhs.is_inline()) {
+        std::memcpy(small_, rhs.small_, length_ + 1);
+        OTPassword::zeroMemory(rhs.small_, rhs.length_);
+        data_ = small_;
+    } else {
+        data_ = rhs.data_;
+    }
+
+    rhs.data_ = nullptr;
+    rhs.length_ = 0;
+    rhs.position_ = 0;
+}
+
 void String::Release(void)
 {
     Release_String();
@@ -722,6 +906,14 @@ String::String(const String& strValue)
     LowLevelSetStr(strValue);
 }
 
+String::String(String&& strValue)
+    : length_(0)
+    , position_(0)
+    , data_(nullptr)
+{
+    take(strValue);
+}
+
 String::String(const char* new_string)
     : length_(0)
     , position_(0)
@@ -766,7 +958,16 @@ void String::LowLevelSetStr(const String& strBuf)
             "anyway--it would have been truncated here, potentially "
             "causing data corruption.)");  // 10 being a buffer.
 
-        data_ = str_dup2(strBuf.data_, length_);
+        if (strBuf.is_inline()) {
+            std::memcpy(small_, strBuf.data_, length_);
+            small_[length_] = '\0';
+            data_ = small_;
+        } else {
+            // Long values are shared until one of the copies is modified
+            Buffer::Get(strBuf.data_)
+                .references_.fetch_add(1, std::memory_order_relaxed);
+            data_ = strBuf.data_;
+        }
     }
 }
 
@@ -818,12 +1019,10 @@ void String::LowLevelSet(
         //
         //      new_string[nLength] = '\0';
 
-        data_ = str_dup2(new_string, nLength);
-
-        if (nullptr != data_)
-            length_ = nLength;
-        else
-            length_ = 0;
+        reserve(nLength);
+        strncpy(data_, new_string, nLength);
+        data_[nLength] = '\0';
+        length_ = nLength;
     }
 }
 
@@ -837,7 +1036,8 @@ bool String::MemSet(const char* pMem, std::uint32_t theSize)  // if theSize is
     // -------------------
     if ((nullptr == pMem) || (theSize < 1)) return true;
 
-    char* str_new = new char[theSize + 1];  // then we allocate 11
+    reserve(theSize);  // then we allocate 11
+    char* str_new = data_;
     OT_ASSERT(nullptr != str_new);
     // -------------------
     OTPassword::zeroMemory(str_new, theSize + 1);
@@ -870,7 +1070,6 @@ bool String::MemSet(const char* pMem, std::uint32_t theSize)  // if theSize is
     str_new[nLength] = '\0';  // This SHOULD be superfluous as well...
 
     length_ = nLength;  // the length doesn't count the 0.
-    data_ = str_new;
 
     return true;
 }
@@ -884,9 +1083,10 @@ String& String::operator=(String rhs)
 
 void String::swap(String& rhs)
 {
-    std::swap(length_, rhs.length_);
-    std::swap(position_, rhs.position_);
-    std::swap(data_, rhs.data_);
+    String temp{};
+    temp.take(*this);
+    take(rhs);
+    rhs.take(temp);
 }
 
 bool String::At(std::uint32_t lIndex, char& c) const
@@ -922,6 +1122,15 @@ void String::Set(const char* new_string, std::uint32_t nEnforcedMaxLength)
     if (new_string == data_)  // Already the same string.
         return;
 
+    if ((nullptr != data_) && (new_string > data_) &&
+        (new_string <= data_ + length_)) {
+        // Part of this string, which Release() would wipe
+        const String copy(new_string, nEnforcedMaxLength);
+        Set(copy);
+
+        return;
+    }
+
     Release();
 
     if (nullptr == new_string) return;
@@ -1025,6 +1234,8 @@ void String::ConvertToUpperCase() const
 {
     if (data_ == nullptr) { return; }
 
+    detach();
+
     for (char* s1 = data_; *s1; s1++) { *s1 = static_cast<char>(toupper(*s1)); }
 }
 
@@ -1158,14 +1369,8 @@ void String::Format(const char* fmt, ...)
 {
     va_list vl;
     va_start(vl, fmt);
-
-    std::string str_output;
-
-    const bool bSuccess = String::vformat(fmt, &vl, str_output);
-
+    append_format(fmt, &vl, true);
     va_end(vl);
-
-    if (bSuccess) Set(str_output.c_str());
 }
 
 // append a string at the end of the current buffer.
@@ -1173,30 +1378,19 @@ void String::Concatenate(const char* fmt, ...)
 {
     va_list vl;
     va_start(vl, fmt);
-
-    std::string str_output;
-
-    const bool bSuccess = String::vformat(fmt, &vl, str_output);
-
+    append_format(fmt, &vl, false);
     va_end(vl);
-
-    if (bSuccess) {
-        const String strConcat(str_output);
-
-        Concatenate(strConcat);
-    }
 }
 
 // append a string at the end of the current buffer.
 void String::Concatenate(const String& strBuf)
 {
-    std::string str_output;
-
-    if ((length_ > 0) && (nullptr != data_)) str_output += data_;
-
-    if (strBuf.Exists() && (strBuf.GetLength() > 0)) str_output += strBuf.Get();
-
-    Set(str_output.c_str());
+    if (this == &strBuf) {
+        const String copy(strBuf);
+        append(copy.Get(), copy.GetLength());
+    } else {
+        append(strBuf.Get(), strBuf.GetLength());
+    }
 }
 
 void String::WriteToFile(std::ostream& ofs) const
@@ -0,0 +1,302 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "stdafx.hpp"
+
+#include "AccountRegistry.hpp"
+
+#include "opentxs/core/util/Assert.hpp"
+#include "opentxs/core/util/OTFolders.hpp"
+#include "opentxs/core/util/OTPaths.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/OTStorage.hpp"
+#include "opentxs/core/String.hpp"
+
+#include "util/Journal.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+#define OT_ACCOUNT_REGISTRY_MIN_COMPACT 1024
+
+#define OT_METHOD "opentxs::AccountRegistry::"
+
+namespace opentxs
+{
+std::mutex AccountRegistry::map_lock_{};
+std::map<std::string, std::unique_ptr<AccountRegistry>> AccountRegistry::map_{};
+
+AccountRegistry::Cursor::Cursor(const AccountRegistry& parent)
+    : parent_(parent)
+    , started_(false)
+    , last_()
+{
+}
+
+bool AccountRegistry::Cursor::Next(
+    std::vector<std::string>& batch,
+    const std::size_t count)
+{
+    Lock lock(parent_.lock_);
+    batch.clear();
+    const auto& accounts = parent_.accounts_;
+    auto it = started_ ? accounts.upper_bound(last_) : accounts.begin();
+
+    while ((accounts.end() != it) && (batch.size() < count)) {
+        batch.emplace_back(*it++);
+    }
+
+    if (batch.empty()) { return false; }
+
+    started_ = true;
+    last_ = batch.back();
+
+    return true;
+}
+
+AccountRegistry::AccountRegistry(const std::string& unitID)
+    : unit_id_(unitID)
+    , lock_()
+    , loaded_(false)
+    , journal_(nullptr)
+    , accounts_()
+{
+}
+
+AccountRegistry& AccountRegistry::Get(const std::string& unitID)
+{
+    Lock lock(map_lock_);
+    auto& output = map_[unitID];
+
+    if (false == bool(output)) { output.reset(new AccountRegistry(unitID)); }
+
+    OT_ASSERT(output);
+
+    return *output;
+}
+
+bool AccountRegistry::Add(const std::string& accountID)
+{
+    if (false == valid(accountID)) { return false; }
+
+    Lock lock(lock_);
+
+    if (false == load(lock)) { return false; }
+
+    if (accounts_.count(accountID)) { return true; }
+
+    return update(lock, '+', accountID);
+}
+
+void AccountRegistry::Cleanup()
+{
+    Lock lock(map_lock_);
+    map_.clear();
+}
+
+bool AccountRegistry::compact(const Lock& lock)
+{
+    OT_ASSERT(lock.owns_lock());
+    OT_ASSERT(journal_);
+
+    Journal::Records records{};
+    records.reserve(accounts_.size());
+
+    for (const auto& account : accounts_) {
+        records.emplace_back('+' + account);
+    }
+
+    return journal_->Rewrite(records);
+}
+
+std::size_t AccountRegistry::Count() const
+{
+    Lock lock(lock_);
+
+    return accounts_.size();
+}
+
+bool AccountRegistry::Erase(const std::string& accountID)
+{
+    Lock lock(lock_);
+
+    if (false == load(lock)) { return false; }
+
+    if (0 == accounts_.count(accountID)) { return true; }
+
+    return update(lock, '-', accountID);
+}
+
+bool AccountRegistry::import_legacy(const Lock& lock)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    const std::string legacy = unit_id_ + ".a";
+
+    if (false == OTDB::Exists(OTFolders::Contract().Get(), legacy)) {
+        return true;
+    }
+
+    std::unique_ptr<OTDB::Storable> pStorable(OTDB::QueryObject(
+        OTDB::STORED_OBJ_STRING_MAP, OTFolders::Contract().Get(), legacy));
+    auto* pMap = dynamic_cast<OTDB::StringMap*>(pStorable.get());
+
+    if (nullptr == pMap) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to load " << legacy
+              << std::endl;
+
+        return false;
+    }
+
+    for (const auto& it : pMap->the_map) {
+        const auto& accountID = it.first;
+        const auto& unitID = it.second;
+
+        if (unit_id_ != unitID) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Error: wrong instrument definition ID (" << unitID
+                  << ") when expecting: " << unit_id_ << std::endl;
+
+            continue;
+        }
+
+        if (valid(accountID)) { accounts_.emplace(accountID); }
+    }
+
+    otWarn << OT_METHOD << __FUNCTION__ << ": Imported " << accounts_.size()
+           << " account records for " << unit_id_ << std::endl;
+
+    return compact(lock);
+}
+
+AccountRegistry::Cursor AccountRegistry::Iterate()
+{
+    Lock lock(lock_);
+    load(lock);
+
+    return Cursor(*this);
+}
+
+bool AccountRegistry::load(const Lock& lock)
+{
+    OT_ASSERT(lock.owns_lock());
+
+    if (loaded_) { return true; }
+
+    std::string path{};
+    const auto found = OTDB::FormPathString(
+        path, OTFolders::Contract().Get(), unit_id_ + ".accounts");
+
+    if (0 > found) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Unable to construct path for account registry of "
+              << unit_id_ << std::endl;
+
+        return false;
+    }
+
+    bool created{false};
+    OTPaths::BuildFilePath(String(path), created);
+    journal_.reset(new Journal(path, OT_ACCOUNT_REGISTRY_MIN_COMPACT));
+
+    OT_ASSERT(journal_);
+
+    if (false == journal_->Exists()) {
+        loaded_ = import_legacy(lock);
+
+        return loaded_;
+    }
+
+    Journal::Records records{};
+
+    if (false == journal_->Load(records)) { return false; }
+
+    for (const auto& record : records) {
+        const char op = record.empty() ? '\0' : record.at(0);
+        const auto accountID = record.empty() ? "" : record.substr(1);
+
+        if (('+' == op) && valid(accountID)) {
+            accounts_.emplace(accountID);
+        } else if (('-' == op) && valid(accountID)) {
+            accounts_.erase(accountID);
+        } else {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Ignoring invalid record in " << path << std::endl;
+        }
+    }
+
+    loaded_ = true;
+
+    if (journal_->ShouldCompact(accounts_.size())) { compact(lock); }
+
+    return true;
+}
+
+bool AccountRegistry::update(
+    const Lock& lock,
+    const char op,
+    const std::string& accountID)
+{
+    OT_ASSERT(lock.owns_lock());
+    OT_ASSERT(journal_);
+
+    if (false == journal_->Append(op + accountID)) { return false; }
+
+    if ('+' == op) {
+        accounts_.emplace(accountID);
+    } else {
+        accounts_.erase(accountID);
+    }
+
+    // The record is already stored, so a failed compaction is harmless
+    if (journal_->ShouldCompact(accounts_.size())) { compact(lock); }
+
+    return true;
+}
+
+bool AccountRegistry::valid(const std::string& accountID)
+{
+    if (accountID.empty()) { return false; }
+
+    return std::all_of(accountID.begin(), accountID.end(), [](const char c) {
+        return 0 != std::isalnum(static_cast<unsigned char>(c));
+    });
+}
+
+AccountRegistry::~AccountRegistry() {}
+}  // namespace opentxs
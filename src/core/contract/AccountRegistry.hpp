@@ -0,0 +1,126 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_CORE_CONTRACT_ACCOUNTREGISTRY_HPP
+#define OPENTXS_CORE_CONTRACT_ACCOUNTREGISTRY_HPP
+
+#include "Internal.hpp"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace opentxs
+{
+/** \brief Set of user account IDs for a single unit definition
+ *
+ *  Replaces the legacy "<unit>.a" StringMap file, which had to be read and
+ *  rewritten in full for every change. Changes are appended to the Journal
+ *  "<unit>.accounts" in the contracts folder as one "+<id>" or "-<id>"
+ *  record each, and an in-memory index is rebuilt from it the first time a
+ *  unit is used.
+ *
+ *  A legacy StringMap file is imported automatically if no journal exists
+ *  yet.
+ */
+class AccountRegistry
+{
+public:
+    /** Returns account IDs in batches, in ID order, without copying the
+     *  whole registry
+     *
+     *  Accounts added or removed while a cursor is in use are returned or
+     *  skipped according to their position relative to the cursor.
+     */
+    class Cursor
+    {
+    public:
+        /** Replaces the contents of batch with up to count account IDs.
+         *  Returns false once every account has been returned */
+        bool Next(std::vector<std::string>& batch, const std::size_t count);
+
+        explicit Cursor(const AccountRegistry& parent);
+
+    private:
+        const AccountRegistry& parent_;
+        bool started_{false};
+        std::string last_{};
+    };
+
+    /** Destroys every registry. Called during shutdown. */
+    static void Cleanup();
+    /** Returns the process-wide registry for the specified unit */
+    static AccountRegistry& Get(const std::string& unitID);
+
+    bool Add(const std::string& accountID);
+    std::size_t Count() const;
+    bool Erase(const std::string& accountID);
+    Cursor Iterate();
+
+    ~AccountRegistry();
+
+private:
+    static std::mutex map_lock_;
+    static std::map<std::string, std::unique_ptr<AccountRegistry>> map_;
+
+    const std::string unit_id_;
+    mutable std::mutex lock_;
+    bool loaded_{false};
+    std::unique_ptr<Journal> journal_;
+    std::set<std::string> accounts_;
+
+    static bool valid(const std::string& accountID);
+
+    bool compact(const Lock& lock);
+    bool import_legacy(const Lock& lock);
+    bool load(const Lock& lock);
+    bool update(const Lock& lock, const char op, const std::string& accountID);
+
+    explicit AccountRegistry(const std::string& unitID);
+    AccountRegistry() = delete;
+    AccountRegistry(const AccountRegistry&) = delete;
+    AccountRegistry(AccountRegistry&&) = delete;
+    AccountRegistry& operator=(const AccountRegistry&) = delete;
+    AccountRegistry& operator=(AccountRegistry&&) = delete;
+};
+}  // namespace opentxs
+#endif  // OPENTXS_CORE_CONTRACT_ACCOUNTREGISTRY_HPP
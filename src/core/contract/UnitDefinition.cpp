@@ -47,18 +47,18 @@
 #include "opentxs/core/contract/Signable.hpp"
 #include "opentxs/core/contract/basket/BasketContract.hpp"
 #include "opentxs/core/util/Assert.hpp"
-#include "opentxs/core/util/OTFolders.hpp"
 #include "opentxs/core/Account.hpp"
 #include "opentxs/core/AccountVisitor.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/Nym.hpp"
-#include "opentxs/core/OTStorage.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/OT.hpp"
 #include "opentxs/Proto.hpp"
 
+#include "AccountRegistry.hpp"
+
 #include <ctype.h>
 #include <stddef.h>
 #include <cmath>
@@ -71,6 +71,10 @@
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
+
+// Number of accounts handed to an AccountVisitor at a time
+#define OT_ACCOUNT_VISITOR_BATCH 256
 
 #define OT_METHOD "opentxs::UnitDefinition::"
 
@@ -302,91 +306,56 @@ bool UnitDefinition::VisitAccountRecords(AccountVisitor& visitor) const
     Lock lock(lock_);
 
     const String strInstrumentDefinitionID(id(lock));
-    String strAcctRecordFile;
-    strAcctRecordFile.Format("%s.a", strInstrumentDefinitionID.Get());
+    const auto pNotaryID = visitor.GetNotaryID();
+    OT_ASSERT(false == pNotaryID->empty());
+
+    const auto& wallet = OT::App().Wallet();
+    auto cursor =
+        AccountRegistry::Get(strInstrumentDefinitionID.Get()).Iterate();
+    std::vector<std::string> batch{};
+
+    // Accounts are handed to the visitor in batches so that the entire
+    // registry is never loaded at once.
+    while (cursor.Next(batch, OT_ACCOUNT_VISITOR_BATCH)) {
+        std::vector<SharedAccount> loaded{};
+        std::vector<const Account*> accounts{};
+        loaded.reserve(batch.size());
+        accounts.reserve(batch.size());
+
+        for (const auto& str_acct_id : batch) {
+            auto account = wallet.Account(Identifier::Factory(str_acct_id));
+
+            if (false == bool(account)) {
+                otErr << OT_METHOD << __FUNCTION__
+                      << ": Unable to load account " << str_acct_id
+                      << std::endl;
 
-    std::unique_ptr<OTDB::Storable> pStorable(OTDB::QueryObject(
-        OTDB::STORED_OBJ_STRING_MAP,
-        OTFolders::Contract().Get(),
-        strAcctRecordFile.Get()));
+                continue;
+            }
 
-    OTDB::StringMap* pMap = dynamic_cast<OTDB::StringMap*>(pStorable.get());
+            accounts.push_back(&account.get());
+            loaded.emplace_back(std::move(account));
+        }
 
-    // There was definitely a StringMap loaded from local storage.
-    // (Even an empty one, possibly.) This is the only block that matters in
-    // this function.
-    //
-    if (nullptr != pMap) {
-        const auto pNotaryID = visitor.GetNotaryID();
-        OT_ASSERT(false == pNotaryID->empty());
-
-        auto& theMap = pMap->the_map;
-
-        // todo: optimize: will probably have to use a database for this,
-        // std::int64_t term.
-        // (What if there are a million acct IDs in this flat file? Not
-        // scaleable.)
-        //
-        for (auto& it : theMap) {
-            const std::string& str_acct_id =
-                it.first;  // Containing the account ID.
-            const std::string& str_instrument_definition_id =
-                it.second;  // Containing the instrument definition ID. (Just in
-                            // case
-                            // someone copied the wrong file here...)
-
-            if (!strInstrumentDefinitionID.Compare(
-                    str_instrument_definition_id.c_str())) {
-                otErr << "OTUnitDefinition::VisitAccountRecords: Error: wrong "
-                         "instrument definition ID ("
-                      << str_instrument_definition_id
-                      << ") when expecting: " << strInstrumentDefinitionID
-                      << "\n";
-            } else {
-                const auto& wallet = OT::App().Wallet();
-                const auto accountID = Identifier::Factory(str_acct_id);
-                auto account = wallet.Account(accountID);
-
-                if (false == bool(account)) {
-                    otErr << OT_METHOD << __FUNCTION__
-                          << ": Unable to load account " << str_acct_id
-                          << std::endl;
-
-                    continue;
-                }
+        if (accounts.empty()) { continue; }
 
-                if (false == visitor.Trigger(account.get())) {
-                    otErr << OT_METHOD << __FUNCTION__
-                          << ": Error: Trigger failed for account "
-                          << str_acct_id << std::endl;
-                }
-            }
+        if (false == visitor.TriggerBatch(accounts)) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Error: Trigger failed for one or more accounts"
+                  << std::endl;
         }
-        return true;
     }
+
     return true;
 }
 
-bool UnitDefinition::AddAccountRecord(const Account& theAccount) const  // adds
-                                                                        // the
-// account
-// to the
-// list.
-// (When
-// account
-// is
-// created.)
+// adds the account to the list. (When account is created.)
+bool UnitDefinition::AddAccountRecord(const Account& theAccount) const
 {
-    //  Load up account list StringMap. Create it if doesn't already exist.
-    //  See if account is already there in the map. Add it otherwise.
-    //  Save the StringMap back again. (The account records list for a given
-    // instrument definition.)
-
     Lock lock(lock_);
-    const char* szFunc = "OTUnitDefinition::AddAccountRecord";
 
     if (theAccount.GetInstrumentDefinitionID() != id_) {
-        otErr << szFunc
+        otErr << OT_METHOD << __FUNCTION__
               << ": Error: theAccount doesn't have the same asset "
                  "type ID as *this does.\n";
         return false;
@@ -394,185 +363,41 @@ bool UnitDefinition::AddAccountRecord(const Account& theAccount) const  // adds
 
     const auto theAcctID = Identifier::Factory(theAccount);
     const String strAcctID(theAcctID);
-
     const String strInstrumentDefinitionID(id(lock));
-    String strAcctRecordFile;
-    strAcctRecordFile.Format("%s.a", strInstrumentDefinitionID.Get());
-
-    OTDB::Storable* pStorable = nullptr;
-    std::unique_ptr<OTDB::Storable> theAngel;
-    OTDB::StringMap* pMap = nullptr;
-
-    if (OTDB::Exists(
-            OTFolders::Contract().Get(),
-            strAcctRecordFile.Get()))  // the file already exists; let's
-                                       // try to load it up.
-        pStorable = OTDB::QueryObject(
-            OTDB::STORED_OBJ_STRING_MAP,
-            OTFolders::Contract().Get(),
-            strAcctRecordFile.Get());
-    else  // the account records file (for this instrument definition) doesn't
-          // exist.
-        pStorable = OTDB::CreateObject(
-            OTDB::STORED_OBJ_STRING_MAP);  // this asserts already, on failure.
-
-    theAngel.reset(pStorable);
-    pMap = (nullptr == pStorable) ? nullptr
-                                  : dynamic_cast<OTDB::StringMap*>(pStorable);
-
-    // It exists.
-    //
-    if (nullptr == pMap) {
-        otErr << szFunc
-              << ": Error: failed trying to load or create the account records "
-                 "file for instrument definition: "
-              << strInstrumentDefinitionID << "\n";
-        return false;
-    }
 
-    auto& theMap = pMap->the_map;
-    auto map_it = theMap.find(strAcctID.Get());
-
-    if (theMap.end() != map_it)  // we found it.
-    {                            // We were ADDING IT, but it was ALREADY THERE.
-        // (Thus, we're ALREADY DONE.)
-        // Let's just make sure the right instrument definition ID is associated
-        // with this
-        // account
-        // (it better be, since we loaded the account records file based on the
-        // instrument definition ID as its filename...)
-        //
-        const std::string& str2 = map_it->second;  // Containing the instrument
-                                                   // definition ID. (Just in
-                                                   // case
-        // someone copied the wrong file here,
-        // --------------------------------          // every account should map
-        // to the SAME instrument definition id.)
-
-        if (false == strInstrumentDefinitionID.Compare(str2.c_str()))  // should
-                                                                       // never
-        // happen.
-        {
-            otErr << szFunc
-                  << ": Error: wrong instrument definition found in "
-                     "account records "
-                     "file...\n For instrument definition: "
-                  << strInstrumentDefinitionID
-                  << "\n "
-                     "For account: "
-                  << strAcctID
-                  << "\n Found wrong instrument definition: " << str2 << "\n";
-            return false;
-        }
-
-        return true;  // already there (no need to add.) + the instrument
-                      // definition ID
-                      // matches.
-    }
-
-    // it wasn't already on the list...
-
-    // ...so add it.
-    //
-    theMap[strAcctID.Get()] = strInstrumentDefinitionID.Get();
-
-    // Then save it back to local storage:
-    //
-    if (!OTDB::StoreObject(
-            *pMap, OTFolders::Contract().Get(), strAcctRecordFile.Get())) {
-        otErr << szFunc
-              << ": Failed trying to StoreObject, while saving updated "
-                 "account records file for instrument definition: "
+    if (false == AccountRegistry::Get(strInstrumentDefinitionID.Get())
+                     .Add(strAcctID.Get())) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to update account records for instrument "
+                 "definition: "
               << strInstrumentDefinitionID
               << "\n to contain account ID: " << strAcctID << "\n";
         return false;
     }
 
-    // Okay, we saved the updated file, with the account added. (done, success.)
-    //
     return true;
 }
 
-bool UnitDefinition::EraseAccountRecord(
-    const Identifier& theAcctID) const  // removes the account from the list.
-                                        // (When account is deleted.)
+// removes the account from the list. (When account is deleted.)
+bool UnitDefinition::EraseAccountRecord(const Identifier& theAcctID) const
 {
-    //  Load up account list StringMap. Create it if doesn't already exist.
-    //  See if account is already there in the map. Erase it, if it is.
-    //  Save the StringMap back again. (The account records list for a given
-    // instrument definition.)
-
     Lock lock(lock_);
-    const char* szFunc = "OTUnitDefinition::EraseAccountRecord";
 
     const String strAcctID(theAcctID);
-
     const String strInstrumentDefinitionID(id(lock));
-    String strAcctRecordFile;
-    strAcctRecordFile.Format("%s.a", strInstrumentDefinitionID.Get());
-
-    OTDB::Storable* pStorable = nullptr;
-    std::unique_ptr<OTDB::Storable> theAngel;
-    OTDB::StringMap* pMap = nullptr;
-
-    if (OTDB::Exists(
-            OTFolders::Contract().Get(),
-            strAcctRecordFile.Get()))  // the file already exists; let's
-                                       // try to load it up.
-        pStorable = OTDB::QueryObject(
-            OTDB::STORED_OBJ_STRING_MAP,
-            OTFolders::Contract().Get(),
-            strAcctRecordFile.Get());
-    else  // the account records file (for this instrument definition) doesn't
-          // exist.
-        pStorable = OTDB::CreateObject(
-            OTDB::STORED_OBJ_STRING_MAP);  // this asserts already, on failure.
-
-    theAngel.reset(pStorable);
-    pMap = (nullptr == pStorable) ? nullptr
-                                  : dynamic_cast<OTDB::StringMap*>(pStorable);
-
-    // It exists.
-    //
-    if (nullptr == pMap) {
-        otErr << szFunc
-              << ": Error: failed trying to load or create the account records "
-                 "file for instrument definition: "
-              << strInstrumentDefinitionID << "\n";
-        return false;
-    }
 
-    // Before we can erase it, let's see if it's even there....
-    //
-    auto& theMap = pMap->the_map;
-    auto map_it = theMap.find(strAcctID.Get());
-
-    // we found it!
-    if (theMap.end() != map_it)  //  Acct ID was already there...
-    {
-        theMap.erase(map_it);  // remove it
-    }
-
-    // it wasn't already on the list...
-    // (So it's like success, since the end result is, acct ID will not appear
-    // on this list--whether
-    // it was there or not beforehand, it's definitely not there now.)
-
-    // Then save it back to local storage:
-    //
-    if (!OTDB::StoreObject(
-            *pMap, OTFolders::Contract().Get(), strAcctRecordFile.Get())) {
-        otErr << szFunc
-              << ": Failed trying to StoreObject, while saving updated "
-                 "account records file for instrument definition: "
+    // If the account isn't on the list, that's success, since the end result
+    // is the same.
+    if (false == AccountRegistry::Get(strInstrumentDefinitionID.Get())
+                     .Erase(strAcctID.Get())) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to update account records for instrument "
+                 "definition: "
               << strInstrumentDefinitionID
               << "\n to erase account ID: " << strAcctID << "\n";
         return false;
     }
 
-    // Okay, we saved the updated file, with the account removed. (done,
-    // success.)
-    //
     return true;
 }
 
@@ -44,6 +44,8 @@
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/String.hpp"
 
+#include "VerificationCache.hpp"
+
 namespace opentxs
 {
 
@@ -124,7 +126,23 @@ bool CryptoAsymmetric::VerifyContractSignature(
     auto signature = Data::Factory();
     theSignature.GetData(signature);
 
-    return Verify(plaintext, theKey, signature, hashType, pPWData);
+    return VerifyWithCache(plaintext, theKey, signature, hashType, pPWData);
+}
+
+bool CryptoAsymmetric::VerifyWithCache(
+    const Data& plaintext,
+    const OTAsymmetricKey& theKey,
+    const Data& signature,
+    const proto::HashType hashType,
+    const OTPasswordData* pPWData) const
+{
+    if (nullptr == verification_cache_) {
+
+        return Verify(plaintext, theKey, signature, hashType, pPWData);
+    }
+
+    return verification_cache_->Verify(
+        *this, plaintext, theKey, signature, hashType, pPWData);
 }
 
 }  // namespace opentxs
@@ -0,0 +1,128 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "stdafx.hpp"
+
+#include "VerificationCache.hpp"
+
+#include "opentxs/api/crypto/Hash.hpp"
+#include "opentxs/core/crypto/AsymmetricKeyEC.hpp"
+#include "opentxs/core/crypto/CryptoAsymmetric.hpp"
+#include "opentxs/core/crypto/OTAsymmetricKey.hpp"
+#include "opentxs/core/Data.hpp"
+
+namespace opentxs
+{
+VerificationCache::VerificationCache(
+    const api::crypto::Hash& hash,
+    const std::size_t size)
+    : hash_(hash)
+    , verified_(size)
+{
+}
+
+bool VerificationCache::cache_key(
+    const Data& plaintext,
+    const OTAsymmetricKey& key,
+    const Data& signature,
+    const proto::HashType hashType,
+    std::string& output) const
+{
+    const auto* ec = dynamic_cast<const AsymmetricKeyEC*>(&key);
+
+    if (nullptr == ec) { return false; }
+
+    auto publicKey = Data::Factory();
+
+    if (false == ec->GetKey(publicKey)) { return false; }
+
+    auto digest = Data::Factory();
+
+    if (false == hash_.Digest(proto::HASHTYPE_BLAKE2B256, plaintext, digest)) {
+        return false;
+    }
+
+    auto append = [&output](const Data& data) -> void {
+        output.append(
+            static_cast<const char*>(data.GetPointer()), data.GetSize());
+    };
+
+    output.clear();
+    output.reserve(
+        3 + publicKey->GetSize() + digest->GetSize() + signature.GetSize());
+    output.push_back(static_cast<char>(key.keyType()));
+    output.push_back(static_cast<char>(hashType));
+    // Lengths differ between key types, so they are recorded to keep the
+    // concatenation unambiguous
+    output.push_back(static_cast<char>(publicKey->GetSize()));
+    append(publicKey);
+    append(digest);
+    append(signature);
+
+    return true;
+}
+
+api::Crypto::VerificationStats VerificationCache::Stats() const
+{
+    const auto stats = verified_.GetStats();
+
+    return api::Crypto::VerificationStats{
+        stats.hits_, stats.misses_, stats.size_};
+}
+
+bool VerificationCache::Verify(
+    const CryptoAsymmetric& engine,
+    const Data& plaintext,
+    const OTAsymmetricKey& key,
+    const Data& signature,
+    const proto::HashType hashType,
+    const OTPasswordData* pPWData) const
+{
+    std::string id{};
+    const bool cacheable = cache_key(plaintext, key, signature, hashType, id);
+    bool verified{false};
+
+    if (cacheable && verified_.Get(id, verified)) { return verified; }
+
+    verified = engine.Verify(plaintext, key, signature, hashType, pPWData);
+
+    if (cacheable && verified) { verified_.Put(id, true); }
+
+    return verified;
+}
+}  // namespace opentxs
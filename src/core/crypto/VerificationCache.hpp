@@ -0,0 +1,96 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_CORE_CRYPTO_VERIFICATIONCACHE_HPP
+#define OPENTXS_CORE_CRYPTO_VERIFICATIONCACHE_HPP
+
+#include "Internal.hpp"
+
+#include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/Proto.hpp"
+
+#include "util/LRU.hpp"
+
+#include <cstddef>
+#include <string>
+
+namespace opentxs
+{
+/** \brief Bounded record of signatures which have already been verified
+ *
+ *  Entries are keyed by the signer's raw public key, a digest of the signed
+ *  contents, the signature itself, and the hash type. Only successful
+ *  verifications are recorded, so the cache can never turn a failure into a
+ *  success. Keys whose raw public key is not available are verified without
+ *  consulting the cache.
+ */
+class VerificationCache
+{
+public:
+    api::Crypto::VerificationStats Stats() const;
+    bool Verify(
+        const CryptoAsymmetric& engine,
+        const Data& plaintext,
+        const OTAsymmetricKey& key,
+        const Data& signature,
+        const proto::HashType hashType,
+        const OTPasswordData* pPWData) const;
+
+    VerificationCache(const api::crypto::Hash& hash, const std::size_t size);
+
+    ~VerificationCache() = default;
+
+private:
+    const api::crypto::Hash& hash_;
+    mutable LRU<std::string, bool> verified_;
+
+    bool cache_key(
+        const Data& plaintext,
+        const OTAsymmetricKey& key,
+        const Data& signature,
+        const proto::HashType hashType,
+        std::string& output) const;
+
+    VerificationCache() = delete;
+    VerificationCache(const VerificationCache&) = delete;
+    VerificationCache(VerificationCache&&) = delete;
+    VerificationCache& operator=(const VerificationCache&) = delete;
+    VerificationCache& operator=(VerificationCache&&) = delete;
+};
+}  // namespace opentxs
+#endif  // OPENTXS_CORE_CRYPTO_VERIFICATIONCACHE_HPP
@@ -0,0 +1,134 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "stdafx.hpp"
+
+#include "LineReader.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace opentxs
+{
+bool LineReader::View::Contains(const char* text) const
+{
+    const auto length = std::strlen(text);
+
+    if (length > size_) { return false; }
+
+    const auto* end = data_ + size_;
+
+    return end != std::search(data_, end, text, text + length);
+}
+
+bool LineReader::View::StartsWith(const char* text) const
+{
+    const auto length = std::strlen(text);
+
+    if (length > size_) { return false; }
+
+    return 0 == std::memcmp(data_, text, length);
+}
+
+LineReader::LineReader(
+    const char* data,
+    const std::size_t size,
+    const std::size_t maxLine)
+    : position_(data)
+    , end_(data + size)
+    , max_line_(maxLine)
+{
+}
+
+bool LineReader::Next(View& line, bool& more)
+{
+    line = View{};
+
+    if (position_ >= end_) {
+        more = false;
+
+        return false;
+    }
+
+    const auto available = static_cast<std::size_t>(end_ - position_);
+    const auto limit = std::min(available, max_line_);
+    const auto* newline =
+        static_cast<const char*>(std::memchr(position_, '\n', limit));
+
+    if (nullptr == newline) {
+        line = View(position_, limit, false);
+        position_ += limit;
+    } else {
+        line = View(
+            position_, static_cast<std::size_t>(newline - position_), true);
+        position_ = newline + 1;
+    }
+
+    more = (position_ < end_);
+
+    return true;
+}
+
+void LineAccumulator::Add(const LineReader::View& line)
+{
+    if (copied_) {
+        buffer_.append(line.data(), line.length());
+        buffer_ += '\n';
+
+        return;
+    }
+
+    if (nullptr == begin_) {
+        begin_ = line.data();
+        end_ = line.data();
+    }
+
+    if ((line.data() == end_) && line.Terminated()) {
+        end_ = line.data() + line.length() + 1;
+
+        return;
+    }
+
+    // The line is not adjacent to the previous one, or the source buffer does
+    // not contain its newline, so switch to an owned copy
+    copied_ = true;
+    buffer_.assign(begin_, end_);
+    buffer_.append(line.data(), line.length());
+    buffer_ += '\n';
+}
+}  // namespace opentxs
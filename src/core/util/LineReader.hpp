@@ -0,0 +1,146 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_CORE_UTIL_LINEREADER_HPP
+#define OPENTXS_CORE_UTIL_LINEREADER_HPP
+
+#include "Internal.hpp"
+
+#include <cstddef>
+#include <string>
+
+namespace opentxs
+{
+/** \brief Splits a contiguous buffer into lines without copying
+ *
+ *  Produces the same sequence of lines as repeated calls to String::sgets()
+ *  with a buffer of maxLine + 1 bytes, including the splitting of lines
+ *  which are longer than maxLine. The buffer must outlive the reader and
+ *  every View it produces.
+ */
+class LineReader
+{
+public:
+    class View
+    {
+    public:
+        char at(const std::size_t index) const { return data_[index]; }
+        bool Contains(const char* text) const;
+        const char* data() const { return data_; }
+        std::size_t length() const { return size_; }
+        bool StartsWith(const char* text) const;
+        std::string str() const { return std::string(data_, size_); }
+        /** True if the line was terminated by a newline which was consumed */
+        bool Terminated() const { return terminated_; }
+
+        View() = default;
+        View(const char* data, const std::size_t size, const bool terminated)
+            : data_(data)
+            , size_(size)
+            , terminated_(terminated)
+        {
+        }
+        View(const View&) = default;
+        View& operator=(const View&) = default;
+
+        ~View() = default;
+
+    private:
+        const char* data_{nullptr};
+        std::size_t size_{0};
+        bool terminated_{false};
+    };
+
+    /** Reads the next line. Returns false if the input was already consumed.
+     *  more is set to false if this was the last line, matching the return
+     *  value of String::sgets() */
+    bool Next(View& line, bool& more);
+
+    LineReader(
+        const char* data,
+        const std::size_t size,
+        const std::size_t maxLine = 2047);
+
+    ~LineReader() = default;
+
+private:
+    const char* position_{nullptr};
+    const char* const end_{nullptr};
+    const std::size_t max_line_{0};
+
+    LineReader() = delete;
+    LineReader(const LineReader&) = delete;
+    LineReader(LineReader&&) = delete;
+    LineReader& operator=(const LineReader&) = delete;
+    LineReader& operator=(LineReader&&) = delete;
+};
+
+/** \brief Collects a sequence of lines, each followed by a newline
+ *
+ *  As long as the lines are adjacent in the source buffer the result is a
+ *  view of that buffer. A copy is only made when a line is not adjacent to
+ *  the previous one.
+ */
+class LineAccumulator
+{
+public:
+    void Add(const LineReader::View& line);
+    bool empty() const { return (false == copied_) && (begin_ == end_); }
+    const char* data() const { return copied_ ? buffer_.data() : begin_; }
+    std::size_t size() const
+    {
+        return copied_ ? buffer_.size()
+                       : static_cast<std::size_t>(end_ - begin_);
+    }
+
+    LineAccumulator() = default;
+    ~LineAccumulator() = default;
+
+private:
+    const char* begin_{nullptr};
+    const char* end_{nullptr};
+    bool copied_{false};
+    std::string buffer_{};
+
+    LineAccumulator(const LineAccumulator&) = delete;
+    LineAccumulator(LineAccumulator&&) = delete;
+    LineAccumulator& operator=(const LineAccumulator&) = delete;
+    LineAccumulator& operator=(LineAccumulator&&) = delete;
+};
+}  // namespace opentxs
+#endif  // OPENTXS_CORE_UTIL_LINEREADER_HPP
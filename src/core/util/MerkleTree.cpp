@@ -0,0 +1,213 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "stdafx.hpp"
+
+#include "MerkleTree.hpp"
+
+#include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
+#include "opentxs/api/Native.hpp"
+#include "opentxs/core/util/Assert.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/OT.hpp"
+
+#include <iterator>
+
+#define OT_MERKLE_LEAF_PREFIX '\x00'
+#define OT_MERKLE_NODE_PREFIX '\x01'
+
+#define OT_METHOD "opentxs::MerkleTree::"
+
+namespace opentxs
+{
+const std::size_t MerkleTree::HashSize{32};
+const std::uint8_t MerkleTree::depth_{64};
+
+std::uint64_t MerkleTree::base(
+    const std::uint64_t key,
+    const std::uint8_t depth)
+{
+    OT_ASSERT(depth_ >= depth);
+
+    if (0 == depth) { return 0; }
+
+    return key & (~std::uint64_t(0) << (depth_ - depth));
+}
+
+void MerkleTree::Clear()
+{
+    leaves_.clear();
+    nodes_.clear();
+}
+
+bool MerkleTree::hash(
+    const char prefix,
+    const std::string& preimage,
+    std::string& output)
+{
+    auto input = Data::Factory(&prefix, sizeof(prefix));
+    input->Concatenate(preimage.data(), preimage.size());
+    auto digest = Data::Factory();
+    const bool hashed = OT::App().Crypto().Hash().Digest(
+        proto::HASHTYPE_BLAKE2B256, input, digest);
+
+    if ((false == hashed) || (HashSize != digest->GetSize())) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to hash node"
+              << std::endl;
+
+        return false;
+    }
+
+    output.assign(
+        static_cast<const char*>(digest->GetPointer()), digest->GetSize());
+
+    return true;
+}
+
+void MerkleTree::invalidate(const std::uint64_t key)
+{
+    for (std::uint8_t depth = 0; depth < depth_; ++depth) {
+        nodes_.erase({depth, base(key, depth)});
+    }
+}
+
+bool MerkleTree::Node(
+    const std::uint8_t depth,
+    const std::uint64_t prefix,
+    std::string& output)
+{
+    OT_ASSERT(depth_ >= depth);
+
+    if (0 == depth) {
+        return node(depth, 0, leaves_.begin(), leaves_.end(), output);
+    }
+
+    const auto shift = depth_ - depth;
+    const auto first = prefix << shift;
+    const auto last = first | ~(~std::uint64_t(0) << shift);
+
+    return node(
+        depth,
+        first,
+        leaves_.lower_bound(first),
+        leaves_.upper_bound(last),
+        output);
+}
+
+bool MerkleTree::node(
+    const std::uint8_t depth,
+    const std::uint64_t base,
+    const Leaves::const_iterator first,
+    const Leaves::const_iterator last,
+    std::string& output)
+{
+    if (first == last) {
+        output.assign(HashSize, '\0');
+
+        return true;
+    }
+
+    if (std::next(first) == last) {
+        output = first->second;
+
+        return true;
+    }
+
+    // Two distinct keys always diverge above the leaves
+    OT_ASSERT(depth_ > depth);
+
+    const auto cached = nodes_.find({depth, base});
+
+    if (nodes_.end() != cached) {
+        output = cached->second;
+
+        return true;
+    }
+
+    const std::uint8_t child = depth + 1;
+    const auto right = base | (std::uint64_t(1) << (depth_ - child));
+    const auto split = leaves_.lower_bound(right);
+
+    if (first == split) { return node(child, right, split, last, output); }
+
+    if (last == split) { return node(child, base, first, split, output); }
+
+    std::string lhs{}, rhs{};
+
+    if (false == node(child, base, first, split, lhs)) { return false; }
+
+    if (false == node(child, right, split, last, rhs)) { return false; }
+
+    if (false == hash(OT_MERKLE_NODE_PREFIX, lhs + rhs, output)) {
+        return false;
+    }
+
+    nodes_.emplace(NodeID{depth, base}, output);
+
+    return true;
+}
+
+void MerkleTree::Remove(const std::uint64_t key)
+{
+    if (0 == leaves_.erase(key)) { return; }
+
+    invalidate(key);
+}
+
+bool MerkleTree::Set(const std::uint64_t key, const std::string& preimage)
+{
+    std::string encoded(sizeof(key), '\0');
+
+    for (std::size_t i = 0; i < sizeof(key); ++i) {
+        encoded[i] = static_cast<char>(key >> (8 * (sizeof(key) - 1 - i)));
+    }
+
+    std::string leaf{};
+
+    if (false == hash(OT_MERKLE_LEAF_PREFIX, encoded + preimage, leaf)) {
+        return false;
+    }
+
+    leaves_[key] = leaf;
+    invalidate(key);
+
+    return true;
+}
+}  // namespace opentxs
@@ -0,0 +1,119 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_CORE_UTIL_MERKLETREE_HPP
+#define OPENTXS_CORE_UTIL_MERKLETREE_HPP
+
+#include "Internal.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace opentxs
+{
+/** \brief Compressed sparse Merkle tree over 64 bit keys
+ *
+ *  Each key has a fixed position in a binary tree of depth 64, so the root
+ *  does not depend on the order in which leaves were added. A subtree which
+ *  holds a single leaf hashes to that leaf, and a subtree with one empty side
+ *  hashes to the other side, so building a tree of n leaves costs 2n - 1
+ *  hashes. Interior nodes are cached, and setting or removing a leaf only
+ *  invalidates the nodes on its path.
+ *
+ *  Leaves commit to their key, and leaves and interior nodes are hashed with
+ *  distinct prefixes so that an interior node can not be presented as a
+ *  leaf. An empty tree hashes to HashSize zero bytes.
+ */
+class MerkleTree
+{
+public:
+    static const std::size_t HashSize;
+
+    void Clear();
+    bool Empty() const { return leaves_.empty(); }
+    /** Hash of the subtree containing every key whose most significant
+     *  depth bits equal prefix. Depth 0 is the root and depth 64 a leaf. */
+    bool Node(
+        const std::uint8_t depth,
+        const std::uint64_t prefix,
+        std::string& output);
+    void Remove(const std::uint64_t key);
+    bool Root(std::string& output) { return Node(0, 0, output); }
+    /** Sets the leaf for key to the hash of the key and preimage */
+    bool Set(const std::uint64_t key, const std::string& preimage);
+
+    MerkleTree() = default;
+    ~MerkleTree() = default;
+
+private:
+    using Leaves = std::map<std::uint64_t, std::string>;
+    // depth, lowest key in the subtree
+    using NodeID = std::pair<std::uint8_t, std::uint64_t>;
+
+    static const std::uint8_t depth_;
+
+    Leaves leaves_{};
+    // Only nodes with leaves on both sides are cached
+    std::map<NodeID, std::string> nodes_{};
+
+    static std::uint64_t base(
+        const std::uint64_t key,
+        const std::uint8_t depth);
+    static bool hash(
+        const char prefix,
+        const std::string& preimage,
+        std::string& output);
+
+    void invalidate(const std::uint64_t key);
+    bool node(
+        const std::uint8_t depth,
+        const std::uint64_t base,
+        const Leaves::const_iterator first,
+        const Leaves::const_iterator last,
+        std::string& output);
+
+    MerkleTree(const MerkleTree&) = delete;
+    MerkleTree(MerkleTree&&) = delete;
+    MerkleTree& operator=(const MerkleTree&) = delete;
+    MerkleTree& operator=(MerkleTree&&) = delete;
+};
+}  // namespace opentxs
+#endif  // OPENTXS_CORE_UTIL_MERKLETREE_HPP
@@ -49,6 +49,7 @@
 #include "opentxs/core/Lockable.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/Message.hpp"
+#include "opentxs/core/Nym.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
 #include "opentxs/network/zeromq/FrameIterator.hpp"
@@ -76,6 +77,9 @@ template class opentxs::Pimpl<opentxs::network::ServerConnection>;
 
 namespace opentxs::network
 {
+const std::string ServerConnection::ArmoredFormat{"armored"};
+const std::string ServerConnection::BinaryFormat{"binary"};
+
 OTServerConnection ServerConnection::Factory(
     const api::network::ZMQ& zmq,
     const std::string& serverID)
@@ -100,6 +104,7 @@ ServerConnection::ServerConnection(
     , socket_ready_(Flag::Factory(false))
     , status_(Flag::Factory(false))
     , use_proxy_(Flag::Factory(false))
+    , binary_(Flag::Factory(false))
 {
     thread_.reset(new std::thread(&ServerConnection::activity_timer, this));
 
@@ -181,27 +186,43 @@ void ServerConnection::reset_timer()
 }
 
 NetworkReplyRaw ServerConnection::Send(const std::string& input)
+{
+    std::string notUsed{};
+
+    return send(input, "", notUsed);
+}
+
+NetworkReplyRaw ServerConnection::send(
+    const std::string& input,
+    const std::string& format,
+    std::string& replyFormat)
 {
     Lock lock(lock_);
     NetworkReplyRaw output{SendResult::ERROR, nullptr};
     auto& status = output.first;
     auto& reply = output.second;
     reply.reset(new std::string);
+    replyFormat.clear();
 
     OT_ASSERT(reply);
 
-    auto result =
-        get_socket(lock).SendRequest(network::zeromq::Message::Factory(input));
+    auto request = network::zeromq::Message::Factory(input);
+
+    if (false == format.empty()) { request->AddFrame(format); }
+
+    auto result = get_socket(lock).SendRequest(request);
     status = result.first;
     network::zeromq::Message& message = result.second;
 
     switch (status) {
         case SendResult::ERROR: {
             status_->Off();
+            binary_->Off();
             reset_socket(lock);
         } break;
         case SendResult::TIMEOUT: {
             status_->Off();
+            binary_->Off();
             reset_socket(lock);
         } break;
         case SendResult::VALID_REPLY: {
@@ -209,9 +230,15 @@ NetworkReplyRaw ServerConnection::Send(const std::string& input)
             reset_timer();
 
             if (0 < input.size()) {
-                OT_ASSERT(1 == message.Body().size());
+                const auto frames = message.Body().size();
+
+                OT_ASSERT((1 == frames) || (2 == frames));
 
                 reply.reset(new std::string(*message.Body().begin()));
+
+                if (2 == frames) {
+                    replyFormat = std::string(message.Body_at(1));
+                }
             }
 
             OT_ASSERT(reply);
@@ -236,10 +263,15 @@ NetworkReplyString ServerConnection::Send(const String& message)
 
     if (!envelope.Exists()) { return output; }
 
-    auto rawOutput = Send(std::string(envelope.Get()));
+    std::string replyFormat{};
+    auto rawOutput =
+        send(std::string(envelope.Get()), ArmoredFormat, replyFormat);
     status = rawOutput.first;
 
     if (SendResult::VALID_REPLY == status) {
+        // Servers which do not understand the format frame reply with a
+        // single frame
+        binary_->Set(ArmoredFormat == replyFormat);
         OTASCIIArmor armored;
         armored.Set(rawOutput.second->c_str());
 
@@ -254,8 +286,19 @@ NetworkReplyString ServerConnection::Send(const String& message)
     return output;
 }
 
-NetworkReplyMessage ServerConnection::Send(const Message& message)
+NetworkReplyMessage ServerConnection::Send(
+    const Message& message,
+    const Nym& signer)
 {
+    const bool binary =
+        binary_.get() &&
+        Message::BinaryFormatAllowed(
+            Message::Type(message.m_strCommand.Get())) &&
+        (signer.ID().str() == message.m_strNymID.Get()) &&
+        signer.HasCapability(NymCapability::AUTHENTICATE_CONNECTION);
+
+    if (binary) { return send_binary(message, signer); }
+
     NetworkReplyMessage output{SendResult::ERROR, nullptr};
     auto& status = output.first;
     auto& reply = output.second;
@@ -280,6 +323,44 @@ NetworkReplyMessage ServerConnection::Send(const Message& message)
     return output;
 }
 
+NetworkReplyMessage ServerConnection::send_binary(
+    const Message& message,
+    const Nym& signer)
+{
+    NetworkReplyMessage output{SendResult::ERROR, nullptr};
+    auto& status = output.first;
+    auto& reply = output.second;
+    reply.reset(new Message);
+
+    OT_ASSERT(reply);
+
+    std::string input{};
+
+    if (false == message.SaveBinary(signer, input)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to serialize message."
+              << std::endl;
+
+        return output;
+    }
+
+    std::string replyFormat{};
+    auto rawOutput = send(input, BinaryFormat, replyFormat);
+    status = rawOutput.first;
+
+    if (SendResult::VALID_REPLY == status) {
+        if ((BinaryFormat != replyFormat) ||
+            (false == reply->LoadBinary(*rawOutput.second))) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Received server reply, "
+                  << "but unable to instantiate it as a Message." << std::endl;
+            binary_->Off();
+            reply.reset();
+            status = SendResult::INVALID_REPLY;
+        }
+    }
+
+    return output;
+}
+
 void ServerConnection::set_curve(
     const Lock& lock,
     zeromq::RequestSocket& socket) const
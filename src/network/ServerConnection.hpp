@@ -52,7 +52,8 @@ public:
     bool EnableProxy() override;
     NetworkReplyRaw Send(const std::string& message) override;
     NetworkReplyString Send(const String& message) override;
-    NetworkReplyMessage Send(const Message& message) override;
+    NetworkReplyMessage Send(const Message& message, const Nym& signer)
+        override;
     bool Status() const override;
 
     ~ServerConnection();
@@ -70,6 +71,7 @@ private:
     OTFlag socket_ready_;
     OTFlag status_;
     OTFlag use_proxy_;
+    OTFlag binary_;
 
     ServerConnection* clone() const override { return nullptr; }
     std::string endpoint() const;
@@ -82,6 +84,11 @@ private:
     zeromq::RequestSocket& get_socket(const Lock& lock);
     void reset_socket(const Lock& lock);
     void reset_timer();
+    NetworkReplyRaw send(
+        const std::string& message,
+        const std::string& format,
+        std::string& replyFormat);
+    NetworkReplyMessage send_binary(const Message& message, const Nym& signer);
 
     ServerConnection(
         const opentxs::api::network::ZMQ& zmq,
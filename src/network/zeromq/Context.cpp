@@ -50,10 +50,13 @@
 #include "opentxs/network/zeromq/RequestSocket.hpp"
 #include "opentxs/network/zeromq/SubscribeSocket.hpp"
 
+#include "Metrics.hpp"
 #include "PairEventListener.hpp"
 
 #include <zmq.h>
 
+#define OT_METHOD "opentxs::network::zeromq::implementation::Context::"
+
 template class opentxs::Pimpl<opentxs::network::zeromq::Context>;
 
 namespace opentxs::network::zeromq
@@ -68,7 +71,11 @@ namespace opentxs::network::zeromq::implementation
 {
 Context::Context()
     : context_(zmq_ctx_new())
+    , metrics_(std::make_shared<Metrics>())
+    , publisher_lock_()
+    , publisher_(nullptr)
 {
+    OT_ASSERT(metrics_);
     OT_ASSERT(nullptr != context_);
     OT_ASSERT(1 == zmq_has("curve"));
 }
@@ -77,6 +84,8 @@ Context::operator void*() const { return context_; }
 
 Context* Context::clone() const { return new Context; }
 
+std::string Context::DumpMetrics() const { return metrics_->Text(); }
+
 OTZMQSubscribeSocket Context::PairEventListener(
     const PairEventCallback& callback) const
 {
@@ -110,6 +119,27 @@ OTZMQProxy Context::Proxy(
     return opentxs::network::zeromq::Proxy::Factory(*this, frontend, backend);
 }
 
+bool Context::PublishMetrics() const
+{
+    Lock lock(publisher_lock_);
+
+    if (false == bool(publisher_)) {
+        publisher_.reset(new OTZMQPublishSocket(PublishSocket()));
+
+        OT_ASSERT(publisher_);
+
+        if (false == publisher_->get().Start(zeromq::Socket::MetricsEndpoint)) {
+            otErr << OT_METHOD << __FUNCTION__
+                  << ": Failed to bind metrics endpoint" << std::endl;
+            publisher_.reset();
+
+            return false;
+        }
+    }
+
+    return publisher_->get().Publish(DumpMetrics());
+}
+
 OTZMQPublishSocket Context::PublishSocket() const
 {
     return PublishSocket::Factory(*this);
@@ -150,6 +180,8 @@ OTZMQSubscribeSocket Context::SubscribeSocket(
 
 Context::~Context()
 {
+    publisher_.reset();
+
     if (nullptr != context_) { zmq_ctx_shutdown(context_); }
 }
 }  // namespace opentxs::network::zeromq::implementation
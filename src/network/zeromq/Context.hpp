@@ -43,6 +43,9 @@
 
 #include "opentxs/network/zeromq/Context.hpp"
 
+#include <memory>
+#include <mutex>
+
 namespace opentxs::network::zeromq::implementation
 {
 class Context : virtual public zeromq::Context
@@ -50,6 +53,7 @@ class Context : virtual public zeromq::Context
 public:
     operator void*() const override;
 
+    std::string DumpMetrics() const override;
     OTZMQSubscribeSocket PairEventListener(
         const PairEventCallback& callback) const override;
     OTZMQPairSocket PairSocket(const opentxs::network::zeromq::ListenCallback&
@@ -63,6 +67,7 @@ public:
     OTZMQProxy Proxy(
         network::zeromq::Socket& frontend,
         network::zeromq::Socket& backend) const override;
+    bool PublishMetrics() const override;
     OTZMQPublishSocket PublishSocket() const override;
     OTZMQPullSocket PullSocket(const bool client) const override;
     OTZMQPullSocket PullSocket(
@@ -74,12 +79,17 @@ public:
     OTZMQSubscribeSocket SubscribeSocket(
         const ListenCallback& callback) const override;
 
+    std::shared_ptr<Metrics> metrics() const { return metrics_; }
+
     ~Context();
 
 private:
     friend network::zeromq::Context;
 
     void* context_{nullptr};
+    const std::shared_ptr<Metrics> metrics_;
+    mutable std::mutex publisher_lock_;
+    mutable std::unique_ptr<OTZMQPublishSocket> publisher_{nullptr};
 
     Context* clone() const override;
 
@@ -0,0 +1,259 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "stdafx.hpp"
+
+#include "opentxs/core/Log.hpp"
+
+#include "Metrics.hpp"
+
+#include <zmq.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <sstream>
+
+#define OT_METHOD "opentxs::network::zeromq::implementation::Metrics::"
+
+namespace opentxs::network::zeromq::implementation
+{
+static std::string socket_type(const SocketType type)
+{
+    switch (type) {
+        case SocketType::Request: {
+            return "request";
+        }
+        case SocketType::Reply: {
+            return "reply";
+        }
+        case SocketType::Publish: {
+            return "publish";
+        }
+        case SocketType::Subscribe: {
+            return "subscribe";
+        }
+        case SocketType::Push: {
+            return "push";
+        }
+        case SocketType::Pull: {
+            return "pull";
+        }
+        case SocketType::Pair: {
+            return "pair";
+        }
+        default: {
+            return "error";
+        }
+    }
+}
+
+SocketMetrics::SocketMetrics(const std::uint64_t id, const std::string& name)
+    : id_(id)
+    , name_(name)
+{
+}
+
+void SocketMetrics::Callback(const std::chrono::microseconds& duration)
+{
+    const auto micros = static_cast<std::uint64_t>(
+        std::max<std::chrono::microseconds::rep>(duration.count(), 0));
+    std::size_t bucket{0};
+
+    while ((bucket < (Buckets - 1)) &&
+           ((std::uint64_t(1) << bucket) < micros)) {
+        ++bucket;
+    }
+
+    callback_[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+void SocketMetrics::Connect(const bool success)
+{
+    if (success) {
+        connects_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        connect_errors_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void SocketMetrics::Merge(const SocketMetrics& rhs)
+{
+    const auto add = [](std::atomic<std::uint64_t>& lhs,
+                        const std::atomic<std::uint64_t>& value) {
+        lhs.fetch_add(value.load(), std::memory_order_relaxed);
+    };
+
+    add(messages_in_, rhs.messages_in_);
+    add(messages_out_, rhs.messages_out_);
+    add(bytes_in_, rhs.bytes_in_);
+    add(bytes_out_, rhs.bytes_out_);
+    add(send_errors_, rhs.send_errors_);
+    add(send_timeouts_, rhs.send_timeouts_);
+    add(receive_errors_, rhs.receive_errors_);
+    add(receive_timeouts_, rhs.receive_timeouts_);
+    add(connects_, rhs.connects_);
+    add(connect_errors_, rhs.connect_errors_);
+
+    for (std::size_t i = 0; i < Buckets; ++i) {
+        add(callback_[i], rhs.callback_[i]);
+    }
+}
+
+void SocketMetrics::ReceiveError()
+{
+    receive_errors_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SocketMetrics::ReceiveTimeout()
+{
+    receive_timeouts_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SocketMetrics::Received(const std::size_t bytes)
+{
+    messages_in_.fetch_add(1, std::memory_order_relaxed);
+    bytes_in_.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void SocketMetrics::SendFailed(const int error)
+{
+    if (EAGAIN == error) {
+        send_timeouts_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        send_errors_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void SocketMetrics::Sent(const std::size_t bytes)
+{
+    messages_out_.fetch_add(1, std::memory_order_relaxed);
+    bytes_out_.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+std::string SocketMetrics::Text() const
+{
+    std::stringstream output{};
+    output << name_ << " messages_in=" << messages_in_.load()
+           << " bytes_in=" << bytes_in_.load()
+           << " messages_out=" << messages_out_.load()
+           << " bytes_out=" << bytes_out_.load()
+           << " send_errors=" << send_errors_.load()
+           << " send_timeouts=" << send_timeouts_.load()
+           << " receive_errors=" << receive_errors_.load()
+           << " receive_timeouts=" << receive_timeouts_.load()
+           << " connects=" << connects_.load()
+           << " connect_errors=" << connect_errors_.load() << " callback_us={";
+    bool first{true};
+
+    for (std::size_t i = 0; i < Buckets; ++i) {
+        const auto count = callback_[i].load();
+
+        if (0 == count) { continue; }
+
+        if (false == first) { output << ","; }
+
+        first = false;
+
+        if (i < (Buckets - 1)) {
+            output << "le" << (std::uint64_t(1) << i);
+        } else {
+            output << "inf";
+        }
+
+        output << ":" << count;
+    }
+
+    output << "}";
+
+    return output.str();
+}
+
+std::shared_ptr<SocketMetrics> Metrics::Register(const SocketType type)
+{
+    return Register(socket_type(type));
+}
+
+std::shared_ptr<SocketMetrics> Metrics::Register(const std::string& name)
+{
+    Lock lock(lock_);
+    const auto id = ++next_id_;
+    auto output = std::make_shared<SocketMetrics>(id, name);
+    live_[id] = output;
+
+    return output;
+}
+
+void Metrics::Retire(const SocketMetrics& metrics)
+{
+    Lock lock(lock_);
+    auto& total = retired_[metrics.name_];
+
+    if (false == bool(total)) {
+        total.reset(new SocketMetrics(0, metrics.name_));
+    }
+
+    OT_ASSERT(total)
+
+    total->Merge(metrics);
+    live_.erase(metrics.id_);
+}
+
+std::string Metrics::Text() const
+{
+    std::stringstream output{};
+    Lock lock(lock_);
+
+    for (const auto& [id, weak] : live_) {
+        const auto metrics = weak.lock();
+
+        if (false == bool(metrics)) { continue; }
+
+        output << "socket " << id << " " << metrics->Text() << "\n";
+    }
+
+    for (const auto& it : retired_) {
+        const auto& total = it.second;
+
+        OT_ASSERT(total)
+
+        output << "retired " << total->Text() << "\n";
+    }
+
+    return output.str();
+}
+}  // namespace opentxs::network::zeromq::implementation
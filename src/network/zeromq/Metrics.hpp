@@ -0,0 +1,137 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_NETWORK_ZEROMQ_IMPLEMENTATION_METRICS_HPP
+#define OPENTXS_NETWORK_ZEROMQ_IMPLEMENTATION_METRICS_HPP
+
+#include "Internal.hpp"
+
+#include "opentxs/Types.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace opentxs::network::zeromq::implementation
+{
+/** Counters for a single socket, or for the traffic forwarded by a Proxy
+ *
+ *  All recording methods are lock-free and may be called from the send path
+ *  and the receiver thread concurrently. Callback durations are kept in a
+ *  histogram with power of two microsecond buckets; the last bucket counts
+ *  everything slower than the largest bound.
+ */
+class SocketMetrics
+{
+public:
+    static const std::size_t Buckets{22};
+
+    const std::uint64_t id_;
+    const std::string name_;
+
+    void Callback(const std::chrono::microseconds& duration);
+    void Connect(const bool success);
+    void Merge(const SocketMetrics& rhs);
+    void ReceiveError();
+    void ReceiveTimeout();
+    void Received(const std::size_t bytes);
+    void SendFailed(const int error);
+    void Sent(const std::size_t bytes);
+    std::string Text() const;
+
+    SocketMetrics(const std::uint64_t id, const std::string& name);
+
+    ~SocketMetrics() = default;
+
+private:
+    std::atomic<std::uint64_t> messages_in_{0};
+    std::atomic<std::uint64_t> messages_out_{0};
+    std::atomic<std::uint64_t> bytes_in_{0};
+    std::atomic<std::uint64_t> bytes_out_{0};
+    std::atomic<std::uint64_t> send_errors_{0};
+    std::atomic<std::uint64_t> send_timeouts_{0};
+    std::atomic<std::uint64_t> receive_errors_{0};
+    std::atomic<std::uint64_t> receive_timeouts_{0};
+    std::atomic<std::uint64_t> connects_{0};
+    std::atomic<std::uint64_t> connect_errors_{0};
+    std::array<std::atomic<std::uint64_t>, Buckets> callback_{};
+
+    SocketMetrics() = delete;
+    SocketMetrics(const SocketMetrics&) = delete;
+    SocketMetrics(SocketMetrics&&) = delete;
+    SocketMetrics& operator=(const SocketMetrics&) = delete;
+    SocketMetrics& operator=(SocketMetrics&&) = delete;
+};
+
+/** Registry of every socket created by a Context
+ *
+ *  Sockets register on construction and retire on destruction. Counters of
+ *  retired sockets are folded into a per-name total so that a snapshot
+ *  accounts for all traffic since the Context was created. Sockets are named
+ *  after their type; other sources of traffic register under their own name.
+ */
+class Metrics
+{
+public:
+    std::shared_ptr<SocketMetrics> Register(const SocketType type);
+    std::shared_ptr<SocketMetrics> Register(const std::string& name);
+    void Retire(const SocketMetrics& metrics);
+    std::string Text() const;
+
+    Metrics() = default;
+
+    ~Metrics() = default;
+
+private:
+    mutable std::mutex lock_;
+    std::uint64_t next_id_{0};
+    std::map<std::uint64_t, std::weak_ptr<SocketMetrics>> live_;
+    std::map<std::string, std::unique_ptr<SocketMetrics>> retired_;
+
+    Metrics(const Metrics&) = delete;
+    Metrics(Metrics&&) = delete;
+    Metrics& operator=(const Metrics&) = delete;
+    Metrics& operator=(Metrics&&) = delete;
+};
+}  // namespace opentxs::network::zeromq::implementation
+#endif  // OPENTXS_NETWORK_ZEROMQ_IMPLEMENTATION_METRICS_HPP
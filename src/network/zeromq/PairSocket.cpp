@@ -88,7 +88,7 @@ PairSocket::PairSocket(
     const bool listener,
     const bool startThread)
     : ot_super(context, SocketType::Pair)
-    , Receiver(lock_, socket_, startThread)
+    , Receiver(lock_, socket_, *metrics_, startThread)
     , callback_(callback)
     , endpoint_(endpoint)
     , bind_(listener)
@@ -170,17 +170,7 @@ bool PairSocket::Send(const opentxs::Data& data) const
 bool PairSocket::Send(zeromq::Message& data) const
 {
     Lock lock(lock_);
-    bool sent{true};
-    const auto parts = data.size();
-    std::size_t counter{0};
-
-    for (auto& frame : data) {
-        int flags{0};
-
-        if (++counter < parts) { flags = ZMQ_SNDMORE; }
-
-        sent |= (-1 != zmq_msg_send(frame, socket_, flags));
-    }
+    const bool sent = send_message(lock, data);
 
     if (false == sent) {
         otErr << OT_METHOD << __FUNCTION__ << ": Send error:\n"
@@ -43,9 +43,15 @@
 
 #include "opentxs/core/Log.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/Frame.hpp"
+#include "opentxs/network/zeromq/FrameIterator.hpp"
 #include "opentxs/network/zeromq/ListenCallback.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/Socket.hpp"
 
+#include "Context.hpp"
+#include "Metrics.hpp"
+
 #include <zmq.h>
 
 template class opentxs::Pimpl<opentxs::network::zeromq::Proxy>;
@@ -72,12 +78,23 @@ Proxy::Proxy(
     : context_(context)
     , frontend_(frontend)
     , backend_(backend)
+    , registry_(
+          dynamic_cast<const implementation::Context&>(context).metrics())
+    , metrics_(registry_->Register("proxy"))
     , null_callback_(opentxs::network::zeromq::ListenCallback::Factory(
           [](const zeromq::Message&) -> void {}))
+    , capture_callback_(opentxs::network::zeromq::ListenCallback::Factory(
+          [this](const zeromq::Message& message) -> void {
+              this->capture(message);
+          }))
     , control_listener_(new PairSocket(context, null_callback_, false))
     , control_sender_(new PairSocket(null_callback_, control_listener_, false))
+    , capture_listener_(new PairSocket(context, capture_callback_, true))
+    , capture_sender_(new PairSocket(null_callback_, capture_listener_, false))
     , thread_(nullptr)
 {
+    OT_ASSERT(metrics_)
+
     thread_.reset(new std::thread(&Proxy::proxy, this));
 
     OT_ASSERT(thread_)
@@ -85,9 +102,21 @@ Proxy::Proxy(
 
 Proxy* Proxy::clone() const { return new Proxy(context_, frontend_, backend_); }
 
+// zmq_proxy copies every message it forwards, in either direction, to the
+// capture socket. The copies are counted as received by the proxy.
+void Proxy::capture(const zeromq::Message& message) const
+{
+    std::size_t bytes{0};
+
+    for (const auto& frame : message) { bytes += frame.size(); }
+
+    metrics_->Received(bytes);
+}
+
 void Proxy::proxy() const
 {
-    zmq_proxy_steerable(frontend_, backend_, nullptr, nullptr);
+    zmq_proxy_steerable(
+        frontend_, backend_, capture_sender_.get(), control_listener_.get());
 }
 
 Proxy::~Proxy()
@@ -95,5 +124,7 @@ Proxy::~Proxy()
     control_sender_->Send("TERMINATE");
 
     if (thread_ && thread_->joinable()) { thread_->join(); }
+
+    registry_->Retire(*metrics_);
 }
 }  // namespace opentxs::network::zeromq::implementation
@@ -59,12 +59,18 @@ private:
     const zeromq::Context& context_;
     zeromq::Socket& frontend_;
     zeromq::Socket& backend_;
+    const std::shared_ptr<Metrics> registry_;
+    const std::shared_ptr<SocketMetrics> metrics_;
     OTZMQListenCallback null_callback_;
+    OTZMQListenCallback capture_callback_;
     OTZMQPairSocket control_listener_;
     OTZMQPairSocket control_sender_;
+    OTZMQPairSocket capture_listener_;
+    OTZMQPairSocket capture_sender_;
     std::unique_ptr<std::thread> thread_{nullptr};
 
     Proxy* clone() const override;
+    void capture(const zeromq::Message& message) const;
     void proxy() const;
 
     Proxy(
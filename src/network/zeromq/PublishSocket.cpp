@@ -81,17 +81,7 @@ bool PublishSocket::Publish(const opentxs::Data& data) const
 bool PublishSocket::Publish(zeromq::Message& data) const
 {
     Lock lock(lock_);
-    bool sent{true};
-    const auto parts = data.size();
-    std::size_t counter{0};
-
-    for (auto& frame : data) {
-        int flags{0};
-
-        if (++counter < parts) { flags = ZMQ_SNDMORE; }
-
-        sent |= (-1 != zmq_msg_send(frame, socket_, flags));
-    }
+    const bool sent = send_message(lock, data);
 
     if (false == sent) {
         otErr << OT_METHOD << __FUNCTION__ << ": Send error:\n"
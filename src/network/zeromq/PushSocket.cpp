@@ -83,17 +83,7 @@ bool PushSocket::Push(const opentxs::Data& data) const
 bool PushSocket::Push(zeromq::Message& data) const
 {
     Lock lock(lock_);
-    bool sent{true};
-    const auto parts = data.size();
-    std::size_t counter{0};
-
-    for (auto& frame : data) {
-        int flags{0};
-
-        if (++counter < parts) { flags = ZMQ_SNDMORE; }
-
-        sent |= (-1 != zmq_msg_send(frame, socket_, flags));
-    }
+    const bool sent = send_message(lock, data);
 
     if (false == sent) {
         otErr << OT_METHOD << __FUNCTION__ << ": Send error:\n"
@@ -43,8 +43,10 @@
 #include "opentxs/network/zeromq/Frame.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
 
+#include <chrono>
 #include <zmq.h>
 #include "Message.hpp"
+#include "Metrics.hpp"
 
 #define CALLBACK_WAIT_MILLISECONDS 50
 #define POLL_MILLISECONDS 1000
@@ -53,9 +55,14 @@
 
 namespace opentxs::network::zeromq::implementation
 {
-Receiver::Receiver(std::mutex& lock, void* socket, const bool startThread)
+Receiver::Receiver(
+    std::mutex& lock,
+    void* socket,
+    SocketMetrics& metrics,
+    const bool startThread)
     : receiver_lock_(lock)
     , receiver_socket_(socket)
+    , receiver_metrics_(metrics)
     , receiver_run_(Flag::Factory(true))
     , receiver_thread_(nullptr)
 {
@@ -93,6 +100,7 @@ void Receiver::thread()
 
         if (-1 == events) {
             const auto error = zmq_errno();
+            receiver_metrics_.ReceiveError();
             otErr << OT_METHOD << __FUNCTION__
                   << ": Poll error: " << zmq_strerror(error) << std::endl;
 
@@ -105,13 +113,15 @@ void Receiver::thread()
         auto reply = Message::Factory();
 
         bool receiving{true};
+        std::size_t bytes{0};
 
         while (receiving) {
             auto& frame = reply->AddFrame();
-            const bool received =
-                (-1 != zmq_msg_recv(frame, receiver_socket_, 0));
+            const auto result = zmq_msg_recv(frame, receiver_socket_, 0);
+            const bool received = (-1 != result);
 
             if (false == received) {
+                receiver_metrics_.ReceiveError();
                 otErr << OT_METHOD << __FUNCTION__
                       << ": Receive error: " << zmq_strerror(zmq_errno())
                       << std::endl;
@@ -137,10 +147,17 @@ void Receiver::thread()
 
             OT_ASSERT(optionBytes == sizeof(option))
 
+            bytes += static_cast<std::size_t>(result);
+
             if (1 != option) { receiving = false; }
         }
 
+        receiver_metrics_.Received(bytes);
+        const auto start = std::chrono::steady_clock::now();
         process_incoming(lock, reply);
+        receiver_metrics_.Callback(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start));
 
         lock.unlock();
     }
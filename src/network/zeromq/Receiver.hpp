@@ -53,7 +53,11 @@ namespace opentxs::network::zeromq::implementation
 class Receiver
 {
 protected:
-    Receiver(std::mutex& lock, void* socket, const bool startThread);
+    Receiver(
+        std::mutex& lock,
+        void* socket,
+        SocketMetrics& metrics,
+        const bool startThread);
 
     virtual ~Receiver();
 
@@ -61,6 +65,7 @@ private:
     std::mutex& receiver_lock_;
     // Not owned by this class
     void* receiver_socket_{nullptr};
+    SocketMetrics& receiver_metrics_;
     OTFlag receiver_run_;
     std::unique_ptr<std::thread> receiver_thread_{nullptr};
 
@@ -69,7 +69,7 @@ ReplySocket::ReplySocket(
     const ReplyCallback& callback)
     : ot_super(context, SocketType::Reply)
     , CurveServer(lock_, socket_)
-    , Receiver(lock_, socket_, true)
+    , Receiver(lock_, socket_, *metrics_, true)
     , callback_(callback)
 {
 }
@@ -81,21 +81,11 @@ ReplySocket* ReplySocket::clone() const
 
 bool ReplySocket::have_callback() const { return true; }
 
-void ReplySocket::process_incoming(const Lock&, Message& message)
+void ReplySocket::process_incoming(const Lock& lock, Message& message)
 {
     auto output = callback_.Process(message);
     Message& reply = output;
-    bool sent{true};
-    const auto parts = reply.size();
-    std::size_t counter{0};
-
-    for (auto& frame : reply) {
-        int flags{0};
-
-        if (++counter < parts) { flags = ZMQ_SNDMORE; }
-
-        sent |= (-1 != zmq_msg_send(frame, socket_, flags));
-    }
+    const bool sent = send_message(lock, reply);
 
     if (false == sent) {
         otErr << OT_METHOD << __FUNCTION__ << ": Send error:\n"
@@ -47,6 +47,7 @@
 
 #include <zmq.h>
 #include "Message.hpp"
+#include "Metrics.hpp"
 
 template class opentxs::Pimpl<opentxs::network::zeromq::RequestSocket>;
 
@@ -102,17 +103,7 @@ Socket::MultipartSendResult RequestSocket::SendRequest(
     MultipartSendResult output{SendResult::ERROR, Message::Factory()};
     auto& status = output.first;
     auto& reply = output.second;
-    bool sent{true};
-    const auto parts = request.size();
-    std::size_t counter{0};
-
-    for (auto& frame : request) {
-        int flags{0};
-
-        if (++counter < parts) { flags = ZMQ_SNDMORE; }
-
-        sent |= (-1 != zmq_msg_send(frame, socket_, flags));
-    }
+    const bool sent = send_message(lock, request);
 
     if (false == sent) {
         otErr << OT_METHOD << __FUNCTION__ << ": Send error:\n"
@@ -125,18 +116,22 @@ Socket::MultipartSendResult RequestSocket::SendRequest(
 
     if (false == ready) {
         otErr << OT_METHOD << __FUNCTION__ << ": Receive timeout." << std::endl;
+        metrics_->ReceiveTimeout();
         status = SendResult::TIMEOUT;
 
         return output;
     }
 
     bool receiving{true};
+    std::size_t bytes{0};
 
     while (receiving) {
         auto& frame = reply->AddFrame();
-        const bool received = (-1 != zmq_msg_recv(frame, socket_, 0));
+        const auto result = zmq_msg_recv(frame, socket_, 0);
+        const bool received = (-1 != result);
 
         if (false == received) {
+            metrics_->ReceiveError();
             otErr << OT_METHOD << __FUNCTION__
                   << ": Receive error: " << zmq_strerror(zmq_errno())
                   << std::endl;
@@ -160,9 +155,12 @@ Socket::MultipartSendResult RequestSocket::SendRequest(
 
         OT_ASSERT(optionBytes == sizeof(option))
 
+        bytes += static_cast<std::size_t>(result);
+
         if (1 != option) { receiving = false; }
     }
 
+    metrics_->Received(bytes);
     status = SendResult::VALID_REPLY;
 
     return output;
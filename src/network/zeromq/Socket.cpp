@@ -42,14 +42,22 @@
 
 #include "opentxs/core/Log.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/Frame.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
+
+#include "Context.hpp"
+#include "Metrics.hpp"
 
 #include <zmq.h>
 
 #define ACCOUNT_UPDATE_ENDPOINT "inproc://opentxs/accountupdate/1"
 #define CONTACT_UPDATE_ENDPOINT "inproc://opentxs/contactupdate/1"
+#define METRICS_ENDPOINT "inproc://opentxs/zmqmetrics/1"
 #define NYM_UPDATE_ENDPOINT "inproc://opentxs/nymupdate/1"
 #define PAIR_EVENT_ENDPOINT "inproc://opentxs/pairevent/1"
 #define PAIR_ENDPOINT_PREFIX "inproc://opentxs//pair/"
+#define PEER_REPLY_UPDATE_ENDPOINT "inproc://opentxs/peerreplyupdate/1"
+#define PEER_REQUEST_UPDATE_ENDPOINT "inproc://opentxs/peerrequestupdate/1"
 #define PENDING_BAILMENT_ENDPOINT                                              \
     "inproc://opentxs/peerrequest/pendingbailment/1"
 #define THREAD_UPDATE_ENDPOINT "inproc://opentxs/threadupdate/1/"
@@ -63,9 +71,13 @@ namespace opentxs::network::zeromq
 {
 const std::string Socket::AccountUpdateEndpoint{ACCOUNT_UPDATE_ENDPOINT};
 const std::string Socket::ContactUpdateEndpoint{CONTACT_UPDATE_ENDPOINT};
+const std::string Socket::MetricsEndpoint{METRICS_ENDPOINT};
 const std::string Socket::NymDownloadEndpoint{NYM_UPDATE_ENDPOINT};
 const std::string Socket::PairEndpointPrefix{PAIR_ENDPOINT_PREFIX};
 const std::string Socket::PairEventEndpoint{PAIR_EVENT_ENDPOINT};
+const std::string Socket::PeerReplyUpdateEndpoint{PEER_REPLY_UPDATE_ENDPOINT};
+const std::string Socket::PeerRequestUpdateEndpoint{
+    PEER_REQUEST_UPDATE_ENDPOINT};
 const std::string Socket::PendingBailmentEndpoint{PENDING_BAILMENT_ENDPOINT};
 const std::string Socket::ThreadUpdateEndpoint{THREAD_UPDATE_ENDPOINT};
 const std::string Socket::WidgetUpdateEndpoint{WIDGET_UPDATE_ENDPOINT};
@@ -88,9 +100,13 @@ const std::map<SocketType, int> Socket::types_{
 Socket::Socket(const zeromq::Context& context, const SocketType type)
     : context_(context)
     , socket_(zmq_socket(context, types_.at(type)))
+    , registry_(
+          dynamic_cast<const implementation::Context&>(context).metrics())
+    , metrics_(registry_->Register(type))
     , type_(type)
 {
     OT_ASSERT(nullptr != socket_);
+    OT_ASSERT(metrics_);
 }
 
 Socket::operator void*() const { return socket_; }
@@ -135,15 +151,19 @@ bool Socket::apply_timeouts(const Lock& lock) const
 bool Socket::bind(const Lock& lock, const std::string& endpoint) const
 {
     apply_timeouts(lock);
+    const bool output = (0 == zmq_bind(socket_, endpoint.c_str()));
+    metrics_->Connect(output);
 
-    return (0 == zmq_bind(socket_, endpoint.c_str()));
+    return output;
 }
 
 bool Socket::connect(const Lock& lock, const std::string& endpoint) const
 {
     apply_timeouts(lock);
+    const bool output = (0 == zmq_connect(socket_, endpoint.c_str()));
+    metrics_->Connect(output);
 
-    return (0 == zmq_connect(socket_, endpoint.c_str()));
+    return output;
 }
 
 bool Socket::Close() const
@@ -155,6 +175,36 @@ bool Socket::Close() const
     return (0 == zmq_close(socket_));
 }
 
+bool Socket::send_message(const Lock& lock, zeromq::Message& message) const
+{
+    OT_ASSERT(nullptr != socket_)
+    OT_ASSERT(verify_lock(lock))
+
+    bool sent{true};
+    std::size_t bytes{0};
+    const auto parts = message.size();
+    std::size_t counter{0};
+
+    for (auto& frame : message) {
+        int flags{0};
+
+        if (++counter < parts) { flags = ZMQ_SNDMORE; }
+
+        const auto result = zmq_msg_send(frame, socket_, flags);
+
+        if (-1 == result) {
+            metrics_->SendFailed(zmq_errno());
+            sent = false;
+        } else {
+            bytes += static_cast<std::size_t>(result);
+        }
+    }
+
+    if (sent) { metrics_->Sent(bytes); }
+
+    return sent;
+}
+
 bool Socket::set_socks_proxy(const std::string& proxy) const
 {
     OT_ASSERT(nullptr != socket_);
@@ -200,5 +250,7 @@ Socket::~Socket()
     Lock lock(lock_);
 
     if (nullptr != socket_) { zmq_close(socket_); }
+
+    registry_->Retire(*metrics_);
 }
 }  // namespace opentxs::network::zeromq::implementation
@@ -45,6 +45,7 @@
 #include "opentxs/network/zeromq/Socket.hpp"
 
 #include <map>
+#include <memory>
 #include <mutex>
 
 #define CURVE_KEY_BYTES 32
@@ -74,10 +75,13 @@ protected:
     mutable int linger_{0};
     mutable int send_timeout_{-1};
     mutable int receive_timeout_{-1};
+    const std::shared_ptr<Metrics> registry_;
+    const std::shared_ptr<SocketMetrics> metrics_;
 
     bool apply_timeouts(const Lock& lock) const;
     bool bind(const Lock& lock, const std::string& endpoint) const;
     bool connect(const Lock& lock, const std::string& endpoint) const;
+    bool send_message(const Lock& lock, zeromq::Message& message) const;
     bool set_socks_proxy(const std::string& proxy) const;
     bool start_client(const Lock& lock, const std::string& endpoint) const;
 
@@ -49,6 +49,7 @@
 #include "opentxs/core/util/Assert.hpp"
 #include "opentxs/core/util/OTDataFolder.hpp"
 #include "opentxs/core/Identifier.hpp"
+#include "opentxs/core/Ledger.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/String.hpp"
 
@@ -61,6 +62,8 @@
 #define SERVER_WALLET_FILENAME "notaryServer.xml"
 #define SERVER_MASTER_KEY_TIMEOUT_DEFAULT -1
 #define SERVER_USE_SYSTEM_KEYRING false
+#define SERVER_MERKLE_BOXES_DEFAULT false
+#define SERVER_ARENA_ALLOCATION_DEFAULT false
 
 namespace opentxs::server
 {
@@ -193,6 +196,29 @@ bool ConfigLoader::load(
             static_cast<std::int32_t>(lValue));
     }
 
+    // TRACE
+
+    {
+        const char* szComment =
+            ";; TRACE\n"
+            "; admin_endpoint is a local ZeroMQ endpoint which answers any "
+            "request\n"
+            "; with per-command latency histograms, for example\n"
+            "; ipc:///var/run/opentxs/trace or tcp://127.0.0.1:7087\n"
+            "; Leave it empty to disable the endpoint.\n";
+
+        bool bSectionExist = false;
+        config.CheckSetSection("trace", szComment, bSectionExist);
+    }
+
+    {
+        bool bIsNewKey = false;
+        String strValue;
+        config.CheckSet_str("trace", "admin_endpoint", "", strValue, bIsNewKey);
+        ServerSettings::SetTraceEndpoint(
+            strValue.Exists() ? strValue.Get() : "");
+    }
+
     // PERMISSIONS
 
     {
@@ -244,6 +270,51 @@ bool ConfigLoader::load(
         ServerSettings::SetMinMarketScale(lValue);
     }
 
+    // BOXES
+
+    {
+        const char* szComment =
+            "; merkle_boxes causes nymboxes, inboxes and outboxes to be "
+            "upgraded to the\n"
+            "; Merkle box format (version 3.0) when they are next saved. The "
+            "box hash\n"
+            "; becomes a Merkle root over the receipts, so adding or removing "
+            "a receipt\n"
+            "; does not rehash the entire box. Clients must support this "
+            "format.\n";
+
+        bool bIsNewKey = false;
+        bool bValue = false;
+        config.CheckSet_bool(
+            "boxes",
+            "merkle_boxes",
+            SERVER_MERKLE_BOXES_DEFAULT,
+            bValue,
+            bIsNewKey,
+            szComment);
+        ServerSettings::SetMerkleBoxes(bValue);
+    }
+
+    {
+        const char* szComment =
+            "; arena_allocation loads the receipts of each box, with their "
+            "items and\n"
+            "; strings, into arena blocks instead of allocating each of them "
+            "from the\n"
+            "; heap. A block is freed once all its receipts are released.\n";
+
+        bool bIsNewKey = false;
+        bool bValue = false;
+        config.CheckSet_bool(
+            "boxes",
+            "arena_allocation",
+            SERVER_ARENA_ALLOCATION_DEFAULT,
+            bValue,
+            bIsNewKey,
+            szComment);
+        Ledger::SetArenaAllocation(bValue);
+    }
+
     // SECURITY (beginnings of..)
 
     // Master Key Timeout
@@ -55,8 +55,11 @@
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/ReplyCallback.hpp"
 #include "opentxs/network/zeromq/ReplySocket.hpp"
+#include "opentxs/network/ServerConnection.hpp"
 
 #include "Server.hpp"
+#include "ServerSettings.hpp"
+#include "Trace.hpp"
 #include "UserCommandProcessor.hpp"
 
 #include <stddef.h>
@@ -81,6 +84,11 @@ MessageProcessor::MessageProcessor(
               return this->processSocket(incoming);
           }))
     , reply_socket_(context.ReplySocket(reply_socket_callback_.get()))
+    , trace_socket_callback_(network::zeromq::ReplyCallback::Factory(
+          [this](const network::zeromq::Message& incoming) -> OTZMQMessage {
+              return this->processTrace(incoming);
+          }))
+    , trace_socket_(context.ReplySocket(trace_socket_callback_.get()))
     , thread_(nullptr)
 {
 }
@@ -105,6 +113,25 @@ void MessageProcessor::init(const int port, const OTPassword& privkey)
     const auto bound = reply_socket_->Start(endpoint);
 
     OT_ASSERT(bound);
+
+    const auto& traceEndpoint = ServerSettings::GetTraceEndpoint();
+
+    if (traceEndpoint.empty()) { return; }
+
+    if (false == trace_socket_->Start(traceEndpoint)) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to bind trace endpoint " << traceEndpoint
+              << std::endl;
+    }
+}
+
+OTZMQMessage MessageProcessor::processTrace(
+    const network::zeromq::Message& incoming)
+{
+    auto output = network::zeromq::Message::ReplyFactory(incoming);
+    output->AddFrame(server_.Tracer().Report());
+
+    return output;
 }
 
 void MessageProcessor::run()
@@ -135,26 +162,71 @@ OTZMQMessage MessageProcessor::processSocket(
         messageString = *incoming.Body().begin();
     }
 
-    bool error = processMessage(messageString, reply);
+    // Clients which understand the binary format name the encoding of the
+    // request in a second frame and expect the same frame in the reply
+    std::string format{};
+
+    if (1 < incoming.Body().size()) {
+        format = std::string(incoming.Body_at(1));
+    }
+
+    const bool binary = (network::ServerConnection::BinaryFormat == format);
+    bool error = processMessage(messageString, binary, reply);
 
     if (error) { reply = ""; }
 
     auto output = network::zeromq::Message::ReplyFactory(incoming);
     output->AddFrame(reply);
 
+    if (false == format.empty()) { output->AddFrame(format); }
+
     return output;
 }
 
+bool MessageProcessor::processCommand(
+    Trace::Request& traced,
+    Message& request,
+    Message& reply)
+{
+    traced.SetCommand(request.m_strCommand.Get());
+    const bool processed =
+        server_.CommandProcessor().ProcessUserCommand(request, reply);
+    traced.SetSuccess(processed);
+
+    if (false == processed) {
+        otWarn << OT_METHOD << __FUNCTION__
+               << ": Failed to process user command " << request.m_strCommand
+               << std::endl;
+        otInfo << String(request) << std::endl;
+    } else {
+        otWarn << OT_METHOD << __FUNCTION__
+               << ": Successfully processed user command "
+               << request.m_strCommand << std::endl;
+    }
+
+    return processed;
+}
+
 bool MessageProcessor::processMessage(
     const std::string& messageString,
+    const bool binary,
     std::string& reply)
 {
     if (messageString.size() < 1) { return true; }
 
-    OTASCIIArmor armored;
-    armored.MemSet(messageString.data(), messageString.size());
+    if (binary) { return processBinaryMessage(messageString, reply); }
+
+    auto& trace = server_.Tracer();
+    Trace::Request traced(trace);
     String serialized;
-    armored.GetString(serialized);
+
+    {
+        Trace::Span span(trace, Trace::Stage::Decode);
+        OTASCIIArmor armored;
+        armored.MemSet(messageString.data(), messageString.size());
+        armored.GetString(serialized);
+    }
+
     Message request;
 
     if (false == serialized.Exists()) {
@@ -164,29 +236,25 @@ bool MessageProcessor::processMessage(
         return true;
     }
 
-    if (false == request.LoadContractFromString(serialized)) {
-        otErr << OT_METHOD << __FUNCTION__
-              << ": Failed to deserialized request." << std::endl;
+    bool loaded{false};
 
-        return true;
+    {
+        Trace::Span span(trace, Trace::Stage::Parse);
+        loaded = request.LoadContractFromString(serialized);
     }
 
-    Message repy{};
-    const bool processed =
-        server_.CommandProcessor().ProcessUserCommand(request, repy);
+    if (false == loaded) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to deserialize request." << std::endl;
 
-    if (false == processed) {
-        otWarn << OT_METHOD << __FUNCTION__
-               << ": Failed to process user command " << request.m_strCommand
-               << std::endl;
-        otInfo << String(request) << std::endl;
-    } else {
-        otWarn << OT_METHOD << __FUNCTION__
-               << ": Successfully processed user command "
-               << request.m_strCommand << std::endl;
+        return true;
     }
 
-    String serializedReply(repy);
+    Message replyMessage{};
+    processCommand(traced, request, replyMessage);
+
+    Trace::Span span(trace, Trace::Stage::Encode);
+    String serializedReply(replyMessage);
 
     if (false == serializedReply.Exists()) {
         otErr << OT_METHOD << __FUNCTION__ << ": Failed to serialize reply."
@@ -209,6 +277,51 @@ bool MessageProcessor::processMessage(
     return false;
 }
 
+bool MessageProcessor::processBinaryMessage(
+    const std::string& messageString,
+    std::string& reply)
+{
+    auto& trace = server_.Tracer();
+    Trace::Request traced(trace);
+    Message request;
+    bool loaded{false};
+
+    {
+        Trace::Span span(trace, Trace::Stage::Parse);
+        loaded = request.LoadBinary(messageString);
+    }
+
+    if (false == loaded) {
+        otErr << OT_METHOD << __FUNCTION__
+              << ": Failed to deserialize request." << std::endl;
+
+        return true;
+    }
+
+    if (false == Message::BinaryFormatAllowed(
+                     Message::Type(request.m_strCommand.Get()))) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Command "
+              << request.m_strCommand << " not allowed in binary format."
+              << std::endl;
+
+        return true;
+    }
+
+    Message replyMessage{};
+    processCommand(traced, request, replyMessage);
+
+    Trace::Span span(trace, Trace::Stage::Encode);
+
+    if (false == replyMessage.SaveBinary(server_.GetServerNym(), reply)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to serialize reply."
+              << std::endl;
+
+        return true;
+    }
+
+    return false;
+}
+
 void MessageProcessor::Start()
 {
     if (false == bool(thread_)) {
@@ -45,6 +45,8 @@
 #include "opentxs/core/Flag.hpp"
 #include "opentxs/network/zeromq/Socket.hpp"
 
+#include "Trace.hpp"
+
 #include <atomic>
 #include <memory>
 #include <string>
@@ -74,10 +76,23 @@ private:
     [[maybe_unused]] const network::zeromq::Context& context_;
     OTZMQReplyCallback reply_socket_callback_;
     OTZMQReplySocket reply_socket_;
+    OTZMQReplyCallback trace_socket_callback_;
+    OTZMQReplySocket trace_socket_;
     std::unique_ptr<std::thread> thread_{nullptr};
 
-    bool processMessage(const std::string& messageString, std::string& reply);
+    bool processBinaryMessage(
+        const std::string& messageString,
+        std::string& reply);
+    bool processCommand(
+        Trace::Request& traced,
+        Message& request,
+        Message& reply);
+    bool processMessage(
+        const std::string& messageString,
+        const bool binary,
+        std::string& reply);
     OTZMQMessage processSocket(const network::zeromq::Message& incoming);
+    OTZMQMessage processTrace(const network::zeromq::Message& incoming);
     void run();
 };
 }  // namespace server
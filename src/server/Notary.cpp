@@ -74,6 +74,8 @@
 #include "opentxs/core/String.hpp"
 #include "opentxs/ext/OTPayment.hpp"
 
+#include "util/ThreadPool.hpp"
+
 #include "Macros.hpp"
 #include "Server.hpp"
 #include "PayDividendVisitor.hpp"
@@ -84,6 +86,7 @@
 #include <cstdint>
 #include <deque>
 #include <list>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -103,13 +106,137 @@ typedef std::deque<Token*> dequeOfTokenPtrs;
 Notary::Notary(
     Server& server,
     const opentxs::api::Server& mint,
-    const opentxs::api::client::Wallet& wallet)
+    const opentxs::api::client::Wallet& wallet,
+    const ThreadPool& pool)
     : server_(server)
     , mint_(mint)
     , wallet_(wallet)
+    , pool_(pool)
 {
 }
 
+// Parses the original item inside every receipt that processInbox accepts by
+// reference (pending transfers and item receipts), plus the cheque attached to
+// it if there is one, and verifies the item against the nym which signed it.
+// Each receipt is independent of the others, so parsing and verification run
+// on the api's thread pool before the items are processed in order.
+//
+// The parse tasks only build the Item and Cheque objects they own from strings
+// which are already in memory. They do not touch storage, sign anything or
+// modify the inbox. Identifier decoding only reads the crypto api, log streams
+// lock internally, and Arena scopes are thread local, so items parsed on a
+// pool thread come from the heap even if the inbox was loaded into an arena.
+void Notary::load_original_items(
+    const Identifier& notaryID,
+    Ledger& inbox,
+    OTTransaction& processInbox,
+    OriginalItems& output) const
+{
+    std::vector<ThreadPool::Task> tasks{};
+
+    for (auto& pItem : processInbox.GetItemList()) {
+        OT_ASSERT(nullptr != pItem);
+
+        switch (pItem->GetType()) {
+            case Item::acceptPending:
+            case Item::acceptItemReceipt: {
+            } break;
+            default: {
+                continue;
+            }
+        }
+
+        const OTTransaction* pServerTransaction =
+            inbox.GetTransaction(pItem->GetReferenceToNum());
+
+        if (nullptr == pServerTransaction) { continue; }
+
+        auto [it, added] =
+            output.try_emplace(pServerTransaction->GetTransactionNum());
+
+        if (false == added) { continue; }
+
+        auto& original = it->second;
+        tasks.emplace_back([&original, &notaryID, pServerTransaction]() {
+            pServerTransaction->GetReferenceString(original.reference_);
+            original.item_.reset(Item::CreateItemFromString(
+                original.reference_,
+                notaryID,
+                pServerTransaction->GetReferenceToNum()));
+
+            if (false == bool(original.item_)) { return; }
+
+            if (Item::depositCheque != original.item_->GetType()) { return; }
+
+            original.item_->GetAttachment(original.cheque_);
+            Cheque cheque;
+            original.cheque_loaded_ =
+                (original.cheque_.GetLength() > 2) &&
+                cheque.LoadContractFromString(original.cheque_);
+
+            if (original.cheque_loaded_) {
+                original.cheque_number_ = cheque.GetTransactionNum();
+            }
+        });
+    }
+
+    if (1 < tasks.size()) {
+        pool_.Wait(tasks);
+    } else {
+        for (auto& task : tasks) { task(); }
+    }
+
+    // Signers are looked up on this thread, then the items of each signer
+    // are verified as one batch
+    std::map<std::string, std::vector<OriginalItem*>> signers{};
+
+    for (auto& it : output) {
+        auto& original = it.second;
+
+        if (false == bool(original.item_)) { continue; }
+
+        signers[String(original.item_->GetNymID()).Get()].push_back(&original);
+    }
+
+    for (auto& it : signers) {
+        const auto& signerID = it.first;
+        auto& originals = it.second;
+        const auto signer = wallet_.Nym(Identifier::Factory(signerID));
+
+        if (false == bool(signer)) {
+            // Nothing to verify against, which is how these items were
+            // handled before they were verified here at all
+            otWarn << OT_METHOD << __FUNCTION__ << ": Signer " << signerID
+                   << " of " << originals.size()
+                   << " original item(s) is not available." << std::endl;
+
+            for (auto* original : originals) { original->verified_ = true; }
+
+            continue;
+        }
+
+        std::vector<const Contract*> items{};
+
+        for (const auto* original : originals) {
+            items.push_back(original->item_.get());
+        }
+
+        const auto verified =
+            Contract::VerifySignatures(server_.Crypto(), items, *signer);
+
+        for (std::size_t i = 0; i < originals.size(); ++i) {
+            originals[i]->verified_ = verified[i];
+
+            if (false == verified[i]) {
+                otErr << OT_METHOD << __FUNCTION__
+                      << ": Invalid signature on original item "
+                      << originals[i]->item_->GetTransactionNum() << " from "
+                      << signerID << std::endl;
+            }
+        }
+    }
+}
+
 void Notary::NotarizeTransfer(
     ClientContext& context,
     ExclusiveAccount& theFromAccount,
@@ -6920,7 +7047,7 @@ void Notary::NotarizeTransaction(
     // security over and over
     // again in the subsequent calls.
     //
-    else if (!tranIn.VerifyItems(context.RemoteNym())) {
+    else if (!tranIn.VerifyItems(server_.Crypto(), context.RemoteNym())) {
         const auto idAcct = Identifier::Factory(theFromAccount.get());
         const String strIDAcct(idAcct);
         Log::vOutput(
@@ -7884,6 +8011,7 @@ void Notary::NotarizeProcessInbox(
     std::int64_t lTotalBeingAccepted{0};
     std::list<TransactionNumber> theListOfInboxReceiptsBeingRemoved{};
     bool bVerifiedBalanceStatement{false};
+    OriginalItems originals{};
     const bool allowed =
         NYM_IS_ALLOWED(strNymID, ServerSettings::__transact_process_inbox);
 
@@ -7923,6 +8051,7 @@ void Notary::NotarizeProcessInbox(
     // This response item is IN RESPONSE to processInbox's balance agreement
     pResponseBalanceItem->SetReferenceToNum(pBalanceItem->GetTransactionNum());
     pResponseBalanceItem->SetNumberOfOrigin(*pBalanceItem);
+    load_original_items(NOTARY_ID, *pInbox, processInbox, originals);
 
     // This transaction accepts various incoming pending transfers. So when
     // it's all done, my balance will be higher. AND pending inbox items
@@ -8172,13 +8301,11 @@ void Notary::NotarizeProcessInbox(
                 // recipient's acceptPending. THAT item is in reference to
                 // my original transfer (or contains a cheque with my
                 // original number.) (THAT's the # I need.)
-                String strOriginalItem;
-                pServerTransaction->GetReferenceString(strOriginalItem);
-
-                std::unique_ptr<Item> pOriginalItem(Item::CreateItemFromString(
-                    strOriginalItem,
-                    NOTARY_ID,
-                    pServerTransaction->GetReferenceToNum()));
+                auto& original =
+                    originals.at(pServerTransaction->GetTransactionNum());
+                const String& strOriginalItem = original.reference_;
+                Item* pOriginalItem =
+                    original.verified_ ? original.item_.get() : nullptr;
 
                 if (nullptr != pOriginalItem) {
                     // If pOriginalItem is acceptPending, that means the
@@ -8210,15 +8337,11 @@ void Notary::NotarizeProcessInbox(
                     // depositCheque (from the recipient) as the original
                     // item within.
                     if (Item::depositCheque == pOriginalItem->GetType()) {
-                        // Get the cheque from the Item and load it up into
-                        // a Cheque object.
-                        String strCheque;
-                        pOriginalItem->GetAttachment(strCheque);
-                        Cheque theCheque;  // allocated on the stack :-)
+                        // The cheque was loaded from the Item by
+                        // load_original_items()
+                        const String& strCheque = original.cheque_;
 
-                        if (false ==
-                            ((strCheque.GetLength() > 2) &&
-                             theCheque.LoadContractFromString(strCheque))) {
+                        if (false == original.cheque_loaded_) {
                             Log::vError(
                                 "%s: ERROR loading cheque from "
                                 "string:\n%s\n",
@@ -8230,7 +8353,7 @@ void Notary::NotarizeProcessInbox(
                         // accepting the cheque receipt, he can be cleared
                         // for that transaction number...
                         else {
-                            const auto number = theCheque.GetTransactionNum();
+                            const auto number = original.cheque_number_;
                             // IF it's actually there on theNym, then
                             // schedule it for removal. (Otherwise we'd end
                             // up improperly re-adding it.)
@@ -8678,13 +8801,27 @@ void Notary::NotarizeProcessInbox(
             // the original item (from the sender) as the
             // "referenced to" object. So let's extract
             // it.
-            String strOriginalItem;
-            pServerTransaction->GetReferenceString(strOriginalItem);
-
-            std::unique_ptr<Item> pOriginalItem(Item::CreateItemFromString(
-                strOriginalItem,
-                NOTARY_ID,
-                pServerTransaction->GetReferenceToNum()));
+            // Receipts keep their reference string for as long as they are
+            // in the inbox, so the item parsed before the first loop is
+            // still the right one.
+            std::unique_ptr<Item> pParsedItem{nullptr};
+            Item* pOriginalItem{nullptr};
+            auto original =
+                originals.find(pServerTransaction->GetTransactionNum());
+
+            if (originals.end() != original) {
+                if (original->second.verified_) {
+                    pOriginalItem = original->second.item_.get();
+                }
+            } else {
+                String strOriginalItem;
+                pServerTransaction->GetReferenceString(strOriginalItem);
+                pParsedItem.reset(Item::CreateItemFromString(
+                    strOriginalItem,
+                    NOTARY_ID,
+                    pServerTransaction->GetReferenceToNum()));
+                pOriginalItem = pParsedItem.get();
+            }
 
             if (nullptr != pOriginalItem) {
 
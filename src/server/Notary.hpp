@@ -41,10 +41,17 @@
 
 #include "Internal.hpp"
 
+#include "opentxs/core/String.hpp"
+
+#include <map>
+#include <memory>
+
 namespace opentxs
 {
 class Account;
 class ClientContext;
+class Item;
+class Ledger;
 class Nym;
 class OTTransaction;
 
@@ -86,10 +93,29 @@ public:
 private:
     friend class Server;
 
+    /** The item referenced by an inbox receipt, and the cheque attached to it
+     *  if there is one, parsed and verified ahead of processInbox */
+    struct OriginalItem {
+        String reference_{};
+        std::unique_ptr<Item> item_{nullptr};
+        bool verified_{false};
+        String cheque_{};
+        bool cheque_loaded_{false};
+        TransactionNumber cheque_number_{0};
+    };
+
+    using OriginalItems = std::map<TransactionNumber, OriginalItem>;
+
     Server& server_;
     const opentxs::api::Server& mint_;
     const opentxs::api::client::Wallet& wallet_;
+    const ThreadPool& pool_;
 
+    void load_original_items(
+        const Identifier& notaryID,
+        Ledger& inbox,
+        OTTransaction& processInbox,
+        OriginalItems& output) const;
     void NotarizeCancelCronItem(
         ClientContext& context,
         ExclusiveAccount& assetAccount,
@@ -148,7 +174,8 @@ private:
     explicit Notary(
         Server& server,
         const opentxs::api::Server& mint,
-        const opentxs::api::client::Wallet& wallet);
+        const opentxs::api::client::Wallet& wallet,
+        const ThreadPool& pool);
     Notary() = delete;
     Notary(const Notary&) = delete;
     Notary(Notary&&) = delete;
@@ -48,6 +48,7 @@
 #include "opentxs/core/Cheque.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
+#include "opentxs/core/Nym.hpp"
 #include "opentxs/core/String.hpp"
 #include "opentxs/core/util/Assert.hpp"
 #include "opentxs/core/util/Common.hpp"
@@ -59,6 +60,8 @@
 
 #include <cinttypes>
 #include <cstdint>
+#include <utility>
+#include <vector>
 
 namespace opentxs
 {
@@ -101,56 +104,119 @@ PayDividendVisitor::~PayDividendVisitor()
     m_lAmountReturned = 0;
 }
 
+PayDividendVisitor::Payout::Payout(
+    const Identifier& recipient,
+    const std::int64_t amount)
+    : recipient_(Identifier::Factory(recipient))
+    , amount_(amount)
+    , number_(0)
+    , voucher_(nullptr)
+    , issued_(false)
+{
+}
+
+PayDividendVisitor::Payout::Payout(Payout&&) = default;
+
+PayDividendVisitor::Payout::~Payout() = default;
+
+bool PayDividendVisitor::issue_voucher(
+    const time64_t& validFrom,
+    const time64_t& validTo,
+    const Identifier& recipient,
+    const std::int64_t amount,
+    const TransactionNumber number,
+    Cheque& voucher)
+{
+    OT_ASSERT(nullptr != GetVoucherAcctID());
+    const Identifier& theVoucherAcctID = *(GetVoucherAcctID());
+    OT_ASSERT(nullptr != GetServer());
+    const Nym& theServerNym = GetServer()->GetServerNym();
+    const auto theServerNymID = Identifier::Factory(theServerNym);
+    OT_ASSERT(nullptr != GetMemo());
+    const String& strMemo = *(GetMemo());
+
+    const bool bIssueVoucher = voucher.IssueCheque(
+        amount,  // The amount of the cheque.
+        number,  // Requiring a transaction number prevents double-spending
+                 // of cheques.
+        validFrom,         // The expiration date (valid from/to dates) of the
+        validTo,           // cheque
+        theVoucherAcctID,  // The asset account the cheque is drawn on.
+        theServerNymID,    // Nym ID of the sender (in this case the server
+                           // nym.)
+        strMemo,  // Optional memo field. Includes item note and request memo.
+        Identifier::Factory(recipient));
+
+    if (false == bIssueVoucher) { return false; }
+
+    // All this does is set the voucher's internal contract string to
+    // "VOUCHER" instead of "CHEQUE". We also set the server itself as the
+    // remitter, which is unusual for vouchers, but necessary in the case of
+    // dividends.
+    //
+    voucher.SetAsVoucher(theServerNymID, theVoucherAcctID);
+    voucher.SignContract(theServerNym);
+    voucher.SaveContract();
+
+    return true;
+}
+
+bool PayDividendVisitor::send_voucher(
+    Cheque& voucher,
+    const Identifier& recipient)
+{
+    OT_ASSERT(false == GetNotaryID()->empty());
+    OT_ASSERT(nullptr != GetServer());
+    server::Server& theServer = *(GetServer());
+    const auto theServerNymID = Identifier::Factory(theServer.GetServerNym());
+
+    // Send the voucher to the payments inbox of the recipient.
+    //
+    const String strVoucher(voucher);
+    OTPayment thePayment(strVoucher);
+
+    // calls DropMessageToNymbox
+    return theServer.SendInstrumentToNym(
+        GetNotaryID(),
+        theServerNymID,  // sender nym
+        recipient,       // recipient nym
+        &thePayment,
+        "payDividend");  // todo: hardcoding.
+}
+
 // For each "user" account of a specific instrument definition, this function
 // is called in order to pay a dividend to the Nym who owns that account.
 
 // PayDividendVisitor::Trigger() is used in
 // OTUnitDefinition::VisitAccountRecords()
 // cppcheck-suppress unusedFunction
-bool PayDividendVisitor::Trigger(
-    const Account& theSharesAccount)  // theSharesAccount
-                                      // is, say, a Pepsi
-                                      // shares
-// account.  Here, we'll send a dollars voucher
-// to its owner.
+bool PayDividendVisitor::Trigger(const Account& theSharesAccount)
+{
+    return TriggerBatch({&theSharesAccount});
+}
+
+// theSharesAccount is, say, a Pepsi shares account. Here, we'll send a dollars
+// voucher to its owner.
+bool PayDividendVisitor::TriggerBatch(
+    const std::vector<const Account*>& accounts)
 {
-    const std::int64_t lPayoutAmount =
-        (theSharesAccount.GetBalance() * GetPayoutPerShare());
-
-    if (lPayoutAmount <= 0) {
-        Log::Output(
-            0,
-            "PayDividendVisitor::Trigger: nothing to pay, "
-            "since this account owns no shares. (Returning "
-            "true.)");
-        return true;  // nothing to pay, since this account owns no shares.
-                      // Success!
-    }
     OT_ASSERT(false == GetNotaryID()->empty());
     const auto theNotaryID = GetNotaryID();
     OT_ASSERT(nullptr != GetPayoutInstrumentDefinitionID());
     const Identifier& thePayoutInstrumentDefinitionID =
         *(GetPayoutInstrumentDefinitionID());
-    OT_ASSERT(nullptr != GetVoucherAcctID());
-    const Identifier& theVoucherAcctID = *(GetVoucherAcctID());
     OT_ASSERT(nullptr != GetServer());
     server::Server& theServer = *(GetServer());
-    Nym& theServerNym = const_cast<Nym&>(theServer.GetServerNym());
-    const auto theServerNymID = Identifier::Factory(theServerNym);
-    const Identifier& RECIPIENT_ID = theSharesAccount.GetNymID();
+    const Nym& theServerNym = theServer.GetServerNym();
     OT_ASSERT(nullptr != GetNymID());
-    const Identifier& theSenderNymID = *(GetNymID());
-    OT_ASSERT(nullptr != GetMemo());
-    const String& strMemo = *(GetMemo());
     // Note: theSenderNymID is the originator of the Dividend Payout.
     // However, all the actual vouchers will be from "the server Nym" and
     // not from theSenderNymID. So then why is it even here? Because anytime
     // there's an error, the server will send to theSenderNymID instead of
     // RECIPIENT_ID (so the original sender can have his money back, instead of
     // just having it get lost in the ether.)
-    bool bReturnValue = false;
-
-    Cheque theVoucher(theNotaryID, thePayoutInstrumentDefinitionID);
+    const Identifier& theSenderNymID = *(GetNymID());
+    bool bReturnValue = true;
 
     // 10 minutes ==    600 Seconds
     // 1 hour    ==     3600 Seconds
@@ -161,80 +227,111 @@ bool PayDividendVisitor::Trigger(
 
     const time64_t VALID_FROM =
         OTTimeGetCurrentTime();  // This time is set to TODAY NOW
+    // This time occurs in 180 days (6 months). Todo hardcoding.
     const time64_t VALID_TO = OTTimeAddTimeInterval(
-        VALID_FROM,
-        OTTimeGetSecondsFromTime(OT_TIME_SIX_MONTHS_IN_SECONDS));  // This time
-                                                                   // occurs in
-    // 180 days (6 months).
-    // Todo hardcoding.
-    TransactionNumber lNewTransactionNumber = 0;
-    auto context = OT::App().Wallet().mutable_ClientContext(
-        theServerNym.ID(), theServerNym.ID());
-    bool bGotNextTransNum =
-        theServer.GetTransactor().issueNextTransactionNumberToNym(
-            context.It(), lNewTransactionNumber);  // We save the transaction
-    // number on the server Nym (normally we'd discard it) because
-    // when the cheque is deposited, the server nym, as the owner of
-    // the voucher account, needs to verify the transaction # on the
-    // cheque (to prevent double-spending of cheques.)
-    if (bGotNextTransNum) {
-        const bool bIssueVoucher = theVoucher.IssueCheque(
-            lPayoutAmount,          // The amount of the cheque.
-            lNewTransactionNumber,  // Requiring a transaction number prevents
-                                    // double-spending of cheques.
-            VALID_FROM,  // The expiration date (valid from/to dates) of the
-                         // cheque
-            VALID_TO,  // Vouchers are automatically starting today and lasting
-                       // 6
-                       // months.
-            theVoucherAcctID,  // The asset account the cheque is drawn on.
-            theServerNymID,    // Nym ID of the sender (in this case the server
-                               // nym.)
-            strMemo,  // Optional memo field. Includes item note and request
-                      // memo.
-            Identifier::Factory(RECIPIENT_ID));
-
-        // All account crediting / debiting happens in the caller, in
-        // server::Server.
-        //    (AND it happens only ONCE, to cover ALL vouchers.)
-        // Then in here, the voucher either gets send to the recipient, or if
-        // error, sent back home to
-        // the issuer Nym. (ALL the funds are removed, then the vouchers are
-        // sent one way or the other.)
-        // Any returned vouchers, obviously serve to notify the dividend payer
-        // of where the errors were
-        // (as well as give him the opportunity to get his money back.)
-        //
+        VALID_FROM, OTTimeGetSecondsFromTime(OT_TIME_SIX_MONTHS_IN_SECONDS));
+
+    std::vector<Payout> payouts{};
+    payouts.reserve(accounts.size());
+
+    // Transaction numbers are issued one at a time, since issuing them
+    // updates the server's main file.
+    {
+        auto context = OT::App().Wallet().mutable_ClientContext(
+            theServerNym.ID(), theServerNym.ID());
+
+        for (const auto* pAccount : accounts) {
+            OT_ASSERT(nullptr != pAccount);
+
+            const Account& theSharesAccount = *pAccount;
+            const std::int64_t lPayoutAmount =
+                (theSharesAccount.GetBalance() * GetPayoutPerShare());
+
+            if (lPayoutAmount <= 0) {
+                Log::Output(
+                    0,
+                    "PayDividendVisitor::Trigger: nothing to pay, "
+                    "since this account owns no shares. (Returning "
+                    "true.)");
+
+                continue;  // nothing to pay, since this account owns no
+                           // shares. Success!
+            }
+
+            const Identifier& RECIPIENT_ID = theSharesAccount.GetNymID();
+            Payout payout(RECIPIENT_ID, lPayoutAmount);
+
+            // We save the transaction number on the server Nym (normally we'd
+            // discard it) because when the cheque is deposited, the server
+            // nym, as the owner of the voucher account, needs to verify the
+            // transaction # on the cheque (to prevent double-spending of
+            // cheques.)
+            const bool bGotNextTransNum =
+                theServer.GetTransactor().issueNextTransactionNumberToNym(
+                    context.It(), payout.number_);
+
+            if (false == bGotNextTransNum) {
+                const String strPayoutInstrumentDefinitionID(
+                    thePayoutInstrumentDefinitionID),
+                    strRecipientNymID(RECIPIENT_ID);
+                Log::vError(
+                    "PayDividendVisitor::Trigger: ERROR!! Failed issuing next "
+                    "transaction "
+                    "number while trying to send a voucher (while paying "
+                    "dividends.) "
+                    "WAS TRYING TO PAY %" PRId64
+                    " of instrument definition %s to Nym %s.\n",
+                    lPayoutAmount,
+                    strPayoutInstrumentDefinitionID.Get(),
+                    strRecipientNymID.Get());
+                bReturnValue = false;
+
+                continue;
+            }
+
+            payout.voucher_.reset(
+                new Cheque(theNotaryID, thePayoutInstrumentDefinitionID));
+
+            OT_ASSERT(payout.voucher_);
+
+            payouts.emplace_back(std::move(payout));
+        }
+    }
+
+    // The vouchers are signed by the server nym, so they are issued one at a
+    // time as well.
+    for (auto& payout : payouts) {
+        payout.issued_ = issue_voucher(
+            VALID_FROM,
+            VALID_TO,
+            payout.recipient_,
+            payout.amount_,
+            payout.number_,
+            *payout.voucher_);
+    }
+
+    // All account crediting / debiting happens in the caller, in
+    // server::Server. (AND it happens only ONCE, to cover ALL vouchers.)
+    // Then in here, the voucher either gets send to the recipient, or if
+    // error, sent back home to the issuer Nym. (ALL the funds are removed,
+    // then the vouchers are sent one way or the other.) Any returned vouchers,
+    // obviously serve to notify the dividend payer of where the errors were
+    // (as well as give him the opportunity to get his money back.)
+    //
+    for (auto& payout : payouts) {
+        const std::int64_t lPayoutAmount = payout.amount_;
+        const Identifier& RECIPIENT_ID = payout.recipient_;
         bool bSent = false;
-        if (bIssueVoucher) {
-            // All this does is set the voucher's internal contract string to
-            // "VOUCHER" instead of "CHEQUE". We also set the server itself as
-            // the remitter, which is unusual for vouchers, but necessary in the
-            // case of dividends.
-            //
-            theVoucher.SetAsVoucher(theServerNymID, theVoucherAcctID);
-            theVoucher.SignContract(theServerNym);
-            theVoucher.SaveContract();
 
-            // Send the voucher to the payments inbox of the recipient.
-            //
-            const String strVoucher(theVoucher);
-            OTPayment thePayment(strVoucher);
-
-            // calls DropMessageToNymbox
-            bSent = theServer.SendInstrumentToNym(
-                theNotaryID,
-                theServerNymID,  // sender nym
-                RECIPIENT_ID,    // recipient nym
-                &thePayment,
-                "payDividend");    // todo: hardcoding.
-            bReturnValue = bSent;  // <======= RETURN VALUE.
-            if (bSent)
-                m_lAmountPaidOut +=
-                    lPayoutAmount;  // At the end of iterating all accounts, if
-                                    // m_lAmountPaidOut is less than
-            // lTotalPayoutAmount, then we return to rest
-            // to the sender.
+        if (payout.issued_) {
+            bSent = send_voucher(*payout.voucher_, RECIPIENT_ID);
+
+            if (bSent) {
+                // At the end of iterating all accounts, if m_lAmountPaidOut is
+                // less than lTotalPayoutAmount, then we return to rest to the
+                // sender.
+                m_lAmountPaidOut += lPayoutAmount;
+            }
         } else {
             const String strPayoutInstrumentDefinitionID(
                 thePayoutInstrumentDefinitionID),
@@ -249,88 +346,51 @@ bool PayDividendVisitor::Trigger(
                 strPayoutInstrumentDefinitionID.Get(),
                 strRecipientNymID.Get());
         }
+
+        if (bSent) { continue; }
+
+        bReturnValue = false;
+
         // If we didn't send it, then we need to return the funds to where they
         // came from.
         //
-        if (!bSent) {
-            Cheque theReturnVoucher(
-                theNotaryID, thePayoutInstrumentDefinitionID);
-
-            const bool bIssueReturnVoucher = theReturnVoucher.IssueCheque(
-                lPayoutAmount,          // The amount of the cheque.
-                lNewTransactionNumber,  // Requiring a transaction number
-                                        // prevents double-spending of cheques.
-                VALID_FROM,  // The expiration date (valid from/to dates) of the
-                             // cheque
-                VALID_TO,    // Vouchers are automatically starting today and
-                             // lasting 6 months.
-                theVoucherAcctID,  // The asset account the cheque is drawn on.
-                theServerNymID,    // Nym ID of the sender (in this case the
-                                   // server nym.)
-                strMemo,  // Optional memo field. Includes item note and request
-                          // memo.
-                Identifier::Factory(theSenderNymID));  // We're returning the
-                                                       // money to its original
-                                                       // sender.
-            if (bIssueReturnVoucher) {
-                // All this does is set the voucher's internal contract string
-                // to
-                // "VOUCHER" instead of "CHEQUE".
-                //
-                theReturnVoucher.SetAsVoucher(theServerNymID, theVoucherAcctID);
-                theReturnVoucher.SignContract(theServerNym);
-                theReturnVoucher.SaveContract();
-
-                // Return the voucher back to the payments inbox of the original
-                // sender.
-                //
-                const String strReturnVoucher(theReturnVoucher);
-                OTPayment theReturnPayment(strReturnVoucher);
-
-                // calls DropMessageToNymbox
-                bSent = theServer.SendInstrumentToNym(
-                    theNotaryID,
-                    theServerNymID,  // sender nym
-                    theSenderNymID,  // recipient nym (original sender.)
-                    &theReturnPayment,
-                    "payDividend");  // todo: hardcoding.
-                if (bSent)
-                    m_lAmountReturned +=
-                        lPayoutAmount;  // At the end of iterating all accounts,
-                                        // if m_lAmountPaidOut+m_lAmountReturned
-                                        // is less than lTotalPayoutAmount, then
-                                        // we return the rest to the sender.
-            } else {
-                const String strPayoutInstrumentDefinitionID(
-                    thePayoutInstrumentDefinitionID),
-                    strSenderNymID(theSenderNymID);
-                Log::vError(
-                    "PayDividendVisitor::Trigger: ERROR "
-                    "failed issuing voucher (to return back to "
-                    "the dividend payout initiator, after a failed "
-                    "payment attempt to the originally intended "
-                    "recipient.) WAS TRYING TO PAY %" PRId64
-                    " of instrument definition "
-                    "%s to Nym %s.\n",
-                    lPayoutAmount,
-                    strPayoutInstrumentDefinitionID.Get(),
-                    strSenderNymID.Get());
-            }
-        }   // if !bSent
-    } else  // !bGotNextTransNum
-    {
-        const String strPayoutInstrumentDefinitionID(
-            thePayoutInstrumentDefinitionID),
-            strRecipientNymID(RECIPIENT_ID);
-        Log::vError(
-            "PayDividendVisitor::Trigger: ERROR!! Failed issuing next "
-            "transaction "
-            "number while trying to send a voucher (while paying dividends.) "
-            "WAS TRYING TO PAY %" PRId64
-            " of instrument definition %s to Nym %s.\n",
+        Cheque theReturnVoucher(theNotaryID, thePayoutInstrumentDefinitionID);
+
+        // We're returning the money to its original sender.
+        const bool bIssueReturnVoucher = issue_voucher(
+            VALID_FROM,
+            VALID_TO,
+            theSenderNymID,
             lPayoutAmount,
-            strPayoutInstrumentDefinitionID.Get(),
-            strRecipientNymID.Get());
+            payout.number_,
+            theReturnVoucher);
+
+        if (bIssueReturnVoucher) {
+            // Return the voucher back to the payments inbox of the original
+            // sender.
+            //
+            if (send_voucher(theReturnVoucher, theSenderNymID)) {
+                // At the end of iterating all accounts, if
+                // m_lAmountPaidOut+m_lAmountReturned is less than
+                // lTotalPayoutAmount, then we return the rest to the sender.
+                m_lAmountReturned += lPayoutAmount;
+            }
+        } else {
+            const String strPayoutInstrumentDefinitionID(
+                thePayoutInstrumentDefinitionID),
+                strSenderNymID(theSenderNymID);
+            Log::vError(
+                "PayDividendVisitor::Trigger: ERROR "
+                "failed issuing voucher (to return back to "
+                "the dividend payout initiator, after a failed "
+                "payment attempt to the originally intended "
+                "recipient.) WAS TRYING TO PAY %" PRId64
+                " of instrument definition "
+                "%s to Nym %s.\n",
+                lPayoutAmount,
+                strPayoutInstrumentDefinitionID.Get(),
+                strSenderNymID.Get());
+        }
     }
 
     return bReturnValue;
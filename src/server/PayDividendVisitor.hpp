@@ -41,14 +41,18 @@
 
 #include "Internal.hpp"
 
+#include "opentxs/core/util/Common.hpp"
 #include "opentxs/core/AccountVisitor.hpp"
 
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 namespace opentxs
 {
 
 class Account;
+class Cheque;
 class Identifier;
 class String;
 
@@ -69,6 +73,18 @@ class Server;
 //
 class PayDividendVisitor : public AccountVisitor
 {
+    struct Payout {
+        OTIdentifier recipient_;
+        std::int64_t amount_{0};
+        TransactionNumber number_{0};
+        std::unique_ptr<Cheque> voucher_{nullptr};
+        bool issued_{false};
+
+        Payout(const Identifier& recipient, const std::int64_t amount);
+        Payout(Payout&&);
+        ~Payout();
+    };
+
     Identifier* m_pNymID{nullptr};
     Identifier* m_pPayoutInstrumentDefinitionID{nullptr};
     Identifier* m_pVoucherAcctID{nullptr};
@@ -108,6 +124,19 @@ public:
     std::int64_t GetAmountReturned() { return m_lAmountReturned; }
 
     bool Trigger(const Account& theAccount) override;
+    /** Reserves transaction numbers for the whole batch, then issues and
+     *  delivers the vouchers one at a time. */
+    bool TriggerBatch(const std::vector<const Account*>& accounts) override;
+
+private:
+    bool issue_voucher(
+        const time64_t& validFrom,
+        const time64_t& validTo,
+        const Identifier& recipient,
+        const std::int64_t amount,
+        const TransactionNumber number,
+        Cheque& voucher);
+    bool send_voucher(Cheque& voucher, const Identifier& recipient);
 };
 
 }  // namespace opentxs
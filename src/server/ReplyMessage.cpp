@@ -49,6 +49,7 @@
 #include "opentxs/core/String.hpp"
 
 #include "Server.hpp"
+#include "Trace.hpp"
 #include "UserCommandProcessor.hpp"
 
 #define OT_METHOD "opentxs::ReplyMessage::"
@@ -81,6 +82,9 @@ ReplyMessage::ReplyMessage(
     message_.m_strNymID = original_.m_strNymID;
     message_.m_strCommand = Message::ReplyCommand(type).c_str();
     message_.m_bSuccess = false;
+    // Clients only send range-encoded transaction statements to notaries
+    // which advertise that they can read them.
+    message_.SetRangeStatements();
     attach_request();
     init_ = init();
 }
@@ -95,6 +99,10 @@ std::set<RequestNumber> ReplyMessage::Acknowledged() const
 
 void ReplyMessage::attach_request()
 {
+    // The XML form of a binary request is regenerated without a signature,
+    // so a copy of it would prove nothing to the client
+    if (original_.Binary()) { return; }
+
     const std::string command = original_.m_strCommand.Get();
     const auto type = Message::Type(command);
 
@@ -145,6 +153,7 @@ void ReplyMessage::clear_request()
     switch (type) {
         case MessageType::checkNym:
         case MessageType::getNymbox:
+        case MessageType::getBoxReceipt:
         case MessageType::getAccountData:
         case MessageType::getInstrumentDefinition:
         case MessageType::getMint: {
@@ -162,7 +171,6 @@ void ReplyMessage::clear_request()
         case MessageType::queryInstrumentDefinitions:
         case MessageType::issueBasket:
         case MessageType::registerAccount:
-        case MessageType::getBoxReceipt:
         case MessageType::unregisterAccount:
         case MessageType::notarizeTransaction:
         case MessageType::processInbox:
@@ -335,8 +343,14 @@ void ReplyMessage::SetTargetNym(const String& nymID)
 
 ReplyMessage::~ReplyMessage()
 {
-    message_.SignContract(signer_);
-    message_.SaveContract();
+    // Replies to binary requests are signed once, in their binary form, by
+    // the caller. Only a reply which is dropped into the nymbox needs the
+    // signed XML form.
+    if ((false == original_.Binary()) || drop_) {
+        Trace::Span span(server_.Tracer(), Trace::Stage::SignReply);
+        message_.SignContract(signer_);
+        message_.SaveContract();
+    }
 
     if (drop_ && context_) {
         UserCommandProcessor::drop_reply_notice_to_nymbox(
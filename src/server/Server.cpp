@@ -68,6 +68,7 @@
 #include "opentxs/ext/OTPayment.hpp"
 
 #include "ConfigLoader.hpp"
+#include "ServerSettings.hpp"
 #include "Transactor.hpp"
 
 #include <sys/types.h>
@@ -114,14 +115,16 @@ Server::Server(
     const opentxs::api::Settings& config,
     const opentxs::api::Server& mint,
     const opentxs::api::storage::Storage& storage,
-    const opentxs::api::client::Wallet& wallet)
+    const opentxs::api::client::Wallet& wallet,
+    const ThreadPool& pool)
     : crypto_(crypto)
     , config_(config)
     , mint_(mint)
     , storage_(storage)
     , wallet_(wallet)
+    , trace_()
     , mainFile_(*this, crypto_, wallet_)
-    , notary_(*this, mint_, wallet_)
+    , notary_(*this, mint_, wallet_, pool)
     , transactor_(this)
     , userCommandProcessor_(*this, config_, mint_, wallet_)
     , m_strWalletFilename()
@@ -599,6 +602,8 @@ void Server::Init(bool readOnly)
         }
     }
 
+    Ledger::SetMerkleBoxes(m_notaryID, ServerSettings::GetMerkleBoxes());
+
     auto password = crypto_.Encode().Nonce(16);
     String notUsed;
     bool ignored;
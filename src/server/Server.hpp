@@ -49,6 +49,7 @@
 #include "Transactor.hpp"
 #include "Notary.hpp"
 #include "MainFile.hpp"
+#include "Trace.hpp"
 #include "UserCommandProcessor.hpp"
 
 #include <cstddef>
@@ -81,6 +82,7 @@ public:
     bool IsFlaggedForShutdown() const;
 
     void ActivateCron();
+    const opentxs::api::Crypto& Crypto() const { return crypto_; }
     UserCommandProcessor& CommandProcessor() { return userCommandProcessor_; }
     std::int64_t ComputeTimeout() { return m_Cron.computeTimeout(); }
     OTCron& Cron() { return m_Cron; }
@@ -102,6 +104,7 @@ public:
         const Identifier& recipientNymID,
         const OTPayment* payment,
         const char* command);
+    Trace& Tracer() { return trace_; }
     String& WalletFilename() { return m_strWalletFilename; }
 
     ~Server();
@@ -120,6 +123,7 @@ private:
     const opentxs::api::Server& mint_;
     const opentxs::api::storage::Storage& storage_;
     const opentxs::api::client::Wallet& wallet_;
+    Trace trace_;
     MainFile mainFile_;
     Notary notary_;
     Transactor transactor_;
@@ -144,7 +148,8 @@ private:
         const opentxs::api::Settings& config,
         const opentxs::api::Server& mint,
         const opentxs::api::storage::Storage& storage,
-        const opentxs::api::client::Wallet& wallet);
+        const opentxs::api::client::Wallet& wallet,
+        const ThreadPool& pool);
 
     void CreateMainFile(bool& mainFileExists);
     // Note: SendInstrumentToNym and SendMessageToNym CALL THIS.
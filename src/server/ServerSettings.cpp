@@ -57,6 +57,10 @@ std::int32_t ServerSettings::__heartbeat_ms_between_beats = 100;
 // The Nym who's allowed to do certain
 // commands even if they are turned off.
 std::string ServerSettings::__override_nym_id;
+// Local endpoint for per-command trace reports. Disabled when empty.
+std::string ServerSettings::__trace_endpoint;
+// Upgrade this notary's boxes to the Merkle format when they are next saved.
+bool ServerSettings::__merkle_boxes = false;
 
 // NOTE: These are all static variables, and these are all just default values.
 //       (The ACTUAL values are configured in ~/.ot/server.cfg)
@@ -84,6 +84,17 @@ struct ServerSettings {
         __override_nym_id = id;
     }
 
+    static const std::string& GetTraceEndpoint() { return __trace_endpoint; }
+
+    static void SetTraceEndpoint(const std::string& endpoint)
+    {
+        __trace_endpoint = endpoint;
+    }
+
+    static bool GetMerkleBoxes() { return __merkle_boxes; }
+
+    static void SetMerkleBoxes(bool value) { __merkle_boxes = value; }
+
     static std::int64_t __min_market_scale;
 
     static std::int32_t __heartbeat_no_requests;
@@ -91,6 +102,11 @@ struct ServerSettings {
 
     // The Nym who's allowed to do certain commands even if they are turned off.
     static std::string __override_nym_id;
+    // Where to answer requests for the per-command trace report. Empty
+    // disables the endpoint.
+    static std::string __trace_endpoint;
+    // Are this notary's boxes saved in the Merkle format?
+    static bool __merkle_boxes;
     // Are usage credits REQUIRED in order to use this server?
     static bool __admin_usage_credits;
     // Is server currently locked to non-override Nyms?
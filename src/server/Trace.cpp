@@ -0,0 +1,221 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "stdafx.hpp"
+
+#include "Trace.hpp"
+
+#include "opentxs/core/Log.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+#define OT_METHOD "opentxs::server::Trace::"
+
+namespace opentxs::server
+{
+const std::array<std::string, Trace::Stages> Trace::stage_names_{
+    {"total",
+     "decode",
+     "parse",
+     "verify",
+     "load_context",
+     "load_box",
+     "save_box",
+     "notarize",
+     "sign_reply",
+     "encode"}};
+
+Trace::Request::Request(Trace& trace)
+    : trace_(trace)
+    , success_(false)
+{
+    trace_.begin();
+}
+
+void Trace::Request::SetCommand(const std::string& command)
+{
+    trace_.set_command(command);
+}
+
+void Trace::Request::SetSuccess(const bool success) { success_ = success; }
+
+Trace::Request::~Request() { trace_.end(success_); }
+
+Trace::Span::Span(Trace& trace, const Stage stage)
+    : trace_(trace)
+    , stage_(stage)
+    , start_(std::chrono::steady_clock::now())
+{
+}
+
+Trace::Span::~Span()
+{
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_);
+    trace_.record(stage_, static_cast<std::uint64_t>(elapsed.count()));
+}
+
+void Trace::Histogram::Add(const std::uint64_t micros)
+{
+    std::size_t bucket{0};
+
+    while ((bucket < (Buckets - 1)) &&
+           ((std::uint64_t(1) << bucket) < micros)) {
+        ++bucket;
+    }
+
+    ++count_;
+    sum_ += micros;
+    max_ = std::max(max_, micros);
+    ++buckets_[bucket];
+}
+
+// Returns the upper bound of the bucket containing the requested quantile
+std::uint64_t Trace::Histogram::Quantile(const double quantile) const
+{
+    const auto target = static_cast<std::uint64_t>(quantile * count_);
+    std::uint64_t seen{0};
+
+    for (std::size_t i = 0; i < (Buckets - 1); ++i) {
+        seen += buckets_[i];
+
+        if (seen > target) {
+            return std::min(std::uint64_t(1) << i, max_);
+        }
+    }
+
+    return max_;
+}
+
+void Trace::begin()
+{
+    Lock lock(lock_);
+    active_ = true;
+    command_.clear();
+    start_ = std::chrono::steady_clock::now();
+    current_.fill(0);
+    touched_.fill(false);
+}
+
+void Trace::end(const bool success)
+{
+    Lock lock(lock_);
+
+    if (false == active_) { return; }
+
+    active_ = false;
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_);
+    const auto total = static_cast<std::size_t>(Stage::Total);
+    current_[total] = static_cast<std::uint64_t>(elapsed.count());
+    touched_[total] = true;
+
+    if (command_.empty()) { command_ = "unknown"; }
+
+    auto& command = commands_[command_];
+    std::stringstream breakdown{};
+
+    if (false == success) { ++command.failed_; }
+
+    for (std::size_t i = 0; i < Stages; ++i) {
+        if (false == touched_[i]) { continue; }
+
+        command.stages_[i].Add(current_[i]);
+        breakdown << " " << stage_names_[i] << "=" << current_[i] << "us";
+    }
+
+    otInfo << OT_METHOD << __FUNCTION__ << ": " << command_
+           << (success ? "" : " (failed)") << breakdown.str() << std::endl;
+}
+
+void Trace::record(const Stage stage, const std::uint64_t micros)
+{
+    Lock lock(lock_);
+
+    if (false == active_) { return; }
+
+    const auto index = static_cast<std::size_t>(stage);
+
+    OT_ASSERT(index < Stages);
+
+    current_[index] += micros;
+    touched_[index] = true;
+}
+
+std::string Trace::Report() const
+{
+    std::stringstream output{};
+    Lock lock(lock_);
+
+    for (const auto& [name, command] : commands_) {
+        for (std::size_t i = 0; i < Stages; ++i) {
+            const auto& histogram = command.stages_[i];
+
+            if (0 == histogram.count_) { continue; }
+
+            output << name << " " << stage_names_[i]
+                   << " count=" << histogram.count_;
+
+            if (static_cast<std::size_t>(Stage::Total) == i) {
+                output << " failed=" << command.failed_;
+            }
+
+            output << " sum_us=" << histogram.sum_
+                   << " mean_us=" << (histogram.sum_ / histogram.count_)
+                   << " p50_us=" << histogram.Quantile(0.5)
+                   << " p99_us=" << histogram.Quantile(0.99)
+                   << " max_us=" << histogram.max_ << "\n";
+        }
+    }
+
+    return output.str();
+}
+
+void Trace::Reset()
+{
+    Lock lock(lock_);
+    commands_.clear();
+}
+
+void Trace::set_command(const std::string& command)
+{
+    Lock lock(lock_);
+    command_ = command;
+}
+}  // namespace opentxs::server
@@ -0,0 +1,170 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_SERVER_TRACE_HPP
+#define OPENTXS_SERVER_TRACE_HPP
+
+#include "Internal.hpp"
+
+#include "opentxs/core/Lockable.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace opentxs
+{
+namespace server
+{
+/** Per-request timing of the stages of processing a user command
+ *
+ *  MessageProcessor opens a Request for every incoming message. Spans
+ *  created while the request is open accumulate into it; spans created
+ *  outside of a request (such as by cron) are ignored. Spans may nest, so
+ *  the time spent loading boxes during notarization is counted in both
+ *  stages.
+ *
+ *  When the request closes its breakdown is logged and added to a set of
+ *  histograms kept per command, which Report() renders as text.
+ */
+class Trace : Lockable
+{
+public:
+    enum class Stage : std::uint8_t {
+        Total = 0,
+        Decode = 1,
+        Parse = 2,
+        Verify = 3,
+        LoadContext = 4,
+        LoadBox = 5,
+        SaveBox = 6,
+        Notarize = 7,
+        SignReply = 8,
+        Encode = 9,
+    };
+
+    class Request
+    {
+    public:
+        void SetCommand(const std::string& command);
+        void SetSuccess(const bool success);
+
+        explicit Request(Trace& trace);
+
+        ~Request();
+
+    private:
+        Trace& trace_;
+        bool success_{false};
+
+        Request() = delete;
+        Request(const Request&) = delete;
+        Request(Request&&) = delete;
+        Request& operator=(const Request&) = delete;
+        Request& operator=(Request&&) = delete;
+    };
+
+    class Span
+    {
+    public:
+        Span(Trace& trace, const Stage stage);
+
+        ~Span();
+
+    private:
+        Trace& trace_;
+        const Stage stage_;
+        const std::chrono::steady_clock::time_point start_;
+
+        Span() = delete;
+        Span(const Span&) = delete;
+        Span(Span&&) = delete;
+        Span& operator=(const Span&) = delete;
+        Span& operator=(Span&&) = delete;
+    };
+
+    std::string Report() const;
+    void Reset();
+
+    Trace() = default;
+
+    ~Trace() = default;
+
+private:
+    static const std::size_t Stages{10};
+    static const std::size_t Buckets{24};
+
+    struct Histogram {
+        std::uint64_t count_{0};
+        std::uint64_t sum_{0};
+        std::uint64_t max_{0};
+        std::array<std::uint64_t, Buckets> buckets_{};
+
+        void Add(const std::uint64_t micros);
+        std::uint64_t Quantile(const double quantile) const;
+    };
+
+    struct Command {
+        std::uint64_t failed_{0};
+        std::array<Histogram, Stages> stages_{};
+    };
+
+    static const std::array<std::string, Stages> stage_names_;
+
+    bool active_{false};
+    std::string command_{};
+    std::chrono::steady_clock::time_point start_{};
+    std::array<std::uint64_t, Stages> current_{};
+    std::array<bool, Stages> touched_{};
+    std::map<std::string, Command> commands_{};
+
+    void begin();
+    void end(const bool success);
+    void record(const Stage stage, const std::uint64_t micros);
+    void set_command(const std::string& command);
+
+    Trace(const Trace&) = delete;
+    Trace(Trace&&) = delete;
+    Trace& operator=(const Trace&) = delete;
+    Trace& operator=(Trace&&) = delete;
+};
+}  // namespace server
+}  // namespace opentxs
+#endif  // OPENTXS_SERVER_TRACE_HPP
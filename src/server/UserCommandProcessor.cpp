@@ -79,6 +79,7 @@
 #include "Server.hpp"
 #include "ReplyMessage.hpp"
 #include "ServerSettings.hpp"
+#include "Trace.hpp"
 #include "Transactor.hpp"
 
 #include <cinttypes>
@@ -300,8 +301,15 @@ void UserCommandProcessor::check_acknowledgements(ReplyMessage& reply) const
     auto numlist_ack_reply = reply.Acknowledged();
     const auto nymID = Identifier::Factory(context.RemoteNym().ID());
     Ledger nymbox(nymID, nymID, NOTARY_ID);
+    bool loaded{false};
 
-    if (nymbox.LoadNymbox() && nymbox.VerifySignature(server_.GetServerNym())) {
+    {
+        Trace::Span span(server_.Tracer(), Trace::Stage::LoadBox);
+        loaded = nymbox.LoadNymbox() &&
+                 nymbox.VerifySignature(server_.GetServerNym());
+    }
+
+    if (loaded) {
         bool bIsDirtyNymbox = false;
 
         for (auto& it : numlist_ack_reply) {
@@ -346,6 +354,7 @@ void UserCommandProcessor::check_acknowledgements(ReplyMessage& reply) const
         }
 
         if (bIsDirtyNymbox) {
+            Trace::Span span(server_.Tracer(), Trace::Stage::SaveBox);
             nymbox.ReleaseSignatures();
             nymbox.SignContract(server_.GetServerNym());
             nymbox.SaveContract();
@@ -378,8 +387,14 @@ bool UserCommandProcessor::check_client_nym(ReplyMessage& reply) const
 {
     const auto& msgIn = reply.Original();
     const auto& nym = reply.Context().RemoteNym();
+    bool verified{false};
 
-    if (false == msgIn.VerifySignature(nym)) {
+    {
+        Trace::Span span(server_.Tracer(), Trace::Stage::Verify);
+        verified = msgIn.VerifySignature(nym);
+    }
+
+    if (false == verified) {
         otErr << OT_METHOD << __FUNCTION__
               << ": Unable to verify message signature." << std::endl;
 
@@ -1454,8 +1469,12 @@ bool UserCommandProcessor::cmd_notarize_transaction(ReplyMessage& reply) const
             inputNumber));
 
         bool success{false};
-        server_.GetNotary().NotarizeTransaction(
-            context, *transaction, *response.Response(), success);
+
+        {
+            Trace::Span span(server_.Tracer(), Trace::Stage::Notarize);
+            server_.GetNotary().NotarizeTransaction(
+                context, *transaction, *response.Response(), success);
+        }
 
         if (response.Response()->IsCancelled()) {
             otErr << OT_METHOD << __FUNCTION__
@@ -1563,7 +1582,7 @@ bool UserCommandProcessor::cmd_process_inbox(ReplyMessage& reply) const
     // ownership, signatures, and transaction number on each item. That way
     // those things don't have to be checked for security over and over again in
     // the subsequent calls.
-    if (false == processInbox->VerifyItems(nym)) {
+    if (false == processInbox->VerifyItems(server_.Crypto(), nym)) {
         otErr << OT_METHOD << __FUNCTION__
               << ": Failed to verify transaction items. " << std::endl;
 
@@ -1595,12 +1614,17 @@ bool UserCommandProcessor::cmd_process_inbox(ReplyMessage& reply) const
         originType::not_applicable,
         inputNumber));
     bool transactionSuccess{false};
-    server_.GetNotary().NotarizeProcessInbox(
-        context,
-        account,
-        *processInbox,
-        *response.Response(),
-        transactionSuccess);
+
+    {
+        Trace::Span span(server_.Tracer(), Trace::Stage::Notarize);
+        server_.GetNotary().NotarizeProcessInbox(
+            context,
+            account,
+            *processInbox,
+            *response.Response(),
+            transactionSuccess);
+    }
+
     const auto consumed = context.ConsumeIssued(inputNumber);
 
     if (false == consumed) {
@@ -1696,8 +1720,12 @@ bool UserCommandProcessor::cmd_process_nymbox(ReplyMessage& reply) const
             transaction->GetTransactionNum()));
 
         bool success{false};
-        server_.GetNotary().NotarizeProcessNymbox(
-            context, *transaction, *response.Response(), success);
+
+        {
+            Trace::Span span(server_.Tracer(), Trace::Stage::Notarize);
+            server_.GetNotary().NotarizeProcessNymbox(
+                context, *transaction, *response.Response(), success);
+        }
 
         if (success) {
             otErr << OT_METHOD << __FUNCTION__
@@ -2077,8 +2105,14 @@ bool UserCommandProcessor::cmd_register_nym(ReplyMessage& reply) const
     }
 
     otLog3 << OT_METHOD << __FUNCTION__ << ": Nym verified!" << std::endl;
+    bool verified{false};
+
+    {
+        Trace::Span span(server_.Tracer(), Trace::Stage::Verify);
+        verified = msgIn.VerifySignature(*sender_nym);
+    }
 
-    if (false == msgIn.VerifySignature(*sender_nym)) {
+    if (false == verified) {
         otErr << OT_METHOD << __FUNCTION__ << ": Invalid signature."
               << sender_nym->ID().str() << std::endl;
 
@@ -2593,6 +2627,8 @@ std::unique_ptr<Ledger> UserCommandProcessor::load_inbox(
     const Nym& serverNym,
     const bool verifyAccount) const
 {
+    Trace::Span span(server_.Tracer(), Trace::Stage::LoadBox);
+
     if (accountID == nymID) {
         otErr << OT_METHOD << __FUNCTION__ << ": Invalid account ID "
               << String(accountID) << std::endl;
@@ -2638,6 +2674,8 @@ std::unique_ptr<Ledger> UserCommandProcessor::load_nymbox(
     const Nym& serverNym,
     const bool verifyAccount) const
 {
+    Trace::Span span(server_.Tracer(), Trace::Stage::LoadBox);
+
     std::unique_ptr<Ledger> nymbox;
     nymbox.reset(new Ledger(nymID, nymID, serverID));
 
@@ -2679,6 +2717,8 @@ std::unique_ptr<Ledger> UserCommandProcessor::load_outbox(
     const Nym& serverNym,
     const bool verifyAccount) const
 {
+    Trace::Span span(server_.Tracer(), Trace::Stage::LoadBox);
+
     if (accountID == nymID) {
         otErr << OT_METHOD << __FUNCTION__ << ": Invalid account ID "
               << String(accountID) << std::endl;
@@ -2751,7 +2791,14 @@ bool UserCommandProcessor::ProcessUserCommand(
         }
     }
 
-    if (false == reply.LoadContext()) { return false; }
+    bool loaded{false};
+
+    {
+        Trace::Span span(server_.Tracer(), Trace::Stage::LoadContext);
+        loaded = reply.LoadContext();
+    }
+
+    if (false == loaded) { return false; }
 
     if (false == check_client_nym(reply)) { return false; }
 
@@ -2934,6 +2981,7 @@ bool UserCommandProcessor::reregister_nym(ReplyMessage& reply) const
 
 bool UserCommandProcessor::save_box(const Nym& nym, Ledger& box) const
 {
+    Trace::Span span(server_.Tracer(), Trace::Stage::SaveBox);
     box.ReleaseSignatures();
 
     if (false == box.SignContract(nym)) { return false; }
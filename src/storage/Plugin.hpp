@@ -48,7 +48,9 @@
 #include "opentxs/Types.hpp"
 
 #include <atomic>
+#include <memory>
 #include <string>
+#include <typeinfo>
 
 namespace opentxs
 {
@@ -134,17 +136,27 @@ private:
 template <class T>
 bool opentxs::api::storage::Driver::LoadProto(
     const std::string& hash,
-    std::shared_ptr<T>& serialized,
+    std::shared_ptr<const T>& serialized,
     const bool checking) const
 {
+    const std::string key = hash + ":" + typeid(T).name();
+    std::shared_ptr<const void> cached{nullptr};
+
+    if (cached_object(key, cached)) {
+        serialized = std::static_pointer_cast<const T>(cached);
+
+        return true;
+    }
+
     std::string raw;
     const bool loaded = Load(hash, checking, raw);
     bool valid = false;
+    std::shared_ptr<T> parsed{nullptr};
 
     if (loaded) {
-        serialized.reset(new T);
-        serialized->ParseFromArray(raw.data(), raw.size());
-        valid = proto::Validate<T>(*serialized, VERBOSE);
+        parsed.reset(new T);
+        parsed->ParseFromArray(raw.data(), raw.size());
+        valid = proto::Validate<T>(*parsed, VERBOSE);
     }
 
     if (!valid) {
@@ -162,9 +174,27 @@ bool opentxs::api::storage::Driver::LoadProto(
 
     OT_ASSERT(valid);
 
+    serialized = parsed;
+    cache_object(key, serialized);
+
     return valid;
 }
 
+template <class T>
+bool opentxs::api::storage::Driver::LoadProto(
+    const std::string& hash,
+    std::shared_ptr<T>& serialized,
+    const bool checking) const
+{
+    std::shared_ptr<const T> shared{nullptr};
+    const bool loaded = LoadProto<T>(hash, shared, checking);
+
+    // The caller may modify its copy, so it can not share the cached one
+    if (loaded) { serialized.reset(new T(*shared)); }
+
+    return loaded;
+}
+
 template <class T>
 bool opentxs::api::storage::Driver::StoreProto(
     const T& data,
@@ -42,6 +42,7 @@
 #include "Internal.hpp"
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <string>
@@ -51,6 +52,7 @@
 #define STORAGE_CONFIG_PRIMARY_PLUGIN_KEY "primary_plugin"
 #define STORAGE_CONFIG_FS_BACKUP_DIRECTORY_KEY "fs_backup_directory"
 #define STORAGE_CONFIG_FS_ENCRYPTED_BACKUP_DIRECTORY_KEY "fs_encrypted_backup"
+#define STORAGE_CONFIG_OBJECT_CACHE_SIZE_KEY "object_cache_size"
 
 namespace C = std::chrono;
 
@@ -69,6 +71,8 @@ public:
         C::duration_cast<C::seconds>(C::hours(1)).count();
     std::string path_{};
     InsertCB dht_callback_{};
+    // Maximum number of parsed objects kept in memory. Zero disables the cache
+    std::size_t object_cache_size_{4096};
 
 #if OT_STORAGE_SQLITE
     std::string primary_plugin_ = OT_STORAGE_PRIMARY_PLUGIN_SQLITE;
@@ -60,6 +60,9 @@
 
 #include <limits>
 
+// Number of independently locked partitions of the parsed object cache
+#define OT_STORAGE_OBJECT_CACHE_SHARDS 16
+
 #define OT_METHOD "opentxs::StorageMultiplex::"
 
 namespace opentxs
@@ -80,10 +83,25 @@ StorageMultiplex::StorageMultiplex(
     , backup_plugins_()
     , digest_(hash)
     , random_(random)
+    , object_cache_(config.object_cache_size_, OT_STORAGE_OBJECT_CACHE_SHARDS)
 {
     Init_StorageMultiplex(primary, migrate, previous);
 }
 
+void StorageMultiplex::cache_object(
+    const std::string& key,
+    const std::shared_ptr<const void>& object) const
+{
+    object_cache_.Put(key, object);
+}
+
+bool StorageMultiplex::cached_object(
+    const std::string& key,
+    std::shared_ptr<const void>& object) const
+{
+    return object_cache_.Get(key, object);
+}
+
 std::string StorageMultiplex::best_root(bool& primaryOutOfSync)
 {
     OT_ASSERT(primary_plugin_);
@@ -392,6 +410,12 @@ void StorageMultiplex::migrate_primary(
     old.reset(newPlugin.release());
 }
 
+ShardedLRU<std::string, std::shared_ptr<const void>>::Stats StorageMultiplex::
+    ObjectCacheStats() const
+{
+    return object_cache_.GetStats();
+}
+
 opentxs::api::storage::Driver& StorageMultiplex::Primary()
 {
     OT_ASSERT(primary_plugin_);
@@ -44,7 +44,10 @@
 #include "opentxs/api/storage/Driver.hpp"
 #include "opentxs/Types.hpp"
 
+#include "util/LRU.hpp"
+
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace opentxs
@@ -116,6 +119,14 @@ private:
     std::vector<std::unique_ptr<opentxs::api::storage::Plugin>> backup_plugins_;
     const Digest digest_;
     const Random random_;
+    mutable ShardedLRU<std::string, std::shared_ptr<const void>> object_cache_;
+
+    void cache_object(
+        const std::string& key,
+        const std::shared_ptr<const void>& object) const override;
+    bool cached_object(
+        const std::string& key,
+        std::shared_ptr<const void>& object) const override;
 
     StorageMultiplex(
         const api::storage::Storage& storage,
@@ -146,6 +157,8 @@ private:
     void InitBackup();
     void InitEncryptedBackup(std::unique_ptr<SymmetricKey>& key);
     void migrate_primary(const std::string& from, const std::string& to);
+    ShardedLRU<std::string, std::shared_ptr<const void>>::Stats
+    ObjectCacheStats() const;
     opentxs::api::storage::Driver& Primary();
     void synchronize_plugins(
         const std::string& hash,
@@ -355,7 +355,7 @@ Accounts::AccountData& Accounts::get_account_data(
 void Accounts::init(const std::string& hash)
 {
     Lock lock(write_lock_);
-    std::shared_ptr<proto::StorageAccounts> serialized{nullptr};
+    std::shared_ptr<const proto::StorageAccounts> serialized{nullptr};
     driver_.LoadProto(hash, serialized);
 
     if (false == bool(serialized)) {
@@ -70,7 +70,8 @@ bool BlockchainTransactions::Delete(const std::string& id)
 
 void BlockchainTransactions::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageBlockchainTransactions> serialized{nullptr};
+    std::shared_ptr<const proto::StorageBlockchainTransactions> serialized{
+        nullptr};
     driver_.LoadProto(hash, serialized);
 
     if (false == bool(serialized)) {
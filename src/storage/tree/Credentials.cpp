@@ -100,7 +100,7 @@ bool Credentials::Delete(const std::string& id) { return delete_item(id); }
 
 void Credentials::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageCredentials> serialized;
+    std::shared_ptr<const proto::StorageCredentials> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
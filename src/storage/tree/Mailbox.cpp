@@ -63,7 +63,7 @@ bool Mailbox::Delete(const std::string& id) { return delete_item(id); }
 
 void Mailbox::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageNymList> serialized;
+    std::shared_ptr<const proto::StorageNymList> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
@@ -152,7 +152,7 @@ protected:
 
         for (const auto& it : copy) {
             const auto& hash = std::get<0>(it.second);
-            std::shared_ptr<T> serialized;
+            std::shared_ptr<const T> serialized;
 
             if (Node::BLANK_HASH == hash) { continue; }
 
@@ -177,9 +177,9 @@ protected:
         // hasn't been updated
         // ...so we have to load the object just to be sure
         if (0 == revision) {
-            std::shared_ptr<T> existing{nullptr};
+            std::shared_ptr<const T> existing{nullptr};
 
-            if (false == driver_.LoadProto(hash, existing, false)) {
+            if (false == driver_.LoadProto<T>(hash, existing, false)) {
                 otErr << method << __FUNCTION__ << ": Unable to load object."
                       << std::endl;
 
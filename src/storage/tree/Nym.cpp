@@ -257,7 +257,7 @@ const PeerReplies& Nym::IncomingReplyBox() const
 
 void Nym::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageNym> serialized;
+    std::shared_ptr<const proto::StorageNym> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
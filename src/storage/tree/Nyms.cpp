@@ -81,7 +81,7 @@ bool Nyms::Exists(const std::string& id) const
 
 void Nyms::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageNymList> serialized;
+    std::shared_ptr<const proto::StorageNymList> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
@@ -44,6 +44,11 @@
 
 #include "storage/Plugin.hpp"
 
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <iterator>
+
 #define CURRENT_VERSION 1
 
 #define OT_METHOD "opentxs::storage::PaymentWorkflows::"
@@ -61,6 +66,7 @@ PaymentWorkflows::PaymentWorkflows(
     , workflow_state_map_()
     , type_workflow_map_()
     , state_workflow_map_()
+    , workflow_time_map_()
 {
     if (check_hash(hash)) {
         init(hash);
@@ -91,6 +97,7 @@ bool PaymentWorkflows::Delete(const std::string& id)
 {
     Lock lock(write_lock_);
     delete_by_value(id);
+    workflow_time_map_.erase(id);
     lock.unlock();
 
     return delete_item(id);
@@ -131,7 +138,7 @@ PaymentWorkflows::State PaymentWorkflows::GetState(
 
 void PaymentWorkflows::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StoragePaymentWorkflows> serialized;
+    std::shared_ptr<const proto::StoragePaymentWorkflows> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
@@ -144,9 +151,31 @@ void PaymentWorkflows::init(const std::string& hash)
 
     if (CURRENT_VERSION > version_) { version_ = CURRENT_VERSION; }
 
+    std::vector<std::pair<std::string, std::string>> untimed{};
+
     for (const auto& it : serialized->workflow()) {
-        item_map_.emplace(
-            it.itemid(), Metadata{it.hash(), it.alias(), 0, false});
+        const auto& id = it.itemid();
+        item_map_.emplace(id, Metadata{it.hash(), "", 0, false});
+        std::int64_t time{0};
+
+        if (parse_time(it.alias(), time)) {
+            workflow_time_map_.emplace(id, time);
+        } else {
+            untimed.emplace_back(id, it.hash());
+        }
+    }
+
+    // Indices written before event times were persisted are missing them.
+    // They are recovered here once and written with the next save.
+    for (const auto& [id, hash] : untimed) {
+        std::shared_ptr<const proto::PaymentWorkflow> workflow{};
+
+        if (driver_.LoadProto(hash, workflow, false)) {
+            workflow_time_map_.emplace(id, last_event(*workflow));
+        } else {
+            otErr << OT_METHOD << __FUNCTION__ << ": Failed to load workflow "
+                  << id << std::endl;
+        }
     }
 
     for (const auto& it : serialized->items()) {
@@ -173,6 +202,39 @@ void PaymentWorkflows::init(const std::string& hash)
     }
 }
 
+std::int64_t PaymentWorkflows::last_event(
+    const proto::PaymentWorkflow& workflow)
+{
+    std::int64_t output{0};
+
+    for (const auto& event : workflow.event()) {
+        output = std::max(output, static_cast<std::int64_t>(event.time()));
+    }
+
+    return output;
+}
+
+bool PaymentWorkflows::parse_time(
+    const std::string& input,
+    std::int64_t& output)
+{
+    if (input.empty()) { return false; }
+
+    errno = 0;
+    char* end{nullptr};
+    const auto value = std::strtoll(input.c_str(), &end, 10);
+
+    if ((0 != errno) || (input.c_str() + input.size() != end)) {
+        return false;
+    }
+
+    if (0 > value) { return false; }
+
+    output = value;
+
+    return true;
+}
+
 PaymentWorkflows::Workflows PaymentWorkflows::ListByAccount(
     const std::string& accountID) const
 {
@@ -227,6 +289,132 @@ std::string PaymentWorkflows::LookupBySource(const std::string& sourceID) const
     return it->second;
 }
 
+// Intersects the index sets selected by the query, smallest first
+std::vector<std::string> PaymentWorkflows::match(
+    const Lock& lock,
+    const PaymentWorkflowQuery& query) const
+{
+    OT_ASSERT(verify_write_lock(lock))
+
+    std::vector<const Workflows*> sets{};
+    Workflows byState{};
+
+    if (false == query.account_.empty()) {
+        const auto it = account_workflow_map_.find(query.account_);
+
+        if (account_workflow_map_.end() == it) { return {}; }
+
+        sets.emplace_back(&it->second);
+    }
+
+    if (false == query.unit_.empty()) {
+        const auto it = unit_workflow_map_.find(query.unit_);
+
+        if (unit_workflow_map_.end() == it) { return {}; }
+
+        sets.emplace_back(&it->second);
+    }
+
+    const bool type = (proto::PAYMENTWORKFLOWTYPE_ERROR != query.type_);
+    const bool state = (proto::PAYMENTWORKFLOWSTATE_ERROR != query.state_);
+
+    if (type && state) {
+        const auto it =
+            state_workflow_map_.find(State{query.type_, query.state_});
+
+        if (state_workflow_map_.end() == it) { return {}; }
+
+        sets.emplace_back(&it->second);
+    } else if (type) {
+        const auto it = type_workflow_map_.find(query.type_);
+
+        if (type_workflow_map_.end() == it) { return {}; }
+
+        sets.emplace_back(&it->second);
+    } else if (state) {
+        for (const auto& [key, workflows] : state_workflow_map_) {
+            if (query.state_ == key.second) {
+                byState.insert(workflows.begin(), workflows.end());
+            }
+        }
+
+        sets.emplace_back(&byState);
+    }
+
+    std::vector<std::string> output{};
+
+    if (sets.empty()) {
+        for (const auto& it : item_map_) { output.emplace_back(it.first); }
+
+        return output;
+    }
+
+    std::sort(sets.begin(), sets.end(), [](const auto* lhs, const auto* rhs) {
+        return lhs->size() < rhs->size();
+    });
+    output.assign(sets.front()->begin(), sets.front()->end());
+
+    for (auto it = std::next(sets.begin()); it != sets.end(); ++it) {
+        if (output.empty()) { break; }
+
+        const auto& next = **it;
+        std::vector<std::string> intersection{};
+        std::set_intersection(
+            output.begin(),
+            output.end(),
+            next.begin(),
+            next.end(),
+            std::back_inserter(intersection));
+        output.swap(intersection);
+    }
+
+    return output;
+}
+
+std::vector<std::string> PaymentWorkflows::Query(
+    const PaymentWorkflowQuery& query) const
+{
+    Lock lock(write_lock_);
+    auto matched = match(lock, query);
+    std::vector<std::pair<std::int64_t, std::string>> ordered{};
+
+    for (auto& id : matched) {
+        const auto it = workflow_time_map_.find(id);
+        const std::int64_t time =
+            (workflow_time_map_.end() == it) ? 0 : it->second;
+
+        if ((0 != query.from_) && (time < query.from_)) { continue; }
+
+        if ((0 != query.to_) && (time > query.to_)) { continue; }
+
+        ordered.emplace_back(time, std::move(id));
+    }
+
+    lock.unlock();
+    std::sort(
+        ordered.begin(), ordered.end(), [](const auto& lhs, const auto& rhs) {
+            if (lhs.first != rhs.first) { return lhs.first > rhs.first; }
+
+            return lhs.second < rhs.second;
+        });
+    std::vector<std::string> output{};
+
+    if (query.offset_ >= ordered.size()) { return output; }
+
+    auto end = ordered.end();
+    const auto available = ordered.size() - query.offset_;
+
+    if ((0 != query.limit_) && (query.limit_ < available)) {
+        end = std::next(ordered.begin(), query.offset_ + query.limit_);
+    }
+
+    for (auto it = std::next(ordered.begin(), query.offset_); it != end; ++it) {
+        output.emplace_back(std::move(it->second));
+    }
+
+    return output;
+}
+
 void PaymentWorkflows::reindex(
     const Lock& lock,
     const std::string& workflowID,
@@ -277,8 +465,13 @@ proto::StoragePaymentWorkflows PaymentWorkflows::serialize() const
         const bool good = goodID && goodHash;
 
         if (good) {
-            serialize_index(
-                item.first, item.second, *serialized.add_workflow());
+            auto& index = *serialized.add_workflow();
+            serialize_index(item.first, item.second, index);
+            const auto time = workflow_time_map_.find(item.first);
+
+            if (workflow_time_map_.end() != time) {
+                index.set_alias(std::to_string(time->second));
+            }
         }
     }
 
@@ -369,6 +562,8 @@ bool PaymentWorkflows::Store(
         unit_workflow_map_[unit].emplace(id);
     }
 
+    workflow_time_map_[id] = last_event(data);
+
     return store_proto(lock, data, id, alias, plaintext);
 }
 }  // namespace opentxs::storage
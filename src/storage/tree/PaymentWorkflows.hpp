@@ -47,6 +47,12 @@
 
 #include "Node.hpp"
 
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
 namespace opentxs::storage
 {
 class PaymentWorkflows : public Node
@@ -67,6 +73,7 @@ public:
         std::shared_ptr<proto::PaymentWorkflow>& output,
         const bool checking) const;
     std::string LookupBySource(const std::string& sourceID) const;
+    std::vector<std::string> Query(const PaymentWorkflowQuery& query) const;
 
     bool Delete(const std::string& id);
     bool Store(const proto::PaymentWorkflow& data, std::string& plaintext);
@@ -83,6 +90,13 @@ private:
     std::map<std::string, State> workflow_state_map_;
     std::map<proto::PaymentWorkflowType, Workflows> type_workflow_map_;
     std::map<State, Workflows> state_workflow_map_;
+    // Time of the most recent event in each workflow. Persisted in the alias
+    // field of the workflow's index entry, which workflows otherwise leave
+    // empty.
+    std::map<std::string, std::int64_t> workflow_time_map_;
+
+    static std::int64_t last_event(const proto::PaymentWorkflow& workflow);
+    static bool parse_time(const std::string& input, std::int64_t& output);
 
     bool save(const Lock& lock) const override;
     proto::StoragePaymentWorkflows serialize() const;
@@ -94,6 +108,9 @@ private:
         proto::PaymentWorkflowState state);
     void delete_by_value(const std::string& value);
     void init(const std::string& hash) override;
+    std::vector<std::string> match(
+        const Lock& lock,
+        const PaymentWorkflowQuery& query) const;
     void reindex(
         const Lock& lock,
         const std::string& workflowID,
@@ -63,7 +63,7 @@ bool PeerRequests::Delete(const std::string& id) { return delete_item(id); }
 
 void PeerRequests::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageNymList> serialized;
+    std::shared_ptr<const proto::StorageNymList> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
@@ -146,7 +146,7 @@ void Root::collect_garbage(const opentxs::api::storage::Driver* to) const
 
 void Root::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageRoot> serialized;
+    std::shared_ptr<const proto::StorageRoot> serialized;
 
     if (!driver_.LoadProto(hash, serialized)) {
         otErr << OT_METHOD << __FUNCTION__
@@ -68,7 +68,7 @@ bool Servers::Delete(const std::string& id) { return delete_item(id); }
 
 void Servers::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageServers> serialized;
+    std::shared_ptr<const proto::StorageServers> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
@@ -99,7 +99,8 @@ bool Thread::Add(
     const std::string& alias,
     const std::string& contents,
     const std::uint64_t index,
-    const std::string& account)
+    const std::string& account,
+    proto::StorageThreadItem* added)
 {
     Lock lock(write_lock_);
 
@@ -164,6 +165,8 @@ bool Thread::Add(
         return false;
     }
 
+    if (nullptr != added) { *added = item; }
+
     return save(lock);
 }
 
@@ -176,7 +179,7 @@ std::string Thread::Alias() const
 
 void Thread::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageThread> serialized;
+    std::shared_ptr<const proto::StorageThread> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (false == bool(serialized)) {
@@ -245,7 +248,7 @@ bool Thread::Read(const std::string& id, const bool unread)
     return save(lock);
 }
 
-bool Thread::Remove(const std::string& id)
+bool Thread::Remove(const std::string& id, proto::StorageThreadItem* removed)
 {
     Lock lock(write_lock_);
 
@@ -255,6 +258,9 @@ bool Thread::Remove(const std::string& id)
 
     auto& item = it->second;
     StorageBox box = static_cast<StorageBox>(item.box());
+
+    if (nullptr != removed) { *removed = item; }
+
     items_.erase(it);
 
     switch (box) {
@@ -117,10 +117,13 @@ public:
         const std::string& alias,
         const std::string& contents,
         const std::uint64_t index = 0,
-        const std::string& account = std::string(""));
+        const std::string& account = std::string(""),
+        proto::StorageThreadItem* added = nullptr);
     bool Read(const std::string& id, const bool unread);
     bool Rename(const std::string& newID);
-    bool Remove(const std::string& id);
+    bool Remove(
+        const std::string& id,
+        proto::StorageThreadItem* removed = nullptr);
     bool SetAlias(const std::string& alias);
 
     ~Thread() = default;
@@ -122,7 +122,9 @@ bool Threads::Exists(const std::string& id) const
     return item_map_.find(id) != item_map_.end();
 }
 
-bool Threads::FindAndDeleteItem(const std::string& itemID)
+bool Threads::FindAndDeleteItem(
+    const std::string& itemID,
+    std::map<std::string, proto::StorageThreadItem>* removed)
 {
     std::unique_lock<std::mutex> lock(write_lock_);
 
@@ -134,8 +136,11 @@ bool Threads::FindAndDeleteItem(const std::string& itemID)
         const bool hasItem = node.Check(itemID);
 
         if (hasItem) {
-            node.Remove(itemID);
+            proto::StorageThreadItem item{};
+            node.Remove(itemID, &item);
             found = true;
+
+            if (nullptr != removed) { removed->emplace(id, item); }
         }
     }
 
@@ -146,7 +151,7 @@ bool Threads::FindAndDeleteItem(const std::string& itemID)
 
 void Threads::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageNymList> serialized;
+    std::shared_ptr<const proto::StorageNymList> serialized;
     driver_.LoadProto(hash, serialized);
 
     if (!serialized) {
@@ -108,7 +108,11 @@ public:
     std::string Create(
         const std::string& id,
         const std::set<std::string>& participants);
-    bool FindAndDeleteItem(const std::string& itemID);
+    /** Removes the item from every thread which contains it. If removed is
+     *  not null, each removed item is added to it keyed by thread id. */
+    bool FindAndDeleteItem(
+        const std::string& itemID,
+        std::map<std::string, proto::StorageThreadItem>* removed = nullptr);
     Editor<class Thread> mutable_Thread(const std::string& id);
     bool Rename(const std::string& existingID, const std::string& newID);
 
@@ -229,7 +229,7 @@ Credentials* Tree::credentials() const
 
 void Tree::init(const std::string& hash)
 {
-    std::shared_ptr<proto::StorageItems> serialized{nullptr};
+    std::shared_ptr<const proto::StorageItems> serialized{nullptr};
     driver_.LoadProto(hash, serialized);
 
     if (false == bool(serialized)) {
@@ -0,0 +1,121 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_UI_ACTIVITYDELTA_HPP
+#define OPENTXS_UI_ACTIVITYDELTA_HPP
+
+#include "Internal.hpp"
+
+#include "opentxs/network/zeromq/Frame.hpp"
+#include "opentxs/network/zeromq/FrameSection.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
+#include "opentxs/Types.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+namespace opentxs::ui::implementation
+{
+/** \brief A change to an activity thread, as published by api::Activity
+ *
+ *  See api::Activity::ThreadPublisher() for the message layout.
+ */
+struct ActivityDelta {
+    std::string thread_{};
+    std::uint64_t sequence_{0};
+    ThreadDelta type_{ThreadDelta::RELOAD};
+    std::string item_{};
+    StorageBox box_{StorageBox::UNKNOWN};
+    std::string account_{};
+    std::uint64_t time_{0};
+    std::uint64_t index_{0};
+    bool unread_{false};
+
+    /** Malformed messages, and messages which only contain a thread id, are
+     *  returned as ThreadDelta::RELOAD without a sequence number */
+    static ActivityDelta Parse(const network::zeromq::Message& message)
+    {
+        ActivityDelta output{};
+        const auto body = message.Body();
+
+        if (0 == body.size()) { return output; }
+
+        output.thread_ = std::string(body.at(0));
+
+        if (9 != body.size()) { return output; }
+
+        const auto type = number(body.at(2));
+
+        if (type > static_cast<std::uint64_t>(ThreadDelta::READSTATE)) {
+            return output;
+        }
+
+        output.sequence_ = number(body.at(1));
+        output.type_ = static_cast<ThreadDelta>(type);
+        output.item_ = std::string(body.at(3));
+        output.box_ = static_cast<StorageBox>(number(body.at(4)));
+        output.account_ = std::string(body.at(5));
+        output.time_ = number(body.at(6));
+        output.index_ = number(body.at(7));
+        output.unread_ = ("1" == std::string(body.at(8)));
+
+        return output;
+    }
+
+    /** Returns false if any messages were missed since the last one seen,
+     *  in which case the subscriber should reload the thread. Updates last
+     *  to this message's sequence number. */
+    bool InSequence(std::uint64_t& last) const
+    {
+        if (0 == sequence_) { return false; }
+
+        const bool output = (0 == last) || (sequence_ == (last + 1));
+        last = sequence_;
+
+        return output;
+    }
+
+private:
+    static std::uint64_t number(const std::string& input)
+    {
+        return std::strtoull(input.c_str(), nullptr, 10);
+    }
+};
+}  // namespace opentxs::ui::implementation
+#endif  // OPENTXS_UI_ACTIVITYDELTA_HPP
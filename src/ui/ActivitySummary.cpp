@@ -54,10 +54,12 @@
 #include "opentxs/ui/ActivitySummary.hpp"
 #include "opentxs/ui/ActivitySummaryItem.hpp"
 
+#include "ActivityDelta.hpp"
 #include "ActivitySummaryItemBlank.hpp"
 #include "ActivitySummaryParent.hpp"
 #include "List.hpp"
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <set>
@@ -163,7 +165,9 @@ ActivitySummaryOuter::const_reverse_iterator ActivitySummary::outer_end() const
     return items_.rend();
 }
 
-void ActivitySummary::process_thread(const std::string& id)
+void ActivitySummary::process_thread(
+    const std::string& id,
+    const std::chrono::system_clock::time_point time)
 {
     const auto threadID = Identifier::Factory(id);
     // It's hypothetically possible for a thread id to not be a contact id
@@ -172,27 +176,47 @@ void ActivitySummary::process_thread(const std::string& id)
     // degrade to an empty string, which is fine for the short delay until the
     // name gets set properly.
     const auto name = contact_manager_.ContactName(threadID);
-    const ActivitySummarySortKey index{{}, name};
+    const ActivitySummarySortKey index{time, name};
     add_item(threadID, index, {});
 }
 
 void ActivitySummary::process_thread(const network::zeromq::Message& message)
 {
     wait_for_startup();
-
-    OT_ASSERT(1 == message.Body().size());
-
-    const std::string id(*message.Body().begin());
+    const auto delta = ActivityDelta::Parse(message);
+    const auto& id = delta.thread_;
     const auto threadID = Identifier::Factory(id);
 
     OT_ASSERT(false == threadID->empty())
 
-    auto existing = names_.count(threadID);
+    if (false == delta.InSequence(last_sequence_)) {
+        process_threads();
 
-    if (0 == existing) { process_thread(id); }
+        return;
+    }
+
+    // Existing rows apply deltas to their own thread
+    if (0 < names_.count(threadID)) { return; }
+
+    switch (delta.type_) {
+        case ThreadDelta::ITEMADDED: {
+            process_thread(
+                id,
+                std::chrono::system_clock::time_point(
+                    std::chrono::seconds(delta.time_)));
+        } break;
+        case ThreadDelta::ITEMREMOVED:
+        case ThreadDelta::READSTATE: {
+            // Only threads which already have a row can be affected
+        } break;
+        case ThreadDelta::RELOAD:
+        default: {
+            process_thread(id, {});
+        }
+    }
 }
 
-void ActivitySummary::startup()
+void ActivitySummary::process_threads()
 {
     const auto threads = activity_.Threads(nym_id_, false);
     otWarn << OT_METHOD << __FUNCTION__ << ": Loading " << threads.size()
@@ -200,9 +224,16 @@ void ActivitySummary::startup()
 
     for (const auto& [id, alias] : threads) {
         [[maybe_unused]] const auto& notUsed = alias;
-        process_thread(id);
+
+        if (0 == names_.count(Identifier::Factory(id))) {
+            process_thread(id, {});
+        }
     }
+}
 
+void ActivitySummary::startup()
+{
+    process_threads();
     startup_complete_->On();
 }
 }  // namespace opentxs::ui::implementation
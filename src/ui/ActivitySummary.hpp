@@ -66,6 +66,7 @@ private:
     const Flag& running_;
     OTZMQListenCallback activity_subscriber_callback_;
     OTZMQSubscribeSocket activity_subscriber_;
+    std::uint64_t last_sequence_{0};
 
     ActivitySummaryID blank_id() const override;
     void construct_item(
@@ -75,8 +76,11 @@ private:
     ActivitySummaryOuter::const_reverse_iterator outer_first() const override;
     ActivitySummaryOuter::const_reverse_iterator outer_end() const override;
 
-    void process_thread(const std::string& threadID);
+    void process_thread(
+        const std::string& threadID,
+        const std::chrono::system_clock::time_point time);
     void process_thread(const network::zeromq::Message& message);
+    void process_threads();
     void startup();
 
     ActivitySummary(
@@ -53,6 +53,7 @@
 #include "opentxs/network/zeromq/SubscribeSocket.hpp"
 #include "opentxs/ui/ActivitySummaryItem.hpp"
 
+#include "ActivityDelta.hpp"
 #include "ActivitySummaryParent.hpp"
 #include "Row.hpp"
 
@@ -105,6 +106,7 @@ ActivitySummaryItem::ActivitySummaryItem(
     , nym_id_(Identifier::Factory(nymID))
     , thread_()
     , display_name_("")
+    , newest_id_("")
     , text_("")
     , type_(StorageBox::UNKNOWN)
     , time_()
@@ -274,22 +276,42 @@ const proto::StorageThreadItem& ActivitySummaryItem::newest_item(
 void ActivitySummaryItem::process_thread(
     const network::zeromq::Message& message)
 {
-    OT_ASSERT(1 == message.Body().size())
-
-    const std::string id(*message.Body().begin());
+    const auto delta = ActivityDelta::Parse(message);
+    const auto& id = delta.thread_;
     otWarn << OT_METHOD << __FUNCTION__ << ": Thread " << id << " has updated.."
            << std::endl;
     const auto threadID = Identifier::Factory(id);
 
     OT_ASSERT(false == threadID->empty())
 
-    if (id_ != threadID) {
+    // Every thread belonging to the nym shares one publisher, so the
+    // sequence must be checked before filtering by thread
+    const bool inSequence = delta.InSequence(last_sequence_);
+
+    if (inSequence && (id_ != threadID)) {
         otWarn << OT_METHOD << __FUNCTION__ << ": Update not relevant to me ("
                << id_->str() << ")" << std::endl;
 
         return;
     }
 
+    if (inSequence && (ThreadDelta::READSTATE == delta.type_)) { return; }
+
+    if (inSequence && (ThreadDelta::ITEMREMOVED == delta.type_)) {
+        sLock lock(shared_lock_);
+        const bool summarized = (delta.item_ == newest_id_);
+        lock.unlock();
+
+        // Removing any item except the newest leaves the summary unchanged
+        if (false == summarized) { return; }
+    }
+
+    if (inSequence && (ThreadDelta::ITEMADDED == delta.type_)) {
+        update(delta);
+
+        return;
+    }
+
     startup();
 }
 
@@ -341,6 +363,7 @@ void ActivitySummaryItem::update(const proto::StorageThread& thread)
         std::chrono::seconds(item.time()));
     const auto box = static_cast<StorageBox>(item.box());
     lock.lock();
+    newest_id_ = item.id();
     time_ = time;
     text_ = "";
     type_ = box;
@@ -351,6 +374,27 @@ void ActivitySummaryItem::update(const proto::StorageThread& thread)
     UpdateNotify();
 }
 
+void ActivitySummaryItem::update(const ActivityDelta& delta)
+{
+    eLock lock(shared_lock_);
+    const auto time = std::chrono::system_clock::time_point(
+        std::chrono::seconds(delta.time_));
+
+    // Only the newest item is summarized
+    if (time < time_) { return; }
+
+    newest_id_ = delta.item_;
+    time_ = time;
+    text_ = "";
+    type_ = delta.box_;
+    const auto displayName = display_name_;
+    lock.unlock();
+    ItemLocator locator{delta.item_, delta.box_, delta.account_};
+    newest_item_.Push(Identifier::Random(), locator);
+    parent_.reindex_item(id_, {time, displayName});
+    UpdateNotify();
+}
+
 ActivitySummaryItem::~ActivitySummaryItem()
 {
     if (newest_item_thread_ && newest_item_thread_->joinable()) {
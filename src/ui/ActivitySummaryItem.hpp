@@ -43,6 +43,8 @@
 
 namespace opentxs::ui::implementation
 {
+struct ActivityDelta;
+
 using ActivitySummaryItemType =
     Row<opentxs::ui::ActivitySummaryItem, ActivitySummaryParent, OTIdentifier>;
 
@@ -68,6 +70,7 @@ private:
     const OTIdentifier nym_id_;
     std::shared_ptr<proto::StorageThread> thread_{nullptr};
     std::string display_name_{""};
+    std::string newest_id_{""};
     std::string text_{""};
     StorageBox type_{StorageBox::UNKNOWN};
     std::chrono::system_clock::time_point time_;
@@ -76,6 +79,7 @@ private:
     UniqueQueue<ItemLocator> newest_item_;
     OTZMQListenCallback activity_subscriber_callback_;
     OTZMQSubscribeSocket activity_subscriber_;
+    std::uint64_t last_sequence_{0};
 
     bool check_thread(const proto::StorageThread& thread) const;
     std::string display_name(const proto::StorageThread& thread) const;
@@ -87,6 +91,7 @@ private:
     void process_thread(const network::zeromq::Message& message);
     void startup();
     void update(const proto::StorageThread& thread);
+    void update(const ActivityDelta& delta);
 
     ActivitySummaryItem(
         const ActivitySummaryParent& parent,
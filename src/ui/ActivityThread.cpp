@@ -58,6 +58,7 @@
 #include "opentxs/ui/ActivityThreadItem.hpp"
 #include "opentxs/Types.hpp"
 
+#include "ActivityDelta.hpp"
 #include "ActivityThreadItemBlank.hpp"
 #include "ActivityThreadParent.hpp"
 #include "List.hpp"
@@ -399,19 +400,54 @@ void ActivityThread::process_thread(const network::zeromq::Message& message)
 {
     wait_for_startup();
     check_drafts();
+    const auto delta = ActivityDelta::Parse(message);
+    const auto threadID = Identifier::Factory(delta.thread_);
 
-    OT_ASSERT(1 == message.Body().size());
+    OT_ASSERT(false == threadID->empty())
 
-    const std::string id(*message.Body().begin());
-    const auto threadID = Identifier::Factory(id);
+    // Every thread belonging to the nym shares one publisher, so the
+    // sequence must be checked before filtering by thread
+    const bool inSequence = delta.InSequence(last_sequence_);
 
-    OT_ASSERT(false == threadID->empty())
+    if (false == inSequence) {
+        reload_thread();
+
+        return;
+    }
 
     if (threadID_ != threadID) { return; }
 
+    switch (delta.type_) {
+        case ThreadDelta::ITEMADDED: {
+            proto::StorageThreadItem item{};
+            item.set_id(delta.item_);
+            item.set_box(static_cast<std::uint32_t>(delta.box_));
+            item.set_account(delta.account_);
+            item.set_time(delta.time_);
+            item.set_index(delta.index_);
+            process_item(item);
+        } break;
+        case ThreadDelta::ITEMREMOVED: {
+            remove_item({Identifier::Factory(delta.item_),
+                         delta.box_,
+                         Identifier::Factory(delta.account_)});
+        } break;
+        case ThreadDelta::READSTATE: {
+            // Rows do not display read state
+        } break;
+        case ThreadDelta::RELOAD:
+        default: {
+            reload_thread();
+        }
+    }
+}
+
+void ActivityThread::reload_thread()
+{
     const auto thread = activity_.Thread(nym_id_, threadID_);
 
-    OT_ASSERT(thread)
+    // The thread is not created in storage until its first item arrives
+    if (false == bool(thread)) { return; }
 
     std::set<ActivityThreadID> active{};
 
@@ -190,6 +190,16 @@ protected:
 
         OT_ASSERT(1 == indexDeleted)
     }
+    void remove_item(const IDType& id) const
+    {
+        Lock lock(lock_);
+
+        if (0 == names_.count(id)) { return; }
+
+        delete_item(lock, id);
+        lock.unlock();
+        UpdateNotify();
+    }
     /** Returns first contact, or blank if none exists. Sets up iterators for
      *  next row
      *
@@ -0,0 +1,273 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "stdafx.hpp"
+
+#include "Arena.hpp"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#include <new>
+
+// Allocations larger than this always go to the heap so that large
+// temporaries made while parsing do not pin arena blocks
+#define OT_ARENA_MAX_ALLOCATION 4096
+#define OT_ARENA_BLOCK_SIZE 16384
+// Address space reserved for blocks. Physical memory is only used by blocks
+// which are live or recently freed.
+#define OT_ARENA_REGION_SIZE (256 * 1024 * 1024)
+// Freed blocks beyond this many are handed back to the operating system
+#define OT_ARENA_RETAINED_BLOCKS 64
+
+namespace opentxs
+{
+namespace
+{
+constexpr std::size_t block_count = OT_ARENA_REGION_SIZE / OT_ARENA_BLOCK_SIZE;
+
+constexpr std::size_t round_up(const std::size_t size)
+{
+    constexpr auto alignment = alignof(std::max_align_t);
+
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+void* reserve_region()
+{
+#ifdef _WIN32
+    return ::VirtualAlloc(
+        nullptr, OT_ARENA_REGION_SIZE, MEM_RESERVE, PAGE_NOACCESS);
+#else
+#ifdef MAP_NORESERVE
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+#else
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#endif
+    auto* output = ::mmap(
+        nullptr, OT_ARENA_REGION_SIZE, PROT_READ | PROT_WRITE, flags, -1, 0);
+
+    return (MAP_FAILED == output) ? nullptr : output;
+#endif
+}
+
+bool commit(char* block)
+{
+#ifdef _WIN32
+    return nullptr != ::VirtualAlloc(
+                          block, OT_ARENA_BLOCK_SIZE, MEM_COMMIT, PAGE_READWRITE);
+#else
+    // Pages of an anonymous mapping are backed when first touched
+    return nullptr != block;
+#endif
+}
+
+void decommit(char* block)
+{
+#ifdef _WIN32
+    ::VirtualFree(block, OT_ARENA_BLOCK_SIZE, MEM_DECOMMIT);
+#else
+    ::madvise(block, OT_ARENA_BLOCK_SIZE, MADV_DONTNEED);
+#endif
+}
+}  // namespace
+
+const std::size_t Arena::no_block_{block_count};
+thread_local Arena* Arena::current_{nullptr};
+std::atomic<std::size_t> Arena::live_blocks_{0};
+std::atomic<std::uintptr_t> Arena::region_{0};
+std::atomic<std::size_t>* Arena::references_{nullptr};
+std::mutex Arena::block_lock_{};
+std::vector<std::size_t> Arena::free_blocks_{};
+std::size_t Arena::unused_blocks_{0};
+
+Arena::Arena()
+    : block_(no_block_)
+    , next_(nullptr)
+    , available_(0)
+    , reserved_(0)
+{
+}
+
+Arena::Scope::Scope(Arena* arena)
+    : previous_(current_)
+{
+    current_ = arena;
+}
+
+std::size_t Arena::acquire()
+{
+    Lock lock(block_lock_);
+
+    if ((0 == region_.load(std::memory_order_relaxed)) &&
+        (0 == unused_blocks_)) {
+        auto* region = reserve_region();
+
+        if (nullptr == region) {
+            // Leave every arena on the heap instead of retrying per block
+            unused_blocks_ = block_count;
+
+            return no_block_;
+        }
+
+        references_ = new std::atomic<std::size_t>[block_count] {};
+        region_.store(
+            reinterpret_cast<std::uintptr_t>(region),
+            std::memory_order_release);
+    }
+
+    std::size_t output{no_block_};
+
+    if (false == free_blocks_.empty()) {
+        output = free_blocks_.back();
+        free_blocks_.pop_back();
+    } else if (block_count > unused_blocks_) {
+        output = unused_blocks_++;
+    } else {
+        return no_block_;
+    }
+
+    if (false == commit(address(output))) {
+        free_blocks_.push_back(output);
+
+        return no_block_;
+    }
+
+    references_[output].store(1, std::memory_order_relaxed);
+    live_blocks_.fetch_add(1, std::memory_order_release);
+
+    return output;
+}
+
+char* Arena::address(const std::size_t block)
+{
+    return reinterpret_cast<char*>(
+        region_.load(std::memory_order_acquire) +
+        (block * OT_ARENA_BLOCK_SIZE));
+}
+
+void* Arena::allocate(const std::size_t bytes)
+{
+    if (bytes > available_) {
+        const auto block = acquire();
+
+        if (no_block_ == block) { return nullptr; }
+
+        if (no_block_ != block_) { release(block_); }
+
+        block_ = block;
+        next_ = address(block);
+        available_ = OT_ARENA_BLOCK_SIZE;
+        reserved_ += OT_ARENA_BLOCK_SIZE;
+    }
+
+    auto* output = next_;
+    next_ += bytes;
+    available_ -= bytes;
+    references_[block_].fetch_add(1, std::memory_order_relaxed);
+
+    return output;
+}
+
+void* Arena::Allocate(const std::size_t size)
+{
+    auto* arena = current_;
+
+    if ((nullptr != arena) && (OT_ARENA_MAX_ALLOCATION >= size)) {
+        auto* output = arena->allocate(round_up(size));
+
+        if (nullptr != output) { return output; }
+    }
+
+    return ::operator new(size);
+}
+
+void Arena::Deallocate(void* pointer)
+{
+    if (nullptr == pointer) { return; }
+
+    const auto region = region_.load(std::memory_order_acquire);
+    const auto offset = reinterpret_cast<std::uintptr_t>(pointer) - region;
+
+    // Below the region the subtraction wraps around, so one comparison
+    // covers both ends of the range
+    if ((0 != region) && (OT_ARENA_REGION_SIZE > offset)) {
+        release(offset / OT_ARENA_BLOCK_SIZE);
+
+        return;
+    }
+
+    ::operator delete(pointer);
+}
+
+std::unique_ptr<Arena> Arena::Factory()
+{
+    return std::unique_ptr<Arena>(new Arena);
+}
+
+std::size_t Arena::LiveBlocks()
+{
+    return live_blocks_.load(std::memory_order_acquire);
+}
+
+void Arena::release(const std::size_t block)
+{
+    if (1 != references_[block].fetch_sub(1, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    live_blocks_.fetch_sub(1, std::memory_order_release);
+    Lock lock(block_lock_);
+
+    if (OT_ARENA_RETAINED_BLOCKS <= free_blocks_.size()) {
+        decommit(address(block));
+    }
+
+    free_blocks_.push_back(block);
+}
+
+Arena::Scope::~Scope() { current_ = previous_; }
+
+Arena::~Arena()
+{
+    if (no_block_ != block_) { release(block_); }
+}
+}  // namespace opentxs
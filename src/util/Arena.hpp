@@ -0,0 +1,138 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_UTIL_ARENA_HPP
+#define OPENTXS_UTIL_ARENA_HPP
+
+#include "Internal.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace opentxs
+{
+/** \brief Monotonic allocator for the receipts of one parsed ledger
+ *
+ *  Memory is handed out from blocks by bumping a pointer. Each block counts
+ *  the allocations made from it and is freed once they have all been
+ *  released and the arena has moved on to another block or been destroyed.
+ *  An object which outlives its ledger stays valid and only keeps its own
+ *  block alive.
+ *
+ *  Allocations carry no header. Every block is carved out of one address
+ *  range which is reserved the first time a block is needed and kept for the
+ *  life of the process, so Deallocate() tells arena memory from heap memory,
+ *  and finds the owning block, from the address alone without taking a lock.
+ *  Once the range is used up, arenas allocate from the heap.
+ *
+ *  Allocation is not thread safe. An arena is only used by the thread which
+ *  installed it via Scope. Deallocation may happen on any thread.
+ */
+class Arena
+{
+public:
+    /** Makes an arena the allocator for the current thread until the scope
+     *  ends. Scopes nest. A null arena disables arena allocation. */
+    class Scope
+    {
+    public:
+        explicit Scope(Arena* arena);
+
+        ~Scope();
+
+    private:
+        Arena* previous_;
+
+        Scope() = delete;
+        Scope(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) = delete;
+    };
+
+    /** Allocates from the current thread's arena if one is installed and the
+     *  request is small enough, otherwise from the heap */
+    static void* Allocate(const std::size_t size);
+    static void Deallocate(void* pointer);
+    static std::unique_ptr<Arena> Factory();
+    /** Number of blocks, across all arenas, which have not been freed */
+    static std::size_t LiveBlocks();
+
+    /** Bytes reserved in blocks by this arena */
+    std::size_t Reserved() const { return reserved_; }
+
+    ~Arena();
+
+private:
+    static const std::size_t no_block_;
+
+    static thread_local Arena* current_;
+    static std::atomic<std::size_t> live_blocks_;
+    // Address of the first block, or zero until the range is reserved
+    static std::atomic<std::uintptr_t> region_;
+    // One per block: a count of its live allocations, plus one while an
+    // arena allocates from it
+    static std::atomic<std::size_t>* references_;
+    // Guards reserving the range and handing blocks out, never Deallocate()
+    static std::mutex block_lock_;
+    static std::vector<std::size_t> free_blocks_;
+    static std::size_t unused_blocks_;
+
+    std::size_t block_;
+    char* next_;
+    std::size_t available_;
+    std::size_t reserved_;
+
+    static std::size_t acquire();
+    static char* address(const std::size_t block);
+    static void release(const std::size_t block);
+
+    void* allocate(const std::size_t bytes);
+
+    Arena();
+    Arena(const Arena&) = delete;
+    Arena(Arena&&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    Arena& operator=(Arena&&) = delete;
+};
+}  // namespace opentxs
+#endif  // OPENTXS_UTIL_ARENA_HPP
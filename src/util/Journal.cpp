@@ -0,0 +1,394 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "stdafx.hpp"
+
+#include "Journal.hpp"
+
+#include "opentxs/core/Log.hpp"
+
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <limits>
+
+#ifdef _WIN32
+#include <io.h>
+
+#define open _open
+#define close _close
+#define write _write
+#define lseek _lseek
+#define ftruncate _chsize
+#define fsync _commit
+#else
+extern "C" {
+#include <fcntl.h>
+#include <unistd.h>
+}
+#endif
+
+#ifndef O_BINARY
+#define O_BINARY 0
+#endif
+
+// Size of the length and checksum which precede every record
+#define OT_JOURNAL_HEADER_SIZE 8
+
+#define OT_METHOD "opentxs::Journal::"
+
+namespace opentxs
+{
+namespace
+{
+void put_uint32(std::string& output, const std::uint32_t value)
+{
+    for (std::size_t i = 0; i < 4; ++i) {
+        output.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+}
+
+std::uint32_t get_uint32(const std::string& input, const std::size_t offset)
+{
+    std::uint32_t output{0};
+
+    for (std::size_t i = 0; i < 4; ++i) {
+        output |= std::uint32_t(static_cast<unsigned char>(input[offset + i]))
+                  << (8 * i);
+    }
+
+    return output;
+}
+
+bool sync(const int fd)
+{
+#if defined(__APPLE__)
+    // This is a Mac OS X system which does not implement
+    // fsync as such.
+    return 0 == ::fcntl(fd, F_FULLFSYNC);
+#else
+    return 0 == ::fsync(fd);
+#endif
+}
+
+bool sync_directory(const std::string& path)
+{
+#ifdef _WIN32
+    return true;
+#else
+    const auto position = path.find_last_of('/');
+    const std::string directory =
+        (std::string::npos == position) ? "." : path.substr(0, position + 1);
+    const int fd = ::open(directory.c_str(), O_DIRECTORY | O_RDONLY);
+
+    if (-1 == fd) { return false; }
+
+    const bool output = sync(fd);
+    ::close(fd);
+
+    return output;
+#endif
+}
+
+bool write_all(const int fd, const std::string& data)
+{
+    std::size_t written{0};
+
+    while (written < data.size()) {
+        const auto result =
+            ::write(fd, data.data() + written, data.size() - written);
+
+        if (0 >= result) { return false; }
+
+        written += static_cast<std::size_t>(result);
+    }
+
+    return true;
+}
+}  // namespace
+
+Journal::Journal(const std::string& path, const std::size_t minimumCompaction)
+    : path_(path)
+    , minimum_compaction_(minimumCompaction)
+    , records_(0)
+{
+}
+
+bool Journal::Append(const std::string& record)
+{
+    if (path_.empty()) { return false; }
+
+    if (std::numeric_limits<std::uint32_t>::max() < record.size()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Record too large."
+              << std::endl;
+
+        return false;
+    }
+
+    const int fd = ::open(
+        path_.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_BINARY, 0600);
+
+    if (-1 == fd) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to open " << path_
+              << std::endl;
+
+        return false;
+    }
+
+    const auto size = ::lseek(fd, 0, SEEK_END);
+    const bool written = (0 <= size) && write_all(fd, encode(record));
+    const bool synced = written && sync(fd);
+
+    if ((false == synced) && (0 <= size)) {
+        // Later records must not follow a torn one
+        if (0 != ::ftruncate(fd, size)) {
+            otErr << OT_METHOD << __FUNCTION__ << ": Failed to truncate "
+                  << path_ << std::endl;
+        }
+    }
+
+    ::close(fd);
+
+    if (false == synced) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to update " << path_
+              << std::endl;
+
+        return false;
+    }
+
+    ++records_;
+
+    return true;
+}
+
+std::uint32_t Journal::checksum(const std::string& payload)
+{
+    // CRC-32 (IEEE 802.3)
+    static const auto table = []() -> std::array<std::uint32_t, 256> {
+        std::array<std::uint32_t, 256> output{};
+
+        for (std::uint32_t i = 0; i < 256; ++i) {
+            std::uint32_t value = i;
+
+            for (std::size_t bit = 0; bit < 8; ++bit) {
+                value = (value & 1) ? (0xedb88320 ^ (value >> 1))
+                                    : (value >> 1);
+            }
+
+            output[i] = value;
+        }
+
+        return output;
+    }();
+
+    std::uint32_t output{0xffffffff};
+
+    for (const auto& byte : payload) {
+        output = table[(output ^ static_cast<unsigned char>(byte)) & 0xff] ^
+                 (output >> 8);
+    }
+
+    return output ^ 0xffffffff;
+}
+
+std::string Journal::encode(const std::string& payload)
+{
+    std::string output{};
+    output.reserve(OT_JOURNAL_HEADER_SIZE + payload.size());
+    put_uint32(output, static_cast<std::uint32_t>(payload.size()));
+    put_uint32(output, checksum(payload));
+    output.append(payload);
+
+    return output;
+}
+
+bool Journal::Exists() const
+{
+    if (path_.empty()) { return false; }
+
+    return std::ifstream(path_, std::ios::in | std::ios::binary).is_open();
+}
+
+bool Journal::Load(Records& output)
+{
+    output.clear();
+    records_ = 0;
+
+    if (path_.empty()) { return false; }
+
+    std::ifstream file(path_, std::ios::in | std::ios::binary);
+
+    if (false == file.is_open()) { return true; }
+
+    const std::string data{std::istreambuf_iterator<char>(file),
+                           std::istreambuf_iterator<char>()};
+
+    if (file.bad()) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to read " << path_
+              << std::endl;
+
+        return false;
+    }
+
+    file.close();
+    std::size_t position{0};
+
+    while (OT_JOURNAL_HEADER_SIZE <= (data.size() - position)) {
+        const std::size_t size = get_uint32(data, position);
+        const auto expected = get_uint32(data, position + 4);
+        const auto start = position + OT_JOURNAL_HEADER_SIZE;
+
+        if (size > (data.size() - start)) { break; }
+
+        auto record = data.substr(start, size);
+
+        if (expected != checksum(record)) { break; }
+
+        output.emplace_back(std::move(record));
+        position = start + size;
+    }
+
+    records_ = output.size();
+
+    if (position == data.size()) { return true; }
+
+    otErr << OT_METHOD << __FUNCTION__ << ": Discarding "
+          << (data.size() - position) << " bytes of incomplete records from "
+          << path_ << std::endl;
+    const int fd = ::open(path_.c_str(), O_WRONLY | O_BINARY);
+    const bool truncated =
+        (-1 != fd) && (0 == ::ftruncate(fd, position)) && sync(fd);
+
+    if (-1 != fd) { ::close(fd); }
+
+    if (false == truncated) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to truncate " << path_
+              << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+bool Journal::Rewrite(const Records& records)
+{
+    if (path_.empty()) { return false; }
+
+    std::string data{};
+
+    for (const auto& record : records) {
+        if (std::numeric_limits<std::uint32_t>::max() < record.size()) {
+            return false;
+        }
+
+        data.append(encode(record));
+    }
+
+    const auto temp = path_ + ".tmp";
+
+    if (false == write_file(temp, data)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to write " << temp
+              << std::endl;
+        std::remove(temp.c_str());
+
+        return false;
+    }
+
+    if (0 != std::rename(temp.c_str(), path_.c_str())) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to replace " << path_
+              << std::endl;
+        std::remove(temp.c_str());
+
+        return false;
+    }
+
+    if (false == sync_directory(path_)) {
+        otErr << OT_METHOD << __FUNCTION__ << ": Failed to sync directory of "
+              << path_ << std::endl;
+    }
+
+    records_ = records.size();
+
+    return true;
+}
+
+bool Journal::ShouldCompact(const std::size_t live) const
+{
+    return (minimum_compaction_ < records_) && ((2 * live) < records_);
+}
+
+bool Journal::Split(
+    const std::string& record,
+    const std::size_t count,
+    std::vector<std::string>& fields)
+{
+    fields.clear();
+
+    if (0 == count) { return false; }
+
+    std::size_t position{0};
+
+    while (fields.size() + 1 < count) {
+        const auto tab = record.find('\t', position);
+
+        if (std::string::npos == tab) { return false; }
+
+        fields.emplace_back(record.substr(position, tab - position));
+        position = tab + 1;
+    }
+
+    fields.emplace_back(record.substr(position));
+
+    return true;
+}
+
+bool Journal::write_file(const std::string& path, const std::string& data)
+{
+    const int fd =
+        ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, 0600);
+
+    if (-1 == fd) { return false; }
+
+    const bool output = write_all(fd, data) && sync(fd);
+    ::close(fd);
+
+    return output;
+}
+}  // namespace opentxs
@@ -0,0 +1,104 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_UTIL_JOURNAL_HPP
+#define OPENTXS_UTIL_JOURNAL_HPP
+
+#include "Internal.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace opentxs
+{
+/** \brief Crash-safe append-only record file
+ *
+ *  Each record is stored as a 32 bit length, a CRC-32 of the payload and the
+ *  payload itself, and is synced to disk before Append() returns. Load()
+ *  stops at the first record which is incomplete or fails its checksum, and
+ *  removes it and everything after it from the file, so a record torn by a
+ *  crash is never returned. Rewrite() replaces the whole file atomically.
+ *
+ *  The class performs no locking of its own.
+ */
+class Journal
+{
+public:
+    using Records = std::vector<std::string>;
+
+    /** Splits a record into count tab-separated fields. The last field
+     *  receives the remainder of the record, tabs included. */
+    static bool Split(
+        const std::string& record,
+        const std::size_t count,
+        std::vector<std::string>& fields);
+
+    bool Append(const std::string& record);
+    bool Exists() const;
+    /** Replaces the contents of output with every intact record */
+    bool Load(Records& output);
+    const std::string& Path() const { return path_; }
+    /** Replaces the journal with the specified records */
+    bool Rewrite(const Records& records);
+    /** Returns true once the journal holds more than twice as many records
+     *  as there are live entries, and at least the minimum compaction size */
+    bool ShouldCompact(const std::size_t live) const;
+
+    Journal(const std::string& path, const std::size_t minimumCompaction);
+
+    ~Journal() = default;
+
+private:
+    const std::string path_;
+    const std::size_t minimum_compaction_;
+    std::size_t records_{0};
+
+    static std::uint32_t checksum(const std::string& payload);
+    static std::string encode(const std::string& payload);
+    static bool write_file(const std::string& path, const std::string& data);
+
+    Journal() = delete;
+    Journal(const Journal&) = delete;
+    Journal(Journal&&) = delete;
+    Journal& operator=(const Journal&) = delete;
+    Journal& operator=(Journal&&) = delete;
+};
+}  // namespace opentxs
+#endif  // OPENTXS_UTIL_JOURNAL_HPP
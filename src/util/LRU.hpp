@@ -0,0 +1,294 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_UTIL_LRU_HPP
+#define OPENTXS_UTIL_LRU_HPP
+
+#include "Internal.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace opentxs
+{
+/** \brief Thread-safe, bounded, least recently used cache
+ *
+ *  Hit and miss counts are kept for every lookup so that callers can report
+ *  the effectiveness of the cache.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class LRU
+{
+public:
+    struct Stats {
+        std::uint64_t hits_{0};
+        std::uint64_t misses_{0};
+        std::size_t size_{0};
+        std::size_t capacity_{0};
+    };
+
+    std::size_t Capacity() const
+    {
+        Lock lock(lock_);
+
+        return capacity_;
+    }
+
+    void Clear()
+    {
+        Lock lock(lock_);
+        index_.clear();
+        items_.clear();
+    }
+
+    /** Copies the cached value into output and marks it as most recently
+     *  used. Returns false if the key is not present. */
+    bool Get(const Key& key, Value& output) const
+    {
+        Lock lock(lock_);
+        auto it = index_.find(key);
+
+        if (index_.end() == it) {
+            ++misses_;
+
+            return false;
+        }
+
+        ++hits_;
+        items_.splice(items_.begin(), items_, it->second);
+        output = it->second->second;
+
+        return true;
+    }
+
+    void Put(const Key& key, const Value& value)
+    {
+        Lock lock(lock_);
+
+        if (0 == capacity_) { return; }
+
+        auto it = index_.find(key);
+
+        if (index_.end() != it) {
+            it->second->second = value;
+            items_.splice(items_.begin(), items_, it->second);
+
+            return;
+        }
+
+        items_.emplace_front(key, value);
+        index_.emplace(key, items_.begin());
+        trim(lock);
+    }
+
+    void Remove(const Key& key)
+    {
+        Lock lock(lock_);
+        auto it = index_.find(key);
+
+        if (index_.end() == it) { return; }
+
+        items_.erase(it->second);
+        index_.erase(it);
+    }
+
+    void SetCapacity(const std::size_t capacity)
+    {
+        Lock lock(lock_);
+        capacity_ = capacity;
+        trim(lock);
+    }
+
+    Stats GetStats() const
+    {
+        Lock lock(lock_);
+        Stats output{};
+        output.hits_ = hits_;
+        output.misses_ = misses_;
+        output.size_ = index_.size();
+        output.capacity_ = capacity_;
+
+        return output;
+    }
+
+    explicit LRU(const std::size_t capacity)
+        : lock_()
+        , items_()
+        , index_()
+        , capacity_(capacity)
+        , hits_(0)
+        , misses_(0)
+    {
+    }
+
+    ~LRU() = default;
+
+private:
+    using Items = std::list<std::pair<Key, Value>>;
+
+    mutable std::mutex lock_;
+    mutable Items items_;
+    std::unordered_map<Key, typename Items::iterator, Hash> index_;
+    std::size_t capacity_{0};
+    mutable std::uint64_t hits_{0};
+    mutable std::uint64_t misses_{0};
+
+    void trim(const Lock&)
+    {
+        while (index_.size() > capacity_) {
+            index_.erase(items_.back().first);
+            items_.pop_back();
+        }
+    }
+
+    LRU() = delete;
+    LRU(const LRU&) = delete;
+    LRU(LRU&&) = delete;
+    LRU& operator=(const LRU&) = delete;
+    LRU& operator=(LRU&&) = delete;
+};
+
+/** \brief LRU cache split into independently locked shards
+ *
+ *  Each key is assigned to a shard by its hash, so that concurrent lookups of
+ *  different keys rarely wait on the same mutex. Capacity is divided evenly
+ *  between the shards, which means eviction is only approximately least
+ *  recently used across the cache as a whole.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class ShardedLRU
+{
+public:
+    using Shard = LRU<Key, Value, Hash>;
+    using Stats = typename Shard::Stats;
+
+    std::size_t Capacity() const
+    {
+        std::size_t output{0};
+
+        for (const auto& shard : shards_) { output += shard->Capacity(); }
+
+        return output;
+    }
+
+    void Clear()
+    {
+        for (auto& shard : shards_) { shard->Clear(); }
+    }
+
+    bool Get(const Key& key, Value& output) const
+    {
+        return shard(key).Get(key, output);
+    }
+
+    void Put(const Key& key, const Value& value) { shard(key).Put(key, value); }
+
+    void Remove(const Key& key) { shard(key).Remove(key); }
+
+    void SetCapacity(const std::size_t capacity)
+    {
+        const auto each = per_shard(capacity, shards_.size());
+
+        for (auto& shard : shards_) { shard->SetCapacity(each); }
+    }
+
+    Stats GetStats() const
+    {
+        Stats output{};
+
+        for (const auto& shard : shards_) {
+            const auto stats = shard->GetStats();
+            output.hits_ += stats.hits_;
+            output.misses_ += stats.misses_;
+            output.size_ += stats.size_;
+            output.capacity_ += stats.capacity_;
+        }
+
+        return output;
+    }
+
+    ShardedLRU(const std::size_t capacity, const std::size_t shards)
+        : hash_()
+        , shards_()
+    {
+        const auto count = (0 == shards) ? 1 : shards;
+        const auto each = per_shard(capacity, count);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            shards_.emplace_back(new Shard(each));
+        }
+    }
+
+    ~ShardedLRU() = default;
+
+private:
+    const Hash hash_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+
+    static std::size_t per_shard(
+        const std::size_t capacity,
+        const std::size_t shards)
+    {
+        return (capacity + shards - 1) / shards;
+    }
+
+    Shard& shard(const Key& key) const
+    {
+        // Fold in the high bits so that the shard index is not correlated
+        // with the bucket index used inside each shard.
+        const std::uint64_t hash = hash_(key);
+        const auto mixed = hash ^ (hash >> 32) ^ (hash >> 16);
+
+        return *shards_.at(mixed % shards_.size());
+    }
+
+    ShardedLRU() = delete;
+    ShardedLRU(const ShardedLRU&) = delete;
+    ShardedLRU(ShardedLRU&&) = delete;
+    ShardedLRU& operator=(const ShardedLRU&) = delete;
+    ShardedLRU& operator=(ShardedLRU&&) = delete;
+};
+}  // namespace opentxs
+#endif  // OPENTXS_UTIL_LRU_HPP
@@ -0,0 +1,216 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_UTIL_SHARDEDMAP_HPP
+#define OPENTXS_UTIL_SHARDEDMAP_HPP
+
+#include "Internal.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace opentxs
+{
+/** \brief Hash map split into independently locked shards
+ *
+ *  Each key is assigned to a shard by its hash. Lookups take a shared lock on
+ *  one shard only, so concurrent readers never wait on each other and writers
+ *  only block readers of the same shard.
+ *
+ *  Entries are never moved once inserted, so a reference obtained inside
+ *  Modify() remains valid until the entry is erased.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class ShardedMap
+{
+public:
+    /** Inserts value if the key is not present. Returns a copy of the value
+     *  which is in the map afterwards, which is the existing one if another
+     *  thread won the race. */
+    Value Add(const Key& key, const Value& value)
+    {
+        auto& shard = this->shard(key);
+        eLock lock(shard.lock_);
+
+        return shard.map_.emplace(key, value).first->second;
+    }
+
+    void Clear()
+    {
+        for (auto& shard : shards_) {
+            eLock lock(shard->lock_);
+            shard->map_.clear();
+        }
+    }
+
+    bool Contains(const Key& key) const
+    {
+        const auto& shard = this->shard(key);
+        sLock lock(shard.lock_);
+
+        return 0 < shard.map_.count(key);
+    }
+
+    std::size_t Erase(const Key& key)
+    {
+        auto& shard = this->shard(key);
+        eLock lock(shard.lock_);
+
+        return shard.map_.erase(key);
+    }
+
+    /** Visits every entry, one shard at a time. The visitor runs while the
+     *  shard is locked for reading and must not call back into the map. */
+    void ForEach(
+        const std::function<void(const Key&, const Value&)>& visitor) const
+    {
+        for (const auto& shard : shards_) {
+            sLock lock(shard->lock_);
+
+            for (const auto& [key, value] : shard->map_) {
+                visitor(key, value);
+            }
+        }
+    }
+
+    /** Copies the value into output. Returns false if the key is not
+     *  present. */
+    bool Get(const Key& key, Value& output) const
+    {
+        const auto& shard = this->shard(key);
+        sLock lock(shard.lock_);
+        const auto it = shard.map_.find(key);
+
+        if (shard.map_.end() == it) { return false; }
+
+        output = it->second;
+
+        return true;
+    }
+
+    /** Runs modifier on the entry for key, default constructing it if
+     *  necessary, while the shard is locked for writing. */
+    template <typename Function>
+    void Modify(const Key& key, Function modifier)
+    {
+        auto& shard = this->shard(key);
+        eLock lock(shard.lock_);
+        modifier(shard.map_[key]);
+    }
+
+    /** Runs reader on the entry for key while the shard is locked for
+     *  reading. Returns false if the key is not present. */
+    template <typename Function>
+    bool Read(const Key& key, Function reader) const
+    {
+        const auto& shard = this->shard(key);
+        sLock lock(shard.lock_);
+        const auto it = shard.map_.find(key);
+
+        if (shard.map_.end() == it) { return false; }
+
+        reader(it->second);
+
+        return true;
+    }
+
+    void Set(const Key& key, const Value& value)
+    {
+        auto& shard = this->shard(key);
+        eLock lock(shard.lock_);
+        shard.map_[key] = value;
+    }
+
+    std::size_t Size() const
+    {
+        std::size_t output{0};
+
+        for (const auto& shard : shards_) {
+            sLock lock(shard->lock_);
+            output += shard->map_.size();
+        }
+
+        return output;
+    }
+
+    explicit ShardedMap(const std::size_t shards)
+        : hash_()
+        , shards_()
+    {
+        const auto count = (0 == shards) ? 1 : shards;
+
+        for (std::size_t i = 0; i < count; ++i) {
+            shards_.emplace_back(new Shard);
+        }
+    }
+
+    ~ShardedMap() = default;
+
+private:
+    struct Shard {
+        mutable std::shared_mutex lock_{};
+        std::unordered_map<Key, Value, Hash> map_{};
+    };
+
+    const Hash hash_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+
+    Shard& shard(const Key& key) const
+    {
+        // Fold in the high bits so that the shard index is not correlated
+        // with the bucket index used inside each shard.
+        const std::uint64_t hash = hash_(key);
+        const auto mixed = hash ^ (hash >> 32) ^ (hash >> 16);
+
+        return *shards_.at(mixed % shards_.size());
+    }
+
+    ShardedMap() = delete;
+    ShardedMap(const ShardedMap&) = delete;
+    ShardedMap(ShardedMap&&) = delete;
+    ShardedMap& operator=(const ShardedMap&) = delete;
+    ShardedMap& operator=(ShardedMap&&) = delete;
+};
+}  // namespace opentxs
+#endif  // OPENTXS_UTIL_SHARDEDMAP_HPP
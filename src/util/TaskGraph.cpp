@@ -0,0 +1,160 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "stdafx.hpp"
+
+#include "TaskGraph.hpp"
+
+#include "opentxs/core/util/Assert.hpp"
+
+#include "ThreadPool.hpp"
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+namespace opentxs
+{
+void TaskGraph::Add(
+    const std::string& name,
+    const std::set<std::string>& dependencies,
+    Task task)
+{
+    OT_ASSERT(task)
+    OT_ASSERT(0 == nodes_.count(name))
+
+    auto& node = nodes_[name];
+    node.dependencies_ = dependencies;
+    node.task_ = std::move(task);
+}
+
+void TaskGraph::Run(const ThreadPool& pool) const
+{
+    validate();
+
+    std::mutex lock{};
+    std::condition_variable finished{};
+    std::map<std::string, std::size_t> waiting{};
+    std::map<std::string, std::set<std::string>> dependents{};
+    std::size_t running{0};
+    std::size_t remaining{nodes_.size()};
+    std::exception_ptr error{};
+
+    for (const auto& [name, node] : nodes_) {
+        waiting[name] = node.dependencies_.size();
+
+        for (const auto& dependency : node.dependencies_) {
+            dependents[dependency].emplace(name);
+        }
+    }
+
+    std::function<void(const Lock&, const std::string&)> start{};
+    start = [&](const Lock&, const std::string& name) -> void {
+        ++running;
+        pool.Run([&, name]() -> void {
+            std::exception_ptr failure{};
+
+            try {
+                nodes_.at(name).task_();
+            } catch (...) {
+                failure = std::current_exception();
+            }
+
+            Lock lock2(lock);
+            --running;
+            --remaining;
+
+            if (failure) {
+                if (false == bool(error)) { error = failure; }
+            } else if (false == bool(error)) {
+                for (const auto& next : dependents[name]) {
+                    if (0 == --waiting.at(next)) { start(lock2, next); }
+                }
+            }
+
+            // Notify while locked so that Run() can not return and destroy
+            // the condition variable before this call completes
+            finished.notify_all();
+        });
+    };
+
+    Lock lock1(lock);
+
+    for (const auto& [name, count] : waiting) {
+        if (0 == count) { start(lock1, name); }
+    }
+
+    finished.wait(lock1, [&]() -> bool {
+        return (0 == remaining) || (error && (0 == running));
+    });
+
+    if (error) { std::rethrow_exception(error); }
+}
+
+void TaskGraph::validate() const
+{
+    std::set<std::string> done{};
+    std::size_t previous{0};
+
+    for (const auto& [name, node] : nodes_) {
+        for (const auto& dependency : node.dependencies_) {
+            OT_ASSERT_MSG(
+                1 == nodes_.count(dependency), "Unknown task dependency");
+        }
+    }
+
+    do {
+        previous = done.size();
+
+        for (const auto& [name, node] : nodes_) {
+            if (1 == done.count(name)) { continue; }
+
+            bool ready{true};
+
+            for (const auto& dependency : node.dependencies_) {
+                ready &= (1 == done.count(dependency));
+            }
+
+            if (ready) { done.emplace(name); }
+        }
+    } while (previous != done.size());
+
+    OT_ASSERT_MSG(done.size() == nodes_.size(), "Cyclic task dependencies");
+}
+}  // namespace opentxs
@@ -0,0 +1,92 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_UTIL_TASKGRAPH_HPP
+#define OPENTXS_UTIL_TASKGRAPH_HPP
+
+#include "Internal.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+
+namespace opentxs
+{
+class ThreadPool;
+
+/** \brief A set of named tasks with dependencies between them
+ *
+ *  Run() executes each task on the supplied pool as soon as every task it
+ *  depends on has finished, so independent tasks execute concurrently.
+ */
+class TaskGraph
+{
+public:
+    using Task = std::function<void()>;
+
+    void Add(
+        const std::string& name,
+        const std::set<std::string>& dependencies,
+        Task task);
+    /** Blocks until every task has finished. If a task throws, no task which
+     *  depends on it is started and the first exception is rethrown. */
+    void Run(const ThreadPool& pool) const;
+
+    TaskGraph() = default;
+
+    ~TaskGraph() = default;
+
+private:
+    struct Node {
+        std::set<std::string> dependencies_{};
+        Task task_{};
+    };
+
+    std::map<std::string, Node> nodes_{};
+
+    void validate() const;
+
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph(TaskGraph&&) = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+    TaskGraph& operator=(TaskGraph&&) = delete;
+};
+}  // namespace opentxs
+#endif  // OPENTXS_UTIL_TASKGRAPH_HPP
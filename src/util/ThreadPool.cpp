@@ -0,0 +1,173 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "stdafx.hpp"
+
+#include "ThreadPool.hpp"
+
+#include "opentxs/core/util/Assert.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+
+namespace opentxs
+{
+ThreadPool::ThreadPool(const std::size_t size)
+    : lock_()
+    , signal_()
+    , queue_()
+    , running_(true)
+    , workers_()
+{
+    const auto count = std::max(size, std::size_t(1));
+
+    for (std::size_t i = 0; i < count; ++i) {
+        workers_.emplace_back(&ThreadPool::worker, this);
+    }
+}
+
+std::size_t ThreadPool::DefaultSize()
+{
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+std::future<void> ThreadPool::queue(Task task, const bool next) const
+{
+    OT_ASSERT(task)
+
+    std::packaged_task<void()> job(std::move(task));
+    auto output = job.get_future();
+    Lock lock(lock_);
+
+    OT_ASSERT(running_)
+
+    if (next) {
+        queue_.emplace_front(std::move(job));
+    } else {
+        queue_.emplace_back(std::move(job));
+    }
+
+    lock.unlock();
+    signal_.notify_one();
+
+    return output;
+}
+
+std::future<void> ThreadPool::Run(Task task) const
+{
+    return queue(std::move(task), false);
+}
+
+std::future<void> ThreadPool::RunNext(Task task) const
+{
+    return queue(std::move(task), true);
+}
+
+bool ThreadPool::run_one() const
+{
+    Lock lock(lock_);
+
+    if (queue_.empty()) { return false; }
+
+    auto job = std::move(queue_.front());
+    queue_.pop_front();
+    lock.unlock();
+    job();
+
+    return true;
+}
+
+void ThreadPool::Wait(std::vector<Task>& tasks) const
+{
+    std::vector<std::future<void>> futures{};
+    futures.reserve(tasks.size());
+
+    for (auto& task : tasks) { futures.emplace_back(Run(std::move(task))); }
+
+    std::exception_ptr error{};
+
+    for (auto& future : futures) {
+        while (std::future_status::ready !=
+               future.wait_for(std::chrono::seconds(0))) {
+            if (false == run_one()) {
+                future.wait();
+
+                break;
+            }
+        }
+
+        try {
+            future.get();
+        } catch (...) {
+            if (false == bool(error)) { error = std::current_exception(); }
+        }
+    }
+
+    if (error) { std::rethrow_exception(error); }
+}
+
+void ThreadPool::worker()
+{
+    while (true) {
+        Lock lock(lock_);
+        signal_.wait(lock, [this]() -> bool {
+            return (false == running_) || (false == queue_.empty());
+        });
+
+        if (queue_.empty()) { return; }
+
+        auto job = std::move(queue_.front());
+        queue_.pop_front();
+        lock.unlock();
+        job();
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    Lock lock(lock_);
+    running_.store(false);
+    lock.unlock();
+    signal_.notify_all();
+
+    for (auto& worker : workers_) {
+        if (worker.joinable()) { worker.join(); }
+    }
+}
+}  // namespace opentxs
@@ -0,0 +1,101 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_UTIL_THREADPOOL_HPP
+#define OPENTXS_UTIL_THREADPOOL_HPP
+
+#include "Internal.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace opentxs
+{
+/** \brief Fixed-size pool of worker threads
+ *
+ *  Tasks are executed in the order in which they were submitted, except for
+ *  tasks submitted via RunNext() which go ahead of every waiting task. Wait()
+ *  runs queued tasks on the calling thread until its own tasks are finished,
+ *  so it may be called from inside a task running on the same pool. Blocking
+ *  on a future returned by Run() from inside a task is not safe.
+ */
+class ThreadPool
+{
+public:
+    using Task = std::function<void()>;
+
+    /** Returns a pool sized to the number of hardware threads */
+    static std::size_t DefaultSize();
+
+    /** Executes every task and waits for all of them to finish. Any exception
+     *  thrown by a task is rethrown after all tasks have completed. */
+    void Wait(std::vector<Task>& tasks) const;
+    std::future<void> Run(Task task) const;
+    /** Queues the task ahead of every task which has not started yet */
+    std::future<void> RunNext(Task task) const;
+    std::size_t Size() const { return workers_.size(); }
+
+    explicit ThreadPool(const std::size_t size = DefaultSize());
+
+    ~ThreadPool();
+
+private:
+    mutable std::mutex lock_;
+    mutable std::condition_variable signal_;
+    mutable std::deque<std::packaged_task<void()>> queue_;
+    std::atomic<bool> running_;
+    std::vector<std::thread> workers_;
+
+    std::future<void> queue(Task task, const bool next) const;
+    bool run_one() const;
+    void worker();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+};
+}  // namespace opentxs
+#endif  // OPENTXS_UTIL_THREADPOOL_HPP
@@ -0,0 +1,113 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "Bench.hpp"
+
+#include <map>
+#include <mutex>
+
+namespace opentxs::bench
+{
+const api::Native& Client()
+{
+    static std::once_flag started{};
+    std::call_once(started, []() -> void { OT::ClientFactory({}); });
+
+    return OT::App();
+}
+
+std::string Ledger(const std::size_t receipts)
+{
+    std::string output{"-----BEGIN SIGNED LEDGER-----\nHash: SHA256\n\n"};
+    output += "<accountLedger version=\"2.0\"\n type=\"inbox\"\n"
+              " numPartialRecords=\"" +
+              std::to_string(receipts) +
+              "\"\n accountID=\"otA5sSgyKzqsV7mBZgZRwU3AH2rB7PMSBNMB\"\n"
+              " nymID=\"ot2CybVv59EZfL1m5rSHHQ4jYkEAmDQEmWrp\"\n"
+              " notaryID=\"ot2qWyX1RVxNzG8FXAb3ZSx3MTbKHsMNLVJb\">\n\n";
+
+    for (std::size_t i = 0; i < receipts; ++i) {
+        const auto number = std::to_string(1000 + i);
+        output += "<inboxRecord type=\"pending\"\n"
+                  " dateSigned=\"1514764800\"\n"
+                  " receiptHash=\"ot2fAw5rnT8FRvA8hR2BNNBywEcMWn3BbSSc\"\n"
+                  " adjustment=\"100\"\n"
+                  " displayValue=\"100\"\n"
+                  " numberOfOrigin=\"" +
+                  number +
+                  "\"\n"
+                  " transactionNum=\"" +
+                  number +
+                  "\"\n"
+                  " inRefDisplay=\"" +
+                  number +
+                  "\"\n"
+                  " inReferenceTo=\"" +
+                  number + "\"/>\n\n";
+    }
+
+    output += "</accountLedger>\n"
+              "-----BEGIN LEDGER SIGNATURE-----\n"
+              "Version: Open Transactions 0.99\n"
+              "Comment: http://opentransactions.org\n\n";
+
+    for (std::size_t i = 0; i < 6; ++i) {
+        output += "iQIcBAEBCAAGBQJaSC2AAAoJEKZ3cxRtCv8MTf4P/2vN5fJz1ELU\n";
+    }
+
+    output += "-----END LEDGER SIGNATURE-----\n";
+
+    return output;
+}
+
+ConstNym Nym(const NymParameterType type)
+{
+    static std::mutex lock{};
+    static std::map<NymParameterType, ConstNym> nyms{};
+    std::lock_guard<std::mutex> guard(lock);
+    auto& output = nyms[type];
+
+    if (output) { return output; }
+
+    NymParameters parameters(proto::CREDTYPE_LEGACY);
+    parameters.setNymParameterType(type);
+    output = Client().Wallet().Nym(parameters);
+
+    return output;
+}
+}  // namespace opentxs::bench
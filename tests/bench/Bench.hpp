@@ -0,0 +1,96 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_TESTS_BENCH_BENCH_HPP
+#define OPENTXS_TESTS_BENCH_BENCH_HPP
+
+#include "opentxs/opentxs.hpp"
+
+extern "C" {
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+}
+
+#include <cstddef>
+#include <string>
+
+namespace opentxs::bench
+{
+/** Starts a client the first time it is called and never cleans it up
+ *
+ *  OT::App() can only be started once per process, so benchmarks which
+ *  fork to start their own clients (Bench_Startup.cpp, Bench_Storage.cpp)
+ *  are built into opentxs-bench-process, which never calls this.
+ */
+const api::Native& Client();
+
+/** Signed ledger with the same layout as an inbox full of abbreviated
+ *  receipts. The signature is not valid. */
+std::string Ledger(const std::size_t receipts);
+
+/** A nym with a single legacy credential of the requested key type
+ *
+ *  Nyms are created once per key type and cached for the life of the
+ *  process.
+ */
+ConstNym Nym(const NymParameterType type);
+
+/** Runs function in a child process
+ *
+ *  Returns true if the child exited with a zero status.
+ */
+template <typename Function>
+bool RunInChild(Function function)
+{
+    const auto pid = ::fork();
+
+    if (0 > pid) { return false; }
+
+    if (0 == pid) {
+        function();
+        ::_exit(0);
+    }
+
+    int status{0};
+    ::waitpid(pid, &status, 0);
+
+    return WIFEXITED(status) && (0 == WEXITSTATUS(status));
+}
+}  // namespace opentxs::bench
+#endif  // OPENTXS_TESTS_BENCH_BENCH_HPP
@@ -0,0 +1,98 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+#include "opentxs/core/crypto/OTASCIIArmor.hpp"
+#include "opentxs/core/String.hpp"
+
+#include "Bench.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+using namespace opentxs;
+
+namespace
+{
+void ArmorEncode(benchmark::State& state)
+{
+    bench::Client();
+    const auto input = bench::Ledger(static_cast<std::size_t>(state.range(0)));
+    const String plaintext(input);
+
+    for (auto _ : state) {
+        const OTASCIIArmor armored(plaintext);
+
+        if (false == armored.Exists()) {
+            state.SkipWithError("Failed to armor input");
+
+            break;
+        }
+    }
+
+    state.SetBytesProcessed(
+        static_cast<std::int64_t>(state.iterations() * input.size()));
+}
+
+void ArmorDecode(benchmark::State& state)
+{
+    bench::Client();
+    const auto input = bench::Ledger(static_cast<std::size_t>(state.range(0)));
+    const OTASCIIArmor armored{String(input)};
+
+    for (auto _ : state) {
+        String plaintext{};
+
+        if (false == armored.GetString(plaintext)) {
+            state.SkipWithError("Failed to decode input");
+
+            break;
+        }
+
+        benchmark::DoNotOptimize(plaintext.Get());
+    }
+
+    state.SetBytesProcessed(
+        static_cast<std::int64_t>(state.iterations() * input.size()));
+}
+}  // namespace
+
+BENCHMARK(ArmorEncode)->Arg(1)->Arg(100)->Arg(1000);
+BENCHMARK(ArmorDecode)->Arg(1)->Arg(100)->Arg(1000);
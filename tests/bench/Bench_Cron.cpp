@@ -0,0 +1,112 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+#include "opentxs/core/cron/OTCron.hpp"
+#include "opentxs/core/recurring/OTPaymentPlan.hpp"
+
+#include "Bench.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+using namespace opentxs;
+
+// Enough to stay clear of the 20 percent floor below which cron skips a beat
+#define BENCH_CRON_TRANSACTION_NUMBERS 1000
+
+namespace
+{
+/* One cron beat over the requested number of payment plans which do not
+ * become valid for a year, so every beat visits each plan and leaves it in
+ * place. This is the cost each waiting item adds to every beat. */
+void CronTick(benchmark::State& state)
+{
+    const auto nym = bench::Nym(NymParameters{}.nymParameterType());
+
+    if (false == bool(nym)) {
+        state.SkipWithError("Failed to create nym");
+
+        return;
+    }
+
+    const auto items = static_cast<std::int64_t>(state.range(0));
+    const auto notaryID = Identifier::Random();
+    const auto unitID = Identifier::Random();
+    const auto accountID = Identifier::Random();
+    const auto interval = OTCron::GetCronMsBetweenProcess();
+    const auto now = OTTimeGetCurrentTime();
+    const auto validFrom = OTTimeAddTimeInterval(
+        now, OTTimeGetSecondsFromTime(OT_TIME_YEAR_IN_SECONDS));
+    OTCron cron{};
+    cron.SetNotaryID(notaryID);
+    cron.SetServerNym(nym);
+    cron.ActivateCron();
+
+    for (std::int64_t i = 1; i <= BENCH_CRON_TRANSACTION_NUMBERS; ++i) {
+        cron.AddTransactionNumber(i);
+    }
+
+    for (std::int64_t i = 1; i <= items; ++i) {
+        auto* plan = new OTPaymentPlan(
+            notaryID, unitID, accountID, nym->ID(), accountID, nym->ID());
+        plan->SetTransactionNum(BENCH_CRON_TRANSACTION_NUMBERS + i);
+        plan->SetValidFrom(validFrom);
+
+        // Cron owns the plan once it has been added
+        if (false == cron.AddCronItem(*plan, false, now)) {
+            delete plan;
+            state.SkipWithError("Failed to add cron item");
+
+            return;
+        }
+    }
+
+    // Let every call to ProcessCronItems run a beat
+    OTCron::SetCronMsBetweenProcess(0);
+
+    for (auto _ : state) { cron.ProcessCronItems(); }
+
+    OTCron::SetCronMsBetweenProcess(interval);
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * items));
+}
+}  // namespace
+
+BENCHMARK(CronTick)->Arg(10)->Arg(100)->Arg(1000);
@@ -0,0 +1,84 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include "Bench.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+void Digest(benchmark::State& state, const proto::HashType type)
+{
+    const auto& hash = bench::Client().Crypto().Hash();
+    const auto size = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::uint8_t> bytes(size, 0x5a);
+    const auto input = Data::Factory(bytes.data(), bytes.size());
+
+    for (auto _ : state) {
+        auto digest = Data::Factory();
+
+        if (false == hash.Digest(type, input, digest)) {
+            state.SkipWithError("Hash type not supported");
+
+            break;
+        }
+
+        benchmark::DoNotOptimize(digest->GetPointer());
+    }
+
+    state.SetBytesProcessed(
+        static_cast<std::int64_t>(state.iterations() * size));
+}
+}  // namespace
+
+BENCHMARK_CAPTURE(Digest, sha256, proto::HASHTYPE_SHA256)
+    ->RangeMultiplier(16)
+    ->Range(64, 1 << 20);
+BENCHMARK_CAPTURE(Digest, sha512, proto::HASHTYPE_SHA512)
+    ->RangeMultiplier(16)
+    ->Range(64, 1 << 20);
+BENCHMARK_CAPTURE(Digest, blake2b256, proto::HASHTYPE_BLAKE2B256)
+    ->RangeMultiplier(16)
+    ->Range(64, 1 << 20);
@@ -0,0 +1,79 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include "Bench.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+using namespace opentxs;
+
+namespace
+{
+void IdentifierStr(benchmark::State& state)
+{
+    bench::Client();
+    const auto id = Identifier::Random();
+
+    for (auto _ : state) {
+        const auto encoded = id->str();
+        benchmark::DoNotOptimize(encoded.data());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void IdentifierFactory(benchmark::State& state)
+{
+    bench::Client();
+    const auto encoded = Identifier::Random()->str();
+
+    for (auto _ : state) {
+        const auto id = Identifier::Factory(encoded);
+        benchmark::DoNotOptimize(id->GetPointer());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+BENCHMARK(IdentifierStr);
+BENCHMARK(IdentifierFactory);
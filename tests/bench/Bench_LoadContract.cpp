@@ -0,0 +1,132 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+#include "opentxs/core/Ledger.hpp"
+#include "opentxs/core/Message.hpp"
+#include "opentxs/core/String.hpp"
+
+#include "Bench.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+using namespace opentxs;
+
+namespace
+{
+void LoadLedger(benchmark::State& state, const bool arena)
+{
+    bench::Client();
+    Ledger::SetArenaAllocation(arena);
+    const auto receipts = static_cast<std::size_t>(state.range(0));
+    const auto input = bench::Ledger(receipts);
+    const String serialized(input);
+    const auto accountID =
+        Identifier::Factory("otA5sSgyKzqsV7mBZgZRwU3AH2rB7PMSBNMB");
+    const auto notaryID =
+        Identifier::Factory("ot2qWyX1RVxNzG8FXAb3ZSx3MTbKHsMNLVJb");
+    const auto allocations = String::Allocations();
+
+    for (auto _ : state) {
+        Ledger ledger(accountID, notaryID);
+
+        if (false == ledger.LoadContractFromString(serialized)) {
+            state.SkipWithError("Failed to load ledger");
+
+            break;
+        }
+    }
+
+    Ledger::SetArenaAllocation(false);
+    state.SetBytesProcessed(
+        static_cast<std::int64_t>(state.iterations() * input.size()));
+    state.counters["receipts"] = static_cast<double>(receipts);
+    state.counters["string_allocations"] = benchmark::Counter(
+        static_cast<double>(String::Allocations() - allocations),
+        benchmark::Counter::kAvgIterations);
+}
+
+void LoadMessage(benchmark::State& state)
+{
+    const auto nym = bench::Nym(NymParameters{}.nymParameterType());
+
+    if (false == bool(nym)) {
+        state.SkipWithError("Failed to create nym");
+
+        return;
+    }
+
+    // A processInbox request carrying a ledger of the requested size
+    Message request{};
+    request.m_strCommand = "processInbox";
+    request.m_strNymID = String(nym->ID());
+    request.m_strNotaryID = "ot2qWyX1RVxNzG8FXAb3ZSx3MTbKHsMNLVJb";
+    request.m_strAcctID = "otA5sSgyKzqsV7mBZgZRwU3AH2rB7PMSBNMB";
+    request.m_strRequestNum = "100";
+    request.m_ascPayload.SetString(
+        String(bench::Ledger(static_cast<std::size_t>(state.range(0)))));
+
+    if (false == (request.SignContract(*nym) && request.SaveContract())) {
+        state.SkipWithError("Failed to sign message");
+
+        return;
+    }
+
+    const String serialized(request);
+
+    for (auto _ : state) {
+        Message message{};
+
+        if (false == message.LoadContractFromString(serialized)) {
+            state.SkipWithError("Failed to load message");
+
+            break;
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(
+        state.iterations() * serialized.GetLength()));
+}
+}  // namespace
+
+BENCHMARK_CAPTURE(LoadLedger, heap, false)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_CAPTURE(LoadLedger, arena, true)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(LoadMessage)->Arg(0)->Arg(10)->Arg(100);
@@ -0,0 +1,102 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+#include "opentxs/core/trade/OTMarket.hpp"
+#include "opentxs/core/trade/OTOffer.hpp"
+
+#include "Bench.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+using namespace opentxs;
+
+#define BENCH_MARKET_SCALE 1
+
+namespace
+{
+/* Builds the order book of a market with the requested number of resting
+ * offers, half bids and half asks interleaved around a common price, then
+ * answers a getMarketOffers query and reads the best bid and ask. These are
+ * the structures the matching loop in OTMarket::ProcessTrade walks. */
+void MarketBook(benchmark::State& state)
+{
+    bench::Client();
+    const auto offers = static_cast<std::int64_t>(state.range(0));
+    const auto notaryID = Identifier::Random();
+    const auto unitID = Identifier::Random();
+    const auto currencyID = Identifier::Random();
+
+    for (auto _ : state) {
+        OTMarket market(notaryID, unitID, currencyID, BENCH_MARKET_SCALE);
+
+        for (std::int64_t i = 1; i <= offers; ++i) {
+            const bool selling = (0 == i % 2);
+            // Asks above 1000 and bids below it, so that no two offers cross
+            const std::int64_t price = selling ? 1000 + i : 1000 - (i % 1000);
+            // The market owns every offer added to it
+            auto* offer = new OTOffer(
+                notaryID, unitID, currencyID, BENCH_MARKET_SCALE);
+            const bool added =
+                offer->MakeOffer(
+                    selling, price, 100, BENCH_MARKET_SCALE, i) &&
+                market.AddOffer(nullptr, *offer, false);
+
+            if (false == added) {
+                delete offer;
+                state.SkipWithError("Failed to add offer");
+
+                break;
+            }
+        }
+
+        OTASCIIArmor list{};
+        std::int32_t count{0};
+        market.GetOfferList(list, 0, count);
+        benchmark::DoNotOptimize(market.GetHighestBidPrice());
+        benchmark::DoNotOptimize(market.GetLowestAskPrice());
+    }
+
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * offers));
+}
+}  // namespace
+
+BENCHMARK(MarketBook)->Arg(10)->Arg(100)->Arg(1000);
@@ -0,0 +1,240 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include "Bench.hpp"
+#include "Loopback.hpp"
+
+#include <benchmark/benchmark.h>
+
+extern "C" {
+#include <sys/stat.h>
+#include <unistd.h>
+}
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+using namespace opentxs;
+
+#define BENCH_NOTARY_PORT 17185
+
+namespace
+{
+// Sends the request and returns true if the notary accepted it
+bool execute(const api::client::ServerAction::Action& action)
+{
+    action->Run();
+
+    if (SendResult::VALID_REPLY != action->LastSendResult()) { return false; }
+
+    const auto& reply = action->Reply();
+
+    return bool(reply) && reply->m_bSuccess;
+}
+
+bool register_nym(
+    const api::Native& ot,
+    const Identifier& server,
+    OTIdentifier& nym)
+{
+    const auto created =
+        ot.Wallet().Nym(NymParameters(proto::CREDTYPE_LEGACY));
+
+    if (false == bool(created)) { return false; }
+
+    nym = Identifier::Factory(created->ID());
+
+    return execute(ot.ServerAction().RegisterNym(nym, server));
+}
+
+/* Starts a client in a child process, registers two nyms with the notary,
+ * issues a unit to the first and opens an account in it for the second,
+ * then times count transfers between them, each followed by the
+ * recipient's processInbox. The elapsed time in seconds is written to fd,
+ * or a negative value on failure. */
+void run(
+    const int fd,
+    const std::string& home,
+    const std::string& contract,
+    const std::size_t count)
+{
+    ::setenv("HOME", home.c_str(), 1);
+    OT::ClientFactory({});
+    const auto& ot = OT::App();
+    double output{-1};
+    const auto server = ot.Wallet().Server(
+        proto::DataToProto<proto::ServerContract>(
+            Data::Factory(contract.data(), contract.size())));
+    auto issuer = Identifier::Factory();
+    auto recipient = Identifier::Factory();
+    auto from = Identifier::Factory();
+    auto to = Identifier::Factory();
+    bool ready = bool(server);
+    ready = ready && register_nym(ot, server->ID(), issuer);
+    ready = ready && register_nym(ot, server->ID(), recipient);
+    ConstUnitDefinition unit{nullptr};
+
+    if (ready) {
+        unit = ot.Wallet().UnitDefinition(
+            issuer->str(),
+            "Bench",
+            "Bench",
+            "BNC",
+            "Benchmark unit",
+            "BNC",
+            2,
+            "cents");
+        ready = bool(unit);
+    }
+
+    if (ready) {
+        auto action = ot.ServerAction().IssueUnitDefinition(
+            issuer, server->ID(), unit->PublicContract());
+        ready = execute(action);
+
+        if (ready) { from->SetString(action->Reply()->m_strAcctID); }
+    }
+
+    if (ready) {
+        auto action = ot.ServerAction().RegisterAccount(
+            recipient, server->ID(), unit->ID());
+        ready = execute(action);
+
+        if (ready) { to->SetString(action->Reply()->m_strAcctID); }
+    }
+
+    if (ready) {
+        const auto start = std::chrono::steady_clock::now();
+
+        for (std::size_t i = 0; i < count; ++i) {
+            ready &= execute(ot.ServerAction().SendTransfer(
+                issuer, server->ID(), from, to, 1, "bench"));
+            ready &= ot.Sync().AcceptIncoming(recipient, to, server->ID());
+        }
+
+        const auto elapsed =
+            std::chrono::duration_cast<std::chrono::duration<double>>(
+                std::chrono::steady_clock::now() - start);
+
+        if (ready) { output = elapsed.count(); }
+    }
+
+    ::write(fd, &output, sizeof(output));
+    OT::Cleanup();
+}
+
+// OT::App() can only be started once per process, so the notary and the
+// client each run in a child process with their own HOME. The notary only
+// serves tcp:// endpoints, so requests go over the loopback interface.
+void NotaryLoop(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    char pattern[] = "/tmp/opentxs-bench-XXXXXX";
+
+    if (nullptr == ::mkdtemp(pattern)) {
+        state.SkipWithError("Failed to create data directory");
+
+        return;
+    }
+
+    const std::string directory{pattern};
+    std::size_t run_number{0};
+
+    for (auto _ : state) {
+        const auto suffix = std::to_string(run_number++);
+        const auto notaryHome = directory + "/notary" + suffix;
+        const auto clientHome = directory + "/client" + suffix;
+
+        if ((0 != ::mkdir(notaryHome.c_str(), 0700)) ||
+            (0 != ::mkdir(clientHome.c_str(), 0700))) {
+            state.SkipWithError("Failed to create data directory");
+
+            break;
+        }
+
+        loopback::Notary notary(notaryHome, BENCH_NOTARY_PORT);
+
+        if (false == notary.Start()) {
+            state.SkipWithError("Failed to start notary");
+
+            break;
+        }
+
+        int fds[2]{};
+
+        if (0 != ::pipe(fds)) {
+            state.SkipWithError("Failed to create pipe");
+
+            break;
+        }
+
+        const auto& contract = notary.Contract();
+        const bool exited = bench::RunInChild([&]() -> void {
+            run(fds[1], clientHome, contract, count);
+        });
+        double elapsed{-1};
+        const auto bytes = ::read(fds[0], &elapsed, sizeof(elapsed));
+        ::close(fds[0]);
+        ::close(fds[1]);
+        notary.Stop();
+
+        if ((false == exited) || (sizeof(elapsed) != bytes) ||
+            (0 > elapsed)) {
+            state.SkipWithError("Notary round trip failed");
+
+            break;
+        }
+
+        state.SetIterationTime(elapsed);
+    }
+
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * count));
+}
+}  // namespace
+
+// Each iteration starts a notary and a client, so only a few are run
+BENCHMARK(NotaryLoop)
+    ->Arg(20)
+    ->Iterations(3)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,104 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+#include "opentxs/core/Contract.hpp"
+#include "opentxs/core/String.hpp"
+
+#include "Bench.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+using namespace opentxs;
+
+namespace
+{
+/* Accepts every element so that the benchmark measures the raw file parser
+ * and the xml reader rather than receipt instantiation. */
+class BenchContract : public Contract
+{
+public:
+    std::int32_t ProcessXMLNode(irr::io::IrrXMLReader*&) override
+    {
+        return 1;
+    }
+};
+
+void ParseRawFile(benchmark::State& state)
+{
+    const auto receipts = static_cast<std::size_t>(state.range(0));
+    const auto input = bench::Ledger(receipts);
+
+    if (MAX_STRING_LENGTH <= input.size()) {
+        state.SkipWithError("Ledger exceeds MAX_STRING_LENGTH");
+
+        return;
+    }
+
+    const String serialized(input);
+
+    for (auto _ : state) {
+        BenchContract contract;
+        const bool loaded = contract.LoadContractFromString(serialized);
+
+        if (false == loaded) {
+            state.SkipWithError("Failed to parse ledger");
+
+            break;
+        }
+
+        benchmark::DoNotOptimize(loaded);
+    }
+
+    state.SetBytesProcessed(
+        static_cast<std::int64_t>(state.iterations() * input.size()));
+    state.counters["receipts"] = static_cast<double>(receipts);
+}
+}  // namespace
+
+// Serialized strings are limited to MAX_STRING_LENGTH (8 MiB), which is
+// reached at roughly 25k receipts in this format.
+BENCHMARK(ParseRawFile)
+    ->Arg(1000)
+    ->Arg(5000)
+    ->Arg(10000)
+    ->Arg(25000)
+    ->Unit(benchmark::kMillisecond);
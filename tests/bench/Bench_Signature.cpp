@@ -0,0 +1,125 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+#include "opentxs/core/Message.hpp"
+#include "opentxs/core/String.hpp"
+
+#include "Bench.hpp"
+
+#include <benchmark/benchmark.h>
+
+using namespace opentxs;
+
+namespace
+{
+bool populate(Message& message, const Nym& nym)
+{
+    message.m_strCommand = "pingNotary";
+    message.m_strNymID = String(nym.ID());
+    message.m_strNotaryID = "ot2qWyX1RVxNzG8FXAb3ZSx3MTbKHsMNLVJb";
+    message.m_strRequestNum = "1";
+
+    return message.SignContract(nym);
+}
+
+void Sign(benchmark::State& state, const NymParameterType type)
+{
+    const auto nym = bench::Nym(type);
+
+    if (false == bool(nym)) {
+        state.SkipWithError("Failed to create nym");
+
+        return;
+    }
+
+    Message message{};
+
+    for (auto _ : state) {
+        if (false == populate(message, *nym)) {
+            state.SkipWithError("Failed to sign message");
+
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void Verify(benchmark::State& state, const NymParameterType type)
+{
+    const auto nym = bench::Nym(type);
+
+    if (false == bool(nym)) {
+        state.SkipWithError("Failed to create nym");
+
+        return;
+    }
+
+    Message message{};
+
+    if (false == populate(message, *nym)) {
+        state.SkipWithError("Failed to sign message");
+
+        return;
+    }
+
+    for (auto _ : state) {
+        if (false == message.VerifySignature(*nym)) {
+            state.SkipWithError("Failed to verify message");
+
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+}  // namespace
+
+#if OT_CRYPTO_SUPPORTED_KEY_ED25519
+BENCHMARK_CAPTURE(Sign, ed25519, NymParameterType::ED25519);
+BENCHMARK_CAPTURE(Verify, ed25519, NymParameterType::ED25519);
+#endif
+#if OT_CRYPTO_SUPPORTED_KEY_SECP256K1
+BENCHMARK_CAPTURE(Sign, secp256k1, NymParameterType::SECP256K1);
+BENCHMARK_CAPTURE(Verify, secp256k1, NymParameterType::SECP256K1);
+#endif
+#if OT_CRYPTO_SUPPORTED_KEY_RSA
+BENCHMARK_CAPTURE(Sign, rsa, NymParameterType::RSA);
+BENCHMARK_CAPTURE(Verify, rsa, NymParameterType::RSA);
+#endif
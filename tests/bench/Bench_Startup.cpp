@@ -0,0 +1,105 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include "Bench.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <string>
+
+using namespace opentxs;
+
+namespace
+{
+void populate_contacts(const std::size_t count)
+{
+    OT::ClientFactory({});
+    const auto& contacts = OT::App().Contact();
+
+    for (auto i = contacts.ContactList().size(); i < count; ++i) {
+        contacts.NewContact("contact " + std::to_string(i));
+    }
+
+    OT::Cleanup();
+}
+
+// OT::App() can only be started once per process, so each measurement is
+// performed in a child process
+void Startup(benchmark::State& state)
+{
+    const auto contacts = static_cast<std::size_t>(state.range(0));
+
+    const auto populated = bench::RunInChild(
+        [&]() -> void { populate_contacts(contacts); });
+
+    if (false == populated) {
+        state.SkipWithError("Failed to create contacts");
+
+        return;
+    }
+
+    for (auto _ : state) {
+        const auto start = std::chrono::steady_clock::now();
+        const auto success = bench::RunInChild([]() -> void {
+            OT::ClientFactory({});
+            OT::Cleanup();
+        });
+        const auto elapsed = std::chrono::duration_cast<
+            std::chrono::duration<double>>(
+            std::chrono::steady_clock::now() - start);
+
+        if (false == success) {
+            state.SkipWithError("Startup failed");
+
+            break;
+        }
+
+        state.SetIterationTime(elapsed.count());
+    }
+}
+}  // namespace
+
+BENCHMARK(Startup)
+    ->Arg(10000)
+    ->Iterations(5)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,186 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include "Bench.hpp"
+
+#include <benchmark/benchmark.h>
+
+extern "C" {
+#include <unistd.h>
+}
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+
+#define BENCH_STORAGE_OBJECT_BYTES 4096
+
+namespace
+{
+enum class Operation : std::uint8_t { Store = 0, Load = 1 };
+
+bool store(
+    const api::storage::Storage& db,
+    const std::string& id,
+    const std::string& data)
+{
+    static const auto nym = Identifier::Random();
+    static const auto server = Identifier::Random();
+    static const auto unit = Identifier::Random();
+
+    return db.Store(
+        id, data, "", nym, nym, nym, server, unit, proto::CITEMTYPE_USD);
+}
+
+/* Starts a client with the requested storage plugin in a child process and
+ * times count stores or loads of account-sized objects. The elapsed time in
+ * seconds is written to fd, or a negative value on failure. */
+void run(
+    const int fd,
+    const std::string& plugin,
+    const Operation operation,
+    const std::size_t count)
+{
+    OT::ClientFactory({{OPENTXS_ARG_STORAGE_PLUGIN, {plugin}}});
+    const auto& db = OT::App().DB();
+    const std::string data(BENCH_STORAGE_OBJECT_BYTES, 'x');
+    std::vector<std::string> ids{};
+    double output{-1};
+    bool success{true};
+
+    for (std::size_t i = 0; i < count; ++i) {
+        ids.emplace_back(Identifier::Random()->str());
+    }
+
+    if (Operation::Load == operation) {
+        for (const auto& id : ids) { success &= store(db, id, data); }
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (const auto& id : ids) {
+        if (Operation::Store == operation) {
+            success &= store(db, id, data);
+        } else {
+            std::string loaded{};
+            std::string alias{};
+            success &= db.Load(id, loaded, alias);
+        }
+    }
+
+    const auto elapsed =
+        std::chrono::duration_cast<std::chrono::duration<double>>(
+            std::chrono::steady_clock::now() - start);
+
+    if (success) { output = elapsed.count(); }
+
+    ::write(fd, &output, sizeof(output));
+    OT::Cleanup();
+}
+
+void Storage(
+    benchmark::State& state,
+    const std::string plugin,
+    const Operation operation)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        int fds[2]{};
+
+        if (0 != ::pipe(fds)) {
+            state.SkipWithError("Failed to create pipe");
+
+            break;
+        }
+
+        const bool exited = bench::RunInChild([&]() -> void {
+            run(fds[1], plugin, operation, count);
+        });
+        double elapsed{-1};
+        const auto bytes = ::read(fds[0], &elapsed, sizeof(elapsed));
+        ::close(fds[0]);
+        ::close(fds[1]);
+
+        if ((false == exited) || (sizeof(elapsed) != bytes) ||
+            (0 > elapsed)) {
+            state.SkipWithError("Storage operation failed");
+
+            break;
+        }
+
+        state.SetIterationTime(elapsed);
+    }
+
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * count));
+    state.SetBytesProcessed(static_cast<std::int64_t>(
+        state.iterations() * count * BENCH_STORAGE_OBJECT_BYTES));
+}
+}  // namespace
+
+// Each iteration starts a client in a child process, so only a few are run
+#if OT_STORAGE_FS
+BENCHMARK_CAPTURE(Storage, fs_store, "fs", Operation::Store)
+    ->Arg(1000)
+    ->Iterations(3)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Storage, fs_load, "fs", Operation::Load)
+    ->Arg(1000)
+    ->Iterations(3)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+#endif
+#if OT_STORAGE_SQLITE
+BENCHMARK_CAPTURE(Storage, sqlite_store, "sqlite", Operation::Store)
+    ->Arg(1000)
+    ->Iterations(3)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Storage, sqlite_load, "sqlite", Operation::Load)
+    ->Arg(1000)
+    ->Iterations(3)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+#endif
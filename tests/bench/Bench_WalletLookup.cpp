@@ -0,0 +1,152 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include "Bench.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+
+#define BENCH_WALLET_OBJECTS 8
+
+namespace
+{
+struct Objects {
+    std::vector<OTIdentifier> nyms_{};
+    std::vector<OTIdentifier> servers_{};
+};
+
+const Objects& objects()
+{
+    static const Objects output = []() -> Objects {
+        const auto& exec = bench::Client().API().Exec();
+        const auto& wallet = bench::Client().Wallet();
+        Objects objects{};
+
+        for (std::size_t i = 0; i < BENCH_WALLET_OBJECTS; ++i) {
+            const auto name = "bench " + std::to_string(i);
+            const auto nymID = Identifier::Factory(
+                exec.CreateNymHD(proto::CITEMTYPE_INDIVIDUAL, name));
+            const std::list<ServerContract::Endpoint> endpoints{
+                {proto::ADDRESSTYPE_IPV4,
+                 proto::PROTOCOLVERSION_LEGACY,
+                 "127.0.0.1",
+                 static_cast<std::uint32_t>(7085 + i),
+                 1}};
+            const auto server =
+                wallet.Server(nymID->str(), name, "terms", endpoints);
+
+            if (false == bool(server)) { break; }
+
+            // Create the context so that lookups hit the cache
+            wallet.mutable_ServerContext(nymID, server->ID());
+            objects.nyms_.emplace_back(nymID);
+            objects.servers_.emplace_back(server->ID());
+        }
+
+        return objects;
+    }();
+
+    return output;
+}
+
+template <typename Function>
+void lookup(benchmark::State& state, Function function)
+{
+    const auto& ids = objects();
+
+    if (BENCH_WALLET_OBJECTS != ids.nyms_.size()) {
+        state.SkipWithError("Failed to create wallet objects");
+
+        return;
+    }
+
+    const auto& wallet = OT::App().Wallet();
+    auto index = static_cast<std::size_t>(state.thread_index);
+
+    for (auto _ : state) {
+        const auto i = index++ % BENCH_WALLET_OBJECTS;
+        const bool found = function(wallet, ids.nyms_[i], ids.servers_[i]);
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+void WalletNym(benchmark::State& state)
+{
+    lookup(
+        state,
+        [](const api::client::Wallet& wallet,
+           const Identifier& nym,
+           const Identifier&) -> bool { return bool(wallet.Nym(nym)); });
+}
+
+void WalletServer(benchmark::State& state)
+{
+    lookup(
+        state,
+        [](const api::client::Wallet& wallet,
+           const Identifier&,
+           const Identifier& server) -> bool {
+            return bool(wallet.Server(server));
+        });
+}
+
+void WalletServerContext(benchmark::State& state)
+{
+    lookup(
+        state,
+        [](const api::client::Wallet& wallet,
+           const Identifier& nym,
+           const Identifier& server) -> bool {
+            return bool(wallet.ServerContext(nym, server));
+        });
+}
+}  // namespace
+
+BENCHMARK(WalletNym)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(WalletServer)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(WalletServerContext)->ThreadRange(1, 32)->UseRealTime();
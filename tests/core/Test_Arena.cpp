@@ -0,0 +1,250 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include "util/Arena.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+TEST(Test_Arena, heap_without_scope)
+{
+    const auto blocks = Arena::LiveBlocks();
+    auto* pointer = Arena::Allocate(64);
+
+    ASSERT_NE(nullptr, pointer);
+    EXPECT_EQ(blocks, Arena::LiveBlocks());
+
+    std::memset(pointer, 0xff, 64);
+    Arena::Deallocate(pointer);
+    Arena::Deallocate(nullptr);
+}
+
+TEST(Test_Arena, scope_allocates_from_arena)
+{
+    const auto blocks = Arena::LiveBlocks();
+    auto arena = Arena::Factory();
+    std::vector<void*> pointers{};
+
+    {
+        Arena::Scope scope(arena.get());
+
+        for (int i = 0; i < 100; ++i) {
+            pointers.emplace_back(Arena::Allocate(24));
+        }
+    }
+
+    EXPECT_EQ(blocks + 1, Arena::LiveBlocks());
+    EXPECT_GT(arena->Reserved(), 0);
+
+    // Allocations after the scope has ended come from the heap again
+    auto* heap = Arena::Allocate(24);
+
+    for (auto* pointer : pointers) { Arena::Deallocate(pointer); }
+
+    Arena::Deallocate(heap);
+    EXPECT_EQ(blocks + 1, Arena::LiveBlocks());
+
+    arena.reset();
+    EXPECT_EQ(blocks, Arena::LiveBlocks());
+}
+
+TEST(Test_Arena, large_allocations_use_heap)
+{
+    const auto blocks = Arena::LiveBlocks();
+    auto arena = Arena::Factory();
+    void* pointer{nullptr};
+
+    {
+        Arena::Scope scope(arena.get());
+        pointer = Arena::Allocate(1024 * 1024);
+    }
+
+    EXPECT_EQ(blocks, Arena::LiveBlocks());
+    EXPECT_EQ(0, arena->Reserved());
+
+    Arena::Deallocate(pointer);
+}
+
+TEST(Test_Arena, allocation_outlives_arena)
+{
+    const auto blocks = Arena::LiveBlocks();
+    auto arena = Arena::Factory();
+    char* pointer{nullptr};
+
+    {
+        Arena::Scope scope(arena.get());
+        pointer = static_cast<char*>(Arena::Allocate(16));
+    }
+
+    std::strcpy(pointer, "still valid");
+    arena.reset();
+
+    EXPECT_EQ(blocks + 1, Arena::LiveBlocks());
+    EXPECT_STREQ("still valid", pointer);
+
+    Arena::Deallocate(pointer);
+    EXPECT_EQ(blocks, Arena::LiveBlocks());
+}
+
+TEST(Test_Arena, survivor_pins_only_its_block)
+{
+    const auto blocks = Arena::LiveBlocks();
+    auto arena = Arena::Factory();
+    std::vector<void*> pointers{};
+
+    {
+        Arena::Scope scope(arena.get());
+
+        while (arena->Reserved() < 4 * 16384) {
+            pointers.emplace_back(Arena::Allocate(1000));
+        }
+    }
+
+    EXPECT_EQ(blocks + 4, Arena::LiveBlocks());
+
+    auto* survivor = pointers.front();
+
+    for (auto it = std::next(pointers.begin()); it != pointers.end(); ++it) {
+        Arena::Deallocate(*it);
+    }
+
+    // The arena still holds the block it allocates from
+    EXPECT_EQ(blocks + 2, Arena::LiveBlocks());
+
+    arena.reset();
+    EXPECT_EQ(blocks + 1, Arena::LiveBlocks());
+
+    Arena::Deallocate(survivor);
+    EXPECT_EQ(blocks, Arena::LiveBlocks());
+}
+
+TEST(Test_Arena, heap_while_blocks_live)
+{
+    const auto blocks = Arena::LiveBlocks();
+    auto arena = Arena::Factory();
+    void* pointer{nullptr};
+
+    {
+        Arena::Scope scope(arena.get());
+        pointer = Arena::Allocate(32);
+    }
+
+    EXPECT_EQ(blocks + 1, Arena::LiveBlocks());
+
+    // Heap memory freed while arena blocks exist goes back to the heap
+    for (int i = 0; i < 100; ++i) {
+        Arena::Deallocate(Arena::Allocate(32));
+        Arena::Deallocate(::operator new(32));
+    }
+
+    EXPECT_EQ(blocks + 1, Arena::LiveBlocks());
+
+    Arena::Deallocate(pointer);
+    arena.reset();
+    EXPECT_EQ(blocks, Arena::LiveBlocks());
+}
+
+TEST(Test_Arena, deallocate_on_other_threads)
+{
+    const auto blocks = Arena::LiveBlocks();
+    auto arena = Arena::Factory();
+    std::vector<std::vector<void*>> pointers(4);
+
+    {
+        Arena::Scope scope(arena.get());
+
+        for (int i = 0; i < 4000; ++i) {
+            pointers[i % pointers.size()].emplace_back(Arena::Allocate(48));
+        }
+    }
+
+    arena.reset();
+    EXPECT_LT(blocks, Arena::LiveBlocks());
+
+    std::vector<std::thread> threads{};
+
+    for (auto& list : pointers) {
+        threads.emplace_back([&list]() {
+            for (auto* pointer : list) { Arena::Deallocate(pointer); }
+        });
+    }
+
+    for (auto& thread : threads) { thread.join(); }
+
+    EXPECT_EQ(blocks, Arena::LiveBlocks());
+}
+
+TEST(Test_Arena, scopes_nest)
+{
+    auto outer = Arena::Factory();
+    auto inner = Arena::Factory();
+    std::vector<void*> pointers{};
+
+    {
+        Arena::Scope first(outer.get());
+        pointers.emplace_back(Arena::Allocate(8));
+
+        {
+            Arena::Scope second(inner.get());
+            pointers.emplace_back(Arena::Allocate(8));
+
+            {
+                Arena::Scope disabled(nullptr);
+                pointers.emplace_back(Arena::Allocate(8));
+            }
+        }
+
+        pointers.emplace_back(Arena::Allocate(8));
+    }
+
+    EXPECT_GT(outer->Reserved(), 0);
+    EXPECT_GT(inner->Reserved(), 0);
+
+    for (auto* pointer : pointers) { Arena::Deallocate(pointer); }
+}
+}  // namespace
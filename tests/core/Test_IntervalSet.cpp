@@ -0,0 +1,146 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+#include "opentxs/core/util/IntervalSet.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace opentxs;
+
+namespace
+{
+using Numbers = IntervalSet<std::int64_t>;
+}  // namespace
+
+TEST(IntervalSet, coalesces_consecutive_values)
+{
+    const Numbers numbers(std::set<std::int64_t>{1, 2, 3, 5, 6, 9});
+
+    ASSERT_EQ(numbers.Runs().size(), 3);
+    ASSERT_EQ(numbers.Count(), 6);
+    ASSERT_EQ(numbers.Encode(), "1-3,5-6,9");
+}
+
+TEST(IntervalSet, add_and_remove)
+{
+    Numbers numbers{};
+
+    ASSERT_TRUE(numbers.Add(10, 20));
+    ASSERT_FALSE(numbers.Add(15));
+    ASSERT_TRUE(numbers.Add(21));
+    ASSERT_EQ(numbers.Runs().size(), 1);
+    ASSERT_TRUE(numbers.Remove(15));
+    ASSERT_FALSE(numbers.Remove(15));
+    ASSERT_FALSE(numbers.Contains(15));
+    ASSERT_TRUE(numbers.Contains(14));
+    ASSERT_TRUE(numbers.Contains(16));
+    ASSERT_EQ(numbers.Encode(), "10-14,16-21");
+}
+
+TEST(IntervalSet, union_and_difference)
+{
+    const Numbers lhs(std::set<std::int64_t>{1, 2, 3, 4, 8, 9});
+    const Numbers rhs(std::set<std::int64_t>{3, 4, 5, 6, 9});
+
+    ASSERT_EQ(lhs.Union(rhs).Encode(), "1-6,8-9");
+    ASSERT_EQ(lhs.Difference(rhs).Encode(), "1-2,8");
+    ASSERT_EQ(rhs.Difference(lhs).Encode(), "5-6");
+    ASSERT_TRUE(lhs.Union(rhs).Contains(lhs));
+    ASSERT_FALSE(lhs.Contains(rhs));
+}
+
+TEST(IntervalSet, decode)
+{
+    Numbers numbers{};
+
+    ASSERT_TRUE(Numbers::Decode("1-500, 503,501", numbers));
+    ASSERT_EQ(numbers.Encode(), "1-501,503");
+    ASSERT_EQ(numbers.Count(), 502);
+    ASSERT_FALSE(Numbers::Decode("5-3", numbers));
+    ASSERT_FALSE(Numbers::Decode("1,x", numbers));
+}
+
+TEST(IntervalSet, expand)
+{
+    const std::set<std::int64_t> values{4, 5, 6, 100};
+
+    ASSERT_EQ(Numbers(values).Set(), values);
+}
+
+TEST(IntervalSet, full_range_run)
+{
+    Numbers numbers{};
+    const auto min = std::numeric_limits<std::int64_t>::min();
+    const auto max = std::numeric_limits<std::int64_t>::max();
+
+    ASSERT_TRUE(Numbers::Decode(
+        std::to_string(min) + "-" + std::to_string(max), numbers));
+    ASSERT_EQ(numbers.Runs().size(), 1);
+    ASSERT_EQ(numbers.Count(), std::numeric_limits<std::size_t>::max());
+    ASSERT_TRUE(numbers.Contains(min));
+    ASSERT_TRUE(numbers.Contains(max));
+    ASSERT_FALSE(numbers.Add(0));
+    ASSERT_FALSE(Numbers::Decode(std::to_string(max) + "-0", numbers));
+}
+
+TEST(IntervalSet, decode_unsorted_runs)
+{
+    Numbers numbers{};
+
+    ASSERT_TRUE(Numbers::Decode("20-30,1-5,6,25-40,8", numbers));
+    ASSERT_EQ(numbers.Encode(), "1-6,8,20-40");
+}
+
+TEST(IntervalSet, bulk_add_and_remove)
+{
+    Numbers numbers(std::set<std::int64_t>{1, 2, 3, 10});
+    const Numbers adding(std::set<std::int64_t>{4, 5, 11});
+    const Numbers overlapping(std::set<std::int64_t>{3, 20});
+
+    ASSERT_FALSE(numbers.Intersects(adding));
+    ASSERT_TRUE(numbers.Add(adding));
+    ASSERT_EQ(numbers.Encode(), "1-5,10-11");
+    ASSERT_TRUE(numbers.Intersects(overlapping));
+    ASSERT_FALSE(numbers.Remove(overlapping));
+    ASSERT_EQ(numbers.Encode(), "1-5,10-11");
+    ASSERT_TRUE(numbers.Remove(adding));
+    ASSERT_EQ(numbers.Encode(), "1-3,10");
+    ASSERT_FALSE(numbers.Add(overlapping));
+    ASSERT_EQ(numbers.Encode(), "1-3,10,20");
+}
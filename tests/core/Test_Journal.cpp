@@ -0,0 +1,220 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include "util/Journal.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+class Test_Journal : public ::testing::Test
+{
+public:
+    const std::string path_;
+
+    Test_Journal()
+        : path_(
+              std::string(::testing::TempDir()) + "opentxs-test.journal")
+    {
+        std::remove(path_.c_str());
+        std::remove((path_ + ".tmp").c_str());
+    }
+
+    ~Test_Journal() { std::remove(path_.c_str()); }
+
+    std::string contents() const
+    {
+        std::ifstream file(path_, std::ios::in | std::ios::binary);
+
+        return {std::istreambuf_iterator<char>(file),
+                std::istreambuf_iterator<char>()};
+    }
+
+    void overwrite(const std::string& data) const
+    {
+        std::ofstream file(
+            path_, std::ios::out | std::ios::trunc | std::ios::binary);
+        file << data;
+    }
+};
+
+TEST_F(Test_Journal, missing_file_is_empty)
+{
+    Journal journal(path_, 0);
+    Journal::Records records{"stale"};
+
+    EXPECT_FALSE(journal.Exists());
+    EXPECT_TRUE(journal.Load(records));
+    EXPECT_TRUE(records.empty());
+}
+
+TEST_F(Test_Journal, append_and_load)
+{
+    const std::string binary{"a\tb\nc\0d", 7};
+
+    {
+        Journal journal(path_, 0);
+
+        ASSERT_TRUE(journal.Append("first"));
+        ASSERT_TRUE(journal.Append(""));
+        ASSERT_TRUE(journal.Append(binary));
+        EXPECT_TRUE(journal.Exists());
+    }
+
+    Journal journal(path_, 0);
+    Journal::Records records{};
+
+    ASSERT_TRUE(journal.Load(records));
+    ASSERT_EQ(3, records.size());
+    EXPECT_EQ("first", records.at(0));
+    EXPECT_EQ("", records.at(1));
+    EXPECT_EQ(binary, records.at(2));
+}
+
+TEST_F(Test_Journal, truncated_record_is_dropped)
+{
+    {
+        Journal journal(path_, 0);
+
+        ASSERT_TRUE(journal.Append("first"));
+        ASSERT_TRUE(journal.Append("second"));
+    }
+
+    const auto full = contents();
+    const auto intact = full.size() - (8 + 6);
+
+    for (std::size_t cut = intact; cut < full.size(); ++cut) {
+        overwrite(full.substr(0, cut));
+        Journal journal(path_, 0);
+        Journal::Records records{};
+
+        ASSERT_TRUE(journal.Load(records));
+        ASSERT_EQ(1, records.size());
+        EXPECT_EQ("first", records.at(0));
+        EXPECT_EQ(intact, contents().size());
+    }
+
+    // Records appended after a torn one must be readable
+    Journal journal(path_, 0);
+    Journal::Records records{};
+
+    ASSERT_TRUE(journal.Load(records));
+    ASSERT_TRUE(journal.Append("third"));
+    ASSERT_TRUE(journal.Load(records));
+    ASSERT_EQ(2, records.size());
+    EXPECT_EQ("third", records.at(1));
+}
+
+TEST_F(Test_Journal, corrupt_record_is_dropped)
+{
+    {
+        Journal journal(path_, 0);
+
+        ASSERT_TRUE(journal.Append("first"));
+        ASSERT_TRUE(journal.Append("second"));
+        ASSERT_TRUE(journal.Append("third"));
+    }
+
+    auto data = contents();
+    // Flip one byte of the second payload
+    data[(8 + 5) + 8 + 2] ^= 0x01;
+    overwrite(data);
+    Journal journal(path_, 0);
+    Journal::Records records{};
+
+    ASSERT_TRUE(journal.Load(records));
+    ASSERT_EQ(1, records.size());
+    EXPECT_EQ("first", records.at(0));
+}
+
+TEST_F(Test_Journal, oversized_length_is_dropped)
+{
+    overwrite(std::string("\xff\xff\xff\x7f\0\0\0\0abc", 11));
+    Journal journal(path_, 0);
+    Journal::Records records{};
+
+    ASSERT_TRUE(journal.Load(records));
+    EXPECT_TRUE(records.empty());
+    EXPECT_TRUE(contents().empty());
+}
+
+TEST_F(Test_Journal, rewrite_and_compaction)
+{
+    Journal journal(path_, 2);
+
+    ASSERT_TRUE(journal.Append("a"));
+    ASSERT_TRUE(journal.Append("b"));
+    EXPECT_FALSE(journal.ShouldCompact(0));
+    ASSERT_TRUE(journal.Append("c"));
+    EXPECT_TRUE(journal.ShouldCompact(1));
+    EXPECT_FALSE(journal.ShouldCompact(2));
+    ASSERT_TRUE(journal.Rewrite({"c"}));
+    EXPECT_FALSE(journal.ShouldCompact(0));
+
+    Journal::Records records{};
+
+    ASSERT_TRUE(journal.Load(records));
+    ASSERT_EQ(1, records.size());
+    EXPECT_EQ("c", records.at(0));
+}
+
+TEST(Journal, split)
+{
+    std::vector<std::string> fields{};
+
+    ASSERT_TRUE(Journal::Split("+\tlocal\tremote\ta\tb", 4, fields));
+    ASSERT_EQ(4, fields.size());
+    EXPECT_EQ("+", fields.at(0));
+    EXPECT_EQ("local", fields.at(1));
+    EXPECT_EQ("remote", fields.at(2));
+    EXPECT_EQ("a\tb", fields.at(3));
+    EXPECT_TRUE(Journal::Split("-\tid", 2, fields));
+    EXPECT_FALSE(Journal::Split("-\tid", 3, fields));
+    EXPECT_FALSE(Journal::Split("+", 2, fields));
+}
+}  // namespace
@@ -0,0 +1,142 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include "core/util/LineReader.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+using Lines = std::vector<std::pair<std::string, bool>>;
+
+const std::size_t max_line_{8};
+
+Lines by_sgets(const std::string& input)
+{
+    Lines output{};
+    String string(input);
+    std::vector<char> buffer(max_line_ + 1, '\0');
+    bool more{true};
+
+    while (more) {
+        more = string.sgets(buffer.data(), buffer.size());
+        output.emplace_back(buffer.data(), more);
+    }
+
+    return output;
+}
+
+Lines by_reader(const std::string& input)
+{
+    Lines output{};
+    LineReader reader(input.data(), input.size(), max_line_);
+    LineReader::View line{};
+    bool more{true};
+
+    while (more && reader.Next(line, more)) {
+        output.emplace_back(line.str(), more);
+    }
+
+    return output;
+}
+}  // namespace
+
+TEST(LineReader, matches_sgets)
+{
+    const std::vector<std::string> inputs{
+        "abc\ndef\n",
+        "\n\nabc\n\n",
+        "0123456789abcdefghij\nxy\n",
+        "01234567\nabc\n",
+        "0123456789abcdef",
+        "-----BEGIN\nabc\ndef",
+        "abc\r\ndef\r\n\r\nghi\r\n",
+    };
+
+    for (const auto& input : inputs) {
+        EXPECT_EQ(by_reader(input), by_sgets(input)) << input;
+    }
+}
+
+TEST(LineReader, missing_final_newline)
+{
+    LineReader reader("abc\nde", 6);
+    LineReader::View line{};
+    bool more{true};
+
+    ASSERT_TRUE(reader.Next(line, more));
+    EXPECT_EQ(line.str(), "abc");
+    EXPECT_TRUE(line.Terminated());
+    EXPECT_TRUE(more);
+    ASSERT_TRUE(reader.Next(line, more));
+    EXPECT_EQ(line.str(), "de");
+    EXPECT_FALSE(line.Terminated());
+    EXPECT_FALSE(more);
+    EXPECT_FALSE(reader.Next(line, more));
+}
+
+TEST(LineReader, accumulator_copies_only_when_needed)
+{
+    const std::string input{"ab\ncd\nef"};
+    LineReader reader(input.data(), input.size());
+    LineReader::View line{};
+    LineAccumulator lines{};
+    bool more{true};
+
+    reader.Next(line, more);
+    lines.Add(line);
+    reader.Next(line, more);
+    lines.Add(line);
+
+    EXPECT_EQ(lines.data(), input.data());
+    EXPECT_EQ(std::string(lines.data(), lines.size()), "ab\ncd\n");
+
+    reader.Next(line, more);
+    lines.Add(line);
+
+    EXPECT_NE(lines.data(), input.data());
+    EXPECT_EQ(std::string(lines.data(), lines.size()), "ab\ncd\nef\n");
+}
@@ -0,0 +1,208 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+
+using namespace opentxs;
+
+namespace
+{
+// Longer than the inline buffer on every platform
+const std::string long_value_(100, 'x');
+
+TEST(Test_String, short_values_stay_inline)
+{
+    const auto allocations = String::Allocations();
+    String number("1000");
+    String copy(number);
+    String empty{};
+
+    EXPECT_TRUE(copy.Compare("1000"));
+    EXPECT_NE(number.Get(), copy.Get());
+    EXPECT_FALSE(empty.Exists());
+    EXPECT_EQ(allocations, String::Allocations());
+}
+
+TEST(Test_String, copies_share_long_values)
+{
+    const auto allocations = String::Allocations();
+    String value(long_value_);
+    String copy(value);
+    String assigned{};
+    assigned = value;
+
+    EXPECT_EQ(allocations + 1, String::Allocations());
+    EXPECT_EQ(value.Get(), copy.Get());
+    EXPECT_EQ(value.Get(), assigned.Get());
+}
+
+TEST(Test_String, mutation_detaches_copy)
+{
+    String value(long_value_);
+    String upper(value);
+    String concatenated(value);
+    String zeroed(value);
+    const auto allocations = String::Allocations();
+
+    upper.ConvertToUpperCase();
+    concatenated.Concatenate("%d", 5);
+    zeroed.zeroMemory();
+
+    EXPECT_EQ(allocations + 3, String::Allocations());
+    EXPECT_TRUE(value.Compare(long_value_.c_str()));
+    EXPECT_EQ('X', upper.Get()[0]);
+    EXPECT_EQ(long_value_.size() + 1, concatenated.GetLength());
+    EXPECT_EQ(long_value_.size(), zeroed.GetLength());
+    EXPECT_EQ('\0', zeroed.Get()[0]);
+}
+
+TEST(Test_String, unshared_mutation_does_not_allocate)
+{
+    String value(long_value_);
+    const auto allocations = String::Allocations();
+
+    value.ConvertToUpperCase();
+    value.Truncate(10);
+
+    EXPECT_EQ(allocations, String::Allocations());
+    EXPECT_TRUE(value.Compare(std::string(10, 'X').c_str()));
+}
+
+TEST(Test_String, inline_to_heap)
+{
+    String value("abc");
+    const auto allocations = String::Allocations();
+
+    value.Concatenate(String(long_value_));
+
+    EXPECT_EQ(allocations + 2, String::Allocations());
+    EXPECT_EQ(3 + long_value_.size(), value.GetLength());
+    EXPECT_TRUE(value.Compare(("abc" + long_value_).c_str()));
+}
+
+TEST(Test_String, heap_to_inline)
+{
+    String value(long_value_);
+    const auto allocations = String::Allocations();
+
+    value.Set("abc");
+
+    EXPECT_EQ(allocations, String::Allocations());
+    EXPECT_TRUE(value.Compare("abc"));
+
+    value.Set(long_value_.c_str());
+
+    EXPECT_EQ(allocations + 1, String::Allocations());
+    EXPECT_TRUE(value.Compare(long_value_.c_str()));
+}
+
+TEST(Test_String, concatenate_grows_geometrically)
+{
+    const auto allocations = String::Allocations();
+    String value{};
+
+    for (int i = 0; i < 10000; ++i) { value.Concatenate("%d,", i % 10); }
+
+    EXPECT_EQ(20000, value.GetLength());
+    EXPECT_GT(allocations + 20, String::Allocations());
+}
+
+TEST(Test_String, move_and_swap_do_not_allocate)
+{
+    String heap(long_value_);
+    String small("abc");
+    const auto allocations = String::Allocations();
+
+    heap.swap(small);
+
+    EXPECT_TRUE(heap.Compare("abc"));
+    EXPECT_TRUE(small.Compare(long_value_.c_str()));
+
+    String movedHeap(std::move(small));
+    String movedSmall(std::move(heap));
+
+    EXPECT_EQ(allocations, String::Allocations());
+    EXPECT_TRUE(movedHeap.Compare(long_value_.c_str()));
+    EXPECT_TRUE(movedSmall.Compare("abc"));
+    EXPECT_FALSE(small.Exists());
+    EXPECT_FALSE(heap.Exists());
+}
+
+TEST(Test_String, release)
+{
+    String value(long_value_);
+    String copy(value);
+    String small("abc");
+
+    value.Release();
+    small.Release();
+
+    EXPECT_FALSE(value.Exists());
+    EXPECT_EQ(0, value.GetLength());
+    EXPECT_STREQ("", value.Get());
+    EXPECT_FALSE(small.Exists());
+    EXPECT_EQ(0, small.GetLength());
+    EXPECT_TRUE(copy.Compare(long_value_.c_str()));
+
+    copy.Release();
+
+    EXPECT_FALSE(copy.Exists());
+
+    value.Set("reused");
+
+    EXPECT_TRUE(value.Compare("reused"));
+}
+
+TEST(Test_String, self_reference)
+{
+    String small("abc");
+    String heap(long_value_);
+
+    small.Concatenate(small);
+    heap.Concatenate("%s", heap.Get());
+    small.Format("%s-%s", small.Get(), small.Get());
+
+    EXPECT_TRUE(small.Compare("abcabc-abcabc"));
+    EXPECT_EQ(2 * long_value_.size(), heap.GetLength());
+}
+}  // namespace
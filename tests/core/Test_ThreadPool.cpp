@@ -0,0 +1,104 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "opentxs/opentxs.hpp"
+
+#include "util/ThreadPool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+using namespace opentxs;
+
+namespace
+{
+TEST(ThreadPool, wait_runs_every_task)
+{
+    const ThreadPool pool(4);
+    std::atomic<int> count{0};
+    std::vector<ThreadPool::Task> tasks{};
+
+    for (int i = 0; i < 100; ++i) {
+        tasks.emplace_back([&count]() { ++count; });
+    }
+
+    pool.Wait(tasks);
+
+    EXPECT_EQ(100, count.load());
+}
+
+TEST(ThreadPool, nested_wait_on_a_single_worker)
+{
+    const ThreadPool pool(1);
+    std::atomic<int> count{0};
+    std::vector<ThreadPool::Task> outer{};
+
+    for (int i = 0; i < 4; ++i) {
+        outer.emplace_back([&pool, &count]() {
+            std::vector<ThreadPool::Task> inner{};
+
+            for (int j = 0; j < 4; ++j) {
+                inner.emplace_back([&count]() { ++count; });
+            }
+
+            pool.Wait(inner);
+        });
+    }
+
+    pool.Wait(outer);
+
+    EXPECT_EQ(16, count.load());
+}
+
+TEST(ThreadPool, wait_rethrows_after_every_task_finishes)
+{
+    const ThreadPool pool(2);
+    std::atomic<int> count{0};
+    std::vector<ThreadPool::Task> tasks{};
+    tasks.emplace_back([]() { throw 1; });
+
+    for (int i = 0; i < 10; ++i) {
+        tasks.emplace_back([&count]() { ++count; });
+    }
+
+    EXPECT_THROW(pool.Wait(tasks), int);
+    EXPECT_EQ(10, count.load());
+}
+}  // namespace
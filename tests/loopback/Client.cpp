@@ -0,0 +1,362 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "Loopback.hpp"
+
+#include <atomic>
+#include <thread>
+
+#define FUNDING_AMOUNT 1000000
+#define OFFER_LIFETIME 3600
+#define OFFER_QUANTITY 10
+
+namespace
+{
+using namespace opentxs;
+
+/** Accounts owned by one nym, one per unit definition */
+struct Accounts {
+    OTIdentifier nym_{Identifier::Factory()};
+    OTIdentifier asset_{Identifier::Factory()};
+    OTIdentifier currency_{Identifier::Factory()};
+};
+
+class Workload
+{
+public:
+    bool Run(const std::string& contract);
+
+    Workload(
+        const api::Native& ot,
+        const loopback::Options& options,
+        const std::size_t index,
+        loopback::Recorder& recorder);
+    ~Workload() = default;
+
+private:
+    const api::Native& ot_;
+    const loopback::Options& options_;
+    const std::size_t index_;
+    loopback::Recorder& recorder_;
+    OTIdentifier server_;
+    OTIdentifier asset_unit_;
+    OTIdentifier currency_unit_;
+    Accounts issuer_;
+    std::vector<Accounts> workers_;
+
+    static bool succeeded(const api::client::ServerAction::Action& action);
+
+    bool accept(const Identifier& nym, const Identifier& account) const;
+    bool fund(const Accounts& worker) const;
+    bool issue(
+        const std::string& tla,
+        Identifier& unit,
+        Identifier& account) const;
+    bool load(const std::size_t worker) const;
+    bool register_account(
+        const Identifier& nym,
+        const Identifier& unit,
+        Identifier& account) const;
+    bool register_nym(Accounts& accounts) const;
+    bool setup(const std::size_t worker);
+    bool transfer(
+        const Identifier& nym,
+        const Identifier& from,
+        const Identifier& to,
+        const Amount amount) const;
+
+    Workload() = delete;
+    Workload(const Workload&) = delete;
+    Workload(Workload&&) = delete;
+    Workload& operator=(const Workload&) = delete;
+    Workload& operator=(Workload&&) = delete;
+};
+
+Workload::Workload(
+    const api::Native& ot,
+    const loopback::Options& options,
+    const std::size_t index,
+    loopback::Recorder& recorder)
+    : ot_(ot)
+    , options_(options)
+    , index_(index)
+    , recorder_(recorder)
+    , server_(Identifier::Factory())
+    , asset_unit_(Identifier::Factory())
+    , currency_unit_(Identifier::Factory())
+    , issuer_()
+    , workers_(options.workers_)
+{
+}
+
+bool Workload::accept(const Identifier& nym, const Identifier& account) const
+{
+    return recorder_.Time("processInbox", [&]() -> bool {
+        return ot_.Sync().AcceptIncoming(nym, account, server_);
+    });
+}
+
+bool Workload::fund(const Accounts& worker) const
+{
+    bool output{true};
+    output &=
+        transfer(issuer_.nym_, issuer_.asset_, worker.asset_, FUNDING_AMOUNT);
+    output &= transfer(
+        issuer_.nym_, issuer_.currency_, worker.currency_, FUNDING_AMOUNT);
+
+    return output;
+}
+
+bool Workload::issue(
+    const std::string& tla,
+    Identifier& unit,
+    Identifier& account) const
+{
+    const auto name = "Loopback " + tla + " " + std::to_string(index_);
+    const auto contract = ot_.Wallet().UnitDefinition(
+        issuer_.nym_->str(),
+        name,
+        name,
+        tla,
+        "Loopback test unit",
+        tla,
+        2,
+        "cents");
+
+    if (false == bool(contract)) { return false; }
+
+    unit.SetString(contract->ID()->str());
+
+    return recorder_.Time("issueUnitDefinition", [&]() -> bool {
+        auto action = ot_.ServerAction().IssueUnitDefinition(
+            issuer_.nym_, server_, contract->PublicContract());
+        action->Run();
+
+        if (false == succeeded(action)) { return false; }
+
+        account.SetString(action->Reply()->m_strAcctID);
+
+        return false == account.empty();
+    });
+}
+
+bool Workload::load(const std::size_t index) const
+{
+    const auto& worker = workers_.at(index);
+    const auto& next = workers_.at((index + 1) % workers_.size());
+    bool output{true};
+
+    for (std::size_t i = 0; i < options_.transfers_; ++i) {
+        output &= transfer(worker.nym_, worker.asset_, next.asset_, 1);
+        output &= accept(worker.nym_, worker.asset_);
+    }
+
+    // Alternate buyers and sellers so offers from neighbouring nyms cross
+    const bool selling = (0 == index % 2);
+
+    for (std::size_t i = 0; i < options_.offers_; ++i) {
+        output &= recorder_.Time("marketOffer", [&]() -> bool {
+            auto action = ot_.ServerAction().CreateMarketOffer(
+                worker.asset_,
+                worker.currency_,
+                1,
+                1,
+                OFFER_QUANTITY,
+                1 + i,
+                selling,
+                std::chrono::seconds(OFFER_LIFETIME),
+                "",
+                0);
+            action->Run();
+
+            return succeeded(action);
+        });
+    }
+
+    return output;
+}
+
+bool Workload::register_account(
+    const Identifier& nym,
+    const Identifier& unit,
+    Identifier& account) const
+{
+    return recorder_.Time("registerAccount", [&]() -> bool {
+        auto action = ot_.ServerAction().RegisterAccount(nym, server_, unit);
+        action->Run();
+
+        if (false == succeeded(action)) { return false; }
+
+        account.SetString(action->Reply()->m_strAcctID);
+
+        return false == account.empty();
+    });
+}
+
+bool Workload::register_nym(Accounts& accounts) const
+{
+    const auto nym = ot_.Wallet().Nym(NymParameters(proto::CREDTYPE_LEGACY));
+
+    if (false == bool(nym)) { return false; }
+
+    accounts.nym_ = Identifier::Factory(nym->ID());
+
+    return recorder_.Time("registerNym", [&]() -> bool {
+        auto action = ot_.ServerAction().RegisterNym(accounts.nym_, server_);
+        action->Run();
+
+        return succeeded(action);
+    });
+}
+
+bool Workload::Run(const std::string& contract)
+{
+    const auto server = ot_.Wallet().Server(
+        proto::DataToProto<proto::ServerContract>(
+            Data::Factory(contract.data(), contract.size())));
+
+    if (false == bool(server)) { return false; }
+
+    server_ = server->ID();
+
+    if (false == register_nym(issuer_)) { return false; }
+
+    if (false == issue("LPA", asset_unit_, issuer_.asset_)) { return false; }
+
+    if (false == issue("LPB", currency_unit_, issuer_.currency_)) {
+        return false;
+    }
+
+    std::atomic<bool> output{true};
+    std::vector<std::thread> threads{};
+
+    for (std::size_t i = 0; i < workers_.size(); ++i) {
+        threads.emplace_back([&, i]() -> void {
+            auto& worker = workers_.at(i);
+            bool ready = register_nym(worker);
+            ready = ready &&
+                    register_account(worker.nym_, asset_unit_, worker.asset_);
+            ready = ready && register_account(
+                                 worker.nym_,
+                                 currency_unit_,
+                                 worker.currency_);
+
+            if (false == ready) { output = false; }
+        });
+    }
+
+    for (auto& thread : threads) { thread.join(); }
+
+    threads.clear();
+
+    if (false == output) { return false; }
+
+    for (const auto& worker : workers_) {
+        if (false == fund(worker)) { return false; }
+    }
+
+    for (std::size_t i = 0; i < workers_.size(); ++i) {
+        threads.emplace_back([&, i]() -> void {
+            const auto& worker = workers_.at(i);
+            bool ready = accept(worker.nym_, worker.asset_);
+            ready &= accept(worker.nym_, worker.currency_);
+
+            if (false == ready) { output = false; }
+        });
+    }
+
+    for (auto& thread : threads) { thread.join(); }
+
+    threads.clear();
+
+    if (false == output) { return false; }
+
+    for (std::size_t i = 0; i < workers_.size(); ++i) {
+        threads.emplace_back([&, i]() -> void {
+            if (false == load(i)) { output = false; }
+        });
+    }
+
+    for (auto& thread : threads) { thread.join(); }
+
+    return output;
+}
+
+bool Workload::succeeded(const api::client::ServerAction::Action& action)
+{
+    if (SendResult::VALID_REPLY != action->LastSendResult()) { return false; }
+
+    const auto& reply = action->Reply();
+
+    return bool(reply) && reply->m_bSuccess;
+}
+
+bool Workload::transfer(
+    const Identifier& nym,
+    const Identifier& from,
+    const Identifier& to,
+    const Amount amount) const
+{
+    return recorder_.Time("transfer", [&]() -> bool {
+        auto action = ot_.ServerAction().SendTransfer(
+            nym, server_, from, to, amount, "loopback");
+        action->Run();
+
+        return succeeded(action);
+    });
+}
+}  // namespace
+
+namespace opentxs::loopback
+{
+bool RunClient(
+    const Options& options,
+    const std::size_t index,
+    const std::string& home,
+    const std::string& contract)
+{
+    ::setenv("HOME", home.c_str(), 1);
+    OT::ClientFactory({});
+    Recorder recorder{};
+    bool output = Workload(OT::App(), options, index, recorder).Run(contract);
+    output &= recorder.Save(home + "/samples");
+    OT::Cleanup();
+
+    return output;
+}
+}  // namespace opentxs::loopback
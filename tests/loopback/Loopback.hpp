@@ -0,0 +1,166 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_TESTS_LOOPBACK_LOOPBACK_HPP
+#define OPENTXS_TESTS_LOOPBACK_LOOPBACK_HPP
+
+#include "opentxs/opentxs.hpp"
+
+extern "C" {
+#include <sys/types.h>
+}
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace opentxs::loopback
+{
+struct Options {
+    /// Number of client processes
+    std::size_t clients_{1};
+    /// Number of concurrent nyms in each client process
+    std::size_t workers_{4};
+    /// Transfers sent by each nym during the load phase
+    std::size_t transfers_{25};
+    /// Market offers placed by each nym during the load phase
+    std::size_t offers_{5};
+    std::uint32_t port_{17085};
+    /// Parent of the notary and client home directories
+    std::string directory_{};
+};
+
+/** One request timed by a client */
+struct Sample {
+    std::string operation_{};
+    /// Steady clock time in nanoseconds, comparable between processes
+    std::int64_t start_{0};
+    std::int64_t duration_{0};
+    bool success_{false};
+};
+
+/** Collects samples from all threads of a client process */
+class Recorder
+{
+public:
+    template <typename Function>
+    bool Time(const std::string& operation, Function function)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const bool success = function();
+        const auto finish = std::chrono::steady_clock::now();
+        add(operation, start, finish, success);
+
+        return success;
+    }
+
+    /** Writes one line per sample: operation start duration success */
+    bool Save(const std::string& path) const;
+
+    Recorder() = default;
+    ~Recorder() = default;
+
+private:
+    mutable std::mutex lock_{};
+    std::vector<Sample> samples_{};
+
+    void add(
+        const std::string& operation,
+        const std::chrono::steady_clock::time_point start,
+        const std::chrono::steady_clock::time_point finish,
+        const bool success);
+
+    Recorder(const Recorder&) = delete;
+    Recorder(Recorder&&) = delete;
+    Recorder& operator=(const Recorder&) = delete;
+    Recorder& operator=(Recorder&&) = delete;
+};
+
+/** A notary running in a child process
+ *
+ *  OT::App() can only be started once per process, so the notary and each
+ *  client get their own process and their own HOME directory. The notary
+ *  listens on the loopback interface only.
+ */
+class Notary
+{
+public:
+    /** Serialized server contract, empty until Start() succeeds */
+    const std::string& Contract() const { return contract_; }
+
+    /** Returns once the notary is accepting requests */
+    bool Start();
+    void Stop();
+
+    Notary(const std::string& home, const std::uint32_t port);
+    ~Notary();
+
+private:
+    const std::string home_;
+    const std::uint32_t port_;
+    pid_t pid_{-1};
+    int control_{-1};
+    std::string contract_{};
+
+    void run(const int contract, const int control) const;
+
+    Notary() = delete;
+    Notary(const Notary&) = delete;
+    Notary(Notary&&) = delete;
+    Notary& operator=(const Notary&) = delete;
+    Notary& operator=(Notary&&) = delete;
+};
+
+/** Runs the scripted workload for one client process
+ *
+ *  Must be called in a freshly forked child. Samples are saved to
+ *  home/samples.
+ */
+bool RunClient(
+    const Options& options,
+    const std::size_t index,
+    const std::string& home,
+    const std::string& contract);
+
+/** Latency percentiles and throughput per operation for saved samples */
+std::string Report(const std::vector<std::string>& files);
+}  // namespace opentxs::loopback
+#endif  // OPENTXS_TESTS_LOOPBACK_LOOPBACK_HPP
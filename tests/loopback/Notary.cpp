@@ -0,0 +1,183 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "Loopback.hpp"
+
+extern "C" {
+#include <sys/wait.h>
+#include <unistd.h>
+}
+
+#include <cerrno>
+#include <cstdlib>
+
+namespace
+{
+std::string read_all(const int fd)
+{
+    std::string output{};
+    char buffer[4096]{};
+
+    while (true) {
+        const auto bytes = ::read(fd, buffer, sizeof(buffer));
+
+        if (0 < bytes) {
+            output.append(buffer, bytes);
+        } else if ((0 > bytes) && (EINTR == errno)) {
+            continue;
+        } else {
+            break;
+        }
+    }
+
+    return output;
+}
+
+bool write_all(const int fd, const std::string& data)
+{
+    std::size_t written{0};
+
+    while (written < data.size()) {
+        const auto bytes =
+            ::write(fd, data.data() + written, data.size() - written);
+
+        if (0 < bytes) {
+            written += bytes;
+        } else if ((0 > bytes) && (EINTR == errno)) {
+            continue;
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
+}  // namespace
+
+namespace opentxs::loopback
+{
+Notary::Notary(const std::string& home, const std::uint32_t port)
+    : home_(home)
+    , port_(port)
+    , pid_(-1)
+    , control_(-1)
+    , contract_()
+{
+}
+
+void Notary::run(const int contract, const int control) const
+{
+    ::setenv("HOME", home_.c_str(), 1);
+    const auto port = std::to_string(port_);
+    OT::ServerFactory({{OPENTXS_ARG_BINDIP, {"127.0.0.1"}},
+                       {OPENTXS_ARG_COMMANDPORT, {port}},
+                       {OPENTXS_ARG_EXTERNALIP, {"127.0.0.1"}},
+                       {OPENTXS_ARG_LISTENCOMMAND, {port}},
+                       {OPENTXS_ARG_NAME, {"loopback"}},
+                       {OPENTXS_ARG_TERMS, {"Loopback test notary"}}});
+    const auto& ot = OT::App();
+    const auto server = ot.Wallet().Server(ot.Server().ID());
+    std::string serialized{};
+
+    if (server) { serialized = proto::ProtoAsString(server->PublicContract()); }
+
+    write_all(contract, serialized);
+    ::close(contract);
+
+    // Serve requests until the parent closes its end of the control pipe
+    read_all(control);
+    ::close(control);
+    OT::Cleanup();
+    ::_exit(serialized.empty() ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+bool Notary::Start()
+{
+    int contract[2]{-1, -1};
+    int control[2]{-1, -1};
+
+    if (0 != ::pipe(contract)) { return false; }
+
+    if (0 != ::pipe(control)) {
+        ::close(contract[0]);
+        ::close(contract[1]);
+
+        return false;
+    }
+
+    pid_ = ::fork();
+
+    if (0 == pid_) {
+        ::close(contract[0]);
+        ::close(control[1]);
+        run(contract[1], control[0]);
+    }
+
+    ::close(contract[1]);
+    ::close(control[0]);
+
+    if (0 > pid_) {
+        ::close(contract[0]);
+        ::close(control[1]);
+
+        return false;
+    }
+
+    control_ = control[1];
+    contract_ = read_all(contract[0]);
+    ::close(contract[0]);
+
+    return false == contract_.empty();
+}
+
+void Notary::Stop()
+{
+    if (-1 != control_) {
+        ::close(control_);
+        control_ = -1;
+    }
+
+    if (0 < pid_) {
+        int status{0};
+        ::waitpid(pid_, &status, 0);
+        pid_ = -1;
+    }
+}
+
+Notary::~Notary() { Stop(); }
+}  // namespace opentxs::loopback
@@ -0,0 +1,175 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "Loopback.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <set>
+#include <sstream>
+
+namespace
+{
+/** Operations which are notarized transactions rather than messages */
+const std::set<std::string> transactions_{"marketOffer",
+                                          "processInbox",
+                                          "transfer"};
+
+double milliseconds(const std::int64_t nanoseconds)
+{
+    return static_cast<double>(nanoseconds) / 1000000.0;
+}
+
+/** Nearest rank percentile of sorted durations */
+std::int64_t percentile(
+    const std::vector<std::int64_t>& sorted,
+    const std::size_t rank)
+{
+    if (sorted.empty()) { return 0; }
+
+    const auto index = (sorted.size() * rank + 99) / 100;
+
+    return sorted.at(std::max<std::size_t>(index, 1) - 1);
+}
+}  // namespace
+
+namespace opentxs::loopback
+{
+void Recorder::add(
+    const std::string& operation,
+    const std::chrono::steady_clock::time_point start,
+    const std::chrono::steady_clock::time_point finish,
+    const bool success)
+{
+    Sample sample{};
+    sample.operation_ = operation;
+    sample.start_ = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        start.time_since_epoch())
+                        .count();
+    sample.duration_ =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start)
+            .count();
+    sample.success_ = success;
+    Lock lock(lock_);
+    samples_.emplace_back(std::move(sample));
+}
+
+bool Recorder::Save(const std::string& path) const
+{
+    Lock lock(lock_);
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+
+    for (const auto& sample : samples_) {
+        file << sample.operation_ << " " << sample.start_ << " "
+             << sample.duration_ << " " << sample.success_ << "\n";
+    }
+
+    return file.good();
+}
+
+std::string Report(const std::vector<std::string>& files)
+{
+    struct Totals {
+        std::vector<std::int64_t> durations_{};
+        std::size_t failed_{0};
+        std::int64_t first_{std::numeric_limits<std::int64_t>::max()};
+        std::int64_t last_{std::numeric_limits<std::int64_t>::min()};
+
+        void Add(const Sample& sample)
+        {
+            durations_.push_back(sample.duration_);
+
+            if (false == sample.success_) { ++failed_; }
+
+            first_ = std::min(first_, sample.start_);
+            last_ = std::max(last_, sample.start_ + sample.duration_);
+        }
+    };
+
+    std::map<std::string, Totals> operations{};
+    Totals transactions{};
+
+    for (const auto& path : files) {
+        std::ifstream file(path);
+        Sample sample{};
+
+        while (file >> sample.operation_ >> sample.start_ >>
+               sample.duration_ >> sample.success_) {
+            operations[sample.operation_].Add(sample);
+
+            if (1 == transactions_.count(sample.operation_)) {
+                transactions.Add(sample);
+            }
+        }
+    }
+
+    operations["(transactions)"] = std::move(transactions);
+    std::stringstream output{};
+    output << std::left << std::setw(20) << "operation" << std::right
+           << std::setw(8) << "count" << std::setw(8) << "failed"
+           << std::setw(12) << "per sec" << std::setw(10) << "p50 ms"
+           << std::setw(10) << "p90 ms" << std::setw(10) << "p99 ms"
+           << std::setw(10) << "max ms"
+           << "\n";
+    output << std::fixed << std::setprecision(2);
+
+    for (auto& [name, totals] : operations) {
+        auto& durations = totals.durations_;
+
+        if (durations.empty()) { continue; }
+
+        std::sort(durations.begin(), durations.end());
+        const auto succeeded = durations.size() - totals.failed_;
+        const auto elapsed = milliseconds(totals.last_ - totals.first_);
+        const double rate =
+            (0 < elapsed) ? (1000.0 * succeeded / elapsed) : 0.0;
+        output << std::left << std::setw(20) << name << std::right
+               << std::setw(8) << durations.size() << std::setw(8)
+               << totals.failed_ << std::setw(12) << rate << std::setw(10)
+               << milliseconds(percentile(durations, 50)) << std::setw(10)
+               << milliseconds(percentile(durations, 90)) << std::setw(10)
+               << milliseconds(percentile(durations, 99)) << std::setw(10)
+               << milliseconds(durations.back()) << "\n";
+    }
+
+    return output.str();
+}
+}  // namespace opentxs::loopback
@@ -0,0 +1,176 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "Loopback.hpp"
+
+extern "C" {
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+}
+
+#include <cerrno>
+#include <cstdlib>
+#include <iostream>
+
+using namespace opentxs;
+
+namespace
+{
+const char* usage_{
+    "Usage: opentxs-loopback [--clients=N] [--workers=N] [--transfers=N]\n"
+    "                        [--offers=N] [--port=N] [--directory=PATH]\n\n"
+    "Starts a notary and N client processes on the loopback interface,\n"
+    "runs a scripted workload (registerNym, issue, registerAccount,\n"
+    "transfer, processInbox, market offers) and prints latency\n"
+    "percentiles and throughput for each request type.\n"};
+
+bool parse(const int argc, char* argv[], loopback::Options& options)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+        const auto equals = arg.find('=');
+
+        if (std::string::npos == equals) { return false; }
+
+        const auto name = arg.substr(0, equals);
+        const auto value = arg.substr(equals + 1);
+
+        try {
+            if ("--clients" == name) {
+                options.clients_ = std::stoul(value);
+            } else if ("--workers" == name) {
+                options.workers_ = std::stoul(value);
+            } else if ("--transfers" == name) {
+                options.transfers_ = std::stoul(value);
+            } else if ("--offers" == name) {
+                options.offers_ = std::stoul(value);
+            } else if ("--port" == name) {
+                options.port_ = std::stoul(value);
+            } else if ("--directory" == name) {
+                options.directory_ = value;
+            } else {
+                return false;
+            }
+        } catch (...) {
+            return false;
+        }
+    }
+
+    // Each nym transfers to its neighbour so at least two are needed
+    return (0 < options.clients_) && (1 < options.workers_);
+}
+
+bool make_directory(const std::string& path)
+{
+    return (0 == ::mkdir(path.c_str(), 0700)) || (EEXIST == errno);
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    loopback::Options options{};
+
+    if (false == parse(argc, argv, options)) {
+        std::cerr << usage_;
+
+        return EXIT_FAILURE;
+    }
+
+    if (options.directory_.empty()) {
+        char pattern[] = "/tmp/opentxs-loopback-XXXXXX";
+
+        if (nullptr == ::mkdtemp(pattern)) { return EXIT_FAILURE; }
+
+        options.directory_ = pattern;
+    } else if (false == make_directory(options.directory_)) {
+        return EXIT_FAILURE;
+    }
+
+    const auto notaryHome = options.directory_ + "/notary";
+
+    if (false == make_directory(notaryHome)) { return EXIT_FAILURE; }
+
+    loopback::Notary notary(notaryHome, options.port_);
+
+    if (false == notary.Start()) {
+        std::cerr << "Failed to start notary" << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    std::vector<pid_t> clients{};
+    std::vector<std::string> samples{};
+
+    for (std::size_t i = 0; i < options.clients_; ++i) {
+        const auto home = options.directory_ + "/client" + std::to_string(i);
+
+        if (false == make_directory(home)) { break; }
+
+        samples.emplace_back(home + "/samples");
+        const auto pid = ::fork();
+
+        if (0 == pid) {
+            const bool success =
+                loopback::RunClient(options, i, home, notary.Contract());
+            ::_exit(success ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+
+        if (0 < pid) { clients.push_back(pid); }
+    }
+
+    bool success = (clients.size() == options.clients_);
+
+    for (const auto pid : clients) {
+        int status{0};
+        ::waitpid(pid, &status, 0);
+        success &= WIFEXITED(status) && (EXIT_SUCCESS == WEXITSTATUS(status));
+    }
+
+    notary.Stop();
+    std::cout << loopback::Report(samples);
+    std::cout << "Data directories: " << options.directory_ << std::endl;
+
+    if (false == success) {
+        std::cerr << "One or more clients failed" << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,125 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+#include "opentxs/opentxs.hpp"
+
+#include <gtest/gtest.h>
+
+#include <future>
+
+using namespace opentxs;
+
+namespace
+{
+class Test_Metrics : public ::testing::Test
+{
+public:
+    const std::string testMessage_{"zeromq metrics test message"};
+    const std::string endpoint_{"inproc://opentxs/text/metrics_test"};
+};
+}  // namespace
+
+TEST_F(Test_Metrics, Request_Reply)
+{
+    auto context = network::zeromq::Context::Factory();
+    auto replyCallback = network::zeromq::ReplyCallback::Factory(
+        [](const network::zeromq::Message& input) -> OTZMQMessage {
+            auto reply = network::zeromq::Message::ReplyFactory(input);
+            reply->AddFrame(std::string(*input.Body().begin()));
+
+            return reply;
+        });
+    auto replySocket = context->ReplySocket(replyCallback);
+    replySocket->SetTimeouts(
+        std::chrono::milliseconds(0),
+        std::chrono::milliseconds(30000),
+        std::chrono::milliseconds(-1));
+
+    ASSERT_TRUE(replySocket->Start(endpoint_));
+
+    {
+        auto requestSocket = context->RequestSocket();
+        requestSocket->SetTimeouts(
+            std::chrono::milliseconds(0),
+            std::chrono::milliseconds(-1),
+            std::chrono::milliseconds(30000));
+
+        ASSERT_TRUE(requestSocket->Start(endpoint_));
+
+        auto [result, message] = requestSocket->SendRequest(testMessage_);
+
+        ASSERT_EQ(result, SendResult::VALID_REPLY);
+    }
+
+    const auto metrics = context->DumpMetrics();
+
+    EXPECT_NE(std::string::npos, metrics.find("reply messages_in=1 "));
+    EXPECT_NE(std::string::npos, metrics.find(" messages_out=1 "));
+    EXPECT_NE(
+        std::string::npos,
+        metrics.find("retired request messages_in=1 "));
+}
+
+TEST_F(Test_Metrics, PublishMetrics)
+{
+    auto context = network::zeromq::Context::Factory();
+    std::promise<std::string> promise{};
+    auto future = promise.get_future();
+    auto callback = network::zeromq::ListenCallback::Factory(
+        [&promise](const network::zeromq::Message& input) -> void {
+            try {
+                promise.set_value(std::string(*input.Body().begin()));
+            } catch (...) {
+            }
+        });
+    auto subscribeSocket = context->SubscribeSocket(callback);
+
+    // Bind the publisher first so the subscriber has somewhere to connect
+    ASSERT_TRUE(context->PublishMetrics());
+    ASSERT_TRUE(subscribeSocket->Start(
+        network::zeromq::Socket::MetricsEndpoint));
+
+    while (std::future_status::ready !=
+           future.wait_for(std::chrono::milliseconds(100))) {
+        ASSERT_TRUE(context->PublishMetrics());
+    }
+
+    const auto metrics = future.get();
+
+    EXPECT_NE(std::string::npos, metrics.find("publish "));
+    EXPECT_NE(std::string::npos, metrics.find("subscribe "));
+}